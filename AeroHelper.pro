@@ -4,7 +4,7 @@
 #
 #-------------------------------------------------
 
-QT += core gui
+QT += core gui concurrent network
 CONFIG += c++17
 
 greaterThan(QT_MAJOR_VERSION, 4): QT += widgets
@@ -24,6 +24,17 @@ DEFINES += QT_DEPRECATED_WARNINGS
 # You can also select to disable deprecated APIs only up to a certain version of Qt.
 #DEFINES += QT_DISABLE_DEPRECATED_BEFORE=0x060000    # disables all the APIs deprecated before Qt 6.0.0
 
+# Embeds the version at compile time, taken from the VERSION file if there is one and the build date
+# otherwise, so that it doesn't have to be read from disk on every launch
+exists ($$PWD/VERSION): AEROHELPER_VERSION = $$cat($$PWD/VERSION)
+isEmpty (AEROHELPER_VERSION): AEROHELPER_VERSION = $$system(date +%Y.%m.%d)
+DEFINES += AEROHELPER_VERSION=\\\"$$AEROHELPER_VERSION\\\"
+
+# Compiles in the scoped profiling instrumentation (see Root/Profiler.h). It is disabled at runtime
+# until the HUD is shown or profiling is enabled from the View menu. Build with CONFIG+=no_profiling
+# to remove it entirely.
+!CONFIG(no_profiling): DEFINES += AEROHELPER_PROFILING
+
 
 !include (Files.pri) {
     message ("Error including header files")
@@ -0,0 +1,161 @@
+#include <atomic>
+#include <cstring>
+#include <new>
+
+#include <QByteArray>
+#include <QCoreApplication>
+#include <QHash>
+#include <QSharedMemory>
+#include <QString>
+#include <QTextStream>
+#include <QTimer>
+
+#include "VertexEditor/Utilities/LivePreviewLayout.h"
+
+using Aerodlyn::LivePreviewHeader;
+
+/**
+ * A consistent copy of the segment, taken between two matching reads of the sequence.
+ */
+struct Snapshot
+{
+    quint32    flags    = 0;
+    quint32    count    = 0;
+    quint64    revision = 0;
+
+    QByteArray data;
+};
+
+/**
+ * Copies the header fields and the data sets out of the given segment, retrying while the editor
+ *  is writing to it.
+ *
+ * @param memory   - The attached segment
+ * @param snapshot - The snapshot to copy into
+ *
+ * @return True if the segment has been initialized by the editor, false otherwise
+ */
+static bool read (QSharedMemory &memory, Snapshot &snapshot)
+{
+    const char *base = static_cast <const char *> (memory.constData ());
+    const LivePreviewHeader *header = std::launder (reinterpret_cast <const LivePreviewHeader *> (base));
+
+    if (header->magic != LivePreviewHeader::MAGIC || header->version != LivePreviewHeader::VERSION)
+        return false;
+
+    const quint32 available = static_cast <quint32> (memory.size ()) - sizeof (LivePreviewHeader);
+
+    quint32 begin;
+    do
+    {
+        begin = header->sequence.load (std::memory_order_acquire);
+        if ((begin & 1) != 0)
+            continue;
+
+        snapshot.flags    = header->flags;
+        snapshot.count    = header->count;
+        snapshot.revision = header->revision;
+        snapshot.data     = QByteArray (base + sizeof (LivePreviewHeader), static_cast <int> (qMin (header->size, available)));
+
+        std::atomic_thread_fence (std::memory_order_acquire);
+    }
+    while ((begin & 1) != 0 || header->sequence.load (std::memory_order_relaxed) != begin);
+
+    return true;
+}
+
+/**
+ * Prints the data sets of the given snapshot whose regions differ from the ones last printed.
+ *
+ * @param snapshot - The snapshot to print
+ * @param regions  - The regions last printed, by name, which are updated
+ */
+static void print (const Snapshot &snapshot, QHash <QString, QByteArray> &regions)
+{
+    QTextStream out (stdout);
+    out << "Revision " << snapshot.revision << ", " << snapshot.count << " data sets\n";
+    if ((snapshot.flags & LivePreviewHeader::OVERFLOWED) != 0)
+        out << "  The data sets no longer fit into the segment, these are the last ones that did\n";
+
+    QHash <QString, QByteArray> current;
+
+    int offset = 0;
+    for (quint32 i = 0; i < snapshot.count && offset < snapshot.data.size (); i++)
+    {
+        quint16 nameSize;
+        std::memcpy (&nameSize, snapshot.data.constData () + offset, sizeof (nameSize));
+        offset += sizeof (nameSize);
+
+        const QString name = QString::fromUtf8 (snapshot.data.constData () + offset, nameSize);
+        offset += nameSize;
+
+        quint32 vertices;
+        std::memcpy (&vertices, snapshot.data.constData () + offset, sizeof (vertices));
+        offset += sizeof (vertices);
+
+        const QByteArray region = snapshot.data.mid (offset, static_cast <int> (vertices * 2 * sizeof (float)));
+        offset += region.size ();
+
+        if (!regions.contains (name) || regions.value (name) != region)
+        {
+            out << "  " << name << ": " << vertices << " vertices";
+            for (quint32 v = 0; v < vertices && v < 4; v++)
+            {
+                float point [2];
+                std::memcpy (point, region.constData () + v * sizeof (point), sizeof (point));
+                out << (v == 0 ? " " : ", ") << "(" << point [0] << ", " << point [1] << ")";
+            }
+
+            out << (vertices > 4 ? ", ...\n" : "\n");
+        }
+
+        current.insert (name, region);
+    }
+
+    regions = current;
+}
+
+int main (int argc, char *argv [])
+{
+    QCoreApplication application (argc, argv);
+
+    QSharedMemory memory;
+    memory.setNativeKey (argc > 1 ? QString::fromLocal8Bit (argv [1]) : LivePreviewHeader::defaultKey ());
+
+    Snapshot snapshot;
+    QHash <QString, QByteArray> regions;
+    quint64 lastRevision = 0;
+
+    // Polled once per frame, as a game would from its update loop
+    QTimer timer;
+    QObject::connect (&timer, &QTimer::timeout, [&]
+    {
+        if (!memory.isAttached () && !memory.attach (QSharedMemory::ReadOnly))
+            return;
+
+        if (!read (memory, snapshot))
+            return;
+
+        if ((snapshot.flags & LivePreviewHeader::CLOSED) != 0)
+        {
+            QTextStream (stdout) << "The editor stopped publishing\n";
+            memory.detach ();
+
+            lastRevision = 0;
+            regions.clear ();
+
+            return;
+        }
+
+        if (snapshot.revision != lastRevision)
+        {
+            lastRevision = snapshot.revision;
+            print (snapshot, regions);
+        }
+    });
+
+    QTextStream (stdout) << "Waiting for the live preview on '" << memory.nativeKey () << "'\n";
+    timer.start (16);
+
+    return application.exec ();
+}
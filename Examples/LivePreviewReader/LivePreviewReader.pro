@@ -0,0 +1,15 @@
+QT += core
+QT -= gui
+CONFIG += c++17
+
+CONFIG += console warn_on
+CONFIG -= app_bundle
+
+TEMPLATE = app
+
+# Reads the live preview that AeroHelper publishes from View > Publish Live Preview, printing the
+# data sets whose regions change. Shows how a game can read the feed without locking (see
+# VertexEditor/Utilities/LivePreviewLayout.h).
+INCLUDEPATH += ../..
+HEADERS += ../../VertexEditor/Utilities/LivePreviewLayout.h
+SOURCES += LivePreviewReader.cpp
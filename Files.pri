@@ -1,15 +1,69 @@
-HEADERS += $$PWD/Root/Utils.h \
+HEADERS += $$PWD/Root/Profiler.h \
+    $$PWD/Root/StartupTrace.h \
+    $$PWD/Root/Utils.h \
+    $$PWD/VertexEditor/DataSetListModel.h \
+    $$PWD/VertexEditor/FrameComposer.h \
+    $$PWD/VertexEditor/FrameScheduler.h \
+    $$PWD/VertexEditor/InputRecorder.h \
+    $$PWD/VertexEditor/InputReplayer.h \
+    $$PWD/VertexEditor/LivePreviewFeed.h \
+    $$PWD/VertexEditor/QueryServer.h \
     $$PWD/VertexEditor/VertexEditorImage.h \
     $$PWD/VertexEditor/VertexEditorWindow.h \
     $$PWD/VertexEditor/VertexEditorTable.h \
     $$PWD/VertexEditor/VertexEditorRenderedImage.h \
     $$PWD/VertexEditor/Utilities/VertexDataSet.h \
-    $$PWD/VertexEditor/Utilities/VertexDataSetCollection.h
+    $$PWD/VertexEditor/Utilities/VertexDataSetCollection.h \
+    $$PWD/VertexEditor/Utilities/BoundingVolumes.h \
+    $$PWD/VertexEditor/Utilities/DataSetNameIndex.h \
+    $$PWD/VertexEditor/Utilities/DataSetRTree.h \
+    $$PWD/VertexEditor/Utilities/DistanceField.h \
+    $$PWD/VertexEditor/Utilities/HeaderExporter.h \
+    $$PWD/VertexEditor/Utilities/LivePreviewLayout.h \
+    $$PWD/VertexEditor/Utilities/OverlapDetector.h \
+    $$PWD/VertexEditor/Utilities/ProjectFile.h \
+    $$PWD/VertexEditor/Utilities/RegionCleaner.h \
+    $$PWD/VertexEditor/Utilities/RegionClipper.h \
+    $$PWD/VertexEditor/Utilities/RegionGeometry.h \
+    $$PWD/VertexEditor/Utilities/RegionImporter.h \
+    $$PWD/VertexEditor/Utilities/RegionRasterizer.h \
+    $$PWD/VertexEditor/Utilities/RegionSlabIndex.h \
+    $$PWD/VertexEditor/Utilities/RegionSpatialIndex.h \
+    $$PWD/VertexEditor/Utilities/SpriteSheet.h \
+    $$PWD/VertexEditor/Utilities/TripleBuffer.h \
+    $$PWD/VertexEditor/Utilities/VertexAttributes.h \
+    $$PWD/VertexEditor/Utilities/VertexTransform.h
 
 SOURCES += $$PWD/Root/Main.cpp \
+    $$PWD/Root/Profiler.cpp \
+    $$PWD/Root/StartupTrace.cpp \
     $$PWD/Root/Utils.cpp \
+    $$PWD/VertexEditor/DataSetListModel.cpp \
+    $$PWD/VertexEditor/FrameComposer.cpp \
+    $$PWD/VertexEditor/FrameScheduler.cpp \
+    $$PWD/VertexEditor/InputRecorder.cpp \
+    $$PWD/VertexEditor/InputReplayer.cpp \
+    $$PWD/VertexEditor/LivePreviewFeed.cpp \
+    $$PWD/VertexEditor/QueryServer.cpp \
     $$PWD/VertexEditor/VertexEditorImage.cpp \
     $$PWD/VertexEditor/VertexEditorWindow.cpp \
     $$PWD/VertexEditor/VertexEditorTable.cpp \
     $$PWD/VertexEditor/VertexEditorRenderedImage.cpp \
-    $$PWD/VertexEditor/Utilities/VertexDataSetCollection.cpp
+    $$PWD/VertexEditor/Utilities/VertexDataSetCollection.cpp \
+    $$PWD/VertexEditor/Utilities/BoundingVolumes.cpp \
+    $$PWD/VertexEditor/Utilities/DataSetNameIndex.cpp \
+    $$PWD/VertexEditor/Utilities/DataSetRTree.cpp \
+    $$PWD/VertexEditor/Utilities/DistanceField.cpp \
+    $$PWD/VertexEditor/Utilities/HeaderExporter.cpp \
+    $$PWD/VertexEditor/Utilities/OverlapDetector.cpp \
+    $$PWD/VertexEditor/Utilities/ProjectFile.cpp \
+    $$PWD/VertexEditor/Utilities/RegionCleaner.cpp \
+    $$PWD/VertexEditor/Utilities/RegionClipper.cpp \
+    $$PWD/VertexEditor/Utilities/RegionGeometry.cpp \
+    $$PWD/VertexEditor/Utilities/RegionImporter.cpp \
+    $$PWD/VertexEditor/Utilities/RegionRasterizer.cpp \
+    $$PWD/VertexEditor/Utilities/RegionSlabIndex.cpp \
+    $$PWD/VertexEditor/Utilities/RegionSpatialIndex.cpp \
+    $$PWD/VertexEditor/Utilities/SpriteSheet.cpp \
+    $$PWD/VertexEditor/Utilities/VertexAttributes.cpp \
+    $$PWD/VertexEditor/Utilities/VertexTransform.cpp
@@ -1,13 +1,207 @@
+#include <cstring>
+#include <memory>
+
 #include <QApplication>
+#include <QCommandLineOption>
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QFile>
+#include <QFileSystemWatcher>
+#include <QPointF>
+#include <QStringList>
+#include <QTextStream>
+#include <QTimer>
+#include <QtGlobal>
 
+#include "Root/StartupTrace.h"
+#include "Root/Utils.h"
+#include "VertexEditor/InputRecorder.h"
+#include "VertexEditor/InputReplayer.h"
+#include "VertexEditor/QueryServer.h"
+#include "VertexEditor/Utilities/ProjectFile.h"
+#include "VertexEditor/Utilities/VertexDataSetCollection.h"
 #include "VertexEditor/VertexEditorWindow.h"
 
+/**
+ * Creates the application, without a GUI if running headless so that no display is needed.
+ *
+ * @param argc - The number of command line arguments
+ * @param argv - The command line arguments
+ *
+ * @return The created application
+ */
+static QCoreApplication *createApplication (int &argc, char *argv [])
+{
+    for (int i = 1; i < argc; i++)
+    {
+        if (std::strcmp (argv [i], "--headless") == 0)
+            return new QCoreApplication (argc, argv);
+
+        // Replaying needs the window, but not a display to show it on
+        if (std::strcmp (argv [i], "--replay") == 0 && qEnvironmentVariableIsEmpty ("QT_QPA_PLATFORM"))
+            qputenv ("QT_QPA_PLATFORM", "offscreen");
+    }
+
+    return new QApplication (argc, argv);
+}
+
 int main (int argc, char *argv [])
 {
-    QApplication a (argc, argv);
+    Aerodlyn::StartupTrace::start ();
+
+    const std::unique_ptr <QCoreApplication> a (createApplication (argc, argv));
+    QCoreApplication::setApplicationName ("AeroHelper");
+    QCoreApplication::setApplicationVersion (Aerodlyn::Utils::getVersion ());
+    Aerodlyn::StartupTrace::mark ("application created");
+
+    QCommandLineParser parser;
+    parser.addHelpOption ();
+    parser.addVersionOption ();
+
+    const QCommandLineOption startupTraceOption ("startup-trace",
+        "Prints the time taken by each step of startup to stderr once the window has been shown.");
+    const QCommandLineOption startupBudgetOption ("startup-budget",
+        "Warns in the startup trace if the first frame takes longer than <ms> milliseconds.", "ms");
+    const QCommandLineOption serveOption ("serve",
+        "Serves the data sets to other processes (such as build tools) over the local socket <name>.", "name");
+    const QCommandLineOption headlessOption ("headless",
+        "Serves the data sets of the project file <project> without a window, reloading them whenever the "
+        "file changes. Serves over the local socket AeroHelper unless --serve is given.", "project");
+    const QCommandLineOption regionsAtOption ("regions-at",
+        "Prints the names of the data sets of the --headless project whose regions contain the point <x,y> "
+        "(relative to the center of the image), one per line, and exits instead of serving.", "x,y");
+    const QCommandLineOption recordOption ("record",
+        "Records the mouse, keyboard and menu input reaching the window to the file <file>, for --replay.", "file");
+    const QCommandLineOption replayOption ("replay",
+        "Replays the input recorded in the file <file> as fast as possible without showing the window, prints "
+        "frame time percentiles and exits.", "file");
+    const QCommandLineOption replayRealTimeOption ("replay-realtime",
+        "Replays the input of --replay at the times it was recorded instead of as fast as possible.");
+
+    parser.addOption (startupTraceOption);
+    parser.addOption (startupBudgetOption);
+    parser.addOption (serveOption);
+    parser.addOption (headlessOption);
+    parser.addOption (regionsAtOption);
+    parser.addOption (recordOption);
+    parser.addOption (replayOption);
+    parser.addOption (replayRealTimeOption);
+    parser.process (*a);
+
+    Aerodlyn::StartupTrace::setEnabled (parser.isSet (startupTraceOption));
+    if (parser.isSet (startupBudgetOption))
+        Aerodlyn::StartupTrace::setBudget (parser.value (startupBudgetOption).toInt ());
+
+    Aerodlyn::QueryServer queryServer;
+    const QString serverName = parser.isSet (serveOption) ? parser.value (serveOption) : QString ("AeroHelper");
+
+    if (parser.isSet (headlessOption))
+    {
+        const QString filepath = parser.value (headlessOption);
+
+        Aerodlyn::VertexDataSetCollection dataSets;
+        Aerodlyn::ProjectFile projectFile;
+
+        if (!projectFile.load (filepath, dataSets))
+        {
+            qCritical ("The project '%s' couldn't be loaded.", qUtf8Printable (filepath));
+            return 1;
+        }
+
+        if (projectFile.isPartial ())
+            qWarning ("The project '%s' is damaged, so only the data sets before the damage were loaded.", qUtf8Printable (filepath));
+
+        if (parser.isSet (regionsAtOption))
+        {
+            const QStringList coordinates = parser.value (regionsAtOption).split (',');
+
+            bool xValid = false, yValid = false;
+            const double x = coordinates.value (0).toDouble (&xValid);
+            const double y = coordinates.value (1).toDouble (&yValid);
+
+            if (coordinates.size () != 2 || !xValid || !yValid)
+            {
+                qCritical ("'%s' isn't a point, expected <x,y>.", qUtf8Printable (parser.value (regionsAtOption)));
+                return 1;
+            }
+
+            QTextStream out (stdout);
+            for (const QString &name : dataSets.regionsAt (QPointF (x, y)))
+                out << name << '\n';
+
+            return 0;
+        }
+
+        // Compacting a project replaces its file, which stops it from being watched
+        QFileSystemWatcher watcher ({ filepath });
+        QObject::connect (&watcher, &QFileSystemWatcher::fileChanged, [&] (const QString &path)
+        {
+            projectFile.load (path, dataSets);
+
+            if (!watcher.files ().contains (path) && QFile::exists (path))
+                watcher.addPath (path);
+        });
+
+        queryServer.watch (&dataSets);
+        if (!queryServer.listen (serverName))
+        {
+            qCritical ("Couldn't serve on '%s': %s", qUtf8Printable (serverName), qUtf8Printable (queryServer.errorString ()));
+            return 1;
+        }
+
+        qInfo ("Serving '%s' on '%s'.", qUtf8Printable (filepath), qUtf8Printable (queryServer.serverName ()));
+        return a->exec ();
+    }
 
     Aerodlyn::VertexEditorWindow vertexWindow;
+    Aerodlyn::StartupTrace::mark ("window created");
+
+    if (parser.isSet (serveOption))
+    {
+        queryServer.watch (&vertexWindow.dataSetCollection ());
+        if (!queryServer.listen (serverName))
+            qWarning ("Couldn't serve on '%s': %s", qUtf8Printable (serverName), qUtf8Printable (queryServer.errorString ()));
+    }
+
+    Aerodlyn::InputReplayer inputReplayer;
+    if (parser.isSet (replayOption) && !inputReplayer.load (parser.value (replayOption)))
+    {
+        qCritical ("'%s' isn't a recording or couldn't be read.", qUtf8Printable (parser.value (replayOption)));
+        return 1;
+    }
+
     vertexWindow.show ();
+    Aerodlyn::StartupTrace::mark ("window shown");
+
+    Aerodlyn::InputRecorder inputRecorder;
+    if (parser.isSet (recordOption) && !inputRecorder.start (&vertexWindow, parser.value (recordOption)))
+        qWarning ("Couldn't record to '%s'.", qUtf8Printable (parser.value (recordOption)));
+
+    if (parser.isSet (replayOption))
+    {
+        // The window finishes starting up after its first frame as well, which has to happen first
+        Aerodlyn::StartupTrace::afterFirstFrame (&vertexWindow, [&] { QTimer::singleShot (0, [&]
+        {
+            const bool realTime = parser.isSet (replayRealTimeOption);
+            const Aerodlyn::InputReplayer::Report report = inputReplayer.replay (&vertexWindow, realTime);
+
+            const auto milliseconds = [&] (const double percentile)
+                { return Aerodlyn::InputReplayer::percentile (report.frameTimes, percentile) / 1.0e6; };
+
+            QTextStream out (stdout);
+            out << QString ("Replayed %1 events in %2 s, %3\n").arg (report.events).arg (report.duration / 1.0e9, 0, 'f', 3)
+                .arg (realTime ? "in real time" : "as fast as possible");
+            out << QString ("Frames: %1\n").arg (report.frameTimes.size ());
+            out << QString ("Frame time (ms): p50 %1, p90 %2, p99 %3, max %4\n").arg (milliseconds (50), 0, 'f', 3)
+                .arg (milliseconds (90), 0, 'f', 3).arg (milliseconds (99), 0, 'f', 3).arg (milliseconds (100), 0, 'f', 3);
+
+            if (report.failures > 0)
+                out << QString ("WARNING: %1 events couldn't be replayed\n").arg (report.failures);
+
+            out.flush ();
+            QCoreApplication::exit (report.failures > 0 ? 1 : 0);
+        }); });
+    }
 
-    return a.exec ();
+    return a->exec ();
 }
@@ -0,0 +1,197 @@
+#include "Profiler.h"
+
+#if defined (Q_OS_LINUX)
+    #include <unistd.h>
+#endif
+
+/**
+ * A process-wide, lightweight recorder of named, timed events. Events are kept in a bounded ring
+ *  buffer and can be exported in the Chrome trace-event format (viewable in chrome://tracing or
+ *  Perfetto).
+ *
+ * @author  Patrick Jahnig (Aerodlyn)
+ * @version 2026.10.19
+ */
+
+/* Static Variables */
+std::atomic <bool> Aerodlyn::Profiler::enabled { false };
+
+int Aerodlyn::Profiler::next  = 0;
+int Aerodlyn::Profiler::count = 0;
+
+QMutex Aerodlyn::Profiler::mutex;
+
+QVector <Aerodlyn::Profiler::Event> Aerodlyn::Profiler::buffer;
+
+namespace
+{
+    /**
+     * Returns the timer all profiler times are relative to, starting it on first use.
+     */
+    const QElapsedTimer &epoch ()
+    {
+        static QElapsedTimer timer;
+        static const bool started = (timer.start (), true);
+        Q_UNUSED (started)
+
+        return timer;
+    }
+
+    /**
+     * Returns a small, stable number identifying the calling thread.
+     */
+    quint32 currentThreadNumber ()
+    {
+        static std::atomic <quint32> nextThread { 1 };
+        thread_local const quint32 thread = nextThread.fetch_add (1);
+
+        return thread;
+    }
+}
+
+/* Public Methods */
+/**
+ * Enables or disables the recording of events. Already recorded events are kept.
+ *
+ * @param enabled - True to record events, false to stop recording
+ */
+void Aerodlyn::Profiler::setEnabled (const bool enabled)
+{
+    epoch ();
+    Profiler::enabled.store (enabled, std::memory_order_relaxed);
+}
+
+/**
+ * Returns the number of nanoseconds since the profiler was first used.
+ *
+ * @return The current profiler time, in nanoseconds
+ */
+qint64 Aerodlyn::Profiler::now ()
+    { return epoch ().nsecsElapsed (); }
+
+/**
+ * Records a completed event.
+ *
+ * @param name     - The name of the event, which must outlive the profiler (i.e. a literal)
+ * @param start    - The start of the event, as returned by {@link #now}
+ * @param duration - The duration of the event, in nanoseconds
+ */
+void Aerodlyn::Profiler::record (const char *name, const qint64 start, const qint64 duration)
+{
+    const quint32 thread = currentThreadNumber ();
+    QMutexLocker locker (&mutex);
+
+    if (buffer.isEmpty ())
+        buffer.resize (CAPACITY);
+
+    buffer [next] = { name, start, duration, thread };
+    next  = (next + 1) % CAPACITY;
+    count = std::min (count + 1, CAPACITY);
+}
+
+/**
+ * Returns the duration of the most recently recorded event with the given name.
+ *
+ * @param name - The name of the event to look up
+ *
+ * @return The duration of the most recent matching event in nanoseconds, or -1 if no such event
+ *  was recorded recently
+ */
+qint64 Aerodlyn::Profiler::lastDuration (const char *name)
+{
+    // Only the recent past is of interest, so the scan is bounded
+    const int SCAN_LIMIT = 1024;
+
+    QMutexLocker locker (&mutex);
+    for (int i = 1; i <= std::min (count, SCAN_LIMIT); i++)
+    {
+        const Event &event = buffer.at ((next - i + CAPACITY) % CAPACITY);
+        if (std::strcmp (event.name, name) == 0)
+            return event.duration;
+    }
+
+    return -1;
+}
+
+/**
+ * Returns a copy of every retained event, oldest first.
+ *
+ * @return The retained events
+ */
+QVector <Aerodlyn::Profiler::Event> Aerodlyn::Profiler::events ()
+{
+    QMutexLocker locker (&mutex);
+
+    QVector <Event> result;
+    result.reserve (count);
+
+    for (int i = count; i > 0; i--)
+        result.append (buffer.at ((next - i + CAPACITY) % CAPACITY));
+
+    return result;
+}
+
+/**
+ * Discards every recorded event.
+ */
+void Aerodlyn::Profiler::clear ()
+{
+    QMutexLocker locker (&mutex);
+
+    next  = 0;
+    count = 0;
+}
+
+/**
+ * Writes every retained event to the file at the given filepath as Chrome trace-event JSON.
+ *
+ * @param filepath - The (full) filepath of the file to write
+ *
+ * @return True if the file was written, false otherwise
+ */
+bool Aerodlyn::Profiler::exportChromeTrace (const QString &filepath)
+{
+    QFile file (filepath);
+    if (!file.open (QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Text))
+        return false;
+
+    QTextStream stream (&file);
+    stream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+    // Event names are literals from the instrumented code, so they never need escaping
+    const QVector <Event> recorded = events ();
+    for (int i = 0; i < recorded.size (); i++)
+    {
+        const Event &event = recorded.at (i);
+
+        stream << (i == 0 ? "\n" : ",\n")
+               << "{\"name\":\"" << event.name << "\",\"cat\":\"AeroHelper\",\"ph\":\"X\",\"pid\":1"
+               << ",\"tid\":" << event.thread
+               << ",\"ts\":" << QString::number (event.start / 1000.0, 'f', 3)
+               << ",\"dur\":" << QString::number (event.duration / 1000.0, 'f', 3) << "}";
+    }
+
+    stream << "\n]}\n";
+    stream.flush ();
+
+    return file.error () == QFileDevice::NoError;
+}
+
+/**
+ * Returns the resident memory of this process.
+ *
+ * @return The resident memory in bytes, or -1 if it cannot be determined on this platform
+ */
+qint64 Aerodlyn::Profiler::residentMemory ()
+{
+#if defined (Q_OS_LINUX)
+    QFile statm ("/proc/self/statm");
+    if (!statm.open (QIODevice::ReadOnly))
+        return -1;
+
+    const QList <QByteArray> fields = statm.readAll ().split (' ');
+    return fields.size () > 1 ? fields.at (1).toLongLong () * sysconf (_SC_PAGESIZE) : -1;
+#else
+    return -1;
+#endif
+}
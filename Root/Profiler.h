@@ -0,0 +1,168 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+
+#include <QElapsedTimer>
+#include <QFile>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QString>
+#include <QTextStream>
+#include <QVector>
+
+/**
+ * Records the duration of the enclosing scope under the given name (which must be a string literal)
+ *  while the profiler is enabled. Compiles to nothing unless AEROHELPER_PROFILING is defined, and
+ *  costs a single relaxed atomic load while the profiler is disabled.
+ */
+#if defined (AEROHELPER_PROFILING)
+    #define AERO_PROFILE_CONCAT_INNER(a, b) a##b
+    #define AERO_PROFILE_CONCAT(a, b)       AERO_PROFILE_CONCAT_INNER (a, b)
+    #define AERO_PROFILE_SCOPE(name)        const Aerodlyn::ProfilerScope AERO_PROFILE_CONCAT (profilerScope, __LINE__) (name)
+#else
+    #define AERO_PROFILE_SCOPE(name)
+#endif
+
+namespace Aerodlyn
+{
+    /**
+     * A process-wide, lightweight recorder of named, timed events. Events are kept in a bounded ring
+     *  buffer and can be exported in the Chrome trace-event format (viewable in chrome://tracing or
+     *  Perfetto).
+     *
+     * @author  Patrick Jahnig (Aerodlyn)
+     * @version 2026.10.19
+     */
+    class Profiler
+    {
+        public: // Types
+            /**
+             * A single completed, timed event. Times are in nanoseconds since the profiler was first used.
+             */
+            struct Event
+            {
+                const char *name;
+                qint64      start;
+                qint64      duration;
+                quint32     thread;
+            };
+
+        public: // Methods
+            /**
+             * Returns whether events are currently being recorded.
+             *
+             * @return True if events are being recorded, false otherwise
+             */
+            static bool isEnabled ()
+                { return enabled.load (std::memory_order_relaxed); }
+
+            /**
+             * Enables or disables the recording of events. Already recorded events are kept.
+             *
+             * @param enabled - True to record events, false to stop recording
+             */
+            static void setEnabled (const bool enabled);
+
+            /**
+             * Returns the number of nanoseconds since the profiler was first used.
+             *
+             * @return The current profiler time, in nanoseconds
+             */
+            static qint64 now ();
+
+            /**
+             * Records a completed event.
+             *
+             * @param name     - The name of the event, which must outlive the profiler (i.e. a literal)
+             * @param start    - The start of the event, as returned by {@link #now}
+             * @param duration - The duration of the event, in nanoseconds
+             */
+            static void record (const char *name, const qint64 start, const qint64 duration);
+
+            /**
+             * Returns the duration of the most recently recorded event with the given name.
+             *
+             * @param name - The name of the event to look up
+             *
+             * @return The duration of the most recent matching event in nanoseconds, or -1 if no such event
+             *  was recorded recently
+             */
+            static qint64 lastDuration (const char *name);
+
+            /**
+             * Returns a copy of every retained event, oldest first.
+             *
+             * @return The retained events
+             */
+            static QVector <Event> events ();
+
+            /**
+             * Discards every recorded event.
+             */
+            static void clear ();
+
+            /**
+             * Writes every retained event to the file at the given filepath as Chrome trace-event JSON.
+             *
+             * @param filepath - The (full) filepath of the file to write
+             *
+             * @return True if the file was written, false otherwise
+             */
+            static bool exportChromeTrace (const QString &filepath);
+
+            /**
+             * Returns the resident memory of this process.
+             *
+             * @return The resident memory in bytes, or -1 if it cannot be determined on this platform
+             */
+            static qint64 residentMemory ();
+
+        private: // Variables
+            static constexpr int           CAPACITY = 1 << 16;
+
+            static std::atomic <bool>      enabled;
+
+            static int                     next;
+            static int                     count;
+
+            static QMutex                  mutex;
+
+            static QVector <Event>         buffer;
+    };
+
+    /**
+     * Records the lifetime of an instance as a {@link Profiler} event, if the profiler was enabled
+     *  when the instance was created. Normally used through AERO_PROFILE_SCOPE. Defined inline so
+     *  that a disabled profiler costs no function call.
+     */
+    class ProfilerScope
+    {
+        public: // Constructors/Deconstructors
+            /**
+             * Starts timing a scope with the given name.
+             *
+             * @param name - The name of the scope, which must outlive the profiler (i.e. a literal)
+             */
+            explicit ProfilerScope (const char *name)
+                : name (name), start (Profiler::isEnabled () ? Profiler::now () : -1) {}
+
+            /**
+             * Stops timing the scope and records it.
+             */
+            ~ProfilerScope ()
+            {
+                if (start >= 0)
+                    Profiler::record (name, start, Profiler::now () - start);
+            }
+
+        private: // Variables
+            const char *name;
+
+            qint64     start;
+    };
+}
+
+#endif // PROFILER_H
@@ -0,0 +1,146 @@
+#include "StartupTrace.h"
+
+/**
+ * Records named milestones between the start of the process and its first frame (and the
+ *  initialization deferred until after it), and reports them when requested with --startup-trace.
+ *
+ * @author  Patrick Jahnig (Aerodlyn)
+ * @version 2026.10.19
+ */
+
+/* Static Variables */
+bool Aerodlyn::StartupTrace::enabled = false;
+
+int Aerodlyn::StartupTrace::budget = -1;
+
+qint64 Aerodlyn::StartupTrace::firstFrame = -1;
+
+QElapsedTimer Aerodlyn::StartupTrace::clock;
+
+QVector <Aerodlyn::StartupTrace::Milestone> Aerodlyn::StartupTrace::milestones;
+
+namespace
+{
+    /**
+     * Watches a widget for its first paint event, then removes itself and calls the callback once
+     *  control returns to the event loop (i.e. after the frame has been composed).
+     */
+    class FirstFrameFilter : public QObject
+    {
+        public:
+            FirstFrameFilter (QWidget *widget, const std::function <void ()> callback)
+                : QObject (widget), callback (callback) { widget->installEventFilter (this); }
+
+        protected:
+            bool eventFilter (QObject *watched, QEvent *event) override
+            {
+                if (event->type () == QEvent::Paint)
+                {
+                    watched->removeEventFilter (this);
+                    Aerodlyn::StartupTrace::mark ("first frame");
+
+                    QTimer::singleShot (0, parent (), callback);
+                    deleteLater ();
+                }
+
+                return false;
+            }
+
+        private:
+            std::function <void ()> callback;
+    };
+}
+
+/* Public Methods */
+/**
+ * Starts the startup clock. Should be the first statement in main.
+ */
+void Aerodlyn::StartupTrace::start ()
+{
+    clock.start ();
+    mark ("process start");
+}
+
+/**
+ * Enables or disables the report printed by {@link #finish}.
+ *
+ * @param enabled - True to print the report, false otherwise
+ */
+void Aerodlyn::StartupTrace::setEnabled (const bool enabled)
+    { StartupTrace::enabled = enabled; }
+
+/**
+ * Sets the number of milliseconds the first frame may take before {@link #finish} warns
+ *  that startup is over budget.
+ *
+ * @param milliseconds - The time-to-first-frame budget, or a negative value for no budget
+ */
+void Aerodlyn::StartupTrace::setBudget (const int milliseconds)
+    { budget = milliseconds; }
+
+/**
+ * Records that the given milestone was reached.
+ *
+ * @param label - The name of the milestone, which must be a literal
+ */
+void Aerodlyn::StartupTrace::mark (const char *label)
+{
+    if (!clock.isValid ())
+        return;
+
+    const qint64 elapsed = clock.nsecsElapsed ();
+    if (qstrcmp (label, "first frame") == 0 && firstFrame < 0)
+        firstFrame = elapsed;
+
+    if (Profiler::isEnabled ())
+        Profiler::record (label, Profiler::now (), 0);
+
+    milestones.append ({ label, elapsed });
+}
+
+/**
+ * Calls the given function once, after the first time the given widget is painted, so that work
+ *  which isn't needed for the first frame can be deferred until after it.
+ *
+ * @param widget   - The widget whose first paint is the first frame
+ * @param callback - The function to call after the first frame
+ */
+void Aerodlyn::StartupTrace::afterFirstFrame (QWidget *widget, const std::function <void ()> callback)
+    { new FirstFrameFilter (widget, callback); }
+
+/**
+ * Records the end of startup and, if enabled, prints the timing report to stderr.
+ */
+void Aerodlyn::StartupTrace::finish ()
+{
+    mark ("startup finished");
+    if (!enabled)
+        return;
+
+    QTextStream err (stderr);
+    err << "Startup trace (AeroHelper " << Utils::getVersion () << ")\n";
+
+    qint64 previous = 0;
+    for (const Milestone &milestone : milestones)
+    {
+        err << QString ("  %1 ms  (+%2 ms)  %3\n")
+            .arg (milestone.elapsed / 1.0e6, 9, 'f', 3)
+            .arg ((milestone.elapsed - previous) / 1.0e6, 8, 'f', 3)
+            .arg (milestone.label);
+
+        previous = milestone.elapsed;
+    }
+
+    if (budget >= 0 && timeToFirstFrame () > budget)
+        err << QString ("WARNING: time to first frame (%1 ms) is over the budget of %2 ms\n").arg (timeToFirstFrame ()).arg (budget);
+
+    err.flush ();
+}
+
+/**
+ * Returns the number of milliseconds between the start of the process and its first frame.
+ *
+ * @return The time to first frame in milliseconds, or -1 if there hasn't been a frame yet
+ */
+qint64 Aerodlyn::StartupTrace::timeToFirstFrame ()
+    { return firstFrame < 0 ? -1 : firstFrame / 1000000; }
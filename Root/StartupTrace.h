@@ -0,0 +1,98 @@
+#ifndef STARTUP_TRACE_H
+#define STARTUP_TRACE_H
+
+#include <functional>
+
+#include <QElapsedTimer>
+#include <QEvent>
+#include <QObject>
+#include <QString>
+#include <QTextStream>
+#include <QTimer>
+#include <QVector>
+#include <QWidget>
+
+#include "Root/Profiler.h"
+#include "Root/Utils.h"
+
+namespace Aerodlyn
+{
+    /**
+     * Records named milestones between the start of the process and its first frame (and the
+     *  initialization deferred until after it), and reports them when requested with --startup-trace.
+     *
+     * @author  Patrick Jahnig (Aerodlyn)
+     * @version 2026.10.19
+     */
+    class StartupTrace
+    {
+        public: // Methods
+            /**
+             * Starts the startup clock. Should be the first statement in main.
+             */
+            static void start ();
+
+            /**
+             * Enables or disables the report printed by {@link #finish}.
+             *
+             * @param enabled - True to print the report, false otherwise
+             */
+            static void setEnabled (const bool enabled);
+
+            /**
+             * Sets the number of milliseconds the first frame may take before {@link #finish} warns
+             *  that startup is over budget.
+             *
+             * @param milliseconds - The time-to-first-frame budget, or a negative value for no budget
+             */
+            static void setBudget (const int milliseconds);
+
+            /**
+             * Records that the given milestone was reached.
+             *
+             * @param label - The name of the milestone, which must be a literal
+             */
+            static void mark (const char *label);
+
+            /**
+             * Calls the given function once, after the first time the given widget is painted, so that work
+             *  which isn't needed for the first frame can be deferred until after it.
+             *
+             * @param widget   - The widget whose first paint is the first frame
+             * @param callback - The function to call after the first frame
+             */
+            static void afterFirstFrame (QWidget *widget, const std::function <void ()> callback);
+
+            /**
+             * Records the end of startup and, if enabled, prints the timing report to stderr.
+             */
+            static void finish ();
+
+            /**
+             * Returns the number of milliseconds between the start of the process and its first frame.
+             *
+             * @return The time to first frame in milliseconds, or -1 if there hasn't been a frame yet
+             */
+            static qint64 timeToFirstFrame ();
+
+        private: // Types
+            struct Milestone
+            {
+                const char *label;
+                qint64      elapsed;
+            };
+
+        private: // Variables
+            static bool                  enabled;
+
+            static int                   budget;
+
+            static qint64                firstFrame;
+
+            static QElapsedTimer         clock;
+
+            static QVector <Milestone>   milestones;
+    };
+}
+
+#endif // STARTUP_TRACE_H
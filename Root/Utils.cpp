@@ -37,14 +37,24 @@ bool Aerodlyn::Utils::isInCircle (const double x, const double y, const double c
 bool Aerodlyn::Utils::isInCircle (const QPointF point, const QPointF center, const double radius)
     { return isInCircle (point.x (), point.y (), center.x (), center.y (), radius); }
 
+/**
+ * Returns the title of the application, including its version.
+ *
+ * @return The title of the application
+ */
 QString Aerodlyn::Utils::getTitle () { return QString ("AeroHelper | Ver: ").append (getVersion ()); }
 
+/**
+ * Returns the version of the application, which is embedded at compile time (see AeroHelper.pro)
+ *  so that no file has to be read at startup.
+ *
+ * @return The version of the application
+ */
 QString Aerodlyn::Utils::getVersion ()
 {
-    FILE *file = fopen (QApplication::applicationDirPath ().append ("/VERSION").toStdString ().c_str (), "r");
-
-    QString str = file ? QTextStream (file).readAll () : QString ("VERSION couldn't be loaded...");
-
-    fclose (file);
-    return str;
+#if defined (AEROHELPER_VERSION)
+    return QStringLiteral (AEROHELPER_VERSION);
+#else
+    return QStringLiteral ("unknown");
+#endif
 }
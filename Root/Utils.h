@@ -2,12 +2,10 @@
 #define UTILS_H
 
 #include <cmath>
-#include <cstdio>
 #include <iostream>
 
-#include <QApplication>
 #include <QPointF>
-#include <QTextStream>
+#include <QString>
 
 namespace Aerodlyn
 {
@@ -40,7 +38,19 @@ namespace Aerodlyn
              */
             static bool isInCircle (const QPointF point, const QPointF center, const double radius);
 
+            /**
+             * Returns the title of the application, including its version.
+             *
+             * @return The title of the application
+             */
             static QString getTitle ();
+
+            /**
+             * Returns the version of the application, which is embedded at compile time (see AeroHelper.pro)
+             *  so that no file has to be read at startup.
+             *
+             * @return The version of the application
+             */
             static QString getVersion ();
     };
 }
@@ -0,0 +1,17 @@
+QT += gui widgets concurrent network testlib
+CONFIG += c++17
+
+CONFIG += qt console warn_on depend_includepath testcase
+CONFIG -= app_bundle
+
+TEMPLATE = app
+
+# Recording needs a whole editor window, so everything but the entry point of the application is built
+# in. The image opened while recording is the one next to the project file.
+DEFINES += TEST_IMAGE=\\\"$$PWD/../../Test.png\\\"
+
+INCLUDEPATH += ../.. ../../VertexEditor/Utilities
+
+include (../../Files.pri)
+SOURCES -= $$clean_path($$PWD/../../Root/Main.cpp)
+SOURCES += tst_inputrecordingtest.cpp
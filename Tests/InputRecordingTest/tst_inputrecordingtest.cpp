@@ -0,0 +1,274 @@
+#include <algorithm>
+
+#include <QApplication>
+#include <QByteArray>
+#include <QDataStream>
+#include <QEvent>
+#include <QFile>
+#include <QIODevice>
+#include <QKeyEvent>
+#include <QMouseEvent>
+#include <QPoint>
+#include <QSize>
+#include <QString>
+#include <QTemporaryDir>
+#include <QVector>
+#include <QWheelEvent>
+#include <QWindow>
+#include <QtTest>
+
+#include "VertexEditor/InputRecorder.h"
+#include "VertexEditor/InputReplayer.h"
+#include "VertexEditor/VertexEditorWindow.h"
+
+using Aerodlyn::InputRecorder;
+using Aerodlyn::InputReplayer;
+
+class InputRecordingTest : public QObject
+{
+    Q_OBJECT
+
+    protected:
+        bool eventFilter (QObject *watched, QEvent *event) override;
+
+    private:
+        // The input sent while recording is only meant for the recorder, so it is kept from the window
+        //  (where a click could open a dialog) once the recorder has seen it
+        bool swallowInput = false;
+
+    private slots:
+        void test_recordAndRead ();
+        void test_readDamaged ();
+        void test_percentile_data ();
+        void test_percentile ();
+};
+
+bool InputRecordingTest::eventFilter (QObject *watched, QEvent *event)
+{
+    Q_UNUSED (watched)
+
+    switch (event->type ())
+    {
+        case QEvent::MouseButtonPress:
+        case QEvent::MouseButtonRelease:
+        case QEvent::MouseButtonDblClick:
+        case QEvent::MouseMove:
+        case QEvent::Wheel:
+        case QEvent::KeyPress:
+        case QEvent::KeyRelease:
+            return swallowInput;
+
+        default:
+            return false;
+    }
+}
+
+void InputRecordingTest::test_recordAndRead ()
+{
+    QTemporaryDir directory;
+    QVERIFY (directory.isValid ());
+
+    const QString path = directory.filePath ("input.ahir");
+
+    Aerodlyn::VertexEditorWindow window;
+    window.show ();
+    QVERIFY (QTest::qWaitForWindowExposed (&window));
+
+    // The window starts at its minimum size, so it is only ever grown
+    const QSize startSize = window.size ();
+    const QSize endSize = startSize + QSize (40, 30);
+
+    QWindow *handle = window.windowHandle ();
+
+    // Filters installed later see events first, so the recorder sees the input before it is swallowed
+    handle->installEventFilter (this);
+    swallowInput = true;
+
+    InputRecorder recorder;
+    QVERIFY (recorder.start (&window, path));
+
+    QMouseEvent press (QEvent::MouseButtonPress, QPointF (40, 50), QPointF (40, 50), handle->mapToGlobal (QPoint (40, 50)),
+        Qt::MiddleButton, Qt::MiddleButton, Qt::ShiftModifier);
+    QCoreApplication::sendEvent (handle, &press);
+
+    // Positions beyond 16 bits are clamped
+    QMouseEvent move (QEvent::MouseMove, QPointF (-100, 40000), QPointF (-100, 40000), QPointF (), Qt::NoButton,
+        Qt::MiddleButton, Qt::NoModifier);
+    QCoreApplication::sendEvent (handle, &move);
+
+    QMouseEvent release (QEvent::MouseButtonRelease, QPointF (41, 51), QPointF (41, 51), QPointF (), Qt::MiddleButton,
+        Qt::NoButton, Qt::NoModifier);
+    QCoreApplication::sendEvent (handle, &release);
+
+    QWheelEvent wheel (QPointF (40, 50), QPointF (), QPoint (), QPoint (0, -120), Qt::NoButton, Qt::ControlModifier,
+        Qt::NoScrollPhase, false);
+    QCoreApplication::sendEvent (handle, &wheel);
+
+    QTest::qWait (20);
+
+    QKeyEvent keyPress (QEvent::KeyPress, Qt::Key_A, Qt::ShiftModifier, QString (QChar (0x00C4)), true);
+    QCoreApplication::sendEvent (handle, &keyPress);
+
+    QKeyEvent keyRelease (QEvent::KeyRelease, Qt::Key_A, Qt::ShiftModifier, QString (QChar (0x00C4)));
+    QCoreApplication::sendEvent (handle, &keyRelease);
+
+    swallowInput = false;
+    handle->removeEventFilter (this);
+
+    QVERIFY (window.openImageFile (TEST_IMAGE));
+
+    window.resize (endSize);
+    QTRY_COMPARE (handle->size (), endSize);
+    QCoreApplication::processEvents ();
+
+    recorder.stop ();
+
+    QSize windowSize;
+    QVector <InputRecorder::Event> events;
+    QVERIFY (InputRecorder::read (path, windowSize, events));
+    QCOMPARE (windowSize, startSize);
+
+    // Laying out the window may resize it more than once, but the last size is the one asked for
+    QVERIFY (events.size () >= 8);
+    QCOMPARE (events.last ().kind, InputRecorder::Resize);
+    QCOMPARE (events.last ().size, endSize);
+
+    QCOMPARE (events.at (0).kind, InputRecorder::MousePress);
+    QCOMPARE (events.at (0).position, QPoint (40, 50));
+    QCOMPARE (events.at (0).button, Qt::MiddleButton);
+    QCOMPARE (events.at (0).buttons, Qt::MouseButtons (Qt::MiddleButton));
+    QCOMPARE (events.at (0).modifiers, Qt::KeyboardModifiers (Qt::ShiftModifier));
+
+    QCOMPARE (events.at (1).kind, InputRecorder::MouseMove);
+    QCOMPARE (events.at (1).position, QPoint (-100, 32767));
+    QCOMPARE (events.at (1).buttons, Qt::MouseButtons (Qt::MiddleButton));
+
+    QCOMPARE (events.at (2).kind, InputRecorder::MouseRelease);
+    QCOMPARE (events.at (2).position, QPoint (41, 51));
+    QCOMPARE (events.at (2).buttons, Qt::MouseButtons (Qt::NoButton));
+
+    QCOMPARE (events.at (3).kind, InputRecorder::Wheel);
+    QCOMPARE (events.at (3).angleDelta, QPoint (0, -120));
+    QCOMPARE (events.at (3).modifiers, Qt::KeyboardModifiers (Qt::ControlModifier));
+
+    QCOMPARE (events.at (4).kind, InputRecorder::KeyPress);
+    QCOMPARE (events.at (4).key, int (Qt::Key_A));
+    QCOMPARE (events.at (4).text, QString (QChar (0x00C4)));
+    QVERIFY (events.at (4).autoRepeat);
+
+    QCOMPARE (events.at (5).kind, InputRecorder::KeyRelease);
+    QVERIFY (!events.at (5).autoRepeat);
+
+    // Opening the image may lay the window out again, which is recorded as well
+    const auto opened = std::find_if (events.cbegin () + 6, events.cend (), [] (const InputRecorder::Event &event)
+        { return event.kind == InputRecorder::ImageOpened; });
+
+    QVERIFY (opened != events.cend ());
+    QCOMPARE (opened->text, QString (TEST_IMAGE));
+
+    // Times are kept in whole microseconds, and never go backwards
+    for (int i = 1; i < events.size (); i++)
+        QVERIFY (events.at (i).time >= events.at (i - 1).time);
+
+    QVERIFY (events.at (4).time - events.at (3).time >= 20000000);
+
+    // Loading for a replay reads the same events
+    InputReplayer replayer;
+    QVERIFY (replayer.load (path));
+}
+
+void InputRecordingTest::test_readDamaged ()
+{
+    QTemporaryDir directory;
+    QVERIFY (directory.isValid ());
+
+    const QString path = directory.filePath ("input.ahir");
+
+    // A header for a 320 by 200 window, a key press and a resize that was cut short
+    QByteArray recording;
+    QDataStream out (&recording, QIODevice::WriteOnly);
+    out.setByteOrder (QDataStream::LittleEndian);
+
+    out << quint32 (0x52494841) << quint32 (1) << quint16 (320) << quint16 (200);
+    out << quint8 (InputRecorder::KeyPress) << quint32 (1500) << quint32 (Qt::Key_Escape) << quint8 (0) << quint8 (0)
+        << quint16 (0);
+    out << quint8 (InputRecorder::Resize) << quint32 (10) << quint16 (640);
+
+    QFile file (path);
+    QVERIFY (file.open (QIODevice::WriteOnly));
+    file.write (recording);
+    file.close ();
+
+    // A recording cut short (such as by a crash) is kept up to its last whole event
+    QSize windowSize;
+    QVector <InputRecorder::Event> events;
+    QVERIFY (InputRecorder::read (path, windowSize, events));
+    QCOMPARE (windowSize, QSize (320, 200));
+    QCOMPARE (events.size (), 1);
+    QCOMPARE (events.at (0).key, int (Qt::Key_Escape));
+    QCOMPARE (events.at (0).time, qint64 (1500000));
+
+    // An unknown kind of event means the file isn't a recording this version understands
+    QVERIFY (file.open (QIODevice::WriteOnly));
+    file.write (recording.left (8 + 4) + QByteArray (1, '\x7F') + QByteArray (4, '\0'));
+    file.close ();
+
+    QVERIFY (!InputRecorder::read (path, windowSize, events));
+
+    QVERIFY (file.open (QIODevice::WriteOnly));
+    file.write ("Not a recording");
+    file.close ();
+
+    QVERIFY (!InputRecorder::read (path, windowSize, events));
+}
+
+void InputRecordingTest::test_percentile_data ()
+{
+    QTest::addColumn <QVector <qint64>> ("frameTimes");
+    QTest::addColumn <double> ("percentile");
+    QTest::addColumn <qint64> ("expected");
+
+    const QVector <qint64> five ({ 50, 10, 40, 20, 30 });
+
+    // Nearest rank: the smallest value with at least the given percent of values at or below it
+    QTest::newRow ("p0") << five << 0.0 << qint64 (10);
+    QTest::newRow ("p20") << five << 20.0 << qint64 (10);
+    QTest::newRow ("p21") << five << 21.0 << qint64 (20);
+    QTest::newRow ("p50") << five << 50.0 << qint64 (30);
+    QTest::newRow ("p90") << five << 90.0 << qint64 (50);
+    QTest::newRow ("p100") << five << 100.0 << qint64 (50);
+    QTest::newRow ("beyond p100") << five << 150.0 << qint64 (50);
+    QTest::newRow ("single") << QVector <qint64> ({ 7 }) << 99.0 << qint64 (7);
+    QTest::newRow ("empty") << QVector <qint64> () << 50.0 << qint64 (0);
+
+    QVector <qint64> hundred;
+    for (int i = 100; i >= 1; i--)
+        hundred.append (i * 1000);
+
+    QTest::newRow ("p99 of 100") << hundred << 99.0 << qint64 (99000);
+    QTest::newRow ("p99.5 of 100") << hundred << 99.5 << qint64 (100000);
+}
+
+void InputRecordingTest::test_percentile ()
+{
+    QFETCH (QVector <qint64>, frameTimes);
+    QFETCH (double, percentile);
+    QFETCH (qint64, expected);
+
+    QCOMPARE (InputReplayer::percentile (frameTimes, percentile), expected);
+}
+
+int main (int argc, char *argv [])
+{
+    // Recording mustn't depend on a display, so the offscreen platform is used unless another one is
+    //  asked for
+    if (!qEnvironmentVariableIsSet ("QT_QPA_PLATFORM"))
+        qputenv ("QT_QPA_PLATFORM", "offscreen");
+
+    QApplication application (argc, argv);
+
+    InputRecordingTest test;
+    return QTest::qExec (&test, argc, argv);
+}
+
+#include "tst_inputrecordingtest.moc"
@@ -0,0 +1,18 @@
+QT += gui concurrent network testlib
+CONFIG += c++17
+
+CONFIG += qt console warn_on depend_includepath testcase
+CONFIG -= app_bundle
+
+TEMPLATE = app
+
+INCLUDEPATH += ../.. ../../VertexEditor/Utilities
+HEADERS += ../../VertexEditor/QueryServer.h
+SOURCES +=  tst_queryservertest.cpp ../../Root/Utils.cpp ../../VertexEditor/QueryServer.cpp \
+    ../../VertexEditor/Utilities/BoundingVolumes.cpp \
+    ../../VertexEditor/Utilities/DataSetRTree.cpp \
+    ../../VertexEditor/Utilities/RegionGeometry.cpp \
+    ../../VertexEditor/Utilities/RegionSlabIndex.cpp \
+    ../../VertexEditor/Utilities/RegionSpatialIndex.cpp \
+    ../../VertexEditor/Utilities/VertexAttributes.cpp \
+    ../../VertexEditor/Utilities/VertexDataSetCollection.cpp
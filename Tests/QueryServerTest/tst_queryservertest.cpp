@@ -0,0 +1,324 @@
+#include <QByteArray>
+#include <QCoreApplication>
+#include <QDataStream>
+#include <QIODevice>
+#include <QLocalSocket>
+#include <QPointF>
+#include <QPolygonF>
+#include <QString>
+#include <QStringList>
+#include <QtEndian>
+#include <QtTest>
+
+#include "VertexEditor/QueryServer.h"
+#include "VertexEditor/Utilities/VertexDataSetCollection.h"
+
+using Aerodlyn::QueryServer;
+
+class QueryServerTest : public QObject
+{
+    Q_OBJECT
+
+    private:
+        const int TIMEOUT = 5000;
+
+        QLocalSocket socket;
+
+        QueryServer server;
+
+        Aerodlyn::VertexDataSetCollection collection;
+
+        QByteArray exchange (const QByteArray &request, quint8 &status);
+        QByteArray readResponse (quint8 &status);
+
+        static QByteArray frame (const quint8 opcode, const QByteArray &payload = QByteArray ());
+        static QByteArray string (const QString &string);
+        static QByteArray numbers (const QVector <double> &values);
+        static QStringList names (const QByteArray &payload);
+
+    private slots:
+        void initTestCase ();
+        void init ();
+        void cleanup ();
+
+        void test_listNames ();
+        void test_fetchRegion ();
+        void test_queryBox ();
+        void test_queryPoint ();
+        void test_pipelined ();
+        void test_malformedPayload ();
+        void test_malformedFrame_data ();
+        void test_malformedFrame ();
+        void test_publish ();
+};
+
+void QueryServerTest::initTestCase ()
+{
+    collection.addAll ({ "Alpha", "Beta", "Bravo" });
+    collection.get ("Alpha")->get () = QPolygonF ({ QPointF (0, 0), QPointF (10, 0), QPointF (10, 10), QPointF (0, 10) });
+    collection.get ("Beta")->get () = QPolygonF ({ QPointF (20, 20), QPointF (30, 20), QPointF (30, 30), QPointF (20, 30) });
+    collection.get ("Bravo")->get () = QPolygonF ({ QPointF (100, 100), QPointF (110, 100), QPointF (100, 110) });
+
+    for (const QString &name : QStringList ({ "Alpha", "Beta", "Bravo" }))
+        collection.markDirty (name);
+
+    server.publish (collection);
+
+    // Named after the process, so test runs in parallel don't share a socket
+    QVERIFY2 (server.listen (QString ("AeroHelperQueryServerTest-%1").arg (QCoreApplication::applicationPid ())),
+        qPrintable (server.errorString ()));
+}
+
+void QueryServerTest::init ()
+{
+    socket.connectToServer (server.serverName ());
+    QVERIFY (socket.waitForConnected (TIMEOUT));
+}
+
+void QueryServerTest::cleanup ()
+{
+    socket.abort ();
+}
+
+void QueryServerTest::test_listNames ()
+{
+    quint8 status;
+
+    QCOMPARE (names (exchange (frame (QueryServer::ListNames, string ("B")), status)), QStringList ({ "Beta", "Bravo" }));
+    QCOMPARE (status, quint8 (QueryServer::Ok));
+
+    QCOMPARE (names (exchange (frame (QueryServer::ListNames, string ("")), status)), QStringList ({ "Alpha", "Beta", "Bravo" }));
+    QCOMPARE (names (exchange (frame (QueryServer::ListNames, string ("Gamma")), status)), QStringList ());
+    QCOMPARE (status, quint8 (QueryServer::Ok));
+}
+
+void QueryServerTest::test_fetchRegion ()
+{
+    quint8 status;
+    const QByteArray payload = exchange (frame (QueryServer::FetchRegion, string ("Bravo")), status);
+    QCOMPARE (status, quint8 (QueryServer::Ok));
+
+    QDataStream in (payload);
+    in.setByteOrder (QDataStream::LittleEndian);
+
+    quint32 count;
+    in >> count;
+
+    QPolygonF region;
+    for (quint32 i = 0; i < count; i++)
+    {
+        double x, y;
+        in >> x >> y;
+        region << QPointF (x, y);
+    }
+
+    QCOMPARE (in.status (), QDataStream::Ok);
+    QVERIFY (in.atEnd ());
+    QCOMPARE (region, collection.get ("Bravo")->get ());
+
+    QVERIFY (exchange (frame (QueryServer::FetchRegion, string ("Brav")), status).isEmpty ());
+    QCOMPARE (status, quint8 (QueryServer::NotFound));
+}
+
+void QueryServerTest::test_queryBox ()
+{
+    quint8 status;
+
+    // Touches the bounds of Alpha and Beta, and a negative size is the same box the other way round
+    QCOMPARE (names (exchange (frame (QueryServer::QueryBox, numbers ({ 5, 5, 20, 20 })), status)),
+        QStringList ({ "Alpha", "Beta" }));
+    QCOMPARE (names (exchange (frame (QueryServer::QueryBox, numbers ({ 25, 25, -20, -20 })), status)),
+        QStringList ({ "Alpha", "Beta" }));
+    QCOMPARE (names (exchange (frame (QueryServer::QueryBox, numbers ({ 40, 40, 10, 10 })), status)), QStringList ());
+    QCOMPARE (status, quint8 (QueryServer::Ok));
+}
+
+void QueryServerTest::test_queryPoint ()
+{
+    quint8 status;
+
+    QCOMPARE (names (exchange (frame (QueryServer::QueryPoint, numbers ({ 5, 5 })), status)), QStringList ({ "Alpha" }));
+
+    // Inside the bounds of Bravo, but outside of its triangle
+    QCOMPARE (names (exchange (frame (QueryServer::QueryPoint, numbers ({ 109, 109 })), status)), QStringList ());
+    QCOMPARE (status, quint8 (QueryServer::Ok));
+}
+
+void QueryServerTest::test_pipelined ()
+{
+    // Both requests arrive together, and one of them split across writes, yet they are answered in order
+    const QByteArray first = frame (QueryServer::ListNames, string ("A"));
+    const QByteArray second = frame (QueryServer::QueryPoint, numbers ({ 25, 25 }));
+
+    socket.write (first + second.left (5));
+    QVERIFY (socket.waitForBytesWritten (TIMEOUT));
+
+    socket.write (second.mid (5));
+
+    quint8 status;
+    QCOMPARE (names (readResponse (status)), QStringList ({ "Alpha" }));
+    QCOMPARE (names (readResponse (status)), QStringList ({ "Beta" }));
+}
+
+void QueryServerTest::test_malformedPayload ()
+{
+    quint8 status;
+
+    // A request that is well framed but can't be read is refused, and the connection stays open
+    exchange (frame (42), status);
+    QCOMPARE (status, quint8 (QueryServer::BadRequest));
+
+    exchange (frame (QueryServer::QueryPoint, numbers ({ 5 })), status);
+    QCOMPARE (status, quint8 (QueryServer::BadRequest));
+
+    exchange (frame (QueryServer::QueryBox, numbers ({ 5, 5, 20 })), status);
+    QCOMPARE (status, quint8 (QueryServer::BadRequest));
+
+    // A string longer than the rest of the request
+    exchange (frame (QueryServer::FetchRegion, string ("Alpha").left (4)), status);
+    QCOMPARE (status, quint8 (QueryServer::BadRequest));
+
+    exchange (frame (QueryServer::ListNames, QByteArray (1, '\0')), status);
+    QCOMPARE (status, quint8 (QueryServer::BadRequest));
+
+    QCOMPARE (names (exchange (frame (QueryServer::ListNames, string ("Al")), status)), QStringList ({ "Alpha" }));
+    QCOMPARE (socket.state (), QLocalSocket::ConnectedState);
+}
+
+void QueryServerTest::test_malformedFrame_data ()
+{
+    QTest::addColumn <quint32> ("size");
+
+    QTest::newRow ("empty") << quint32 (0);
+    QTest::newRow ("too large") << quint32 (64 * 1024 + 1);
+    QTest::newRow ("huge") << quint32 (0xFFFFFFFF);
+}
+
+void QueryServerTest::test_malformedFrame ()
+{
+    QFETCH (quint32, size);
+
+    // The rest of the stream can't be framed, so the request is refused and the client disconnected
+    QByteArray request (4, '\0');
+    qToLittleEndian (size, request.data ());
+    socket.write (request + QByteArray (16, '\1'));
+
+    quint8 status;
+    readResponse (status);
+    QCOMPARE (status, quint8 (QueryServer::BadRequest));
+
+    if (socket.state () != QLocalSocket::UnconnectedState)
+        QVERIFY (socket.waitForDisconnected (TIMEOUT));
+}
+
+void QueryServerTest::test_publish ()
+{
+    // Requests are answered from the snapshot last published, until the next one
+    collection.add (QString ("Alps"));
+    collection.get ("Alps")->get () = QPolygonF ({ QPointF (2, 2), QPointF (4, 2), QPointF (4, 4) });
+    collection.markDirty ("Alps");
+
+    quint8 status;
+    QCOMPARE (names (exchange (frame (QueryServer::ListNames, string ("Al")), status)), QStringList ({ "Alpha" }));
+
+    server.publish (collection);
+    QCOMPARE (names (exchange (frame (QueryServer::ListNames, string ("Al")), status)), QStringList ({ "Alpha", "Alps" }));
+    QCOMPARE (names (exchange (frame (QueryServer::QueryPoint, numbers ({ 3.5, 2.5 })), status)),
+        QStringList ({ "Alpha", "Alps" }));
+}
+
+QByteArray QueryServerTest::exchange (const QByteArray &request, quint8 &status)
+{
+    socket.write (request);
+    return readResponse (status);
+}
+
+QByteArray QueryServerTest::readResponse (quint8 &status)
+{
+    status = 0xFF;
+
+    while (socket.bytesAvailable () < 4)
+    {
+        if (!socket.waitForReadyRead (TIMEOUT))
+            return QByteArray ();
+    }
+
+    char header [4];
+    socket.peek (header, 4);
+
+    const quint32 size = qFromLittleEndian <quint32> (header);
+    while (socket.bytesAvailable () < 4 + size)
+    {
+        if (!socket.waitForReadyRead (TIMEOUT))
+            return QByteArray ();
+    }
+
+    socket.read (header, 4);
+    const QByteArray response = socket.read (size);
+
+    status = static_cast <quint8> (response.at (0));
+    return response.mid (1);
+}
+
+QByteArray QueryServerTest::frame (const quint8 opcode, const QByteArray &payload)
+{
+    QByteArray request;
+    QDataStream out (&request, QIODevice::WriteOnly);
+    out.setByteOrder (QDataStream::LittleEndian);
+
+    out << static_cast <quint32> (payload.size () + 1) << opcode;
+    out.writeRawData (payload.constData (), payload.size ());
+
+    return request;
+}
+
+QByteArray QueryServerTest::string (const QString &string)
+{
+    const QByteArray bytes = string.toUtf8 ();
+
+    QByteArray payload;
+    QDataStream out (&payload, QIODevice::WriteOnly);
+    out.setByteOrder (QDataStream::LittleEndian);
+
+    out << static_cast <quint16> (bytes.size ());
+    out.writeRawData (bytes.constData (), bytes.size ());
+
+    return payload;
+}
+
+QByteArray QueryServerTest::numbers (const QVector <double> &values)
+{
+    QByteArray payload;
+    QDataStream out (&payload, QIODevice::WriteOnly);
+    out.setByteOrder (QDataStream::LittleEndian);
+
+    for (const double value : values)
+        out << value;
+
+    return payload;
+}
+
+QStringList QueryServerTest::names (const QByteArray &payload)
+{
+    QDataStream in (payload);
+    in.setByteOrder (QDataStream::LittleEndian);
+
+    quint32 count = 0;
+    in >> count;
+
+    QStringList names;
+    for (quint32 i = 0; i < count && in.status () == QDataStream::Ok; i++)
+    {
+        quint16 length;
+        in >> length;
+
+        QByteArray bytes (length, '\0');
+        in.readRawData (bytes.data (), length);
+        names.append (QString::fromUtf8 (bytes));
+    }
+
+    return names;
+}
+
+QTEST_GUILESS_MAIN(QueryServerTest)
+#include "tst_queryservertest.moc"
@@ -1,4 +1,4 @@
-QT += gui testlib
+QT += gui concurrent testlib
 CONFIG += c++17
 
 CONFIG += qt console warn_on depend_includepath testcase
@@ -6,5 +6,24 @@ CONFIG -= app_bundle
 
 TEMPLATE = app
 
-INCLUDEPATH += ../../VertexEditor/Utilities
-SOURCES +=  tst_vertexdatasetcollectiontest.cpp ../../VertexEditor/Utilities/VertexDataSetCollection.cpp
+INCLUDEPATH += ../.. ../../VertexEditor/Utilities
+HEADERS += ../../VertexEditor/DataSetListModel.h
+SOURCES +=  tst_vertexdatasetcollectiontest.cpp ../../Root/Utils.cpp ../../VertexEditor/Utilities/VertexDataSetCollection.cpp \
+    ../../VertexEditor/DataSetListModel.cpp \
+    ../../VertexEditor/Utilities/BoundingVolumes.cpp \
+    ../../VertexEditor/Utilities/DataSetNameIndex.cpp \
+    ../../VertexEditor/Utilities/DataSetRTree.cpp \
+    ../../VertexEditor/Utilities/DistanceField.cpp \
+    ../../VertexEditor/Utilities/HeaderExporter.cpp \
+    ../../VertexEditor/Utilities/OverlapDetector.cpp \
+    ../../VertexEditor/Utilities/ProjectFile.cpp \
+    ../../VertexEditor/Utilities/RegionCleaner.cpp \
+    ../../VertexEditor/Utilities/RegionClipper.cpp \
+    ../../VertexEditor/Utilities/RegionGeometry.cpp \
+    ../../VertexEditor/Utilities/RegionImporter.cpp \
+    ../../VertexEditor/Utilities/RegionRasterizer.cpp \
+    ../../VertexEditor/Utilities/RegionSlabIndex.cpp \
+    ../../VertexEditor/Utilities/RegionSpatialIndex.cpp \
+    ../../VertexEditor/Utilities/SpriteSheet.cpp \
+    ../../VertexEditor/Utilities/VertexAttributes.cpp \
+    ../../VertexEditor/Utilities/VertexTransform.cpp
@@ -1,11 +1,43 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <functional>
 #include <optional>
 
+#include <QAbstractItemModelTester>
+#include <QByteArray>
+#include <QDataStream>
+#include <QDir>
+#include <QFile>
+#include <QImage>
+#include <QPainterPath>
+#include <QPointF>
 #include <QPolygonF>
+#include <QProcess>
+#include <QRect>
+#include <QRectF>
 #include <QString>
+#include <QStringList>
+#include <QTemporaryDir>
+#include <QVector>
 #include <QtTest>
 
+#include "BoundingVolumes.h"
+#include "DataSetNameIndex.h"
+#include "DistanceField.h"
+#include "HeaderExporter.h"
+#include "OverlapDetector.h"
+#include "ProjectFile.h"
+#include "RegionCleaner.h"
+#include "RegionClipper.h"
+#include "RegionImporter.h"
+#include "RegionRasterizer.h"
+#include "RegionSpatialIndex.h"
+#include "SpriteSheet.h"
+#include "VertexAttributes.h"
 #include "VertexDataSetCollection.h"
+#include "VertexEditor/DataSetListModel.h"
+#include "VertexTransform.h"
 
 class VertexDataSetCollectionTest : public QObject
 {
@@ -20,8 +52,33 @@ class VertexDataSetCollectionTest : public QObject
         void test_contains ();
         void test_remove ();
         void test_add ();
+        void test_addAll ();
+        void test_insertAll ();
         void test_length ();
         void test_get ();
+        void test_indexOf ();
+        void test_removeAt ();
+        void test_removeAll ();
+        void test_clearAll ();
+        void test_dataSetNameIndex ();
+        void test_dataSetListModel ();
+        void test_dirtyTracking ();
+        void test_geometry ();
+        void test_pathCache ();
+        void test_regionsAt ();
+        void test_regionClipper ();
+        void test_overlapDetector ();
+        void test_distanceField ();
+        void test_boundingVolumes ();
+        void test_regionCleaner ();
+        void test_spriteSheet ();
+        void test_regionImporter ();
+        void test_projectFile ();
+        void test_headerExporter ();
+        void test_vertexAttributes ();
+        void test_vertexTransform ();
+        void test_regionSpatialIndex ();
+        void test_regionRasterizer ();
 };
 
 void VertexDataSetCollectionTest::init ()
@@ -61,6 +118,49 @@ void VertexDataSetCollectionTest::test_add ()
     QCOMPARE (collection.length (), 2);
 }
 
+void VertexDataSetCollectionTest::test_addAll ()
+{
+    collection.add (QString ("B"));
+    collection.add (QString ("D"));
+
+    const QStringList conflicts = collection.addAll ({ "E", "C", "B", "A", "C", "C" });
+    QCOMPARE (conflicts, QStringList ({ "B", "C" }));
+    QCOMPARE (collection.length (), 5);
+
+    const QStringList expected = { "A", "B", "C", "D", "E" };
+    for (int i = 0; i < expected.size (); i++)
+        QCOMPARE (collection.at (i).name, expected.at (i));
+
+    QVERIFY (collection.addAll ({}).isEmpty ());
+    QCOMPARE (collection.length (), 5);
+}
+
+void VertexDataSetCollectionTest::test_insertAll ()
+{
+    using Aerodlyn::VertexDataSet;
+
+    collection.add (QString ("B"));
+    collection.markClean ();
+
+    const QPolygonF triangle ({ QPointF (0, 0), QPointF (4, 0), QPointF (0, 4) });
+    const QStringList conflicts = collection.insertAll ({ { "C", triangle }, { "B", triangle },
+        { "A", QPolygonF () }, { "C", QPolygonF () } });
+
+    QCOMPARE (conflicts, QStringList ({ "B", "C" }));
+    QCOMPARE (collection.length (), 3);
+
+    // The first of the data sets sharing a name is the one added, and an existing one is kept
+    QCOMPARE (collection.at (0).name, QString ("A"));
+    QCOMPARE (collection.at (1).region, QPolygonF ());
+    QCOMPARE (collection.at (2).region, triangle);
+
+    QVERIFY (collection.isDirty (0));
+    QVERIFY (!collection.isDirty (1));
+    QVERIFY (collection.isDirty (2));
+
+    QCOMPARE (collection.regionsAt (QPointF (1, 1)), QStringList ({ "C" }));
+}
+
 void VertexDataSetCollectionTest::test_length ()
 {
     for (int i = 0; i < 100; i++)
@@ -84,5 +184,1117 @@ void VertexDataSetCollectionTest::test_get ()
     QVERIFY (!value.has_value ());
 }
 
+void VertexDataSetCollectionTest::test_indexOf ()
+{
+    for (int i = 0; i < 100; i++)
+        collection.add (QString::number (i));
+
+    QCOMPARE (collection.indexOf (QString ("0")), 0);
+    QCOMPARE (collection.indexOf (QString ("99")), 99);
+    QCOMPARE (collection.indexOf (QString ("100")), -1);
+    QCOMPARE (collection.at (collection.indexOf (QString ("50"))).name, QString ("50"));
+
+    QCOMPARE (collection.insertionIndex (QString ("100")), collection.indexOf (QString ("11")));
+    QCOMPARE (collection.add (QString ("100")), collection.indexOf (QString ("100")));
+}
+
+void VertexDataSetCollectionTest::test_removeAt ()
+{
+    collection.add (QString ("A"));
+    collection.add (QString ("B"));
+    collection.add (QString ("C"));
+
+    QVERIFY (!collection.removeAt (3));
+    QVERIFY (!collection.removeAt (-1));
+    QVERIFY (collection.removeAt (1));
+    QCOMPARE (collection.length (), 2);
+    QVERIFY (!collection.contains (QString ("B")));
+    QCOMPARE (collection.indexOf (QString ("C")), 1);
+}
+
+void VertexDataSetCollectionTest::test_removeAll ()
+{
+    for (int i = 0; i < 10; i++)
+        collection.add (QString::number (i));
+
+    collection.removeAll ();
+    QCOMPARE (collection.length (), 0);
+    QVERIFY (!collection.contains (QString ("5")));
+}
+
+void VertexDataSetCollectionTest::test_clearAll ()
+{
+    collection.add (QString ("A"));
+    collection.add (QString ("B"));
+    collection.get (QString ("A"))->get ().append (QPointF (1, 2));
+    collection.get (QString ("B"))->get ().append (QPointF (3, 4));
+
+    collection.clearAll ();
+    QCOMPARE (collection.length (), 2);
+    QVERIFY (collection.get (QString ("A"))->get ().isEmpty ());
+    QVERIFY (collection.get (QString ("B"))->get ().isEmpty ());
+}
+
+void VertexDataSetCollectionTest::test_dataSetNameIndex ()
+{
+    collection.addAll ({ "Player Hitbox", "player_feet", "Enemy", "Ground" });
+
+    // The indices of the given data sets in the collection, in ascending order
+    const auto indicesOf = [this] (const QStringList &names)
+    {
+        QVector <int> indices;
+        for (const QString &name : names)
+            indices.append (collection.indexOf (name));
+
+        std::sort (indices.begin (), indices.end ());
+        return indices;
+    };
+
+    Aerodlyn::DataSetNameIndex index;
+    index.rebuild (collection);
+
+    QCOMPARE (index.findPrefix ("PLAYER"), indicesOf ({ "Player Hitbox", "player_feet" }));
+    QCOMPARE (index.findPrefix ("gr"), indicesOf ({ "Ground" }));
+    QVERIFY (index.findPrefix ("x").isEmpty ());
+    QCOMPARE (index.findSubstring ("HIT"), indicesOf ({ "Player Hitbox" }));
+    QCOMPARE (index.findSubstring ("ay"), indicesOf ({ "Player Hitbox", "player_feet" }));
+    QVERIFY (index.findSubstring ("xyz").isEmpty ());
+
+    // Adding a data set shifts the indices of the ones after it
+    collection.add (QString ("Layer"));
+    index.rebuild (collection);
+
+    QCOMPARE (index.findSubstring ("aye"), indicesOf ({ "Layer", "Player Hitbox", "player_feet" }));
+    QCOMPARE (index.findPrefix ("l"), indicesOf ({ "Layer" }));
+
+    // As does removing one
+    QVERIFY (collection.remove (QString ("Enemy")));
+    index.rebuild (collection);
+
+    QCOMPARE (index.findPrefix ("player"), indicesOf ({ "Player Hitbox", "player_feet" }));
+    QVERIFY (index.findSubstring ("nem").isEmpty ());
+
+    // Data sets are renamed by removing them and adding them again under the new name
+    QVERIFY (collection.remove (QString ("Ground")));
+    collection.add (QString ("Playground"));
+    index.rebuild (collection);
+
+    QVERIFY (index.findPrefix ("ground").isEmpty ());
+    QCOMPARE (index.findSubstring ("ground"), indicesOf ({ "Playground" }));
+    QCOMPARE (index.findPrefix ("play"), indicesOf ({ "Player Hitbox", "player_feet", "Playground" }));
+}
+
+void VertexDataSetCollectionTest::test_dataSetListModel ()
+{
+    Aerodlyn::DataSetListModel model (collection);
+    QAbstractItemModelTester tester (&model);
+
+    QCOMPARE (model.add ("Beta"), 0);
+    QCOMPARE (model.add ("Alpha"), 0);
+    QCOMPARE (model.add ("Alpha"), -1);
+    model.addAll ({ "Gamma", "Alphabet" });
+
+    // Without a filter, rows are the indices of the data sets in the collection
+    QCOMPARE (model.rowCount (), 4);
+    QCOMPARE (model.nameAt (0), QString ("Alpha"));
+    QCOMPARE (model.data (model.index (1)).toString (), QString ("Alphabet"));
+    QCOMPARE (model.rowOf ("Gamma"), 3);
+    QCOMPARE (model.rowOf ("Delta"), -1);
+    QVERIFY (model.nameAt (-1).isEmpty ());
+    QVERIFY (model.nameAt (4).isEmpty ());
+
+    // Filtered, rows only count the matching data sets
+    model.setFilter ("ALPHA");
+    QCOMPARE (model.rowCount (), 2);
+    QCOMPARE (model.nameAt (1), QString ("Alphabet"));
+    QCOMPARE (model.rowOf ("Alphabet"), 1);
+    QCOMPARE (model.rowOf ("Beta"), -1);
+
+    QVERIFY (model.add ("Alphanumeric") >= 0);
+    QVERIFY (model.add ("Delta") >= 0);
+    QCOMPARE (model.rowCount (), 3);
+    QCOMPARE (model.rowOf ("Alphanumeric"), 2);
+    QCOMPARE (model.rowOf ("Delta"), -1);
+
+    // Removing a data set shifts the rows after it
+    QVERIFY (model.removeDataSet (model.rowOf ("Alphabet")));
+    QVERIFY (!model.removeDataSet (2));
+    QVERIFY (!collection.contains (QString ("Alphabet")));
+    QCOMPARE (model.rowCount (), 2);
+    QCOMPARE (model.nameAt (1), QString ("Alphanumeric"));
+
+    // A data set renamed outside of the model shows up under its new name once it is reloaded
+    QVERIFY (collection.remove (QString ("Gamma")));
+    collection.add (QString ("Alpha Gamma"));
+    model.reload ();
+
+    QCOMPARE (model.rowCount (), 3);
+    QCOMPARE (model.rowOf ("Alpha Gamma"), 1);
+    QCOMPARE (model.rowOf ("Gamma"), -1);
+
+    model.setFilter ("^alphan");
+    QCOMPARE (model.rowCount (), 1);
+    QCOMPARE (model.nameAt (0), QString ("Alphanumeric"));
+
+    // Clearing the filter shows every data set in the order of the collection again
+    model.setFilter (QString ());
+    QCOMPARE (model.rowCount (), collection.length ());
+    for (int i = 0; i < collection.length (); i++)
+        QCOMPARE (model.rowOf (collection.at (i).name), i);
+}
+
+void VertexDataSetCollectionTest::test_dirtyTracking ()
+{
+    collection.add (QString ("A"));
+    collection.add (QString ("B"));
+    QVERIFY (collection.hasChanges ());
+    QVERIFY (collection.isDirty (0));
+
+    collection.markClean ();
+    QVERIFY (!collection.hasChanges ());
+    QVERIFY (!collection.isDirty (0) && !collection.isDirty (1));
+
+    QVERIFY (collection.markDirty (QString ("B")));
+    QVERIFY (!collection.markDirty (QString ("C")));
+    QVERIFY (!collection.isDirty (0));
+    QVERIFY (collection.isDirty (1));
+
+    collection.markClean ();
+    QVERIFY (collection.remove (QString ("A")));
+    QVERIFY (collection.hasChanges ());
+    QCOMPARE (collection.removedNames (), QStringList ({ "A" }));
+
+    // Clearing an empty region changes nothing
+    collection.markClean ();
+    collection.clearAll ();
+    QVERIFY (!collection.hasChanges ());
+}
+
+void VertexDataSetCollectionTest::test_geometry ()
+{
+    collection.add (QString ("Test"));
+    collection.get (QString ("Test"))->get () << QPointF (0, 0) << QPointF (4, 0) << QPointF (4, 2) << QPointF (0, 2);
+    collection.markDirty (QString ("Test"));
+
+    const Aerodlyn::RegionGeometry &geometry = collection.geometryAt (0);
+    QCOMPARE (geometry.bounds (), QRectF (0, 0, 4, 2));
+    QCOMPARE (geometry.area (), 8.0);
+    QCOMPARE (geometry.perimeter (), 12.0);
+    QCOMPARE (geometry.centroid (), QPointF (2, 1));
+    QCOMPARE (geometry.winding (), Aerodlyn::RegionGeometry::Winding::Clockwise);
+
+    // Moving a vertex updates the cached values without recomputing them
+    QVERIFY (collection.movePoint (QString ("Test"), 2, QPointF (8, 2)));
+    QVERIFY (!collection.movePoint (QString ("Test"), 4, QPointF (8, 2)));
+    QCOMPARE (collection.geometryAt (0).bounds (), QRectF (0, 0, 8, 2));
+    QCOMPARE (collection.geometryAt (0).area (), 12.0);
+
+    Aerodlyn::RegionGeometry reference;
+    reference.update (collection.get (QString ("Test"))->get ());
+    QCOMPARE (collection.geometryAt (0).centroid (), reference.centroid ());
+    QCOMPARE (collection.geometryAt (0).perimeter (), reference.perimeter ());
+
+    // Moving a vertex on the edge of the bounds back inside shrinks them
+    QVERIFY (collection.movePoint (QString ("Test"), 2, QPointF (3, 1)));
+    QCOMPARE (collection.geometryAt (0).bounds (), QRectF (0, 0, 4, 2));
+
+    // Moving a vertex from inside of the bounds to beyond them grows them
+    QPolygonF notch ({ QPointF (0, 0), QPointF (4, 0), QPointF (4, 4), QPointF (2, 2), QPointF (0, 4) });
+    Aerodlyn::RegionGeometry grown;
+    grown.update (notch);
+
+    const QPointF from = notch.at (3);
+    notch [3] = QPointF (2, 6);
+    grown.moveVertex (notch, 3, from);
+
+    QCOMPARE (grown.bounds (), QRectF (0, 0, 4, 6));
+}
+
+void VertexDataSetCollectionTest::test_pathCache ()
+{
+    collection.add (QString ("Test"));
+    collection.get (QString ("Test"))->get () << QPointF (0, 0) << QPointF (4, 0) << QPointF (4, 2) << QPointF (0, 2);
+    collection.markDirty (QString ("Test"));
+
+    // The path closes with an explicit line back to the first vertex
+    const QPainterPath &path = collection.pathAt (0);
+    QCOMPARE (path.elementCount (), 5);
+    QCOMPARE (QPointF (path.elementAt (2)), QPointF (4, 2));
+    QCOMPARE (QPointF (path.elementAt (4)), QPointF (0, 0));
+
+    // Moving a vertex patches the cached path along with the other values, moving the closing element
+    //  along with the first vertex
+    collection.geometryAt (0);
+    QVERIFY (collection.movePoint (QString ("Test"), 2, QPointF (5, 3)));
+    QCOMPARE (QPointF (collection.pathAt (0).elementAt (2)), QPointF (5, 3));
+
+    QVERIFY (collection.movePoint (QString ("Test"), 0, QPointF (-1, -1)));
+    QCOMPARE (collection.pathAt (0).elementCount (), 5);
+    QCOMPARE (QPointF (collection.pathAt (0).elementAt (0)), QPointF (-1, -1));
+    QCOMPARE (QPointF (collection.pathAt (0).elementAt (4)), QPointF (-1, -1));
+
+    // Inserting a vertex rebuilds the path through it
+    QVERIFY (collection.insertPoint (QString ("Test"), 1, QPointF (2, -2)));
+    QCOMPARE (collection.pathAt (0).elementCount (), 6);
+    QCOMPARE (QPointF (collection.pathAt (0).elementAt (1)), QPointF (2, -2));
+    QCOMPARE (QPointF (collection.pathAt (0).elementAt (2)), QPointF (4, 0));
+
+    // A path built before the other values isn't left going through the old position
+    QPolygonF region ({ QPointF (0, 0), QPointF (4, 0), QPointF (4, 2) });
+    Aerodlyn::RegionGeometry pathOnly;
+    pathOnly.path (region);
+
+    const QPointF from = region.at (1);
+    region [1] = QPointF (6, 0);
+    pathOnly.moveVertex (region, 1, from);
+    QCOMPARE (QPointF (pathOnly.path (region).elementAt (1)), QPointF (6, 0));
+}
+
+void VertexDataSetCollectionTest::test_regionsAt ()
+{
+    collection.addAll ({ "A", "B", "Empty" });
+    collection.get (QString ("A"))->get () << QPointF (0, 0) << QPointF (4, 0) << QPointF (4, 4) << QPointF (0, 4);
+    collection.get (QString ("B"))->get () << QPointF (2, 2) << QPointF (6, 2) << QPointF (6, 6) << QPointF (2, 6);
+    collection.markDirty (QString ("A"));
+    collection.markDirty (QString ("B"));
+
+    QCOMPARE (collection.regionsAt (QPointF (1, 1)), QStringList ({ "A" }));
+    QCOMPARE (collection.regionsAt (QPointF (3, 3)), QStringList ({ "A", "B" }));
+    QCOMPARE (collection.regionsAt (QPointF (8, 8)), QStringList ());
+    QCOMPARE (collection.regionsIn (QRectF (5, 5, 1, 1)), QStringList ({ "B" }));
+
+    // The index follows edits made after it was built
+    QVERIFY (collection.movePoint (QString ("B"), 2, QPointF (10, 10)));
+    QCOMPARE (collection.regionsAt (QPointF (7, 7)), QStringList ({ "B" }));
+
+    QVERIFY (collection.remove (QString ("A")));
+    QCOMPARE (collection.regionsAt (QPointF (3, 3)), QStringList ({ "B" }));
+
+    collection.get (QString ("Empty"))->get () << QPointF (20, 20) << QPointF (24, 20) << QPointF (22, 24);
+    collection.markDirty (QString ("Empty"));
+    QCOMPARE (collection.regionsAt (QPointF (22, 21)), QStringList ({ "Empty" }));
+
+    // Regions with many vertices are tested against their slabs, which must agree with Qt
+    collection.add (QString ("Star"));
+    QPolygonF &star = collection.get (QString ("Star"))->get ();
+    for (int i = 0; i < 64; i++)
+    {
+        const double angle = i * M_PI / 32.0, radius = i % 2 == 0 ? 10.0 : 4.0;
+        star << QPointF (40 + radius * std::cos (angle), 40 + radius * std::sin (angle));
+    }
+
+    collection.markDirty (QString ("Star"));
+    QVERIFY (collection.movePoint (QString ("Star"), 0, QPointF (60, 41)));
+
+    const int index = collection.indexOf (QString ("Star"));
+    for (double y = 28.5; y < 52; y += 1.0)
+    {
+        for (double x = 28.5; x < 62; x += 1.0)
+        {
+            const QPointF point (x, y);
+            QCOMPARE (collection.containsPoint (index, point), collection.at (index).region.containsPoint (point, Qt::OddEvenFill));
+        }
+    }
+}
+
+void VertexDataSetCollectionTest::test_regionClipper ()
+{
+    using Aerodlyn::RegionClipper;
+
+    const QPolygonF a ({ QPointF (0, 0), QPointF (4, 0), QPointF (4, 4), QPointF (0, 4) });
+    const QPolygonF b ({ QPointF (2, 2), QPointF (6, 2), QPointF (6, 6), QPointF (2, 6) });
+
+    const auto areaOf = [] (const QPolygonF &region)
+    {
+        Aerodlyn::RegionGeometry geometry;
+        geometry.update (region);
+        return geometry.area ();
+    };
+
+    QCOMPARE (areaOf (RegionClipper::merge (RegionClipper::clip (a, b, RegionClipper::Operation::Union))), 28.0);
+    QCOMPARE (areaOf (RegionClipper::merge (RegionClipper::clip (a, b, RegionClipper::Operation::Intersection))), 4.0);
+    QCOMPARE (areaOf (RegionClipper::merge (RegionClipper::clip (a, b, RegionClipper::Operation::Difference))), 12.0);
+
+    const QPolygonF exclusive = RegionClipper::merge (RegionClipper::clip (a, b, RegionClipper::Operation::Xor));
+    QVERIFY (exclusive.containsPoint (QPointF (1, 1), Qt::OddEvenFill));
+    QVERIFY (!exclusive.containsPoint (QPointF (3, 3), Qt::OddEvenFill));
+    QVERIFY (exclusive.containsPoint (QPointF (5, 5), Qt::OddEvenFill));
+
+    // A hole is joined to the outline by a bridge, and stays empty
+    const QPolygonF hole ({ QPointF (1, 1), QPointF (3, 1), QPointF (3, 3), QPointF (1, 3) });
+    const QPolygonF ring = RegionClipper::merge (RegionClipper::clip (a, hole, RegionClipper::Operation::Difference));
+    QVERIFY (!ring.containsPoint (QPointF (2, 2), Qt::OddEvenFill));
+    QVERIFY (ring.containsPoint (QPointF (0.5, 2), Qt::OddEvenFill));
+    QVERIFY (ring.containsPoint (QPointF (3.5, 3.5), Qt::OddEvenFill));
+
+    // Regions that share an edge merge along it
+    const QPolygonF adjacent ({ QPointF (4, 0), QPointF (8, 0), QPointF (8, 4), QPointF (4, 4) });
+    QCOMPARE (areaOf (RegionClipper::merge (RegionClipper::clip (a, adjacent, RegionClipper::Operation::Union))), 32.0);
+    QVERIFY (RegionClipper::clip (a, adjacent, RegionClipper::Operation::Intersection).isEmpty ());
+
+    // Regions that share part of an edge, or only a vertex, touch without overlapping, which must
+    //  still hold once their edges aren't axis aligned and their vertices are rounded
+    const QPolygonF beside ({ QPointF (4, 1), QPointF (8, 1), QPointF (8, 3), QPointF (4, 3) });
+    const QPolygonF corner ({ QPointF (4, 4), QPointF (6, 4), QPointF (6, 6), QPointF (4, 6) });
+    const QPolygonF notch  ({ QPointF (4, 2), QPointF (6, 0), QPointF (6, 4) });
+
+    const auto rotated = [] (const QPolygonF &region, const double angle)
+    {
+        QPolygonF result;
+        for (const QPointF &point : region)
+            result << QPointF (point.x () * std::cos (angle) - point.y () * std::sin (angle),
+                               point.x () * std::sin (angle) + point.y () * std::cos (angle));
+
+        return result;
+    };
+
+    const auto clippedArea = [&areaOf] (const QPolygonF &subject, const QPolygonF &clipping,
+        const RegionClipper::Operation operation)
+        { return areaOf (RegionClipper::merge (RegionClipper::clip (subject, clipping, operation))); };
+
+    for (const double angle : { 0.0, 0.3, M_PI / 4.0, M_PI / 2.0, M_PI })
+    {
+        const QPolygonF square     = rotated (a, angle);
+        const QPolygonF overlap    = rotated (b, angle);
+        const QPolygonF edge       = rotated (adjacent, angle);
+        const QPolygonF partOfEdge = rotated (beside, angle);
+        const QPolygonF vertex     = rotated (corner, angle);
+        const QPolygonF onEdge     = rotated (notch, angle);
+
+        QCOMPARE (clippedArea (square, overlap, RegionClipper::Operation::Intersection), 4.0);
+        QCOMPARE (clippedArea (square, edge, RegionClipper::Operation::Union), 32.0);
+        QVERIFY (RegionClipper::clip (square, edge, RegionClipper::Operation::Intersection).isEmpty ());
+
+        QCOMPARE (clippedArea (square, partOfEdge, RegionClipper::Operation::Union), 24.0);
+        QCOMPARE (clippedArea (square, partOfEdge, RegionClipper::Operation::Difference), 16.0);
+        QCOMPARE (clippedArea (partOfEdge, square, RegionClipper::Operation::Difference), 8.0);
+        QVERIFY (RegionClipper::clip (square, partOfEdge, RegionClipper::Operation::Intersection).isEmpty ());
+
+        QCOMPARE (clippedArea (square, vertex, RegionClipper::Operation::Difference), 16.0);
+        QVERIFY (RegionClipper::clip (square, vertex, RegionClipper::Operation::Intersection).isEmpty ());
+
+        QCOMPARE (clippedArea (square, onEdge, RegionClipper::Operation::Difference), 16.0);
+        QVERIFY (RegionClipper::clip (square, onEdge, RegionClipper::Operation::Intersection).isEmpty ());
+    }
+
+    // Regions without area enclose nothing
+    QVERIFY (RegionClipper::clip (a, QPolygonF (), RegionClipper::Operation::Intersection).isEmpty ());
+    QCOMPARE (RegionClipper::clip (a, QPolygonF (), RegionClipper::Operation::Union), QVector <QPolygonF> ({ a }));
+}
+
+void VertexDataSetCollectionTest::test_overlapDetector ()
+{
+    using Aerodlyn::OverlapDetector;
+
+    const QPolygonF a ({ QPointF (0, 0), QPointF (4, 0), QPointF (4, 4), QPointF (0, 4) });
+
+    // Crossing edges, containment and identical regions all overlap
+    QVERIFY (OverlapDetector::overlaps (a, QPolygonF ({ QPointF (2, 2), QPointF (6, 2), QPointF (6, 6), QPointF (2, 6) })));
+    QVERIFY (OverlapDetector::overlaps (a, QPolygonF ({ QPointF (1, 1), QPointF (3, 1), QPointF (3, 3), QPointF (1, 3) })));
+    QVERIFY (OverlapDetector::overlaps (a, a));
+
+    // Regions that only touch along an edge or at a vertex don't
+    QVERIFY (!OverlapDetector::overlaps (a, QPolygonF ({ QPointF (4, 0), QPointF (8, 0), QPointF (8, 4), QPointF (4, 4) })));
+    QVERIFY (!OverlapDetector::overlaps (a, QPolygonF ({ QPointF (4, 4), QPointF (6, 4), QPointF (6, 6), QPointF (4, 6) })));
+    QVERIFY (!OverlapDetector::overlaps (a, QPolygonF ({ QPointF (4, 2), QPointF (6, 0), QPointF (6, 4) })));
+
+    // B is beside A, C overlaps A and B, and D has no area
+    const QStringList names ({ "A", "B", "C", "D" });
+    collection.addAll (names);
+
+    collection.get (QString ("A"))->get () = a;
+    collection.get (QString ("B"))->get () = QPolygonF ({ QPointF (4, 0), QPointF (8, 0), QPointF (8, 4), QPointF (4, 4) });
+    collection.get (QString ("C"))->get () = QPolygonF ({ QPointF (3, 3), QPointF (5, 3), QPointF (5, 5), QPointF (3, 5) });
+    collection.get (QString ("D"))->get () = QPolygonF ({ QPointF (0, 0), QPointF (8, 0) });
+
+    for (const QString &name : names)
+        collection.markDirty (name);
+
+    const QVector <QPair <QString, QString>> expected ({ qMakePair (QString ("A"), QString ("C")),
+        qMakePair (QString ("B"), QString ("C")) });
+    QCOMPARE (OverlapDetector::findOverlaps (collection), expected);
+}
+
+void VertexDataSetCollectionTest::test_distanceField ()
+{
+    using Aerodlyn::DistanceField;
+
+    // A 4x4 square in the middle of a 10x10 field covers the pixels from 3 to 6
+    const QPolygonF square ({ QPointF (-2, -2), QPointF (2, -2), QPointF (2, 2), QPointF (-2, 2) });
+    const DistanceField::Field field = DistanceField::generate (square, QSize (10, 10), QPointF (5, 5), 1.0);
+
+    QCOMPARE (field.width, 10);
+    QCOMPARE (field.distances.size (), 100);
+
+    const auto at = [&field] (const int x, const int y) { return field.distances.at (y * field.width + x); };
+
+    QCOMPARE (at (3, 5), -0.5f);
+    QCOMPARE (at (4, 5), -1.5f);
+    QCOMPARE (at (2, 5), 0.5f);
+    QCOMPARE (at (0, 5), 2.5f);
+    QCOMPARE (at (0, 0), static_cast <float> (std::sqrt (18.0) - 0.5));
+
+    // Distances are in the units of the region at any resolution
+    const DistanceField::Field fine = DistanceField::generate (square, QSize (20, 20), QPointF (10, 10), 2.0);
+    QCOMPARE (fine.distances.at (10 * fine.width + 1), 2.25f);
+
+    // Without an edge in the field, every pixel is as far as the diagonal of the field
+    const DistanceField::Field empty = DistanceField::generate (QPolygonF (), QSize (6, 8), QPointF (3, 4), 2.0);
+    QCOMPARE (empty.distances.at (0), 5.0f);
+    QCOMPARE (empty.distances.at (47), 5.0f);
+
+    const DistanceField::Field covered = DistanceField::generate (square, QSize (2, 2), QPointF (1, 1), 1.0);
+    QCOMPARE (covered.distances.at (0), static_cast <float> (-std::sqrt (8.0)));
+
+    QVERIFY (DistanceField::generate (square, QSize (10, 10), QPointF (5, 5), 0.0).distances.isEmpty ());
+
+    const QImage image = DistanceField::toImage (field, 2.5);
+    QCOMPARE (qGray (image.pixel (0, 5)), 0);
+    QVERIFY (qGray (image.pixel (4, 5)) > 128);
+}
+
+void VertexDataSetCollectionTest::test_boundingVolumes ()
+{
+    using Aerodlyn::BoundingVolumes;
+
+    // A diamond with a notch, whose notch isn't on the hull
+    collection.add (QString ("Diamond"));
+    collection.get ("Diamond")->get () = QPolygonF ({ QPointF (0, -2), QPointF (2, 0), QPointF (0, 2), QPointF (0, 1),
+                                                       QPointF (-2, 0) });
+
+    collection.updateVolumes ();
+    const BoundingVolumes::Volumes &volumes = collection.volumesAt (0);
+
+    QCOMPARE (volumes.hull.size (), 4);
+    QVERIFY (!volumes.hull.contains (QPointF (0, 1)));
+    QCOMPARE (volumes.box, QRectF (-2, -2, 4, 4));
+
+    // The box of least area is turned to lie along the sides of the diamond
+    QCOMPARE (volumes.orientedBox.size.width () * volumes.orientedBox.size.height (), 8.0);
+    QCOMPARE (std::abs (std::cos (2.0 * volumes.orientedBox.angle)) + 1.0, 1.0);
+    QCOMPARE (volumes.orientedBox.center + QPointF (1, 1), QPointF (1, 1));
+
+    QCOMPARE (volumes.circle.center + QPointF (1, 1), QPointF (1, 1));
+    QCOMPARE (volumes.circle.radius, 2.0);
+
+    // Moving a vertex discards the cached shapes
+    QVERIFY (collection.movePoint ("Diamond", 0, QPointF (0, -4)));
+    QCOMPARE (collection.volumesAt (0).circle.center, QPointF (0, -1));
+    QCOMPARE (collection.volumesAt (0).circle.radius, 3.0);
+    QCOMPARE (collection.volumesAt (0).box, QRectF (-2, -4, 4, 6));
+
+    // Collinear points are enclosed by a flat box and the circle through the furthest two
+    const QPolygonF line ({ QPointF (0, 0), QPointF (1, 1), QPointF (3, 3) });
+    QCOMPARE (BoundingVolumes::convexHull (line), QPolygonF ({ QPointF (0, 0), QPointF (3, 3) }));
+    QCOMPARE (BoundingVolumes::compute (line).orientedBox.size.height (), 0.0);
+    QCOMPARE (BoundingVolumes::compute (line).circle.center, QPointF (1.5, 1.5));
+}
+
+void VertexDataSetCollectionTest::test_regionCleaner ()
+{
+    using Aerodlyn::RegionCleaner;
+    using Aerodlyn::RegionGeometry;
+
+    // A square going clockwise on screen, with a vertex along its top and another one next to a corner
+    collection.add (QString ("A"));
+    collection.get ("A")->get () = QPolygonF ({ QPointF (0, 0), QPointF (5, 0), QPointF (10, 0), QPointF (10, 10),
+                                                QPointF (10.4, 10.3), QPointF (0, 10) });
+
+    collection.add (QString ("B"));
+    collection.get ("B")->get () = QPolygonF ({ QPointF (0, 0), QPointF (0, 10), QPointF (10, 10), QPointF (10, 0) });
+
+    // Each vertex of A is tagged with its index, to follow it through the clean
+    Aerodlyn::VertexAttributes &attributes = collection.attributes ("A")->get ();
+    QVERIFY (attributes.addChannel ("Material", Aerodlyn::VertexAttributes::Type::Integer, 6));
+    QVERIFY (attributes.addChannel ("Normal", Aerodlyn::VertexAttributes::Type::Vector, 6));
+
+    for (int i = 0; i < 6; i++)
+    {
+        attributes.setValue (0, i, 10 * i);
+        attributes.setValue (1, i, i, 0);
+        attributes.setValue (1, i, i + 0.5, 1);
+    }
+
+    collection.markClean ();
+
+    const RegionCleaner::Summary summary = RegionCleaner::cleanAll (collection, 1.0,
+        RegionGeometry::Winding::CounterClockwise);
+
+    QCOMPARE (summary.mergedVertices, 1);
+    QCOMPARE (summary.collinearVertices, 1);
+    QCOMPARE (summary.reversedRegions, 1);
+    QCOMPARE (summary.changed, QStringList ({ "A" }));
+
+    // The first vertex stays first when a region is reversed
+    QCOMPARE (collection.at (0).region, QPolygonF ({ QPointF (0, 0), QPointF (0, 10), QPointF (10, 10), QPointF (10, 0) }));
+    QVERIFY (collection.isDirty (0));
+    QVERIFY (!collection.isDirty (1));
+
+    // The attributes follow their vertices through merging, removal and reversal, where the merged
+    //  vertex keeps those of the vertex it was merged into
+    QCOMPARE (collection.at (0).attributes.channel (0).integers, QVector <qint32> ({ 0, 50, 30, 20 }));
+    QCOMPARE (collection.at (0).attributes.channel (1).reals, QVector <float> ({ 0.0f, 0.5f, 5.0f, 5.5f, 3.0f, 3.5f,
+        2.0f, 2.5f }));
+
+    // Repeats and spikes folding straight back are removed even without merging
+    RegionCleaner::Summary spike;
+    QVector <int> sources;
+    const QPolygonF cleaned = RegionCleaner::clean (QPolygonF ({ QPointF (0, 0), QPointF (0, 0), QPointF (4, 0),
+        QPointF (8, 0), QPointF (6, 0), QPointF (4, 4) }), 0.0, RegionGeometry::Winding::None, spike, sources);
+
+    QCOMPARE (cleaned, QPolygonF ({ QPointF (0, 0), QPointF (6, 0), QPointF (4, 4) }));
+    QCOMPARE (sources, QVector <int> ({ 0, 4, 5 }));
+    QCOMPARE (spike.mergedVertices + spike.collinearVertices, 3);
+}
+
+void VertexDataSetCollectionTest::test_spriteSheet ()
+{
+    using Aerodlyn::SpriteSheet;
+
+    // Two frames side by side, each with a square sprite of a different size
+    QImage image (40, 20, QImage::Format_ARGB32);
+    image.fill (Qt::transparent);
+
+    for (int y = 0; y < 20; y++)
+    {
+        for (int x = 0; x < 40; x++)
+        {
+            if ((x >= 5 && x < 15 && y >= 5 && y < 15) || (x >= 24 && x < 36 && y >= 4 && y < 16))
+                image.setPixel (x, y, qRgba (0, 255, 0, 255));
+        }
+    }
+
+    const QVector <QRect> frames = SpriteSheet::gridFrames (image.size (), 2, 1);
+    QCOMPARE (frames, QVector <QRect> ({ QRect (0, 0, 20, 20), QRect (20, 0, 20, 20) }));
+    QCOMPARE (SpriteSheet::detectFrames (image), QVector <QRect> ({ QRect (5, 5, 10, 10), QRect (24, 4, 12, 12) }));
+
+    // Traced through the centers of the corner pixels of the first sprite
+    const QPointF origin (20, 10);
+    const QPolygonF region ({ QPointF (-14.5, -4.5), QPointF (-5.5, -4.5), QPointF (-5.5, 4.5), QPointF (-14.5, 4.5) });
+
+    QCOMPARE (SpriteSheet::frameAt (frames, region.boundingRect ().center () + origin), 0);
+
+    const QVector <QPolygonF> regions = SpriteSheet::propagate (region, image, origin, frames, 0, 4);
+    QCOMPARE (regions.size (), 2);
+    QCOMPARE (regions.at (0), region);
+
+    // Every vertex ends up on an opaque pixel next to a transparent one
+    QCOMPARE (regions.at (1).size (), region.size ());
+    for (const QPointF &vertex : regions.at (1))
+    {
+        const int x = static_cast <int> (std::floor (vertex.x () + origin.x ()));
+        const int y = static_cast <int> (std::floor (vertex.y () + origin.y ()));
+
+        QVERIFY (qAlpha (image.pixel (x, y)) == 255);
+        QVERIFY (qAlpha (image.pixel (x - 1, y)) == 0 || qAlpha (image.pixel (x + 1, y)) == 0 ||
+                 qAlpha (image.pixel (x, y - 1)) == 0 || qAlpha (image.pixel (x, y + 1)) == 0);
+    }
+}
+
+void VertexDataSetCollectionTest::test_regionImporter ()
+{
+    using Aerodlyn::RegionImporter;
+
+    QTemporaryDir directory;
+    QVERIFY (directory.isValid ());
+
+    const auto write = [&] (const QString &name, const QByteArray &contents)
+    {
+        QFile file (directory.filePath (name));
+        file.open (QIODevice::WriteOnly);
+        file.write (contents);
+
+        return file.fileName ();
+    };
+
+    // PhysicsEditor bodies named by their key, and a RUBE body named by its "name" member
+    const QString json = write ("bodies.json",
+        "{\n"
+        "  \"bodies\": {\n"
+        "    \"player\": { \"fixtures\": [\n"
+        "      { \"polygons\": [ [ { \"x\": 10, \"y\": 10 }, { \"x\": 20, \"y\": 10 }, { \"x\": 20, \"y\": 20 } ] ] },\n"
+        "      { \"shape\": [ 30, 30, 40, 30, 40, 40 ] }\n"
+        "    ] }\n"
+        "  },\n"
+        "  \"body\": [ { \"name\": \"Crate Top\", \"fixture\": [ { \"polygon\": { \"vertices\": {\n"
+        "    \"x\": [ 10, 14, 14, 10 ], \"y\": [ 10, 10, 14, 14 ] } } } ] } ]\n"
+        "}\n");
+
+    const RegionImporter::Result bodies = RegionImporter::read (json, QPointF (10, 10));
+    QVERIFY (bodies.errors.isEmpty ());
+    QCOMPARE (bodies.dataSets.size (), 3);
+
+    QCOMPARE (bodies.dataSets.at (0).name, QString ("player"));
+    QCOMPARE (bodies.dataSets.at (0).region, QPolygonF ({ QPointF (0, 0), QPointF (10, 0), QPointF (10, 10) }));
+    QCOMPARE (bodies.dataSets.at (1).name, QString ("player_2"));
+    QCOMPARE (bodies.dataSets.at (1).region, QPolygonF ({ QPointF (20, 20), QPointF (30, 20), QPointF (30, 30) }));
+    QCOMPARE (bodies.dataSets.at (2).name, QString ("CrateTop"));
+    QCOMPARE (bodies.dataSets.at (2).region, QPolygonF ({ QPointF (0, 0), QPointF (4, 0), QPointF (4, 4), QPointF (0, 4) }));
+
+    // A file that can't be parsed adds nothing, and says where it went wrong
+    const QString malformed = write ("malformed.json", "{\n  \"a\": [ [ 0, 0, 1, 0, 1, 1 ],\n  [ 3 4 ] ]\n}\n");
+    const RegionImporter::Result broken = RegionImporter::read (malformed);
+
+    QVERIFY (broken.dataSets.isEmpty ());
+    QCOMPARE (broken.errors.size (), 1);
+    QCOMPARE (broken.errors.at (0).line, qint64 (3));
+
+    // Tiled objects in an offset layer: a rectangle, a polygon, and a point that isn't a region
+    const QString tmx = write ("level.tmx",
+        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<map version=\"1.10\" orientation=\"orthogonal\" width=\"4\" height=\"4\" tilewidth=\"16\" tileheight=\"16\">\n"
+        " <objectgroup id=\"1\" name=\"Collision\" offsetx=\"5\" offsety=\"0\">\n"
+        "  <object id=\"1\" name=\"Floor\" x=\"0\" y=\"40\" width=\"64\" height=\"8\"/>\n"
+        "  <object id=\"2\" x=\"10\" y=\"10\"><polygon points=\"0,0 10,0 0,10\"/></object>\n"
+        "  <object id=\"3\" x=\"0\" y=\"0\"><point/></object>\n"
+        " </objectgroup>\n"
+        "</map>\n");
+
+    const RegionImporter::Result level = RegionImporter::read (tmx);
+    QVERIFY (level.errors.isEmpty ());
+    QCOMPARE (level.dataSets.size (), 2);
+
+    QCOMPARE (level.dataSets.at (0).name, QString ("Floor"));
+    QCOMPARE (level.dataSets.at (0).region, QPolygonF ({ QPointF (5, 40), QPointF (69, 40), QPointF (69, 48), QPointF (5, 48) }));
+    QCOMPARE (level.dataSets.at (1).name, QString ("object2"));
+    QCOMPARE (level.dataSets.at (1).region, QPolygonF ({ QPointF (15, 10), QPointF (25, 10), QPointF (15, 20) }));
+
+    // The collision objects of a tile are placed on its tile in the image of the tileset: the second
+    //  tile of the second row, past the margin and the spacing between the tiles before it
+    const QString tsx = write ("tiles.tsx",
+        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<tileset version=\"1.10\" name=\"Tiles\" tilewidth=\"16\" tileheight=\"16\" spacing=\"2\" margin=\"1\" tilecount=\"16\" columns=\"4\">\n"
+        " <image source=\"tiles.png\" width=\"74\" height=\"74\"/>\n"
+        " <tile id=\"5\">\n"
+        "  <objectgroup draworder=\"index\">\n"
+        "   <object id=\"1\" x=\"2\" y=\"3\" width=\"4\" height=\"4\"/>\n"
+        "  </objectgroup>\n"
+        " </tile>\n"
+        "</tileset>\n");
+
+    const RegionImporter::Result tiles = RegionImporter::read (tsx);
+    QVERIFY (tiles.errors.isEmpty ());
+    QCOMPARE (tiles.dataSets.size (), 1);
+
+    QCOMPARE (tiles.dataSets.at (0).name, QString ("tile5"));
+    QCOMPARE (tiles.dataSets.at (0).region, QPolygonF ({ QPointF (21, 22), QPointF (25, 22), QPointF (25, 26), QPointF (21, 26) }));
+
+    // SVG shapes with transforms, a path of two subpaths, definitions that aren't drawn, a malformed
+    //  path that is skipped on its own, and an arc
+    const QString svg = write ("shapes.svg",
+        "<svg xmlns=\"http://www.w3.org/2000/svg\" width=\"100\" height=\"100\">\n"
+        " <g transform=\"translate(10 0)\">\n"
+        "  <path id=\"hull\" d=\"M0 0 H10 V10 Z M20 20 l5 0 0 5 z\"/>\n"
+        "  <rect x=\"0\" y=\"50\" width=\"4\" height=\"2\"/>\n"
+        " </g>\n"
+        " <defs><path id=\"hidden\" d=\"M0 0 L1 0 L1 1 Z\"/></defs>\n"
+        " <path id=\"broken\" d=\"M0 0 L\"/>\n"
+        " <path id=\"arc\" d=\"M0 50 A10 10 0 0 1 20 50 Z\"/>\n"
+        "</svg>\n");
+
+    const RegionImporter::Result shapes = RegionImporter::read (svg);
+    QCOMPARE (shapes.errors.size (), 1);
+    QCOMPARE (shapes.errors.at (0).line, qint64 (7));
+    QCOMPARE (shapes.dataSets.size (), 4);
+
+    QCOMPARE (shapes.dataSets.at (0).name, QString ("hull"));
+    QCOMPARE (shapes.dataSets.at (0).region, QPolygonF ({ QPointF (10, 0), QPointF (20, 0), QPointF (20, 10) }));
+    QCOMPARE (shapes.dataSets.at (1).name, QString ("hull_2"));
+    QCOMPARE (shapes.dataSets.at (1).region, QPolygonF ({ QPointF (30, 20), QPointF (35, 20), QPointF (35, 25) }));
+    QCOMPARE (shapes.dataSets.at (2).name, QString ("rect1"));
+    QCOMPARE (shapes.dataSets.at (2).region, QPolygonF ({ QPointF (10, 50), QPointF (14, 50), QPointF (14, 52), QPointF (10, 52) }));
+
+    // The arc bulges up (clockwise on screen) and every point of it is on the circle
+    const QPolygonF arc = shapes.dataSets.at (3).region;
+    QVERIFY (arc.size () > 8);
+    QCOMPARE (arc.boundingRect (), QRectF (0, 40, 20, 10));
+
+    for (const QPointF &point : arc)
+        QVERIFY (std::abs (std::hypot (point.x () - 10.0, point.y () - 50.0) - 10.0) < 1e-9);
+
+    // Files are read in parallel, but their data sets and errors keep the order of the files
+    const RegionImporter::Result all = RegionImporter::readAll ({ svg, directory.filePath ("missing.svg"), tmx,
+        directory.filePath ("notes.txt") });
+
+    QCOMPARE (all.dataSets.size (), 6);
+    QCOMPARE (all.dataSets.at (0).name, QString ("hull"));
+    QCOMPARE (all.dataSets.at (4).name, QString ("Floor"));
+    QCOMPARE (all.errors.size (), 3);
+    QCOMPARE (all.errors.at (1).line, qint64 (0));
+    QVERIFY (all.errors.at (2).toString ().startsWith (directory.filePath ("notes.txt")));
+}
+
+void VertexDataSetCollectionTest::test_projectFile ()
+{
+    collection.addAll ({ "A", "B" });
+    collection.get ("A")->get () = QPolygonF ({ QPointF (0, 0), QPointF (4, 0), QPointF (4, 4) });
+    collection.get ("B")->get () = QPolygonF ({ QPointF (1, 1), QPointF (2, 2), QPointF (3, 1) });
+    collection.markDirty ("A");
+    collection.markDirty ("B");
+
+    QTemporaryDir directory;
+    QVERIFY (directory.isValid ());
+
+    const QString path = directory.filePath ("project.ahp");
+
+    Aerodlyn::ProjectFile saved;
+    QVERIFY (saved.save (path, collection));
+
+    QFile file (path);
+    QVERIFY (file.open (QIODevice::ReadOnly));
+    const QByteArray contents = file.readAll ();
+    file.close ();
+
+    Aerodlyn::VertexDataSetCollection loaded;
+    Aerodlyn::ProjectFile opened;
+    QVERIFY (opened.load (path, loaded));
+    QVERIFY (!opened.isPartial ());
+    QCOMPARE (opened.path (), path);
+
+    // A data set chunk claiming more points than it holds is corrupt, so it and everything after it
+    //  are ignored instead of reserving room for the points
+    QByteArray payload;
+    QDataStream stream (&payload, QIODevice::WriteOnly);
+    stream.setByteOrder (QDataStream::LittleEndian);
+    stream << QString ("C") << static_cast <quint32> (0x7FFFFFFF) << 1.0 << 2.0;
+
+    QByteArray corrupt;
+    QDataStream corruptStream (&corrupt, QIODevice::WriteOnly);
+    corruptStream.setByteOrder (QDataStream::LittleEndian);
+    corruptStream << static_cast <quint32> (1) << static_cast <quint32> (payload.size ());
+    corrupt.prepend (contents);
+    corrupt.append (payload);
+
+    QVERIFY (file.open (QIODevice::WriteOnly));
+    file.write (corrupt);
+    file.close ();
+
+    QVERIFY (opened.load (path, loaded));
+    QVERIFY (opened.isPartial ());
+    QVERIFY (opened.path ().isEmpty ());
+    QCOMPARE (loaded.length (), 2);
+    QVERIFY (!loaded.contains ("C"));
+
+    // A chunk cut short (by an interrupted save) loads the chunks before it
+    QVERIFY (file.open (QIODevice::WriteOnly));
+    file.write (contents.left (contents.size () - 4));
+    file.close ();
+
+    QVERIFY (opened.load (path, loaded));
+    QVERIFY (opened.isPartial ());
+    QCOMPARE (loaded.length (), 1);
+    QCOMPARE (loaded.at (0).region, collection.at (0).region);
+
+    // Saving a partly loaded project rewrites it, leaving a whole file
+    QVERIFY (opened.save (path, loaded));
+    QVERIFY (opened.load (path, loaded));
+    QVERIFY (!opened.isPartial ());
+    QCOMPARE (loaded.length (), 1);
+}
+
+void VertexDataSetCollectionTest::test_headerExporter ()
+{
+    using Aerodlyn::VertexAttributes;
+
+    // Names that need escaping, and two whose UTF-16 order (a surrogate pair before U+FF5A) is the
+    //  reverse of their UTF-8 order
+    const QString quoted = QString ("A\"\\\n") + QChar (0x00E9);
+    const QString fullwidth = QString (QChar (0xFF5A));
+    const QString emoji = QString::fromUcs4 (U"\U0001F600");
+
+    collection.addAll ({ "Box", "Far", quoted, fullwidth, emoji });
+    collection.get ("Box")->get () = QPolygonF ({ QPointF (0, 0), QPointF (4, 0), QPointF (4, 4), QPointF (0, 4) });
+    collection.get ("Far")->get () = QPolygonF ({ QPointF (0, 0), QPointF (1e39, 0), QPointF (0, 10) });
+    collection.get (emoji)->get () = QPolygonF ({ QPointF (1, 1), QPointF (2, 1), QPointF (2, 2) });
+
+    // Values no float can hold are clamped, as C++ has no literals for them
+    VertexAttributes &attributes = collection.attributes ("Box")->get ();
+    QVERIFY (attributes.addChannel ("oneWay", VertexAttributes::Type::Flag, 4));
+    QVERIFY (attributes.addChannel ("depth", VertexAttributes::Type::Scalar, 4));
+    attributes.setValue (0, 0, 1.0);
+    attributes.setValue (1, 0, std::numeric_limits <double>::quiet_NaN ());
+    attributes.setValue (1, 1, std::numeric_limits <double>::infinity ());
+    attributes.setValue (1, 2, -std::numeric_limits <double>::infinity ());
+    attributes.setValue (1, 3, 1.5);
+
+    collection.markDirty ("Box");
+    collection.markDirty ("Far");
+    collection.markDirty (emoji);
+
+    const QByteArray header = Aerodlyn::HeaderExporter::generate (collection, "Regions");
+
+    QVERIFY (header.contains (R"({ "A\"\\\012\303\251", nullptr, 0,)"));
+    QVERIFY (header.contains ("0.0f, 3.40282347e+38f, -3.40282347e+38f, 1.5f"));
+    QVERIFY (header.contains ("{ 3.40282347e+38f, 0.0f }"));
+    QVERIFY (!header.contains ("inf.0f") && !header.contains ("nan.0f"));
+
+    // The table is sorted by UTF-8 bytes, as find compares std::string_views
+    const int fullwidthAt = header.indexOf (R"("\357\275\232")"), emojiAt = header.indexOf (R"("\360\237\230\200")");
+    QVERIFY (fullwidthAt != -1 && emojiAt != -1);
+    QVERIFY (fullwidthAt < emojiAt);
+
+    // The header compiles, and find resolves every name at compile time
+    QTemporaryDir directory;
+    QVERIFY (directory.isValid ());
+    QVERIFY (Aerodlyn::HeaderExporter::save (directory.filePath ("Regions.h"), collection));
+
+    QFile source (directory.filePath ("main.cpp"));
+    QVERIFY (source.open (QIODevice::WriteOnly));
+    source.write (R"(#include "Regions.h"
+
+static_assert (Regions::regionCount == 5);
+static_assert (Regions::find ("A\"\\\012\303\251") == &Regions::regions [0]);
+static_assert (Regions::find ("Box") == &Regions::regions [1] && Regions::find ("Box")->size == 4);
+static_assert (Regions::find ("\357\275\232") == &Regions::regions [3] && Regions::find ("\357\275\232")->size == 0);
+static_assert (Regions::find ("\360\237\230\200") == &Regions::regions [4]);
+static_assert (Regions::find ("Missing") == nullptr);
+static_assert (Regions::findAttribute (*Regions::find ("Box"), "oneWay")->ints [0] == 1);
+static_assert (Regions::findAttribute (*Regions::find ("Box"), "depth")->floats [3] == 1.5f);
+static_assert (Regions::find ("Far")->points [1].x == 3.40282347e+38f);
+
+int main () { return 0; }
+)");
+    source.close ();
+
+    QProcess compiler;
+    compiler.setWorkingDirectory (directory.path ());
+    compiler.start (qEnvironmentVariable ("CXX", "c++"), { "-std=c++17", "-fsyntax-only", "main.cpp" });
+
+    if (!compiler.waitForStarted ())
+        QSKIP ("No C++ compiler to compile the header with (set CXX to one)");
+
+    QVERIFY (compiler.waitForFinished (60000));
+    QVERIFY2 (compiler.exitStatus () == QProcess::NormalExit && compiler.exitCode () == 0,
+        compiler.readAllStandardError ().constData ());
+}
+
+void VertexDataSetCollectionTest::test_vertexAttributes ()
+{
+    using Aerodlyn::VertexAttributes;
+
+    collection.add (QString ("A"));
+    collection.get ("A")->get () = QPolygonF ({ QPointF (0, 0), QPointF (4, 0), QPointF (4, 4) });
+    collection.markDirty ("A");
+
+    VertexAttributes &attributes = collection.attributes ("A")->get ();
+    QVERIFY (attributes.isEmpty ());
+    QVERIFY (!collection.attributes ("Missing").has_value ());
+
+    QVERIFY (attributes.addChannel ("oneWay", VertexAttributes::Type::Flag, 3));
+    QVERIFY (attributes.addChannel ("normal", VertexAttributes::Type::Vector, 3));
+    QVERIFY (!attributes.addChannel ("normal", VertexAttributes::Type::Scalar, 3));
+    QCOMPARE (attributes.names (), QStringList ({ "oneWay", "normal" }));
+
+    attributes.setValue (0, 1, 5.0);
+    attributes.setValue (1, 1, 0.5, 0);
+    attributes.setValue (1, 1, -1.0, 1);
+    attributes.setValue (1, 2, 2.0, 1);
+    QCOMPARE (attributes.value (0, 1), 1.0);
+
+    // Inserting and removing vertices keeps the values of the other vertices with them
+    QVERIFY (collection.insertPoint ("A", 1, QPointF (2, -1)));
+    QVERIFY (!collection.insertPoint ("A", 5, QPointF ()));
+    QCOMPARE (collection.at (0).region.size (), 4);
+    QCOMPARE (attributes.channel (1).reals.size (), 8);
+    QCOMPARE (attributes.value (0, 1), 0.0);
+    QCOMPARE (attributes.value (0, 2), 1.0);
+    QCOMPARE (attributes.value (1, 2, 1), -1.0);
+
+    QVERIFY (collection.removePoint ("A", 0));
+    QCOMPARE (collection.at (0).region.at (0), QPointF (2, -1));
+    QCOMPARE (attributes.value (0, 1), 1.0);
+    QCOMPARE (attributes.value (1, 1, 0), 0.5);
+    QCOMPARE (attributes.value (1, 2, 1), 2.0);
+
+    // Replacing the region truncates or pads the channels to match it
+    collection.get ("A")->get ().append (QPointF (8, 8));
+    collection.markDirty ("A");
+    QCOMPARE (attributes.channel (0).integers.size (), 4);
+    QCOMPARE (attributes.value (1, 3, 1), 0.0);
+
+    // Attributes survive a save and load, and data sets without them stay without them
+    collection.add (QString ("B"));
+    collection.get ("B")->get () = QPolygonF ({ QPointF (1, 1), QPointF (2, 2), QPointF (3, 1) });
+    collection.markDirty ("B");
+
+    QTemporaryDir directory;
+    QVERIFY (directory.isValid ());
+
+    Aerodlyn::ProjectFile saved;
+    QVERIFY (saved.save (directory.filePath ("project.ahp"), collection));
+
+    Aerodlyn::VertexDataSetCollection loaded;
+    Aerodlyn::ProjectFile opened;
+    QVERIFY (opened.load (directory.filePath ("project.ahp"), loaded));
+    QCOMPARE (loaded.length (), 2);
+    QVERIFY (loaded.at (0).attributes == collection.at (0).attributes);
+    QVERIFY (loaded.at (1).attributes.isEmpty ());
+
+    // Clearing a region clears its values, but keeps its channels
+    collection.clearAll ();
+    QCOMPARE (collection.at (0).attributes.channelCount (), 2);
+    QVERIFY (collection.at (0).attributes.channel (1).reals.isEmpty ());
+}
+
+void VertexDataSetCollectionTest::test_vertexTransform ()
+{
+    using Aerodlyn::VertexTransform;
+
+    // An odd number of vertices, so the bulk kernel (SSE2 where available) also has to handle a last
+    //  vertex that doesn't pair up with another one
+    QPolygonF region;
+    for (int i = 0; i < 7; i++)
+        region << QPointF (i * 3.25 - 10.0, std::sin (i) * 40.0);
+
+    const QVector <VertexTransform> transforms = { VertexTransform::translation (QPointF (5.5, -2.0)),
+        VertexTransform::scale (QPointF (1.0, 2.0), 1.75), VertexTransform::rotation (QPointF (-3.0, 4.0), 0.7) };
+
+    // The bulk kernels must agree with the scalar map, for every vertex or only the given ones
+    for (const VertexTransform &transform : transforms)
+    {
+        QPolygonF all = region;
+        transform.apply (all);
+
+        QPolygonF some = region;
+        transform.apply (some, { 0, 3, 6 });
+
+        for (int i = 0; i < region.size (); i++)
+        {
+            const QPointF expected = transform.map (region.at (i));
+
+            QCOMPARE (all.at (i), expected);
+            QCOMPARE (some.at (i), i % 3 == 0 ? expected : region.at (i));
+        }
+    }
+
+    // A quarter turn is clockwise on screen, where y points down
+    QPolygonF point ({ QPointF (1.0, 0.0) });
+    VertexTransform::rotation (QPointF (), M_PI / 2.0).apply (point);
+    QVERIFY (std::abs (point.at (0).x ()) < 1e-12 && std::abs (point.at (0).y () - 1.0) < 1e-12);
+}
+
+void VertexDataSetCollectionTest::test_regionSpatialIndex ()
+{
+    // Vertices spread over many cells, including negative coordinates and cell borders
+    QPolygonF region;
+    for (int i = 0; i < 200; i++)
+        region << QPointF ((i * 37) % 101 - 50.0, (i * 53) % 89 - 40.0);
+
+    Aerodlyn::RegionSpatialIndex index (10.0);
+    index.rebuild (region);
+    QCOMPARE (index.size (), region.size ());
+
+    const QRectF rect (-20.0, -10.0, 30.0, 25.0);
+    const QPolygonF lasso ({ QPointF (-30.0, -30.0), QPointF (40.0, -20.0), QPointF (0.0, 30.0) });
+
+    // The queries must find exactly what looking at every vertex finds
+    QVector <int> inRect, inLasso;
+    for (int i = 0; i < region.size (); i++)
+    {
+        if (rect.contains (region.at (i)))
+            inRect.append (i);
+
+        if (lasso.containsPoint (region.at (i), Qt::OddEvenFill))
+            inLasso.append (i);
+    }
+
+    QCOMPARE (index.queryRect (region, rect), inRect);
+    QCOMPARE (index.queryPolygon (region, lasso), inLasso);
+
+    // The vertices are on distinct whole coordinates, so only the vertex itself is within reach, and
+    //  the lowest index wins when several are
+    QCOMPARE (index.hitTest (region, region.at (150), 0.5), 150);
+    QCOMPARE (index.hitTest (region, region.at (150), 200.0), 0);
+    QCOMPARE (index.hitTest (region, QPointF (1000.0, 1000.0), 5.0), -1);
+}
+
+void VertexDataSetCollectionTest::test_regionRasterizer ()
+{
+    using Aerodlyn::RegionRasterizer;
+
+    // Pixels are covered when their centers are inside the region
+    const auto covered = [] (const RegionRasterizer::Mask &mask, const int x, const int y)
+    {
+        const uchar *row = reinterpret_cast <const uchar *> (mask.data.constData ()) + y * mask.stride;
+        return mask.format == RegionRasterizer::Format::Bit ? ((row [x >> 3] >> (x & 7)) & 1) != 0 : row [x] == 0xFF;
+    };
+
+    const auto compare = [&] (const RegionRasterizer::Mask &mask, const std::function <bool (int, int)> &inside)
+    {
+        for (int y = 0; y < mask.height; y++)
+        {
+            for (int x = 0; x < mask.width; x++)
+            {
+                if (covered (mask, x, y) != inside (x, y))
+                    return false;
+            }
+        }
+
+        return true;
+    };
+
+    const QPolygonF rectangle ({ QPointF (2, 1), QPointF (7, 1), QPointF (7, 4), QPointF (2, 4) });
+    const QPolygonF triangle ({ QPointF (0, 0), QPointF (8, 0), QPointF (0, 8) });
+
+    // A square with a square hole, joined by a bridge whose edges cancel out under even-odd
+    const QPolygonF holed ({ QPointF (0, 0), QPointF (10, 0), QPointF (10, 10), QPointF (0, 10), QPointF (0, 0),
+        QPointF (3, 3), QPointF (3, 7), QPointF (7, 7), QPointF (7, 3), QPointF (3, 3) });
+
+    for (const RegionRasterizer::Format format : { RegionRasterizer::Format::Bit, RegionRasterizer::Format::Byte })
+    {
+        const RegionRasterizer::Mask box = RegionRasterizer::rasterize (rectangle, QSize (10, 6), QPointF (), format);
+        QCOMPARE (box.stride, format == RegionRasterizer::Format::Bit ? 8 : 12);
+        QVERIFY (compare (box, [] (int x, int y) { return x >= 2 && x < 7 && y >= 1 && y < 4; }));
+
+        const RegionRasterizer::Mask wedge = RegionRasterizer::rasterize (triangle, QSize (8, 8), QPointF (), format);
+        QVERIFY (compare (wedge, [] (int x, int y) { return x + y < 7; }));
+
+        const RegionRasterizer::Mask hole = RegionRasterizer::rasterize (holed, QSize (12, 12), QPointF (), format);
+        QVERIFY (compare (hole, [] (int x, int y) { return x < 10 && y < 10 && !(x >= 3 && x < 7 && y >= 3 && y < 7); }));
+
+        // Moved by the origin, and clipped to the mask
+        const RegionRasterizer::Mask moved = RegionRasterizer::rasterize (rectangle, QSize (6, 4), QPointF (-3, 1), format);
+        QVERIFY (compare (moved, [] (int x, int y) { return x < 4 && y >= 2; }));
+    }
+
+    // A span crossing byte boundaries sets the partial bytes at either end and the whole ones between,
+    //  and a span within one byte sets only its own bits
+    const RegionRasterizer::Mask span = RegionRasterizer::rasterize (QPolygonF ({ QPointF (5, 0), QPointF (21, 0),
+        QPointF (21, 1), QPointF (5, 1) }), QSize (30, 1), QPointF (), RegionRasterizer::Format::Bit);
+    QCOMPARE (span.data, QByteArray::fromHex ("e0ff1f0000000000"));
+
+    const RegionRasterizer::Mask narrow = RegionRasterizer::rasterize (QPolygonF ({ QPointF (1, 0), QPointF (3, 0),
+        QPointF (3, 1), QPointF (1, 1) }), QSize (30, 1), QPointF (), RegionRasterizer::Format::Bit);
+    QCOMPARE (narrow.data, QByteArray::fromHex ("0600000000000000"));
+
+    // Packed masks are the header followed by the rows as they are stored
+    QTemporaryDir directory;
+    QVERIFY (directory.isValid ());
+
+    QVERIFY (RegionRasterizer::save (span, directory.filePath ("span.mask"), RegionRasterizer::Encoding::Packed));
+
+    QFile packed (directory.filePath ("span.mask"));
+    QVERIFY (packed.open (QIODevice::ReadOnly));
+    QCOMPARE (packed.readAll (), QByteArray::fromHex ("41484d4b" "01000000" "1e000000" "01000000" "01000000" "08000000")
+        + span.data);
+
+    const QImage image = RegionRasterizer::toImage (span);
+    QCOMPARE (image.pixelIndex (4, 0), 0);
+    QCOMPARE (image.pixelIndex (5, 0), 1);
+    QCOMPARE (image.pixelIndex (20, 0), 1);
+    QCOMPARE (image.pixelIndex (21, 0), 0);
+
+    // Names that would clash or be invalid as file names are escaped, so every mask gets its own file
+    collection.addAll ({ "a/b", "a_b", "a%2Fb", "c:d", "nul", "end." });
+    for (int i = 0; i < collection.length (); i++)
+        collection.get (collection.at (i).name)->get () = rectangle;
+
+    QVERIFY (RegionRasterizer::exportAll (collection, QSize (10, 6), QPointF (), RegionRasterizer::Format::Byte,
+        RegionRasterizer::Encoding::Png, QDir (directory.path ())).isEmpty ());
+
+    for (const QString &name : { "a%2Fb", "a_b", "a%252Fb", "c%3Ad", "%6Eul", "end%2E" })
+        QVERIFY2 (QFile::exists (directory.filePath (name + ".png")), qPrintable (name));
+}
+
 QTEST_APPLESS_MAIN(VertexDataSetCollectionTest)
 #include "tst_vertexdatasetcollectiontest.moc"
@@ -0,0 +1,27 @@
+QT += gui widgets concurrent testlib
+CONFIG += c++17
+
+CONFIG += qt console warn_on depend_includepath testcase
+CONFIG -= app_bundle
+
+TEMPLATE = app
+
+# Golden images are read from (and, with AEROHELPER_UPDATE_GOLDEN=1, written to) the golden directory
+# next to this file. Paint times are reported as benchmark results, so they can be collected with
+# "-o timings.csv,csv" alongside the usual output.
+DEFINES += AEROHELPER_PROFILING GOLDEN_DIR=\\\"$$PWD/golden\\\" TEST_IMAGE=\\\"$$PWD/../../Test.png\\\"
+
+INCLUDEPATH += ../.. ../../VertexEditor/Utilities
+HEADERS += ../../VertexEditor/FrameComposer.h ../../VertexEditor/FrameScheduler.h ../../VertexEditor/VertexEditorImage.h
+SOURCES +=  tst_vertexeditorrenderingtest.cpp ../../Root/Profiler.cpp ../../Root/Utils.cpp \
+    ../../VertexEditor/FrameComposer.cpp \
+    ../../VertexEditor/FrameScheduler.cpp \
+    ../../VertexEditor/VertexEditorImage.cpp \
+    ../../VertexEditor/VertexEditorRenderedImage.cpp \
+    ../../VertexEditor/Utilities/BoundingVolumes.cpp \
+    ../../VertexEditor/Utilities/DataSetRTree.cpp \
+    ../../VertexEditor/Utilities/RegionGeometry.cpp \
+    ../../VertexEditor/Utilities/RegionSlabIndex.cpp \
+    ../../VertexEditor/Utilities/RegionSpatialIndex.cpp \
+    ../../VertexEditor/Utilities/VertexDataSetCollection.cpp \
+    ../../VertexEditor/Utilities/VertexTransform.cpp
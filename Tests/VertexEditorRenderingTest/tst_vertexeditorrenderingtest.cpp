@@ -0,0 +1,299 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <memory>
+
+#include <QApplication>
+#include <QDir>
+#include <QFile>
+#include <QImage>
+#include <QPointF>
+#include <QPolygonF>
+#include <QRectF>
+#include <QSize>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+#include <QWidget>
+#include <QtTest>
+
+#include "VertexEditor/Utilities/RegionGeometry.h"
+#include "VertexEditor/Utilities/VertexDataSetCollection.h"
+#include "VertexEditor/VertexEditorImage.h"
+#include "VertexEditor/VertexEditorRenderedImage.h"
+
+class VertexEditorRenderingTest : public QObject
+{
+    Q_OBJECT
+
+    private:
+        int hoveredPoint = -1;
+
+        QPointF center;
+
+        QPolygonF region;
+        QPolygonF selectionOutline;
+
+        QVector <int> selectedPoints;
+
+        Aerodlyn::RegionGeometry geometry;
+        Aerodlyn::VertexDataSetCollection overlay;
+
+        std::unique_ptr <Aerodlyn::VertexEditorRenderedImage> renderedImage;
+        std::unique_ptr <Aerodlyn::VertexEditorImage> editorImage;
+
+        // A channel may differ by this much (anti-aliasing, rounding between platforms) before the
+        //  pixel counts as changed, and this fraction of the pixels may change before the test fails
+        const int CHANNEL_TOLERANCE = 16;
+        const double PIXEL_TOLERANCE = 0.001;
+
+        const QSize CANVAS_SIZE = QSize (1100, 320);
+
+        QWidget *setUp (const QString &scenario);
+        QImage render (QWidget *widget) const;
+        int countChangedPixels (const QImage &actual, const QImage &expected) const;
+
+        static QPolygonF polygon (const QPointF &center, const double rx, const double ry, const int sides);
+
+    private slots:
+        void init ();
+        void cleanup ();
+
+        void test_render_data ();
+        void test_render ();
+        void test_paintTime_data ();
+        void test_paintTime ();
+        void test_renderThread_data ();
+        void test_renderThread ();
+};
+
+void VertexEditorRenderingTest::init ()
+{
+    hoveredPoint = -1;
+    region.clear ();
+    selectionOutline.clear ();
+    selectedPoints.clear ();
+    geometry = Aerodlyn::RegionGeometry ();
+    overlay = Aerodlyn::VertexDataSetCollection ();
+}
+
+void VertexEditorRenderingTest::cleanup ()
+{
+    renderedImage.reset ();
+    editorImage.reset ();
+}
+
+void VertexEditorRenderingTest::test_render_data ()
+{
+    QTest::addColumn <QString> ("scenario");
+
+    QTest::newRow ("image") << QString ("image");
+    QTest::newRow ("region") << QString ("region");
+    QTest::newRow ("hovered") << QString ("hovered");
+    QTest::newRow ("selection") << QString ("selection");
+    QTest::newRow ("culled") << QString ("culled");
+    QTest::newRow ("overlay") << QString ("overlay");
+    QTest::newRow ("editor") << QString ("editor");
+}
+
+void VertexEditorRenderingTest::test_render ()
+{
+    QFETCH (QString, scenario);
+
+    const QImage actual = render (setUp (scenario));
+    const QString goldenPath = QDir (GOLDEN_DIR).filePath (scenario + ".png");
+
+    if (qEnvironmentVariableIntValue ("AEROHELPER_UPDATE_GOLDEN") != 0)
+    {
+        QVERIFY (QDir ().mkpath (GOLDEN_DIR));
+        QVERIFY (actual.save (goldenPath));
+        QSKIP (qPrintable (QString ("Wrote the golden image '%1'").arg (goldenPath)));
+    }
+
+    // A missing golden image is a failure, so a scenario can't pass without ever being compared
+    if (!QFile::exists (goldenPath))
+        QFAIL (qPrintable (QString ("No golden image '%1', run with AEROHELPER_UPDATE_GOLDEN=1 to write it").arg (goldenPath)));
+
+    const QImage expected (goldenPath);
+    QCOMPARE (actual.size (), expected.size ());
+
+    const int changed = countChangedPixels (actual, expected);
+    if (changed > PIXEL_TOLERANCE * actual.width () * actual.height ())
+    {
+        // Kept for comparing by eye with the golden image
+        const QString actualPath = QDir::temp ().filePath (scenario + ".actual.png");
+        actual.save (actualPath);
+
+        QFAIL (qPrintable (QString ("%1 pixels differ from '%2' (see '%3')").arg (changed).arg (goldenPath, actualPath)));
+    }
+}
+
+void VertexEditorRenderingTest::test_paintTime_data ()
+{
+    test_render_data ();
+    QTest::newRow ("overlay (10k regions)") << QString ("overlay 10k");
+}
+
+void VertexEditorRenderingTest::test_paintTime ()
+{
+    QFETCH (QString, scenario);
+
+    QWidget *widget = setUp (scenario);
+    QImage canvas (widget->size (), QImage::Format_ARGB32_Premultiplied);
+
+    QBENCHMARK
+        { widget->render (&canvas); }
+}
+
+void VertexEditorRenderingTest::test_renderThread_data ()
+{
+    QTest::addColumn <QString> ("scenario");
+
+    QTest::newRow ("image") << QString ("image");
+    QTest::newRow ("selection") << QString ("selection");
+    QTest::newRow ("overlay") << QString ("overlay");
+}
+
+void VertexEditorRenderingTest::test_renderThread ()
+{
+    QFETCH (QString, scenario);
+
+    // A widget that isn't shown composes an out of date frame right away, so this is the frame
+    //  composed on the GUI thread
+    Aerodlyn::VertexEditorRenderedImage *image = static_cast <Aerodlyn::VertexEditorRenderedImage *> (setUp (scenario));
+    const QImage expected = render (image);
+
+    image->compose ();
+    QTRY_VERIFY (image->hasCurrentFrame ());
+
+    QCOMPARE (countChangedPixels (render (image), expected), 0);
+}
+
+QWidget *VertexEditorRenderingTest::setUp (const QString &scenario)
+{
+    if (scenario == "editor")
+    {
+        region = polygon (QPointF (), 100.0, 60.0, 7);
+        selectedPoints = { 2, 3 };
+
+        editorImage = std::make_unique <Aerodlyn::VertexEditorImage> ();
+        editorImage->resize (CANVAS_SIZE);
+        editorImage->setImageFile (TEST_IMAGE);
+        editorImage->setRegion (region, geometry);
+
+        return editorImage.get ();
+    }
+
+    renderedImage = std::make_unique <Aerodlyn::VertexEditorRenderedImage> (hoveredPoint, selectedPoints,
+        selectionOutline, center);
+    renderedImage->load (TEST_IMAGE);
+    renderedImage->resizeToFit (CANVAS_SIZE);
+
+    if (scenario == "region" || scenario == "hovered" || scenario == "selection")
+    {
+        region = polygon (QPointF (-200.0, 0.0), 120.0, 80.0, 9);
+        renderedImage->setRegion (region, geometry);
+    }
+
+    if (scenario == "hovered")
+        hoveredPoint = 4;
+
+    else if (scenario == "selection")
+    {
+        selectedPoints = { 0, 1, 5 };
+        selectionOutline = QPolygonF (QRectF (-340.0, -100.0, 160.0, 120.0));
+    }
+
+    else if (scenario == "culled")
+    {
+        // Far outside of the canvas, so nothing of it is painted
+        region = polygon (QPointF (10000.0, 10000.0), 50.0, 50.0, 6);
+        renderedImage->setRegion (region, geometry);
+    }
+
+    else if (scenario.startsWith ("overlay"))
+    {
+        const int count = scenario.endsWith ("10k") ? 10000 : 512;
+        const int columns = static_cast <int> (std::ceil (std::sqrt (count * 4.0)));
+        const double cell = CANVAS_SIZE.width () / static_cast <double> (columns);
+
+        QStringList names;
+        for (int i = 0; i < count; i++)
+            names << QString ("Region %1").arg (i, 5, 10, QChar ('0'));
+
+        overlay.addAll (names);
+        for (int i = 0; i < count; i++)
+        {
+            const QPointF position ((i % columns + 0.5) * cell - CANVAS_SIZE.width () / 2.0,
+                                    (i / columns + 0.5) * cell - CANVAS_SIZE.height () / 2.0);
+
+            overlay.get (names.at (i))->get () = polygon (position, cell * 0.4, cell * 0.3, 3 + i % 5);
+        }
+
+        renderedImage->setOverlay (&overlay);
+    }
+
+    return renderedImage.get ();
+}
+
+QImage VertexEditorRenderingTest::render (QWidget *widget) const
+{
+    QImage canvas (widget->size (), QImage::Format_ARGB32);
+    canvas.fill (Qt::transparent);
+    widget->render (&canvas);
+
+    return canvas;
+}
+
+int VertexEditorRenderingTest::countChangedPixels (const QImage &actual, const QImage &expected) const
+{
+    const QImage a = actual.convertToFormat (QImage::Format_ARGB32);
+    const QImage b = expected.convertToFormat (QImage::Format_ARGB32);
+
+    int changed = 0;
+    for (int y = 0; y < a.height (); y++)
+    {
+        const QRgb *rowA = reinterpret_cast <const QRgb *> (a.constScanLine (y));
+        const QRgb *rowB = reinterpret_cast <const QRgb *> (b.constScanLine (y));
+
+        for (int x = 0; x < a.width (); x++)
+        {
+            const int difference = std::max ({ std::abs (qRed (rowA [x]) - qRed (rowB [x])),
+                std::abs (qGreen (rowA [x]) - qGreen (rowB [x])), std::abs (qBlue (rowA [x]) - qBlue (rowB [x])),
+                std::abs (qAlpha (rowA [x]) - qAlpha (rowB [x])) });
+
+            if (difference > CHANNEL_TOLERANCE)
+                changed++;
+        }
+    }
+
+    return changed;
+}
+
+QPolygonF VertexEditorRenderingTest::polygon (const QPointF &center, const double rx, const double ry, const int sides)
+{
+    QPolygonF result;
+    for (int i = 0; i < sides; i++)
+    {
+        const double angle = 2.0 * M_PI * i / sides;
+        result << center + QPointF (rx * std::cos (angle), ry * std::sin (angle));
+    }
+
+    return result;
+}
+
+int main (int argc, char *argv [])
+{
+    // Rendering mustn't depend on a display or the desktop style, so the offscreen platform and a
+    //  fixed style are used unless another platform is asked for
+    if (!qEnvironmentVariableIsSet ("QT_QPA_PLATFORM"))
+        qputenv ("QT_QPA_PLATFORM", "offscreen");
+
+    QApplication application (argc, argv);
+    QApplication::setStyle ("Fusion");
+
+    VertexEditorRenderingTest test;
+    return QTest::qExec (&test, argc, argv);
+}
+
+#include "tst_vertexeditorrenderingtest.moc"
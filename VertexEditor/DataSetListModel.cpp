@@ -0,0 +1,255 @@
+#include "DataSetListModel.h"
+
+/**
+ * A list model presenting the names of the data sets of a {@link VertexDataSetCollection}, optionally
+ *  filtered by name. Structural changes to the collection are made through this model so that views
+ *  are notified with a single, precise change rather than being rebuilt item by item.
+ *
+ * @author  Patrick Jahnig (Aerodlyn)
+ * @version 2026.10.19
+ */
+
+/* Constructors/Deconstructors */
+/**
+ * Creates a new {@link DataSetListModel} instance over the given collection, which must outlive it.
+ *
+ * @param collection - The collection to present
+ * @param parent     - The optional parent of this instance
+ */
+Aerodlyn::DataSetListModel::DataSetListModel (VertexDataSetCollection &collection, QObject *parent)
+    : QAbstractListModel (parent), collection (collection) {}
+
+/* Public Methods */
+/**
+ * See: https://doc.qt.io/qt-5/qabstractitemmodel.html#rowCount
+ */
+int Aerodlyn::DataSetListModel::rowCount (const QModelIndex &parent) const
+{
+    if (parent.isValid ())
+        return 0;
+
+    return filtered ? rows.size () : collection.length ();
+}
+
+/**
+ * See: https://doc.qt.io/qt-5/qabstractitemmodel.html#data
+ */
+QVariant Aerodlyn::DataSetListModel::data (const QModelIndex &index, int role) const
+{
+    if (!index.isValid () || index.row () >= rowCount () || role != Qt::DisplayRole)
+        return QVariant ();
+
+    return collection.at (dataSetIndex (index.row ())).name;
+}
+
+/**
+ * Adds a new data set with the given name to the collection.
+ *
+ * @param name - The name of the data set to add
+ *
+ * @return The index of the new data set in the collection, or -1 if the name is already in use
+ */
+int Aerodlyn::DataSetListModel::add (const QString &name)
+{
+    if (collection.contains (name))
+        return -1;
+
+    indexDirty = true;
+    if (filtered)
+    {
+        beginResetModel ();
+        const int index = collection.add (name);
+        refilter ();
+        endResetModel ();
+
+        return index;
+    }
+
+    const int row = collection.insertionIndex (name);
+
+    beginInsertRows (QModelIndex (), row, row);
+    const int index = collection.add (name);
+    endInsertRows ();
+
+    return index;
+}
+
+/**
+ * Adds a new data set for each of the given names to the collection, with a single reset of the
+ *  model.
+ *
+ * @param names - The names of the data sets to add
+ *
+ * @return The names that weren't added because they were repeated or already in use
+ */
+QStringList Aerodlyn::DataSetListModel::addAll (const QStringList &names)
+{
+    beginResetModel ();
+
+    const QStringList conflicts = collection.addAll (names);
+    indexDirty = true;
+    refilter ();
+
+    endResetModel ();
+    return conflicts;
+}
+
+/**
+ * Adds the given data sets, with their regions, to the collection, with a single reset of the
+ *  model.
+ *
+ * @param dataSets - The data sets to add
+ *
+ * @return The names that weren't added because they were repeated or already in use
+ */
+QStringList Aerodlyn::DataSetListModel::insertAll (QVector <VertexDataSet> dataSets)
+{
+    beginResetModel ();
+
+    const QStringList conflicts = collection.insertAll (std::move (dataSets));
+    indexDirty = true;
+    refilter ();
+
+    endResetModel ();
+    return conflicts;
+}
+
+/**
+ * Removes the data set shown at the given row from the collection.
+ *
+ * @param row - The row of the data set to remove
+ *
+ * @return True if the data set was removed, false if the row was invalid
+ */
+bool Aerodlyn::DataSetListModel::removeDataSet (const int row)
+{
+    if (row < 0 || row >= rowCount ())
+        return false;
+
+    const int index = dataSetIndex (row);
+    indexDirty = true;
+
+    beginRemoveRows (QModelIndex (), row, row);
+    collection.removeAt (index);
+
+    // Later data sets shift down by one in the collection
+    if (filtered)
+    {
+        rows.remove (row);
+        for (int i = row; i < rows.size (); i++)
+            rows [i]--;
+    }
+
+    endRemoveRows ();
+    return true;
+}
+
+/**
+ * Removes every data set from the collection, with a single reset of the model.
+ */
+void Aerodlyn::DataSetListModel::removeAll ()
+{
+    beginResetModel ();
+
+    collection.removeAll ();
+    rows.clear ();
+    indexDirty = true;
+
+    endResetModel ();
+}
+
+/**
+ * Notifies views that the collection was changed by something other than this model.
+ */
+void Aerodlyn::DataSetListModel::reload ()
+{
+    beginResetModel ();
+
+    indexDirty = true;
+    if (filtered)
+        refilter ();
+
+    endResetModel ();
+}
+
+/**
+ * Filters the data sets shown by name, ignoring case. A filter starting with '^' matches names
+ *  starting with the rest of the filter, any other filter matches names containing it. An empty
+ *  filter shows every data set.
+ *
+ * @param filter - The filter to apply
+ */
+void Aerodlyn::DataSetListModel::setFilter (const QString &filter)
+{
+    AERO_PROFILE_SCOPE ("DataSetListModel::setFilter");
+
+    beginResetModel ();
+
+    this->filter = filter;
+    filtered     = !filter.isEmpty ();
+    refilter ();
+
+    endResetModel ();
+}
+
+/**
+ * Returns the name of the data set shown at the given row.
+ *
+ * @param row - The row of the data set
+ *
+ * @return The name of the data set, or an empty string if the row is invalid
+ */
+QString Aerodlyn::DataSetListModel::nameAt (const int row) const
+{
+    if (row < 0 || row >= rowCount ())
+        return QString ();
+
+    return collection.at (dataSetIndex (row)).name;
+}
+
+/**
+ * Returns the row at which the data set with the given name is shown.
+ *
+ * @param name - The name of the data set
+ *
+ * @return The row of the data set, or -1 if it doesn't exist or is filtered out
+ */
+int Aerodlyn::DataSetListModel::rowOf (const QString &name) const
+{
+    const int index = collection.indexOf (name);
+    if (index == -1 || !filtered)
+        return index;
+
+    const auto it = std::lower_bound (rows.constBegin (), rows.constEnd (), index);
+    return it != rows.constEnd () && *it == index ? static_cast <int> (std::distance (rows.constBegin (), it)) : -1;
+}
+
+/* Private Methods */
+/**
+ * Returns the index in the collection of the data set shown at the given row.
+ *
+ * @param row - The row of the data set, which must be valid
+ *
+ * @return The index of the data set in the collection
+ */
+int Aerodlyn::DataSetListModel::dataSetIndex (const int row) const
+    { return filtered ? rows.at (row) : row; }
+
+/**
+ * Recomputes the rows shown for the current filter, rebuilding the name index first if the
+ *  collection changed since it was built.
+ */
+void Aerodlyn::DataSetListModel::refilter ()
+{
+    rows.clear ();
+    if (!filtered)
+        return;
+
+    if (indexDirty)
+    {
+        nameIndex.rebuild (collection);
+        indexDirty = false;
+    }
+
+    rows = filter.startsWith ('^') ? nameIndex.findPrefix (filter.mid (1)) : nameIndex.findSubstring (filter);
+}
@@ -0,0 +1,157 @@
+#ifndef DATA_SET_LIST_MODEL_H
+#define DATA_SET_LIST_MODEL_H
+
+#include <algorithm>
+#include <iterator>
+
+#include <QAbstractListModel>
+#include <QModelIndex>
+#include <QString>
+#include <QStringList>
+#include <QVariant>
+#include <QVector>
+
+#include "Root/Profiler.h"
+#include "VertexEditor/Utilities/DataSetNameIndex.h"
+#include "VertexEditor/Utilities/VertexDataSetCollection.h"
+
+namespace Aerodlyn
+{
+    /**
+     * A list model presenting the names of the data sets of a {@link VertexDataSetCollection}, optionally
+     *  filtered by name. Structural changes to the collection are made through this model so that views
+     *  are notified with a single, precise change rather than being rebuilt item by item.
+     *
+     * @author  Patrick Jahnig (Aerodlyn)
+     * @version 2026.10.19
+     */
+    class DataSetListModel : public QAbstractListModel
+    {
+        Q_OBJECT
+
+        public: // Constructors/Deconstructors
+            /**
+             * Creates a new {@link DataSetListModel} instance over the given collection, which must outlive it.
+             *
+             * @param collection - The collection to present
+             * @param parent     - The optional parent of this instance
+             */
+            DataSetListModel (VertexDataSetCollection &collection, QObject *parent = nullptr);
+
+        public: // Methods
+            /**
+             * See: https://doc.qt.io/qt-5/qabstractitemmodel.html#rowCount
+             */
+            int rowCount (const QModelIndex &parent = QModelIndex ()) const override;
+
+            /**
+             * See: https://doc.qt.io/qt-5/qabstractitemmodel.html#data
+             */
+            QVariant data (const QModelIndex &index, int role = Qt::DisplayRole) const override;
+
+            /**
+             * Adds a new data set with the given name to the collection.
+             *
+             * @param name - The name of the data set to add
+             *
+             * @return The index of the new data set in the collection, or -1 if the name is already in use
+             */
+            int add (const QString &name);
+
+            /**
+             * Adds a new data set for each of the given names to the collection, with a single reset of the
+             *  model.
+             *
+             * @param names - The names of the data sets to add
+             *
+             * @return The names that weren't added because they were repeated or already in use
+             */
+            QStringList addAll (const QStringList &names);
+
+            /**
+             * Adds the given data sets, with their regions, to the collection, with a single reset of the
+             *  model.
+             *
+             * @param dataSets - The data sets to add
+             *
+             * @return The names that weren't added because they were repeated or already in use
+             */
+            QStringList insertAll (QVector <VertexDataSet> dataSets);
+
+            /**
+             * Removes the data set shown at the given row from the collection.
+             *
+             * @param row - The row of the data set to remove
+             *
+             * @return True if the data set was removed, false if the row was invalid
+             */
+            bool removeDataSet (const int row);
+
+            /**
+             * Removes every data set from the collection, with a single reset of the model.
+             */
+            void removeAll ();
+
+            /**
+             * Notifies views that the collection was changed by something other than this model.
+             */
+            void reload ();
+
+            /**
+             * Filters the data sets shown by name, ignoring case. A filter starting with '^' matches names
+             *  starting with the rest of the filter, any other filter matches names containing it. An empty
+             *  filter shows every data set.
+             *
+             * @param filter - The filter to apply
+             */
+            void setFilter (const QString &filter);
+
+            /**
+             * Returns the name of the data set shown at the given row.
+             *
+             * @param row - The row of the data set
+             *
+             * @return The name of the data set, or an empty string if the row is invalid
+             */
+            QString nameAt (const int row) const;
+
+            /**
+             * Returns the row at which the data set with the given name is shown.
+             *
+             * @param name - The name of the data set
+             *
+             * @return The row of the data set, or -1 if it doesn't exist or is filtered out
+             */
+            int rowOf (const QString &name) const;
+
+        private: // Methods
+            /**
+             * Returns the index in the collection of the data set shown at the given row.
+             *
+             * @param row - The row of the data set, which must be valid
+             *
+             * @return The index of the data set in the collection
+             */
+            int dataSetIndex (const int row) const;
+
+            /**
+             * Recomputes the rows shown for the current filter, rebuilding the name index first if the
+             *  collection changed since it was built.
+             */
+            void refilter ();
+
+        private: // Variables
+            bool                                               filtered   = false;
+            bool                                               indexDirty = true;
+
+            DataSetNameIndex                                   nameIndex;
+
+            QString                                            filter;
+
+            QVector <int>                                      rows;
+
+            VertexDataSetCollection                            &collection;
+    };
+}
+
+#endif // DATA_SET_LIST_MODEL_H
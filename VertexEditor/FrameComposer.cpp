@@ -0,0 +1,297 @@
+#include "FrameComposer.h"
+
+/**
+ * Composes the frames shown by {@link VertexEditorRenderedImage} on a render thread: the
+ *  background and the image, the overlay and highlighted data sets, and the current region with
+ *  its markers. The GUI thread copies what a frame shows into a {@link Snapshot} (which is cheap,
+ *  as the regions and image are implicitly shared) and submits it. The render thread composes
+ *  the latest snapshot into an image and hands it back, so painting only has to draw that image
+ *  however heavy the frame is. Only the area of the snapshot (the part of the widget shown in its
+ *  scroll area) is composed, so a frame costs what is on screen rather than the whole image.
+ *
+ * Snapshots and frames are each handed over through a {@link TripleBuffer}, so neither thread
+ *  ever waits on the other. Snapshots submitted while a frame is being composed are merged into
+ *  the next one, and frames finished before the GUI thread painted are dropped.
+ *
+ * @author  Patrick Jahnig (Aerodlyn)
+ * @version 2026.10.19
+ */
+
+/* Constructors/Deconstructors */
+/**
+ * Creates a new {@link FrameComposer} instance and starts its render thread.
+ *
+ * @param parent - The optional parent of this instance
+ */
+Aerodlyn::FrameComposer::FrameComposer (QObject *parent) : QObject (parent)
+{
+    renderThread.setObjectName ("FrameComposer");
+    worker.moveToThread (&renderThread);
+    renderThread.start ();
+}
+
+/**
+ * Stops the render thread, once it has finished the frame it is composing.
+ */
+Aerodlyn::FrameComposer::~FrameComposer ()
+{
+    renderThread.quit ();
+    renderThread.wait ();
+}
+
+/* Public Methods */
+/**
+ * Returns the snapshot to fill before calling {@link #submit}. Its contents are whatever it held
+ *  the last time it was used, so every member should be set. Only the GUI thread may call this.
+ *
+ * @return The snapshot to fill
+ */
+Aerodlyn::FrameComposer::Snapshot &Aerodlyn::FrameComposer::nextSnapshot ()
+    { return snapshots.back (); }
+
+/**
+ * Hands the filled snapshot to the render thread, which composes a frame from it and then
+ *  signals {@link #frameReady}. Only the GUI thread may call this.
+ */
+void Aerodlyn::FrameComposer::submit ()
+{
+    snapshots.publish ();
+
+    // Every submission wakes the render thread, but one that finds its snapshot already composed
+    //  (merged into an earlier frame) does nothing
+    QMetaObject::invokeMethod (&worker, [this] { composeLatest (); }, Qt::QueuedConnection);
+}
+
+/**
+ * Takes the latest frame finished by the render thread, if one was finished since the last
+ *  time. Only the GUI thread may call this.
+ *
+ * @return True if a new frame was taken, false otherwise
+ */
+bool Aerodlyn::FrameComposer::takeFrame ()
+    { return frames.take (); }
+
+/**
+ * Returns the frame last taken or composed by {@link #composeNow}. Only the GUI thread may call
+ *  this.
+ *
+ * @return The current frame
+ */
+Aerodlyn::FrameComposer::Frame &Aerodlyn::FrameComposer::frame ()
+    { return frames.front (); }
+
+/**
+ * Composes a frame from the given snapshot on the calling thread, replacing the current frame,
+ *  for when it can't wait for the render thread. Only the GUI thread may call this.
+ *
+ * @param snapshot - The snapshot to compose the frame from
+ */
+void Aerodlyn::FrameComposer::composeNow (const Snapshot &snapshot)
+{
+    Frame &current = frames.front ();
+
+    compose (snapshot, current.image);
+    current.revision = snapshot.revision;
+    current.area     = snapshot.area;
+}
+
+/* Private Methods */
+/**
+ * Composes the latest submitted snapshot, if it wasn't composed already, and hands the frame
+ *  back. Runs on the render thread.
+ */
+void Aerodlyn::FrameComposer::composeLatest ()
+{
+    if (!snapshots.take ())
+        return;
+
+    const Snapshot &snapshot = snapshots.front ();
+    Frame &next = frames.back ();
+
+    compose (snapshot, next.image);
+    next.revision = snapshot.revision;
+    next.area     = snapshot.area;
+
+    frames.publish ();
+    emit frameReady ();
+}
+
+/**
+ * Composes the area of the given snapshot into the given image, which is reallocated if it
+ *  has another size.
+ *
+ * @param snapshot - The snapshot to compose the frame from
+ * @param target   - The image to compose the frame into
+ */
+void Aerodlyn::FrameComposer::compose (const Snapshot &snapshot, QImage &target) const
+{
+    AERO_PROFILE_SCOPE ("FrameComposer::compose");
+
+    // Composed in device pixels, so that blitting the frame on a high-DPI screen doesn't scale it
+    const QSize pixels = snapshot.area.size () * snapshot.devicePixelRatio;
+    if (target.size () != pixels)
+        target = QImage (pixels, QImage::Format_ARGB32_Premultiplied);
+
+    target.setDevicePixelRatio (snapshot.devicePixelRatio);
+    if (target.isNull ())
+        return;
+
+    target.fill (BACKGROUND_COLOR);
+
+    // Everything is painted in the coordinates of the widget, moved so that the area starts at the
+    //  corner of the frame
+    QPainter painter (&target);
+    painter.translate (-snapshot.area.topLeft ());
+
+    const QRect &exposed = snapshot.area;
+
+    painter.drawImage ((snapshot.size.width () - snapshot.image.width ()) / 2,
+        (snapshot.size.height () - snapshot.image.height ()) / 2, snapshot.image);
+
+    if (!snapshot.overlay.isEmpty ())
+        paintOverlay (painter, snapshot, exposed);
+
+    if (!snapshot.highlighted.isEmpty ())
+        paintHighlighted (painter, snapshot, exposed);
+
+    if (snapshot.hasRegion)
+        paintRegion (painter, snapshot, exposed);
+}
+
+/**
+ * Paints the current region of the given snapshot: its edges, its points (highlighting the
+ *  hovered and selected ones) and the outline of any selection being dragged.
+ *
+ * @param painter  - The painter to paint with
+ * @param snapshot - The snapshot to paint the region of
+ * @param exposed  - The area being painted
+ */
+void Aerodlyn::FrameComposer::paintRegion (QPainter &painter, const Snapshot &snapshot, const QRect &exposed) const
+{
+    const QPolygonF &region = snapshot.region;
+    const QPointF &center   = snapshot.center;
+
+    // A culled region still paints the outline of a selection being dragged
+    const int size = regionVisible (snapshot, exposed) ? region.size () : 0;
+
+    painter.setPen (QColor ("#FFFFFF"));
+    if (size >= 2)
+        painter.drawLine (region.at (0) + center, region.at (size - 1) + center);
+
+    auto nextSelected = snapshot.selectedPoints.constBegin ();
+    for (int i = 0; i < size; i++)
+    {
+        const QPointF point = region.at (i) + center;
+
+        if (size >= 2 && i < size - 1)
+            painter.drawLine (point, region.at (i + 1) + center);
+
+        // The selection is sorted, so it can be walked alongside the points
+        const bool selected = nextSelected != snapshot.selectedPoints.constEnd () && *nextSelected == i;
+        if (selected)
+            nextSelected++;
+
+        if (snapshot.selectedPointIndex == i)
+            painter.setBrush (QBrush ("#000000"));
+
+        else if (selected)
+            painter.setBrush (QBrush (SELECTION_COLOR));
+
+        else
+            painter.setBrush (QBrush ("#FFFFFF"));
+
+        painter.drawEllipse (point, POINT_RADIUS, POINT_RADIUS);
+    }
+
+    if (!snapshot.selectionOutline.isEmpty ())
+    {
+        painter.setPen (QPen (SELECTION_COLOR, 1.0, Qt::DashLine));
+        painter.setBrush (Qt::NoBrush);
+        painter.drawPolygon (snapshot.selectionOutline.translated (center));
+    }
+}
+
+/**
+ * Determines if any edge or point of the current region of the given snapshot may lie within the
+ *  given area, using the bounding box of the region. Always true if the bounds aren't known.
+ *
+ * @param snapshot - The snapshot holding the region
+ * @param exposed  - The area being painted
+ *
+ * @return False if the region is entirely outside of the given area, true otherwise
+ */
+bool Aerodlyn::FrameComposer::regionVisible (const Snapshot &snapshot, const QRect &exposed) const
+{
+    if (snapshot.regionBounds.isNull () || snapshot.region.isEmpty ())
+        return true;
+
+    return snapshot.regionBounds.translated (snapshot.center)
+        .adjusted (-POINT_RADIUS, -POINT_RADIUS, POINT_RADIUS, POINT_RADIUS).intersects (QRectF (exposed));
+}
+
+/**
+ * Paints every overlay shape of the given snapshot whose bounding box intersects the given
+ *  area, each filled with a translucent color of its hue.
+ *
+ * @param painter  - The painter to paint with
+ * @param snapshot - The snapshot to paint the overlay of
+ * @param exposed  - The area being painted
+ */
+void Aerodlyn::FrameComposer::paintOverlay (QPainter &painter, const Snapshot &snapshot, const QRect &exposed) const
+{
+    AERO_PROFILE_SCOPE ("FrameComposer::paintOverlay");
+
+    // Regions are in coordinates relative to the center, so the exposed area is moved there instead
+    //  of moving every path out of it
+    const QRectF visible = QRectF (exposed).translated (-snapshot.center);
+
+    painter.save ();
+    painter.translate (snapshot.center);
+
+    for (const Shape &shape : snapshot.overlay)
+    {
+        // Bounding boxes of regions without area are grown, so that they can still intersect
+        if (!shape.bounds.adjusted (-1.0, -1.0, 1.0, 1.0).intersects (visible))
+            continue;
+
+        painter.setPen (QColor::fromHsv (shape.hue, 200, 255));
+        painter.setBrush (QColor::fromHsv (shape.hue, 200, 255, OVERLAY_FILL_ALPHA));
+        painter.drawPolygon (shape.region);
+    }
+
+    painter.restore ();
+}
+
+/**
+ * Paints every highlighted shape of the given snapshot whose bounding box intersects the given
+ *  area.
+ *
+ * @param painter  - The painter to paint with
+ * @param snapshot - The snapshot to paint the highlighted shapes of
+ * @param exposed  - The area being painted
+ */
+void Aerodlyn::FrameComposer::paintHighlighted (QPainter &painter, const Snapshot &snapshot, const QRect &exposed) const
+{
+    AERO_PROFILE_SCOPE ("FrameComposer::paintHighlighted");
+
+    const QRectF visible = QRectF (exposed).translated (-snapshot.center);
+
+    painter.save ();
+    painter.translate (snapshot.center);
+
+    QColor fill = HIGHLIGHT_COLOR;
+    fill.setAlpha (HIGHLIGHT_FILL_ALPHA);
+
+    painter.setPen (QPen (HIGHLIGHT_COLOR, HIGHLIGHT_WIDTH));
+    painter.setBrush (fill);
+
+    for (const Shape &shape : snapshot.highlighted)
+    {
+        if (!shape.bounds.adjusted (-HIGHLIGHT_WIDTH, -HIGHLIGHT_WIDTH, HIGHLIGHT_WIDTH, HIGHLIGHT_WIDTH).intersects (visible))
+            continue;
+
+        painter.drawPolygon (shape.region);
+    }
+
+    painter.restore ();
+}
@@ -0,0 +1,244 @@
+#ifndef FRAME_COMPOSER_H
+#define FRAME_COMPOSER_H
+
+#include <QColor>
+#include <QImage>
+#include <QMetaObject>
+#include <QObject>
+#include <QPainter>
+#include <QPen>
+#include <QPointF>
+#include <QPolygonF>
+#include <QRect>
+#include <QRectF>
+#include <QSize>
+#include <QThread>
+#include <QVector>
+
+#include "Root/Profiler.h"
+#include "VertexEditor/Utilities/TripleBuffer.h"
+
+namespace Aerodlyn
+{
+    /**
+     * Composes the frames shown by {@link VertexEditorRenderedImage} on a render thread: the
+     *  background and the image, the overlay and highlighted data sets, and the current region with
+     *  its markers. The GUI thread copies what a frame shows into a {@link Snapshot} (which is cheap,
+     *  as the regions and image are implicitly shared) and submits it. The render thread composes
+     *  the latest snapshot into an image and hands it back, so painting only has to draw that image
+     *  however heavy the frame is. Only the area of the snapshot (the part of the widget shown in its
+     *  scroll area) is composed, so a frame costs what is on screen rather than the whole image.
+     *
+     * Snapshots and frames are each handed over through a {@link TripleBuffer}, so neither thread
+     *  ever waits on the other. Snapshots submitted while a frame is being composed are merged into
+     *  the next one, and frames finished before the GUI thread painted are dropped.
+     *
+     * @author  Patrick Jahnig (Aerodlyn)
+     * @version 2026.10.19
+     */
+    class FrameComposer : public QObject
+    {
+        Q_OBJECT
+
+        public: // Types
+            /**
+             * A filled and outlined region, with its bounds for culling. Regions are handed over rather
+             *  than the paths cached for them, as painting a path updates caches within it that the GUI
+             *  thread may be reading at the same time.
+             */
+            struct Shape
+            {
+                QPolygonF    region;
+                QRectF       bounds;
+
+                int          hue = 0;
+            };
+
+            /**
+             * Everything a frame shows, as of when it was submitted.
+             */
+            struct Snapshot
+            {
+                // Identifies the state the snapshot was taken from, for telling if a frame is current
+                quint64        revision           = 0;
+
+                QSize          size;
+
+                // The part of the widget to compose, in its coordinates
+                QRect          area;
+
+                double         devicePixelRatio   = 1.0;
+
+                QPointF        center;
+
+                QImage         image;
+
+                QVector <Shape> overlay;
+                QVector <Shape> highlighted;
+
+                bool           hasRegion          = false;
+
+                QPolygonF      region;
+
+                // The bounds of the region, or a null rectangle if they aren't known (so it is never culled)
+                QRectF         regionBounds;
+
+                int            selectedPointIndex = -1;
+
+                QVector <int>  selectedPoints;
+
+                QPolygonF      selectionOutline;
+            };
+
+            /**
+             * A composed frame.
+             */
+            struct Frame
+            {
+                // The revision of the snapshot it was composed from
+                quint64 revision = 0;
+
+                // The part of the widget it covers, in its coordinates
+                QRect   area;
+
+                QImage  image;
+            };
+
+        public: // Constructors/Deconstructors
+            /**
+             * Creates a new {@link FrameComposer} instance and starts its render thread.
+             *
+             * @param parent - The optional parent of this instance
+             */
+            FrameComposer (QObject *parent = nullptr);
+
+            /**
+             * Stops the render thread, once it has finished the frame it is composing.
+             */
+            ~FrameComposer () override;
+
+        public: // Methods
+            /**
+             * Returns the snapshot to fill before calling {@link #submit}. Its contents are whatever it held
+             *  the last time it was used, so every member should be set. Only the GUI thread may call this.
+             *
+             * @return The snapshot to fill
+             */
+            Snapshot &nextSnapshot ();
+
+            /**
+             * Hands the filled snapshot to the render thread, which composes a frame from it and then
+             *  signals {@link #frameReady}. Only the GUI thread may call this.
+             */
+            void submit ();
+
+            /**
+             * Takes the latest frame finished by the render thread, if one was finished since the last
+             *  time. Only the GUI thread may call this.
+             *
+             * @return True if a new frame was taken, false otherwise
+             */
+            bool takeFrame ();
+
+            /**
+             * Returns the frame last taken or composed by {@link #composeNow}. Only the GUI thread may call
+             *  this.
+             *
+             * @return The current frame
+             */
+            Frame &frame ();
+
+            /**
+             * Composes a frame from the given snapshot on the calling thread, replacing the current frame,
+             *  for when it can't wait for the render thread. Only the GUI thread may call this.
+             *
+             * @param snapshot - The snapshot to compose the frame from
+             */
+            void composeNow (const Snapshot &snapshot);
+
+        signals:
+            /**
+             * Signals, from the render thread, that a frame was finished and can be taken.
+             */
+            void frameReady ();
+
+        private: // Methods
+            /**
+             * Composes the latest submitted snapshot, if it wasn't composed already, and hands the frame
+             *  back. Runs on the render thread.
+             */
+            void composeLatest ();
+
+            /**
+             * Composes the area of the given snapshot into the given image, which is reallocated if it
+             *  has another size.
+             *
+             * @param snapshot - The snapshot to compose the frame from
+             * @param target   - The image to compose the frame into
+             */
+            void compose (const Snapshot &snapshot, QImage &target) const;
+
+            /**
+             * Paints the current region of the given snapshot: its edges, its points (highlighting the
+             *  hovered and selected ones) and the outline of any selection being dragged.
+             *
+             * @param painter  - The painter to paint with
+             * @param snapshot - The snapshot to paint the region of
+             * @param exposed  - The area being painted
+             */
+            void paintRegion (QPainter &painter, const Snapshot &snapshot, const QRect &exposed) const;
+
+            /**
+             * Determines if any edge or point of the current region of the given snapshot may lie within the
+             *  given area, using the bounding box of the region. Always true if the bounds aren't known.
+             *
+             * @param snapshot - The snapshot holding the region
+             * @param exposed  - The area being painted
+             *
+             * @return False if the region is entirely outside of the given area, true otherwise
+             */
+            bool regionVisible (const Snapshot &snapshot, const QRect &exposed) const;
+
+            /**
+             * Paints every overlay shape of the given snapshot whose bounding box intersects the given
+             *  area, each filled with a translucent color of its hue.
+             *
+             * @param painter  - The painter to paint with
+             * @param snapshot - The snapshot to paint the overlay of
+             * @param exposed  - The area being painted
+             */
+            void paintOverlay (QPainter &painter, const Snapshot &snapshot, const QRect &exposed) const;
+
+            /**
+             * Paints every highlighted shape of the given snapshot whose bounding box intersects the given
+             *  area.
+             *
+             * @param painter  - The painter to paint with
+             * @param snapshot - The snapshot to paint the highlighted shapes of
+             * @param exposed  - The area being painted
+             */
+            void paintHighlighted (QPainter &painter, const Snapshot &snapshot, const QRect &exposed) const;
+
+        private: // Variables
+            const int                                          OVERLAY_FILL_ALPHA   = 60;
+            const int                                          HIGHLIGHT_FILL_ALPHA = 90;
+
+            const double                                       POINT_RADIUS         = 5.0;
+            const double                                       HIGHLIGHT_WIDTH      = 2.0;
+
+            const QColor                                       BACKGROUND_COLOR     = QColor ("#FF00FF");
+            const QColor                                       SELECTION_COLOR      = QColor ("#00C8FF");
+            const QColor                                       HIGHLIGHT_COLOR      = QColor ("#FF3030");
+
+            // Lives on the render thread, so that work queued to it runs there
+            QObject                                            worker;
+
+            QThread                                            renderThread;
+
+            TripleBuffer <Snapshot>                            snapshots;
+
+            TripleBuffer <Frame>                               frames;
+    };
+}
+
+#endif // FRAME_COMPOSER_H
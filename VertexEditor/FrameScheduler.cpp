@@ -0,0 +1,132 @@
+#include "FrameScheduler.h"
+
+/**
+ * Paces work to the display refresh rate. Input handlers record what changed and request a frame;
+ *  however many requests arrive before the next display frame, {@link #frame} is only signalled
+ *  once, so pending input and the resulting table and canvas refreshes are applied once per frame.
+ *
+ * @author  Patrick Jahnig (Aerodlyn)
+ * @version 2026.10.19
+ */
+
+/* Constructors/Deconstructors */
+/**
+ * Creates a new {@link FrameScheduler} instance, paced to the refresh rate of the primary
+ *  screen.
+ *
+ * @param parent - The optional parent of this instance
+ */
+Aerodlyn::FrameScheduler::FrameScheduler (QObject *parent) : QObject (parent)
+{
+    const QScreen *screen = QGuiApplication::primaryScreen ();
+    const double refreshRate = screen && screen->refreshRate () > 0 ? screen->refreshRate () : DEFAULT_REFRESH_RATE;
+
+    interval = std::max (1, static_cast <int> (1000.0 / refreshRate));
+
+    timer.setSingleShot (true);
+    timer.setTimerType (Qt::PreciseTimer);
+    connect (&timer, &QTimer::timeout, this, &FrameScheduler::handleTimeout);
+
+    sinceLastFrame.start ();
+}
+
+/* Public Methods */
+/**
+ * Records that an input event was received, for the purposes of {@link #stats}.
+ */
+void Aerodlyn::FrameScheduler::noteEvent ()
+    { counters.eventsReceived++; }
+
+/**
+ * Records whether the frame currently being signalled issued a repaint, for the purposes of
+ *  {@link #stats}.
+ *
+ * @param rendered - True if a repaint was issued, false if it was skipped
+ */
+void Aerodlyn::FrameScheduler::noteFrame (const bool rendered)
+{
+    if (rendered)
+        counters.framesRendered++;
+
+    else
+        counters.repaintsSkipped++;
+}
+
+/**
+ * Requests that {@link #frame} be signalled at the next display frame. Requests made while one
+ *  is already pending are merged into it.
+ */
+void Aerodlyn::FrameScheduler::requestFrame ()
+{
+    if (timer.isActive ())
+        return;
+
+    const qint64 elapsed = sinceLastFrame.elapsed ();
+    timer.start (elapsed >= interval ? 0 : static_cast <int> (interval - elapsed));
+}
+
+/**
+ * Signals {@link #frame} right away if a frame was requested and hasn't been signalled yet,
+ *  such as to replay recorded input without waiting for the display.
+ */
+void Aerodlyn::FrameScheduler::flush ()
+{
+    if (!timer.isActive ())
+        return;
+
+    timer.stop ();
+    handleTimeout ();
+}
+
+/**
+ * Determines if a frame was requested and hasn't been signalled yet.
+ *
+ * @return True if a frame is pending, false otherwise
+ */
+bool Aerodlyn::FrameScheduler::isPending () const
+    { return timer.isActive (); }
+
+/**
+ * Returns the time left until the pending frame is signalled.
+ *
+ * @return The time left until the next frame in milliseconds, or -1 if no frame is pending
+ */
+int Aerodlyn::FrameScheduler::remainingTime () const
+    { return timer.remainingTime (); }
+
+/**
+ * Returns the counters collected since this instance was created.
+ *
+ * @return The collected counters
+ */
+const Aerodlyn::FrameScheduler::Stats &Aerodlyn::FrameScheduler::stats () const
+    { return counters; }
+
+/**
+ * Returns the interval between two display frames.
+ *
+ * @return The interval between two frames, in milliseconds
+ */
+int Aerodlyn::FrameScheduler::frameInterval () const
+    { return interval; }
+
+/**
+ * Returns a timer restarted whenever {@link #frame} is signalled, for timing the work of a frame
+ *  from its start.
+ *
+ * @return The timer restarted at the start of the last frame
+ */
+const QElapsedTimer &Aerodlyn::FrameScheduler::frameTimer () const
+    { return sinceLastFrame; }
+
+/* Private Slots */
+/**
+ * Handles the frame timer firing by signalling {@link #frame}.
+ */
+void Aerodlyn::FrameScheduler::handleTimeout ()
+{
+    sinceLastFrame.restart ();
+    counters.framesScheduled++;
+
+    emit frame ();
+}
@@ -0,0 +1,134 @@
+#ifndef FRAME_SCHEDULER_H
+#define FRAME_SCHEDULER_H
+
+#include <algorithm>
+
+#include <QElapsedTimer>
+#include <QGuiApplication>
+#include <QObject>
+#include <QScreen>
+#include <QTimer>
+
+namespace Aerodlyn
+{
+    /**
+     * Paces work to the display refresh rate. Input handlers record what changed and request a frame;
+     *  however many requests arrive before the next display frame, {@link #frame} is only signalled
+     *  once, so pending input and the resulting table and canvas refreshes are applied once per frame.
+     *
+     * @author  Patrick Jahnig (Aerodlyn)
+     * @version 2026.10.19
+     */
+    class FrameScheduler : public QObject
+    {
+        Q_OBJECT
+
+        public: // Types
+            /**
+             * Counters describing how much input was coalesced into how many frames.
+             */
+            struct Stats
+            {
+                quint64 eventsReceived = 0;
+                quint64 framesScheduled = 0;
+                quint64 framesRendered = 0;
+                quint64 repaintsSkipped = 0;
+            };
+
+        public: // Constructors/Deconstructors
+            /**
+             * Creates a new {@link FrameScheduler} instance, paced to the refresh rate of the primary
+             *  screen.
+             *
+             * @param parent - The optional parent of this instance
+             */
+            FrameScheduler (QObject *parent = nullptr);
+
+        public: // Methods
+            /**
+             * Records that an input event was received, for the purposes of {@link #stats}.
+             */
+            void noteEvent ();
+
+            /**
+             * Records whether the frame currently being signalled issued a repaint, for the purposes of
+             *  {@link #stats}.
+             *
+             * @param rendered - True if a repaint was issued, false if it was skipped
+             */
+            void noteFrame (const bool rendered);
+
+            /**
+             * Requests that {@link #frame} be signalled at the next display frame. Requests made while one
+             *  is already pending are merged into it.
+             */
+            void requestFrame ();
+
+            /**
+             * Signals {@link #frame} right away if a frame was requested and hasn't been signalled yet,
+             *  such as to replay recorded input without waiting for the display.
+             */
+            void flush ();
+
+            /**
+             * Determines if a frame was requested and hasn't been signalled yet.
+             *
+             * @return True if a frame is pending, false otherwise
+             */
+            bool isPending () const;
+
+            /**
+             * Returns the time left until the pending frame is signalled.
+             *
+             * @return The time left until the next frame in milliseconds, or -1 if no frame is pending
+             */
+            int remainingTime () const;
+
+            /**
+             * Returns the counters collected since this instance was created.
+             *
+             * @return The collected counters
+             */
+            const Stats &stats () const;
+
+            /**
+             * Returns the interval between two display frames.
+             *
+             * @return The interval between two frames, in milliseconds
+             */
+            int frameInterval () const;
+
+            /**
+             * Returns a timer restarted whenever {@link #frame} is signalled, for timing the work of a frame
+             *  from its start.
+             *
+             * @return The timer restarted at the start of the last frame
+             */
+            const QElapsedTimer &frameTimer () const;
+
+        signals:
+            /**
+             * Signals that a display frame has started and that pending work should be applied.
+             */
+            void frame ();
+
+        private slots:
+            /**
+             * Handles the frame timer firing by signalling {@link #frame}.
+             */
+            void handleTimeout ();
+
+        private: // Variables
+            const int                                          DEFAULT_REFRESH_RATE = 60;
+
+            int                                                interval;
+
+            QElapsedTimer                                      sinceLastFrame;
+
+            QTimer                                             timer;
+
+            Stats                                              counters;
+    };
+}
+
+#endif // FRAME_SCHEDULER_H
@@ -0,0 +1,376 @@
+#include "InputRecorder.h"
+
+/**
+ * Records the input reaching a {@link VertexEditorWindow} to a file, so that an interaction can be
+ *  replayed by {@link InputReplayer} to reproduce it or to benchmark it. Mouse, wheel and key events
+ *  are recorded as the window receives them from the platform, before they are sent on to its
+ *  widgets, along with the menu actions triggered and the image and project files opened. Input
+ *  to dialogs isn't recorded, as the files a dialog chooses are.
+ *
+ * @author  Patrick Jahnig (Aerodlyn)
+ * @version 2026.10.19
+ */
+
+/* Constructors/Deconstructors */
+/**
+ * Creates a new {@link InputRecorder} instance, which doesn't record until {@link #start} is
+ *  called.
+ *
+ * @param parent - The optional parent of this instance
+ */
+Aerodlyn::InputRecorder::InputRecorder (QObject *parent) : QObject (parent)
+    { stream.setByteOrder (QDataStream::LittleEndian); }
+
+/**
+ * Stops recording, closing the file.
+ */
+Aerodlyn::InputRecorder::~InputRecorder ()
+    { stop (); }
+
+/* Public Methods */
+/**
+ * Starts recording the input reaching the given window to the file at the given filepath,
+ *  replacing it. The window must have been shown.
+ *
+ * @param window   - The window to record the input of
+ * @param filepath - The (full) filepath of the file to record to
+ *
+ * @return True if recording started, false if the file couldn't be written
+ */
+bool Aerodlyn::InputRecorder::start (VertexEditorWindow *window, const QString &filepath)
+{
+    stop ();
+
+    file.setFileName (filepath);
+    if (!file.open (QIODevice::WriteOnly | QIODevice::Truncate))
+        return false;
+
+    stream.setDevice (&file);
+    stream << MAGIC << VERSION << static_cast <quint16> (window->width ()) << static_cast <quint16> (window->height ());
+
+    // The menus are filled in after the first frame, but every action is added to one of them
+    for (QMenu *menu : window->menuBar ()->findChildren <QMenu *> ())
+        connect (menu, &QMenu::triggered, this, &InputRecorder::handleActionTriggered, Qt::UniqueConnection);
+
+    connect (window, &VertexEditorWindow::imageOpened, this, [this] (const QString &filepath)
+        { recordFile (ImageOpened, filepath); });
+    connect (window, &VertexEditorWindow::projectOpened, this, [this] (const QString &filepath)
+        { recordFile (ProjectOpened, filepath); });
+
+    recordedWindow = window;
+    recordedWindow->windowHandle ()->installEventFilter (this);
+
+    lastTime = 0;
+    clock.start ();
+
+    return true;
+}
+
+/**
+ * Stops recording, closing the file. Does nothing if not recording.
+ */
+void Aerodlyn::InputRecorder::stop ()
+{
+    if (!file.isOpen ())
+        return;
+
+    if (recordedWindow)
+    {
+        recordedWindow->windowHandle ()->removeEventFilter (this);
+        QObject::disconnect (recordedWindow, nullptr, this, nullptr);
+
+        for (QMenu *menu : recordedWindow->menuBar ()->findChildren <QMenu *> ())
+            QObject::disconnect (menu, nullptr, this, nullptr);
+    }
+
+    stream.setDevice (nullptr);
+    file.close ();
+}
+
+/**
+ * Reads a recording from the file at the given filepath.
+ *
+ * @param filepath   - The (full) filepath of the file to read
+ * @param windowSize - Set to the size of the window when the recording started
+ * @param events     - Set to the events of the recording, oldest first
+ *
+ * @return True if the file was read, false if it isn't a recording or couldn't be read
+ */
+bool Aerodlyn::InputRecorder::read (const QString &filepath, QSize &windowSize, QVector <Event> &events)
+{
+    QFile input (filepath);
+    if (!input.open (QIODevice::ReadOnly))
+        return false;
+
+    QDataStream in (&input);
+    in.setByteOrder (QDataStream::LittleEndian);
+
+    quint32 magic = 0, version = 0;
+    quint16 width = 0, height = 0;
+    in >> magic >> version >> width >> height;
+
+    if (in.status () != QDataStream::Ok || magic != MAGIC || version > VERSION)
+        return false;
+
+    windowSize = QSize (width, height);
+    events.clear ();
+
+    qint64 time = 0;
+    while (!in.atEnd ())
+    {
+        quint8 kind = 0;
+        quint32 delta = 0;
+        in >> kind >> delta;
+
+        Event event;
+        event.kind = static_cast <Kind> (kind);
+        event.time = time += static_cast <qint64> (delta) * 1000;
+
+        qint16 x = 0, y = 0, dx = 0, dy = 0;
+        quint8 button = 0, buttons = 0, modifiers = 0, autoRepeat = 0;
+        quint16 w = 0, h = 0;
+        quint32 key = 0;
+
+        switch (event.kind)
+        {
+            case MousePress:
+            case MouseRelease:
+            case MouseDoubleClick:
+            case MouseMove:
+                in >> x >> y >> button >> buttons >> modifiers;
+                event.position = QPoint (x, y);
+                event.button   = static_cast <Qt::MouseButton> (button);
+                event.buttons  = Qt::MouseButtons (buttons);
+                break;
+
+            case Wheel:
+                in >> x >> y >> dx >> dy >> buttons >> modifiers;
+                event.position   = QPoint (x, y);
+                event.angleDelta = QPoint (dx, dy);
+                event.buttons    = Qt::MouseButtons (buttons);
+                break;
+
+            case KeyPress:
+            case KeyRelease:
+                in >> key >> modifiers >> autoRepeat;
+                event.key        = static_cast <int> (key);
+                event.autoRepeat = autoRepeat != 0;
+                event.text       = readString (in);
+                break;
+
+            case Action:
+            case ImageOpened:
+            case ProjectOpened:
+                event.text = readString (in);
+                break;
+
+            case Resize:
+                in >> w >> h;
+                event.size = QSize (w, h);
+                break;
+
+            default:
+                return false;
+        }
+
+        event.modifiers = Qt::KeyboardModifiers (static_cast <int> (modifiers) << MODIFIER_SHIFT);
+
+        // A recording cut short (such as by a crash) is kept up to its last whole event
+        if (in.status () != QDataStream::Ok)
+            break;
+
+        events.append (event);
+    }
+
+    return true;
+}
+
+/* Protected Methods */
+/**
+ * See: https://doc.qt.io/qt-5/qobject.html#eventFilter
+ */
+bool Aerodlyn::InputRecorder::eventFilter (QObject *watched, QEvent *event)
+{
+    Q_UNUSED (watched)
+
+    Event recorded;
+
+    switch (event->type ())
+    {
+        case QEvent::MouseButtonPress:
+        case QEvent::MouseButtonRelease:
+        case QEvent::MouseButtonDblClick:
+        case QEvent::MouseMove:
+        {
+            const QMouseEvent *mouse = static_cast <const QMouseEvent *> (event);
+
+            recorded.kind      = event->type () == QEvent::MouseButtonPress ? MousePress :
+                                 event->type () == QEvent::MouseButtonRelease ? MouseRelease :
+                                 event->type () == QEvent::MouseButtonDblClick ? MouseDoubleClick : MouseMove;
+            recorded.position  = mouse->localPos ().toPoint ();
+            recorded.button    = mouse->button ();
+            recorded.buttons   = mouse->buttons ();
+            recorded.modifiers = mouse->modifiers ();
+            break;
+        }
+
+        case QEvent::Wheel:
+        {
+            const QWheelEvent *wheel = static_cast <const QWheelEvent *> (event);
+
+            recorded.kind       = Wheel;
+            recorded.position   = wheel->position ().toPoint ();
+            recorded.angleDelta = wheel->angleDelta ();
+            recorded.buttons    = wheel->buttons ();
+            recorded.modifiers  = wheel->modifiers ();
+            break;
+        }
+
+        case QEvent::KeyPress:
+        case QEvent::KeyRelease:
+        {
+            const QKeyEvent *key = static_cast <const QKeyEvent *> (event);
+
+            recorded.kind       = event->type () == QEvent::KeyPress ? KeyPress : KeyRelease;
+            recorded.key        = key->key ();
+            recorded.autoRepeat = key->isAutoRepeat ();
+            recorded.modifiers  = key->modifiers ();
+            recorded.text       = key->text ();
+            break;
+        }
+
+        case QEvent::Resize:
+            recorded.kind = Resize;
+            recorded.size = static_cast <const QResizeEvent *> (event)->size ();
+            break;
+
+        default:
+            return false;
+    }
+
+    record (recorded);
+    return false;
+}
+
+/* Private Methods */
+/**
+ * Records the given event, timestamped with the time since recording started.
+ *
+ * @param event - The event to record
+ */
+void Aerodlyn::InputRecorder::record (Event event)
+{
+    if (!file.isOpen ())
+        return;
+
+    // Times are kept in whole microseconds, so rounding never adds up over a long recording
+    const qint64 now   = clock.nsecsElapsed () / 1000;
+    const qint64 delta = std::min <qint64> (now - lastTime, std::numeric_limits <quint32>::max ());
+    lastTime = now;
+
+    const quint8 modifiers = static_cast <quint8> (static_cast <int> (event.modifiers) >> MODIFIER_SHIFT);
+    const auto clamped = [] (const int value)
+        { return static_cast <qint16> (std::clamp (value, -32768, 32767)); };
+
+    stream << static_cast <quint8> (event.kind) << static_cast <quint32> (delta);
+
+    switch (event.kind)
+    {
+        case MousePress:
+        case MouseRelease:
+        case MouseDoubleClick:
+        case MouseMove:
+            stream << clamped (event.position.x ()) << clamped (event.position.y ())
+                   << static_cast <quint8> (event.button) << static_cast <quint8> (event.buttons) << modifiers;
+            break;
+
+        case Wheel:
+            stream << clamped (event.position.x ()) << clamped (event.position.y ())
+                   << clamped (event.angleDelta.x ()) << clamped (event.angleDelta.y ())
+                   << static_cast <quint8> (event.buttons) << modifiers;
+            break;
+
+        case KeyPress:
+        case KeyRelease:
+            stream << static_cast <quint32> (event.key) << modifiers << static_cast <quint8> (event.autoRepeat);
+            writeString (stream, event.text);
+            break;
+
+        case Action:
+        case ImageOpened:
+        case ProjectOpened:
+            writeString (stream, event.text);
+
+            // Whatever an action does may end the process, so everything up to it is kept
+            file.flush ();
+            break;
+
+        case Resize:
+            stream << static_cast <quint16> (event.size.width ()) << static_cast <quint16> (event.size.height ());
+            break;
+    }
+}
+
+/**
+ * Records that the file at the given filepath was opened.
+ *
+ * @param kind     - The kind of file that was opened, ImageOpened or ProjectOpened
+ * @param filepath - The (full) filepath of the file
+ */
+void Aerodlyn::InputRecorder::recordFile (const Kind kind, const QString &filepath)
+{
+    Event event;
+    event.kind = kind;
+    event.text = filepath;
+
+    record (event);
+}
+
+/**
+ * Writes the given string to the given stream as a byte count followed by UTF-8, truncated if
+ *  longer than the count can hold.
+ *
+ * @param stream - The stream to write to
+ * @param string - The string to write
+ */
+void Aerodlyn::InputRecorder::writeString (QDataStream &stream, const QString &string)
+{
+    const QByteArray utf8 = string.toUtf8 ().left (std::numeric_limits <quint16>::max ());
+
+    stream << static_cast <quint16> (utf8.size ());
+    stream.writeRawData (utf8.constData (), utf8.size ());
+}
+
+/**
+ * Reads a string written by {@link #writeString} from the given stream.
+ *
+ * @param stream - The stream to read from
+ *
+ * @return The string read
+ */
+QString Aerodlyn::InputRecorder::readString (QDataStream &stream)
+{
+    quint16 size = 0;
+    stream >> size;
+
+    QByteArray utf8 (size, Qt::Uninitialized);
+    if (stream.readRawData (utf8.data (), size) != size)
+        stream.setStatus (QDataStream::ReadPastEnd);
+
+    return QString::fromUtf8 (utf8);
+}
+
+/* Private Slots */
+/**
+ * Handles an action being triggered from one of the menus of the window, or its shortcut.
+ *
+ * @param action - The action that was triggered
+ */
+void Aerodlyn::InputRecorder::handleActionTriggered (QAction *action)
+{
+    Event event;
+    event.kind = Action;
+    event.text = action->text ();
+
+    record (event);
+}
@@ -0,0 +1,201 @@
+#ifndef INPUT_RECORDER_H
+#define INPUT_RECORDER_H
+
+#include <algorithm>
+#include <limits>
+
+#include <QAction>
+#include <QByteArray>
+#include <QDataStream>
+#include <QElapsedTimer>
+#include <QEvent>
+#include <QFile>
+#include <QKeyEvent>
+#include <QList>
+#include <QMenu>
+#include <QMenuBar>
+#include <QMouseEvent>
+#include <QObject>
+#include <QPoint>
+#include <QPointer>
+#include <QResizeEvent>
+#include <QSize>
+#include <QString>
+#include <QVector>
+#include <QWheelEvent>
+
+#include "VertexEditor/VertexEditorWindow.h"
+
+namespace Aerodlyn
+{
+    /**
+     * Records the input reaching a {@link VertexEditorWindow} to a file, so that an interaction can be
+     *  replayed by {@link InputReplayer} to reproduce it or to benchmark it. Mouse, wheel and key events
+     *  are recorded as the window receives them from the platform, before they are sent on to its
+     *  widgets, along with the menu actions triggered and the image and project files opened. Input
+     *  to dialogs isn't recorded, as the files a dialog chooses are.
+     *
+     * The file is binary and little-endian: a header made of a magic number (u32), a version (u32)
+     *  and the size of the window (u16 each), followed by events until the end of the file. Each
+     *  event is a {@link Kind} (u8), the microseconds since the previous event (u32) and a payload:
+     *
+     *  - Mouse events:       x, y (i16), button, buttons, modifiers (u8)
+     *  - Wheel:              x, y (i16), angle delta x, y (i16), buttons, modifiers (u8)
+     *  - Key events:         key (u32), modifiers (u8), auto-repeat (u8), text (string)
+     *  - Action:             text of the action (string)
+     *  - Files opened:       filepath (string)
+     *  - Resize:             width, height (u16)
+     *
+     * Positions are relative to the window, modifiers are shifted down to the low byte and strings
+     *  are a byte count (u16) followed by UTF-8, so a mouse move takes 12 bytes.
+     *
+     * @author  Patrick Jahnig (Aerodlyn)
+     * @version 2026.10.19
+     */
+    class InputRecorder : public QObject
+    {
+        Q_OBJECT
+
+        public: // Types
+            enum Kind : quint8
+            {
+                MousePress = 1, MouseRelease = 2, MouseDoubleClick = 3, MouseMove = 4, Wheel = 5,
+                KeyPress = 6, KeyRelease = 7, Action = 8, ImageOpened = 9, ProjectOpened = 10, Resize = 11
+            };
+
+            /**
+             * A single recorded event. Only the members used by its kind are meaningful.
+             */
+            struct Event
+            {
+                Kind                  kind;
+
+                // Nanoseconds since the recording started
+                qint64                time       = 0;
+
+                QPoint                position;
+                QPoint                angleDelta;
+
+                QSize                 size;
+
+                int                   key        = 0;
+                bool                  autoRepeat = false;
+
+                Qt::MouseButton       button     = Qt::NoButton;
+                Qt::MouseButtons      buttons    = Qt::NoButton;
+                Qt::KeyboardModifiers modifiers  = Qt::NoModifier;
+
+                // The text of a key or of an action, or the filepath of an opened file
+                QString               text;
+            };
+
+        public: // Constructors/Deconstructors
+            /**
+             * Creates a new {@link InputRecorder} instance, which doesn't record until {@link #start} is
+             *  called.
+             *
+             * @param parent - The optional parent of this instance
+             */
+            InputRecorder (QObject *parent = nullptr);
+
+            /**
+             * Stops recording, closing the file.
+             */
+            ~InputRecorder () override;
+
+        public: // Methods
+            /**
+             * Starts recording the input reaching the given window to the file at the given filepath,
+             *  replacing it. The window must have been shown.
+             *
+             * @param window   - The window to record the input of
+             * @param filepath - The (full) filepath of the file to record to
+             *
+             * @return True if recording started, false if the file couldn't be written
+             */
+            bool start (VertexEditorWindow *window, const QString &filepath);
+
+            /**
+             * Stops recording, closing the file. Does nothing if not recording.
+             */
+            void stop ();
+
+            /**
+             * Reads a recording from the file at the given filepath.
+             *
+             * @param filepath   - The (full) filepath of the file to read
+             * @param windowSize - Set to the size of the window when the recording started
+             * @param events     - Set to the events of the recording, oldest first
+             *
+             * @return True if the file was read, false if it isn't a recording or couldn't be read
+             */
+            static bool read (const QString &filepath, QSize &windowSize, QVector <Event> &events);
+
+        protected: // Methods
+            /**
+             * See: https://doc.qt.io/qt-5/qobject.html#eventFilter
+             */
+            bool eventFilter (QObject *watched, QEvent *event) override;
+
+        private: // Methods
+            /**
+             * Records the given event, timestamped with the time since recording started.
+             *
+             * @param event - The event to record
+             */
+            void record (Event event);
+
+            /**
+             * Records that the file at the given filepath was opened.
+             *
+             * @param kind     - The kind of file that was opened, ImageOpened or ProjectOpened
+             * @param filepath - The (full) filepath of the file
+             */
+            void recordFile (const Kind kind, const QString &filepath);
+
+            /**
+             * Writes the given string to the given stream as a byte count followed by UTF-8, truncated if
+             *  longer than the count can hold.
+             *
+             * @param stream - The stream to write to
+             * @param string - The string to write
+             */
+            static void writeString (QDataStream &stream, const QString &string);
+
+            /**
+             * Reads a string written by {@link #writeString} from the given stream.
+             *
+             * @param stream - The stream to read from
+             *
+             * @return The string read
+             */
+            static QString readString (QDataStream &stream);
+
+        private slots:
+            /**
+             * Handles an action being triggered from one of the menus of the window, or its shortcut.
+             *
+             * @param action - The action that was triggered
+             */
+            void handleActionTriggered (QAction *action);
+
+        private: // Variables
+            static constexpr quint32           MAGIC          = 0x52494841; // "AHIR"
+            static constexpr quint32           VERSION        = 1;
+
+            // Modifiers start at Qt::ShiftModifier (bit 25), so they are stored shifted down to fit a byte
+            static constexpr int               MODIFIER_SHIFT = 25;
+
+            qint64                             lastTime       = 0;
+
+            QDataStream                        stream;
+
+            QElapsedTimer                      clock;
+
+            QFile                              file;
+
+            QPointer <VertexEditorWindow>      recordedWindow;
+    };
+}
+
+#endif // INPUT_RECORDER_H
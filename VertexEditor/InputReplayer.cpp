@@ -0,0 +1,266 @@
+#include "InputReplayer.h"
+
+/**
+ * Replays input recorded by {@link InputRecorder} into a {@link VertexEditorWindow}, timing every
+ *  frame it causes, so that an interaction becomes a repeatable benchmark. Events are sent to the
+ *  window as the platform would send them, and the frame scheduler of the window is driven by the
+ *  replay rather than by the display:
+ *
+ *  - As fast as possible, every event is followed by its own frame, so each frame time is the
+ *      time taken to handle a single event and show its result.
+ *  - In real time, events are sent at the times they were recorded and frames are run when they
+ *      fall due, so input is merged into frames the way it was while recording.
+ *
+ * A frame time runs from sending the event (or from the frame falling due) until the frame
+ *  composed on the render thread is back and painted, and the event loop has nothing left to do.
+ *  Dialogs opened by replayed actions are rejected, as the files they chose were recorded and are
+ *  opened directly.
+ *
+ * @author  Patrick Jahnig (Aerodlyn)
+ * @version 2026.10.19
+ */
+
+/* Constructors/Deconstructors */
+/**
+ * Creates a new {@link InputReplayer} instance, with nothing to replay until {@link #load} is
+ *  called.
+ *
+ * @param parent - The optional parent of this instance
+ */
+Aerodlyn::InputReplayer::InputReplayer (QObject *parent) : QObject (parent)
+{
+    // Only fires within the event loop of a dialog, as replaying never returns to the main one
+    dialogTimer.setInterval (0);
+    connect (&dialogTimer, &QTimer::timeout, this, &InputReplayer::handleDialogTimeout);
+}
+
+/* Public Methods */
+/**
+ * Loads the recording to replay from the file at the given filepath.
+ *
+ * @param filepath - The (full) filepath of the recording
+ *
+ * @return True if the recording was loaded, false if it isn't a recording or couldn't be read
+ */
+bool Aerodlyn::InputReplayer::load (const QString &filepath)
+    { return InputRecorder::read (filepath, windowSize, events); }
+
+/**
+ * Replays the loaded recording into the given window, which must have been shown and have
+ *  finished starting up. Returns once every event has been replayed.
+ *
+ * @param window   - The window to replay the recording into
+ * @param realTime - True to send events at the times they were recorded, false to send them
+ *                    as fast as possible
+ *
+ * @return What the replay did and how long its frames took
+ */
+Aerodlyn::InputReplayer::Report Aerodlyn::InputReplayer::replay (VertexEditorWindow *window, const bool realTime)
+{
+    AERO_PROFILE_SCOPE ("InputReplayer::replay");
+
+    // Positions are relative to the window, so it must be laid out as it was while recording
+    if (!windowSize.isEmpty ())
+    {
+        window->resize (windowSize);
+        QCoreApplication::processEvents ();
+    }
+
+    FrameScheduler *scheduler = window->frameScheduler ();
+
+    Report report;
+    report.frameTimes.reserve (events.size ());
+
+    clock.start ();
+
+    for (const InputRecorder::Event &event : events)
+    {
+        if (realTime)
+        {
+            // Frames falling due before the event are run at their own time, as they were while recording
+            while (scheduler->isPending () && clock.nsecsElapsed () + scheduler->remainingTime () * 1000000LL < event.time)
+            {
+                QThread::msleep (static_cast <unsigned long> (std::max (scheduler->remainingTime (), 0)));
+                settle (window, true, report, clock.nsecsElapsed ());
+            }
+
+            const qint64 wait = event.time - clock.nsecsElapsed ();
+            if (wait > 0)
+                QThread::usleep (static_cast <unsigned long> (wait / 1000));
+        }
+
+        const qint64 start = clock.nsecsElapsed ();
+
+        if (!dispatch (window, event))
+            report.failures++;
+
+        report.events++;
+        settle (window, !realTime, report, start);
+    }
+
+    // The frame for the last events is still pending in real time
+    if (realTime && scheduler->isPending ())
+        QThread::msleep (static_cast <unsigned long> (std::max (scheduler->remainingTime (), 0)));
+
+    settle (window, true, report, clock.nsecsElapsed ());
+    report.duration = clock.nsecsElapsed ();
+
+    return report;
+}
+
+/**
+ * Returns the given percentile of the given frame times, by the nearest rank.
+ *
+ * @param frameTimes - The frame times, in any order
+ * @param percentile - The percentile, from 0 to 100
+ *
+ * @return The frame time at the percentile, or 0 if there are no frame times
+ */
+qint64 Aerodlyn::InputReplayer::percentile (QVector <qint64> frameTimes, const double percentile)
+{
+    if (frameTimes.isEmpty ())
+        return 0;
+
+    const int rank = std::clamp (static_cast <int> (std::ceil (percentile / 100.0 * frameTimes.size ())), 1,
+        frameTimes.size ());
+
+    std::nth_element (frameTimes.begin (), frameTimes.begin () + rank - 1, frameTimes.end ());
+    return frameTimes.at (rank - 1);
+}
+
+/* Private Methods */
+/**
+ * Sends the given event to the given window.
+ *
+ * @param window - The window to send the event to
+ * @param event  - The event to send
+ *
+ * @return True if the event was sent, false if it couldn't be (such as a file that no longer
+ *  opens, or an action that no longer exists)
+ */
+bool Aerodlyn::InputReplayer::dispatch (VertexEditorWindow *window, const InputRecorder::Event &event)
+{
+    QWindow *handle = window->windowHandle ();
+
+    switch (event.kind)
+    {
+        case InputRecorder::MousePress:
+        case InputRecorder::MouseRelease:
+        case InputRecorder::MouseDoubleClick:
+        case InputRecorder::MouseMove:
+        {
+            const QEvent::Type type = event.kind == InputRecorder::MousePress ? QEvent::MouseButtonPress :
+                                      event.kind == InputRecorder::MouseRelease ? QEvent::MouseButtonRelease :
+                                      event.kind == InputRecorder::MouseDoubleClick ? QEvent::MouseButtonDblClick :
+                                                                                      QEvent::MouseMove;
+
+            QMouseEvent mouse (type, event.position, event.position, handle->mapToGlobal (event.position), event.button,
+                event.buttons, event.modifiers);
+
+            QCoreApplication::sendEvent (handle, &mouse);
+            return true;
+        }
+
+        case InputRecorder::Wheel:
+        {
+            QWheelEvent wheel (event.position, handle->mapToGlobal (event.position), QPoint (), event.angleDelta,
+                event.buttons, event.modifiers, Qt::NoScrollPhase, false);
+
+            QCoreApplication::sendEvent (handle, &wheel);
+            return true;
+        }
+
+        case InputRecorder::KeyPress:
+        case InputRecorder::KeyRelease:
+        {
+            QKeyEvent key (event.kind == InputRecorder::KeyPress ? QEvent::KeyPress : QEvent::KeyRelease, event.key,
+                event.modifiers, event.text, event.autoRepeat);
+
+            QCoreApplication::sendEvent (handle, &key);
+            return true;
+        }
+
+        case InputRecorder::Action:
+        {
+            for (const QMenu *menu : window->menuBar ()->findChildren <QMenu *> ())
+            {
+                for (QAction *action : menu->actions ())
+                {
+                    if (action->text () != event.text)
+                        continue;
+
+                    dialogTimer.start ();
+                    action->trigger ();
+                    dialogTimer.stop ();
+
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        case InputRecorder::ImageOpened:
+            return window->openImageFile (event.text);
+
+        case InputRecorder::ProjectOpened:
+            return window->openProjectFile (event.text);
+
+        case InputRecorder::Resize:
+            window->resize (event.size);
+            return true;
+    }
+
+    return false;
+}
+
+/**
+ * Runs the event loop until it has nothing left to do, first signalling the pending frame if
+ *  asked to. A frame that was signalled is waited for until it was composed and painted.
+ *
+ * @param window  - The window being replayed into
+ * @param flush   - True to signal the pending frame right away, false to only signal it if it's due
+ * @param report  - Where the time taken is added, if a frame was signalled
+ * @param start   - When the work being timed started, in nanoseconds of the replay clock
+ */
+void Aerodlyn::InputReplayer::settle (VertexEditorWindow *window, const bool flush, Report &report, const qint64 start)
+{
+    FrameScheduler *scheduler = window->frameScheduler ();
+    const quint64 framesBefore = scheduler->stats ().framesScheduled;
+
+    if (flush)
+        scheduler->flush ();
+
+    // Delivers the repaint the frame posted, along with anything else that is due
+    QCoreApplication::processEvents ();
+
+    if (scheduler->stats ().framesScheduled == framesBefore)
+        return;
+
+    // The frame is composed on the render thread, so it is only shown once the composed frame was
+    //  handed back and painted. A frame that never arrives (such as while the window is hidden) is
+    //  given up on rather than hanging the replay
+    QElapsedTimer waited;
+    waited.start ();
+
+    while (!window->hasCurrentFrame () && waited.elapsed () < FRAME_TIMEOUT)
+    {
+        QThread::yieldCurrentThread ();
+        QCoreApplication::processEvents ();
+    }
+
+    // Delivers the repaint of the frame that was just taken
+    QCoreApplication::processEvents ();
+
+    report.frameTimes.append (clock.nsecsElapsed () - start);
+}
+
+/* Private Slots */
+/**
+ * Handles the dialog timer firing by rejecting the dialog that is open, if any.
+ */
+void Aerodlyn::InputReplayer::handleDialogTimeout ()
+{
+    if (QDialog *dialog = qobject_cast <QDialog *> (QApplication::activeModalWidget ()))
+        dialog->reject ();
+}
@@ -0,0 +1,156 @@
+#ifndef INPUT_REPLAYER_H
+#define INPUT_REPLAYER_H
+
+#include <algorithm>
+#include <cmath>
+
+#include <QAction>
+#include <QApplication>
+#include <QCoreApplication>
+#include <QDialog>
+#include <QElapsedTimer>
+#include <QKeyEvent>
+#include <QList>
+#include <QMenu>
+#include <QMenuBar>
+#include <QMouseEvent>
+#include <QObject>
+#include <QSize>
+#include <QString>
+#include <QThread>
+#include <QTimer>
+#include <QVector>
+#include <QWheelEvent>
+#include <QWindow>
+
+#include "Root/Profiler.h"
+#include "VertexEditor/FrameScheduler.h"
+#include "VertexEditor/InputRecorder.h"
+#include "VertexEditor/VertexEditorWindow.h"
+
+namespace Aerodlyn
+{
+    /**
+     * Replays input recorded by {@link InputRecorder} into a {@link VertexEditorWindow}, timing every
+     *  frame it causes, so that an interaction becomes a repeatable benchmark. Events are sent to the
+     *  window as the platform would send them, and the frame scheduler of the window is driven by the
+     *  replay rather than by the display:
+     *
+     *  - As fast as possible, every event is followed by its own frame, so each frame time is the
+     *      time taken to handle a single event and show its result.
+     *  - In real time, events are sent at the times they were recorded and frames are run when they
+     *      fall due, so input is merged into frames the way it was while recording.
+     *
+     * A frame time runs from sending the event (or from the frame falling due) until the frame
+     *  composed on the render thread is back and painted, and the event loop has nothing left to do.
+     *  Dialogs opened by replayed actions are rejected, as the files they chose were recorded and are
+     *  opened directly.
+     *
+     * @author  Patrick Jahnig (Aerodlyn)
+     * @version 2026.10.19
+     */
+    class InputReplayer : public QObject
+    {
+        Q_OBJECT
+
+        public: // Types
+            /**
+             * What a replay did and how long its frames took.
+             */
+            struct Report
+            {
+                int              events   = 0;
+                int              failures = 0;
+
+                // Nanoseconds, from the first event until the last frame finished
+                qint64           duration = 0;
+
+                // The time taken by each frame in nanoseconds, in the order they ran
+                QVector <qint64> frameTimes;
+            };
+
+        public: // Constructors/Deconstructors
+            /**
+             * Creates a new {@link InputReplayer} instance, with nothing to replay until {@link #load} is
+             *  called.
+             *
+             * @param parent - The optional parent of this instance
+             */
+            InputReplayer (QObject *parent = nullptr);
+
+        public: // Methods
+            /**
+             * Loads the recording to replay from the file at the given filepath.
+             *
+             * @param filepath - The (full) filepath of the recording
+             *
+             * @return True if the recording was loaded, false if it isn't a recording or couldn't be read
+             */
+            bool load (const QString &filepath);
+
+            /**
+             * Replays the loaded recording into the given window, which must have been shown and have
+             *  finished starting up. Returns once every event has been replayed.
+             *
+             * @param window   - The window to replay the recording into
+             * @param realTime - True to send events at the times they were recorded, false to send them
+             *                    as fast as possible
+             *
+             * @return What the replay did and how long its frames took
+             */
+            Report replay (VertexEditorWindow *window, const bool realTime);
+
+            /**
+             * Returns the given percentile of the given frame times, by the nearest rank.
+             *
+             * @param frameTimes - The frame times, in any order
+             * @param percentile - The percentile, from 0 to 100
+             *
+             * @return The frame time at the percentile, or 0 if there are no frame times
+             */
+            static qint64 percentile (QVector <qint64> frameTimes, const double percentile);
+
+        private: // Methods
+            /**
+             * Sends the given event to the given window.
+             *
+             * @param window - The window to send the event to
+             * @param event  - The event to send
+             *
+             * @return True if the event was sent, false if it couldn't be (such as a file that no longer
+             *  opens, or an action that no longer exists)
+             */
+            bool dispatch (VertexEditorWindow *window, const InputRecorder::Event &event);
+
+            /**
+             * Runs the event loop until it has nothing left to do, first signalling the pending frame if
+             *  asked to. A frame that was signalled is waited for until it was composed and painted.
+             *
+             * @param window  - The window being replayed into
+             * @param flush   - True to signal the pending frame right away, false to only signal it if it's due
+             * @param report  - Where the time taken is added, if a frame was signalled
+             * @param start   - When the work being timed started, in nanoseconds of the replay clock
+             */
+            void settle (VertexEditorWindow *window, const bool flush, Report &report, const qint64 start);
+
+        private slots:
+            /**
+             * Handles the dialog timer firing by rejecting the dialog that is open, if any.
+             */
+            void handleDialogTimeout ();
+
+        private: // Variables
+            // How long to wait for a frame to be composed, in milliseconds
+            const qint64                       FRAME_TIMEOUT = 2000;
+
+            QElapsedTimer                      clock;
+
+            QSize                              windowSize;
+
+            QTimer                             dialogTimer;
+
+            QVector <InputRecorder::Event>     events;
+    };
+}
+
+#endif // INPUT_REPLAYER_H
@@ -0,0 +1,223 @@
+#include "LivePreviewFeed.h"
+
+/**
+ * Publishes the data sets of a {@link VertexDataSetCollection} into a shared memory segment, so
+ *  that a running game can poll it and pick up edits within a frame, without saving, exporting or
+ *  restarting. The layout of the segment, and how to read it without locking, is described by
+ *  {@link LivePreviewHeader}.
+ *
+ * The segment has a fixed capacity, as it can't be resized while readers are attached to it.
+ *
+ * @author  Patrick Jahnig (Aerodlyn)
+ * @version 2026.10.19
+ */
+
+/* Constructors/Deconstructors */
+/**
+ * Creates a new {@link LivePreviewFeed} instance, which doesn't publish until {@link #start}
+ *  is called.
+ *
+ * @param parent - The optional parent of this instance
+ */
+Aerodlyn::LivePreviewFeed::LivePreviewFeed (QObject *parent) : QObject (parent)
+{
+    publishTimer.setInterval (PUBLISH_INTERVAL);
+    publishTimer.setTimerType (Qt::PreciseTimer);
+    connect (&publishTimer, &QTimer::timeout, this, [this] { publish (*watched); });
+}
+
+/**
+ * Stops publishing, marking the segment as closed for any attached readers.
+ */
+Aerodlyn::LivePreviewFeed::~LivePreviewFeed ()
+    { stop (); }
+
+/* Public Methods */
+/**
+ * Creates the shared memory segment with the given native key (on Unix, a file path passed to
+ *  ftok), replacing the segment of an editor that didn't stop cleanly. Readers attach with
+ *  QSharedMemory::setNativeKey and the same key.
+ *
+ * @param key - The native key of the segment to create
+ *
+ * @return True if the segment was created, false otherwise (see {@link #errorString})
+ */
+bool Aerodlyn::LivePreviewFeed::start (const QString &key)
+{
+    stop ();
+
+    segment.setNativeKey (key);
+
+    // Detaching from a segment left behind by a crash removes it, unless a reader is still attached
+    //  to it (or another editor is publishing to it), in which case creating the segment fails below
+    if (segment.attach ())
+        segment.detach ();
+
+    if (!segment.create (static_cast <int> (sizeof (LivePreviewHeader)) + CAPACITY))
+    {
+        lastError = segment.errorString ();
+        return false;
+    }
+
+    LivePreviewHeader *h = new (segment.data ()) LivePreviewHeader ();
+    h->version  = LivePreviewHeader::VERSION;
+    h->capacity = CAPACITY;
+
+    // Readers ignore the segment until the magic appears, so it is written last
+    std::atomic_thread_fence (std::memory_order_release);
+    h->magic = LivePreviewHeader::MAGIC;
+
+    // Reserving keeps the payload from being freed and reallocated between publishes
+    payload.reserve (64 * 1024);
+
+    lastError.clear ();
+    publishedRevision = 0;
+
+    return true;
+}
+
+/**
+ * Marks the segment as closed for any attached readers, stops watching and detaches from it.
+ */
+void Aerodlyn::LivePreviewFeed::stop ()
+{
+    watch (nullptr);
+
+    if (!segment.isAttached ())
+        return;
+
+    LivePreviewHeader *h = header ();
+    const quint32 sequence = h->sequence.load (std::memory_order_relaxed);
+
+    h->sequence.store (sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence (std::memory_order_release);
+
+    h->flags |= LivePreviewHeader::CLOSED;
+    h->sequence.store (sequence + 2, std::memory_order_release);
+
+    segment.detach ();
+}
+
+/**
+ * Determines if the feed is publishing.
+ *
+ * @return True if the segment exists, false otherwise
+ */
+bool Aerodlyn::LivePreviewFeed::isPublishing () const
+    { return segment.isAttached (); }
+
+/**
+ * Returns a description of why the segment last couldn't be created.
+ *
+ * @return A description of the last error, or an empty string if there was none
+ */
+QString Aerodlyn::LivePreviewFeed::errorString () const
+    { return lastError; }
+
+/**
+ * Writes the given collection into the segment, unless it hasn't changed since it was last
+ *  written.
+ *
+ * @param collection - The collection to publish
+ */
+void Aerodlyn::LivePreviewFeed::publish (const VertexDataSetCollection &collection)
+{
+    if (!segment.isAttached () || collection.revision () == publishedRevision)
+        return;
+
+    AERO_PROFILE_SCOPE ("LivePreviewFeed::publish");
+
+    // Serializing first keeps the sequence odd only for as long as copying takes, so readers rarely
+    //  have to retry
+    serialize (collection);
+
+    LivePreviewHeader *h = header ();
+    const quint32 sequence = h->sequence.load (std::memory_order_relaxed);
+
+    h->sequence.store (sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence (std::memory_order_release);
+
+    if (payload.size () <= CAPACITY)
+    {
+        std::memcpy (static_cast <char *> (segment.data ()) + sizeof (LivePreviewHeader), payload.constData (),
+            static_cast <size_t> (payload.size ()));
+
+        h->revision = collection.revision ();
+        h->size     = static_cast <quint32> (payload.size ());
+        h->count    = static_cast <quint32> (collection.length ());
+        h->flags   &= ~LivePreviewHeader::OVERFLOWED;
+    }
+
+    else
+        h->flags |= LivePreviewHeader::OVERFLOWED;
+
+    h->sequence.store (sequence + 2, std::memory_order_release);
+    publishedRevision = collection.revision ();
+}
+
+/**
+ * Publishes the given collection now and then whenever it changes, checking for changes once
+ *  per display frame. The collection must outlive the watch.
+ *
+ * @param collection - The collection to watch, or null to stop watching
+ */
+void Aerodlyn::LivePreviewFeed::watch (const VertexDataSetCollection *collection)
+{
+    watched = collection;
+    if (watched == nullptr)
+    {
+        publishTimer.stop ();
+        return;
+    }
+
+    publish (*watched);
+    publishTimer.start ();
+}
+
+/* Private Methods */
+/**
+ * Returns the header at the start of the segment.
+ *
+ * @return The header of the segment
+ */
+Aerodlyn::LivePreviewHeader *Aerodlyn::LivePreviewFeed::header ()
+    { return std::launder (static_cast <LivePreviewHeader *> (segment.data ())); }
+
+/**
+ * Appends the given data sets to the payload, in the layout described by
+ *  {@link LivePreviewHeader}.
+ *
+ * @param collection - The collection to serialize
+ */
+void Aerodlyn::LivePreviewFeed::serialize (const VertexDataSetCollection &collection)
+{
+    payload.resize (0);
+
+    for (int i = 0; i < collection.length (); i++)
+    {
+        const VertexDataSet &set = collection.at (i);
+
+        const QByteArray name = set.name.toUtf8 ().left (0xFFFF);
+        const quint16 nameSize = static_cast <quint16> (name.size ());
+        const quint32 count = static_cast <quint32> (set.region.size ());
+
+        append (&nameSize, sizeof (nameSize));
+        append (name.constData (), name.size ());
+        append (&count, sizeof (count));
+
+        for (const QPointF &point : set.region)
+        {
+            const float coordinates [2] = { static_cast <float> (point.x ()), static_cast <float> (point.y ()) };
+            append (coordinates, sizeof (coordinates));
+        }
+    }
+}
+
+/**
+ * Appends the given bytes to the payload.
+ *
+ * @param data - The bytes to append
+ * @param size - The number of bytes to append
+ */
+void Aerodlyn::LivePreviewFeed::append (const void *data, const int size)
+    { payload.append (static_cast <const char *> (data), size); }
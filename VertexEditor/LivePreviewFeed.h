@@ -0,0 +1,139 @@
+#ifndef LIVE_PREVIEW_FEED_H
+#define LIVE_PREVIEW_FEED_H
+
+#include <atomic>
+#include <cstring>
+#include <new>
+
+#include <QByteArray>
+#include <QObject>
+#include <QSharedMemory>
+#include <QString>
+#include <QTimer>
+
+#include "Root/Profiler.h"
+#include "VertexEditor/Utilities/LivePreviewLayout.h"
+#include "VertexEditor/Utilities/VertexDataSetCollection.h"
+
+namespace Aerodlyn
+{
+    /**
+     * Publishes the data sets of a {@link VertexDataSetCollection} into a shared memory segment, so
+     *  that a running game can poll it and pick up edits within a frame, without saving, exporting or
+     *  restarting. The layout of the segment, and how to read it without locking, is described by
+     *  {@link LivePreviewHeader}.
+     *
+     * The segment has a fixed capacity, as it can't be resized while readers are attached to it.
+     *
+     * @author  Patrick Jahnig (Aerodlyn)
+     * @version 2026.10.19
+     */
+    class LivePreviewFeed : public QObject
+    {
+        Q_OBJECT
+
+        public: // Constructors/Deconstructors
+            /**
+             * Creates a new {@link LivePreviewFeed} instance, which doesn't publish until {@link #start}
+             *  is called.
+             *
+             * @param parent - The optional parent of this instance
+             */
+            LivePreviewFeed (QObject *parent = nullptr);
+
+            /**
+             * Stops publishing, marking the segment as closed for any attached readers.
+             */
+            ~LivePreviewFeed () override;
+
+        public: // Methods
+            /**
+             * Creates the shared memory segment with the given native key (on Unix, a file path passed to
+             *  ftok), replacing the segment of an editor that didn't stop cleanly. Readers attach with
+             *  QSharedMemory::setNativeKey and the same key.
+             *
+             * @param key - The native key of the segment to create
+             *
+             * @return True if the segment was created, false otherwise (see {@link #errorString})
+             */
+            bool start (const QString &key);
+
+            /**
+             * Marks the segment as closed for any attached readers, stops watching and detaches from it.
+             */
+            void stop ();
+
+            /**
+             * Determines if the feed is publishing.
+             *
+             * @return True if the segment exists, false otherwise
+             */
+            bool isPublishing () const;
+
+            /**
+             * Returns a description of why the segment last couldn't be created.
+             *
+             * @return A description of the last error, or an empty string if there was none
+             */
+            QString errorString () const;
+
+            /**
+             * Writes the given collection into the segment, unless it hasn't changed since it was last
+             *  written.
+             *
+             * @param collection - The collection to publish
+             */
+            void publish (const VertexDataSetCollection &collection);
+
+            /**
+             * Publishes the given collection now and then whenever it changes, checking for changes once
+             *  per display frame. The collection must outlive the watch.
+             *
+             * @param collection - The collection to watch, or null to stop watching
+             */
+            void watch (const VertexDataSetCollection *collection);
+
+        private: // Methods
+            /**
+             * Returns the header at the start of the segment.
+             *
+             * @return The header of the segment
+             */
+            LivePreviewHeader *header ();
+
+            /**
+             * Appends the given data sets to the payload, in the layout described by
+             *  {@link LivePreviewHeader}.
+             *
+             * @param collection - The collection to serialize
+             */
+            void serialize (const VertexDataSetCollection &collection);
+
+            /**
+             * Appends the given bytes to the payload.
+             *
+             * @param data - The bytes to append
+             * @param size - The number of bytes to append
+             */
+            void append (const void *data, const int size);
+
+        private: // Variables
+            const int                                          PUBLISH_INTERVAL     = 16;
+
+            static constexpr int                               CAPACITY             = 16 * 1024 * 1024;
+
+            quint64                                            publishedRevision    = 0;
+
+            QByteArray                                         payload;
+
+            QSharedMemory                                      segment;
+
+            QString                                            lastError;
+
+            QTimer                                             publishTimer;
+
+            const VertexDataSetCollection                      *watched             = nullptr;
+    };
+}
+
+#endif // LIVE_PREVIEW_FEED_H
@@ -0,0 +1,403 @@
+#include "QueryServer.h"
+
+/**
+ * Serves the data sets of a {@link VertexDataSetCollection} to other processes (such as build
+ *  tools) over a local socket, so that they don't have to parse exported files to look up a few
+ *  regions. Connections are served on a worker thread from a read-only snapshot of the
+ *  collection, which is republished from the GUI thread whenever the collection changes, so
+ *  clients never wait on the GUI and the GUI never waits on clients.
+ *
+ * @author  Patrick Jahnig (Aerodlyn)
+ * @version 2026.10.19
+ */
+
+/* Constructors/Deconstructors */
+/**
+ * Creates a new {@link QueryServer} instance, which doesn't listen until {@link #listen} is called.
+ *
+ * @param parent - The optional parent of this instance
+ */
+Aerodlyn::QueryServer::QueryServer (QObject *parent) : QObject (parent), snapshot (new Snapshot ())
+{
+    workerThread.setObjectName ("QueryServer");
+
+    publishTimer.setInterval (PUBLISH_INTERVAL);
+    connect (&publishTimer, &QTimer::timeout, this, [this] { publish (*watched); });
+}
+
+/**
+ * Stops listening, disconnects every client and stops the worker thread.
+ */
+Aerodlyn::QueryServer::~QueryServer ()
+{
+    close ();
+
+    workerThread.quit ();
+    workerThread.wait ();
+}
+
+/* Public Methods */
+/**
+ * Starts listening for connections on the local socket with the given name, replacing a stale
+ *  socket left behind by a server that didn't shut down cleanly. Only the current user may
+ *  connect.
+ *
+ * @param name - The name of the local socket to listen on
+ *
+ * @return True if the server is listening, false otherwise (see {@link #errorString})
+ */
+bool Aerodlyn::QueryServer::listen (const QString &name)
+{
+    close ();
+
+    if (!workerThread.isRunning ())
+        workerThread.start ();
+
+    // The server is moved to the worker thread before listening, so that its socket notifiers (and
+    //  every connection it accepts) belong to that thread
+    QLocalServer *server = new QLocalServer ();
+    server->setSocketOptions (QLocalServer::UserAccessOption);
+    server->moveToThread (&workerThread);
+
+    connect (server, &QLocalServer::newConnection, server, [this, server] { acceptConnections (server); });
+
+    bool listening = false;
+    QMetaObject::invokeMethod (server, [&]
+    {
+        listening = server->listen (name);
+
+        // A socket that nobody answers on was left behind by a crash, and is safe to replace
+        if (!listening && server->serverError () == QAbstractSocket::AddressInUseError)
+        {
+            QLocalSocket probe;
+            probe.connectToServer (name);
+
+            if (!probe.waitForConnected (PUBLISH_INTERVAL) && QLocalServer::removeServer (name))
+                listening = server->listen (name);
+        }
+
+        lastError = listening ? QString () : server->errorString ();
+        fullName  = listening ? server->fullServerName () : QString ();
+    }, Qt::BlockingQueuedConnection);
+
+    if (!listening)
+    {
+        server->deleteLater ();
+        return false;
+    }
+
+    localServer = server;
+    return true;
+}
+
+/**
+ * Stops listening and disconnects every client.
+ */
+void Aerodlyn::QueryServer::close ()
+{
+    if (localServer == nullptr)
+        return;
+
+    // The connections are children of the server, so they are deleted along with it
+    QMetaObject::invokeMethod (localServer, [server = localServer]
+    {
+        server->close ();
+        server->deleteLater ();
+    }, Qt::BlockingQueuedConnection);
+
+    localServer = nullptr;
+    fullName.clear ();
+}
+
+/**
+ * Determines if the server is listening for connections.
+ *
+ * @return True if the server is listening, false otherwise
+ */
+bool Aerodlyn::QueryServer::isListening () const
+    { return localServer != nullptr; }
+
+/**
+ * Returns the full name of the socket the server listens on (on Unix, its path).
+ *
+ * @return The full name of the socket, or an empty string if the server isn't listening
+ */
+QString Aerodlyn::QueryServer::serverName () const
+    { return fullName; }
+
+/**
+ * Returns a description of why the server last failed to listen.
+ *
+ * @return A description of the last error, or an empty string if there was none
+ */
+QString Aerodlyn::QueryServer::errorString () const
+    { return lastError; }
+
+/**
+ * Replaces the snapshot that requests are answered from with the current state of the given
+ *  collection. Does nothing if the collection hasn't changed since it was last published. Regions
+ *  are implicitly shared with the collection, so this copies no vertices.
+ *
+ * @param collection - The collection to publish
+ */
+void Aerodlyn::QueryServer::publish (const VertexDataSetCollection &collection)
+{
+    if (currentSnapshot ()->revision == collection.revision ())
+        return;
+
+    AERO_PROFILE_SCOPE ("QueryServer::publish");
+
+    QSharedPointer <Snapshot> published (new Snapshot ());
+    published->revision = collection.revision ();
+    published->names.reserve (collection.length ());
+    published->regions.reserve (collection.length ());
+    published->slabs.reserve (collection.length ());
+
+    // The slabs are only rebuilt for regions that changed, and the tree is brought up to date
+    //  incrementally, so publishing after a small edit stays cheap
+    for (int i = 0; i < collection.length (); i++)
+    {
+        published->names.append (collection.at (i).name);
+        published->regions.append (collection.at (i).region);
+        published->slabs.append (collection.slabsAt (i));
+    }
+
+    published->tree = collection.boundsTree ();
+
+    const QMutexLocker locker (&snapshotMutex);
+    snapshot = published;
+}
+
+/**
+ * Publishes the given collection now and then whenever it changes, checking for changes a few
+ *  times a second. The collection must outlive the watch.
+ *
+ * @param collection - The collection to watch, or null to stop watching
+ */
+void Aerodlyn::QueryServer::watch (const VertexDataSetCollection *collection)
+{
+    watched = collection;
+    if (watched == nullptr)
+    {
+        publishTimer.stop ();
+        return;
+    }
+
+    publish (*watched);
+    publishTimer.start ();
+}
+
+/* Private Methods */
+/**
+ * Serves every connection waiting on the given server. Runs on the worker thread.
+ *
+ * @param server - The server with waiting connections
+ */
+void Aerodlyn::QueryServer::acceptConnections (QLocalServer *server)
+{
+    while (QLocalSocket *socket = server->nextPendingConnection ())
+    {
+        connect (socket, &QLocalSocket::readyRead, socket, [this, socket] { serve (socket); });
+        connect (socket, &QLocalSocket::disconnected, socket, &QLocalSocket::deleteLater);
+    }
+}
+
+/**
+ * Answers every complete request received on the given socket. A request that is too large or
+ *  has an invalid size is answered with {@link Status#BadRequest} and the client is
+ *  disconnected, as the rest of its stream can't be framed. Runs on the worker thread.
+ *
+ * @param socket - The socket to answer requests on
+ */
+void Aerodlyn::QueryServer::serve (QLocalSocket *socket) const
+{
+    AERO_PROFILE_SCOPE ("QueryServer::serve");
+
+    while (socket->bytesAvailable () >= FRAME_HEADER_SIZE)
+    {
+        char header [FRAME_HEADER_SIZE];
+        socket->peek (header, FRAME_HEADER_SIZE);
+
+        const quint32 size = qFromLittleEndian <quint32> (header);
+        if (size == 0 || size > MAX_REQUEST_SIZE)
+        {
+            socket->write (frame (BadRequest));
+            socket->disconnectFromServer ();
+
+            return;
+        }
+
+        // The rest of the request hasn't arrived yet, this is called again once more of it has
+        if (socket->bytesAvailable () < FRAME_HEADER_SIZE + size)
+            return;
+
+        socket->read (header, FRAME_HEADER_SIZE);
+        socket->write (respond (socket->read (size)));
+    }
+}
+
+/**
+ * Answers the given request from the current snapshot.
+ *
+ * @param request - The request, without its size
+ *
+ * @return The response frame, including its size
+ */
+QByteArray Aerodlyn::QueryServer::respond (const QByteArray &request) const
+{
+    const QSharedPointer <const Snapshot> data = currentSnapshot ();
+
+    QDataStream in (request);
+    in.setByteOrder (QDataStream::LittleEndian);
+
+    QByteArray payload;
+    QDataStream out (&payload, QIODevice::WriteOnly);
+    out.setByteOrder (QDataStream::LittleEndian);
+
+    // The names are sorted, so the names matching a request are written in order
+    QStringList matches;
+
+    quint8 opcode;
+    in >> opcode;
+
+    switch (opcode)
+    {
+        case ListNames:
+        {
+            const QString prefix = readString (in);
+
+            auto it = std::lower_bound (data->names.constBegin (), data->names.constEnd (), prefix);
+            for (; it != data->names.constEnd () && it->startsWith (prefix); it++)
+                matches.append (*it);
+
+            break;
+        }
+
+        case FetchRegion:
+        {
+            const QString name = readString (in);
+
+            const auto it = std::lower_bound (data->names.constBegin (), data->names.constEnd (), name);
+            if (in.status () != QDataStream::Ok)
+                return frame (BadRequest);
+
+            if (it == data->names.constEnd () || *it != name)
+                return frame (NotFound);
+
+            const QPolygonF &region = data->regions.at (static_cast <int> (it - data->names.constBegin ()));
+
+            out << static_cast <quint32> (region.size ());
+            for (const QPointF &point : region)
+                out << point.x () << point.y ();
+
+            return frame (Ok, payload);
+        }
+
+        case QueryBox:
+        {
+            double left, top, width, height;
+            in >> left >> top >> width >> height;
+
+            matches = data->tree.query (QRectF (left, top, width, height).normalized ());
+            break;
+        }
+
+        case QueryPoint:
+        {
+            double x, y;
+            in >> x >> y;
+
+            // The tree rules out all but the few regions whose bounds hold the point
+            const QPointF point (x, y);
+            for (const QString &name : data->tree.query (point))
+            {
+                const int i = static_cast <int> (std::lower_bound (data->names.constBegin (), data->names.constEnd (), name)
+                    - data->names.constBegin ());
+
+                if (data->slabs.at (i).contains (data->regions.at (i), point))
+                    matches.append (name);
+            }
+
+            break;
+        }
+
+        default:
+            return frame (BadRequest);
+    }
+
+    if (in.status () != QDataStream::Ok)
+        return frame (BadRequest);
+
+    out << static_cast <quint32> (matches.size ());
+    for (const QString &name : matches)
+        writeString (out, name);
+
+    return frame (Ok, payload);
+}
+
+/**
+ * Returns the snapshot requests are currently answered from.
+ *
+ * @return The current snapshot
+ */
+QSharedPointer <const Aerodlyn::QueryServer::Snapshot> Aerodlyn::QueryServer::currentSnapshot () const
+{
+    const QMutexLocker locker (&snapshotMutex);
+    return snapshot;
+}
+
+/**
+ * Reads a string (a u16 byte count followed by UTF-8) from the given stream.
+ *
+ * @param stream - The stream to read from
+ *
+ * @return The string read, or an empty string if the stream ended early
+ */
+QString Aerodlyn::QueryServer::readString (QDataStream &stream)
+{
+    quint16 length;
+    stream >> length;
+
+    QByteArray bytes (length, '\0');
+    if (stream.status () != QDataStream::Ok || stream.readRawData (bytes.data (), length) != length)
+    {
+        stream.setStatus (QDataStream::ReadPastEnd);
+        return QString ();
+    }
+
+    return QString::fromUtf8 (bytes);
+}
+
+/**
+ * Writes the given string (as a u16 byte count followed by UTF-8) to the given stream.
+ *
+ * @param stream - The stream to write to
+ * @param string - The string to write
+ */
+void Aerodlyn::QueryServer::writeString (QDataStream &stream, const QString &string)
+{
+    const QByteArray bytes = string.toUtf8 ().left (0xFFFF);
+
+    stream << static_cast <quint16> (bytes.size ());
+    stream.writeRawData (bytes.constData (), bytes.size ());
+}
+
+/**
+ * Frames the given status and payload as a response.
+ *
+ * @param status  - The status of the response
+ * @param payload - The payload of the response
+ *
+ * @return The response frame, including its size
+ */
+QByteArray Aerodlyn::QueryServer::frame (const Status status, const QByteArray &payload)
+{
+    QByteArray response;
+    QDataStream stream (&response, QIODevice::WriteOnly);
+    stream.setByteOrder (QDataStream::LittleEndian);
+
+    stream << static_cast <quint32> (payload.size () + 1) << static_cast <quint8> (status);
+    stream.writeRawData (payload.constData (), payload.size ());
+
+    return response;
+}
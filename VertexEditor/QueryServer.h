@@ -0,0 +1,231 @@
+#ifndef QUERY_SERVER_H
+#define QUERY_SERVER_H
+
+#include <algorithm>
+
+#include <QByteArray>
+#include <QDataStream>
+#include <QIODevice>
+#include <QLocalServer>
+#include <QLocalSocket>
+#include <QMetaObject>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QObject>
+#include <QPointF>
+#include <QPolygonF>
+#include <QRectF>
+#include <QSharedPointer>
+#include <QString>
+#include <QStringList>
+#include <QThread>
+#include <QTimer>
+#include <QVector>
+#include <QtEndian>
+
+#include "Root/Profiler.h"
+#include "VertexEditor/Utilities/DataSetRTree.h"
+#include "VertexEditor/Utilities/RegionSlabIndex.h"
+#include "VertexEditor/Utilities/VertexDataSetCollection.h"
+
+namespace Aerodlyn
+{
+    /**
+     * Serves the data sets of a {@link VertexDataSetCollection} to other processes (such as build
+     *  tools) over a local socket, so that they don't have to parse exported files to look up a few
+     *  regions. Connections are served on a worker thread from a read-only snapshot of the
+     *  collection, which is republished from the GUI thread whenever the collection changes, so
+     *  clients never wait on the GUI and the GUI never waits on clients.
+     *
+     * The protocol is binary and little-endian. Each request is a frame made of its size (u32, not
+     *  counting itself), an opcode (u8) and a payload, and is answered by a frame made of its size, a
+     *  {@link Status} (u8) and a payload. Strings are a byte count (u16) followed by UTF-8, and
+     *  coordinates are f64, relative to the center of the image like everywhere else.
+     *
+     *  - ListNames   (1): prefix string        -> count (u32), names
+     *  - FetchRegion (2): name string          -> count (u32), x and y of each vertex
+     *  - QueryBox    (3): left, top, w, h      -> count (u32), names of regions whose bounds touch it
+     *  - QueryPoint  (4): x, y                 -> count (u32), names of regions containing the point
+     *
+     * Names are always sorted. Requests may be pipelined, and are answered in order.
+     *
+     * @author  Patrick Jahnig (Aerodlyn)
+     * @version 2026.10.19
+     */
+    class QueryServer : public QObject
+    {
+        Q_OBJECT
+
+        public: // Types
+            enum Opcode : quint8 { ListNames = 1, FetchRegion = 2, QueryBox = 3, QueryPoint = 4 };
+
+            enum Status : quint8 { Ok = 0, NotFound = 1, BadRequest = 2 };
+
+        public: // Constructors/Deconstructors
+            /**
+             * Creates a new {@link QueryServer} instance, which doesn't listen until {@link #listen} is called.
+             *
+             * @param parent - The optional parent of this instance
+             */
+            QueryServer (QObject *parent = nullptr);
+
+            /**
+             * Stops listening, disconnects every client and stops the worker thread.
+             */
+            ~QueryServer () override;
+
+        public: // Methods
+            /**
+             * Starts listening for connections on the local socket with the given name, replacing a stale
+             *  socket left behind by a server that didn't shut down cleanly. Only the current user may
+             *  connect.
+             *
+             * @param name - The name of the local socket to listen on
+             *
+             * @return True if the server is listening, false otherwise (see {@link #errorString})
+             */
+            bool listen (const QString &name);
+
+            /**
+             * Stops listening and disconnects every client.
+             */
+            void close ();
+
+            /**
+             * Determines if the server is listening for connections.
+             *
+             * @return True if the server is listening, false otherwise
+             */
+            bool isListening () const;
+
+            /**
+             * Returns the full name of the socket the server listens on (on Unix, its path).
+             *
+             * @return The full name of the socket, or an empty string if the server isn't listening
+             */
+            QString serverName () const;
+
+            /**
+             * Returns a description of why the server last failed to listen.
+             *
+             * @return A description of the last error, or an empty string if there was none
+             */
+            QString errorString () const;
+
+            /**
+             * Replaces the snapshot that requests are answered from with the current state of the given
+             *  collection. Does nothing if the collection hasn't changed since it was last published. Regions
+             *  are implicitly shared with the collection, so this copies no vertices.
+             *
+             * @param collection - The collection to publish
+             */
+            void publish (const VertexDataSetCollection &collection);
+
+            /**
+             * Publishes the given collection now and then whenever it changes, checking for changes a few
+             *  times a second. The collection must outlive the watch.
+             *
+             * @param collection - The collection to watch, or null to stop watching
+             */
+            void watch (const VertexDataSetCollection *collection);
+
+        private: // Types
+            /**
+             * A read-only copy of a collection, shared between the GUI and worker threads.
+             */
+            struct Snapshot
+            {
+                quint64                   revision = 0;
+
+                QStringList               names;
+
+                QVector <QPolygonF>       regions;
+                QVector <RegionSlabIndex> slabs;
+
+                DataSetRTree              tree;
+            };
+
+        private: // Methods
+            /**
+             * Serves every connection waiting on the given server. Runs on the worker thread.
+             *
+             * @param server - The server with waiting connections
+             */
+            void acceptConnections (QLocalServer *server);
+
+            /**
+             * Answers every complete request received on the given socket. A request that is too large or
+             *  has an invalid size is answered with {@link Status#BadRequest} and the client is
+             *  disconnected, as the rest of its stream can't be framed. Runs on the worker thread.
+             *
+             * @param socket - The socket to answer requests on
+             */
+            void serve (QLocalSocket *socket) const;
+
+            /**
+             * Answers the given request from the current snapshot.
+             *
+             * @param request - The request, without its size
+             *
+             * @return The response frame, including its size
+             */
+            QByteArray respond (const QByteArray &request) const;
+
+            /**
+             * Returns the snapshot requests are currently answered from.
+             *
+             * @return The current snapshot
+             */
+            QSharedPointer <const Snapshot> currentSnapshot () const;
+
+            /**
+             * Reads a string (a u16 byte count followed by UTF-8) from the given stream.
+             *
+             * @param stream - The stream to read from
+             *
+             * @return The string read, or an empty string if the stream ended early
+             */
+            static QString readString (QDataStream &stream);
+
+            /**
+             * Writes the given string (as a u16 byte count followed by UTF-8) to the given stream.
+             *
+             * @param stream - The stream to write to
+             * @param string - The string to write
+             */
+            static void writeString (QDataStream &stream, const QString &string);
+
+            /**
+             * Frames the given status and payload as a response.
+             *
+             * @param status  - The status of the response
+             * @param payload - The payload of the response
+             *
+             * @return The response frame, including its size
+             */
+            static QByteArray frame (const Status status, const QByteArray &payload = QByteArray ());
+
+        private: // Variables
+            const int                                          PUBLISH_INTERVAL     = 100;
+
+            static constexpr quint32                           FRAME_HEADER_SIZE    = 4;
+            static constexpr quint32                           MAX_REQUEST_SIZE     = 64 * 1024;
+
+            mutable QMutex                                     snapshotMutex;
+
+            QLocalServer                                       *localServer         = nullptr;
+
+            QSharedPointer <const Snapshot>                    snapshot;
+
+            QString                                            fullName;
+            QString                                            lastError;
+
+            QThread                                            workerThread;
+
+            QTimer                                             publishTimer;
+
+            const VertexDataSetCollection                      *watched             = nullptr;
+    };
+}
+
+#endif // QUERY_SERVER_H
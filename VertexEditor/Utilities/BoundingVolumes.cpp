@@ -0,0 +1,283 @@
+#include "BoundingVolumes.h"
+
+/**
+ * Computes simple shapes enclosing a region, for the broad phase of collision tests: its convex hull
+ *  (by Andrew's monotone chain), its bounding box, the oriented box of least area (by rotating
+ *  calipers around the hull) and the smallest enclosing circle (by Welzl's algorithm, over the
+ *  vertices of the hull in a shuffled order). Every shape encloses all of the vertices of the region,
+ *  whatever their order.
+ *
+ * @author  Patrick Jahnig (Aerodlyn)
+ * @version 2026.10.19
+ */
+
+/* Public Methods */
+/**
+ * Computes every shape enclosing the given region.
+ *
+ * @param region - The region to enclose
+ *
+ * @return The shapes enclosing the region
+ */
+Aerodlyn::BoundingVolumes::Volumes Aerodlyn::BoundingVolumes::compute (const QPolygonF &region)
+{
+    Volumes volumes;
+    if (region.isEmpty ())
+        return volumes;
+
+    volumes.hull = convexHull (region);
+
+    // The hull holds the extreme vertices, so everything else only needs to look at it
+    volumes.box         = volumes.hull.boundingRect ();
+    volumes.orientedBox = minimumAreaBox (volumes.hull);
+    volumes.circle      = minimumEnclosingCircle (volumes.hull);
+
+    return volumes;
+}
+
+/**
+ * Computes the convex hull of the given points.
+ *
+ * @param points - The points to enclose
+ *
+ * @return The vertices of the hull, counter-clockwise (with y pointing up) from the lowest of
+ *  the leftmost points, without repeated or collinear vertices
+ */
+QPolygonF Aerodlyn::BoundingVolumes::convexHull (const QPolygonF &points)
+{
+    QVector <QPointF> sorted (points.begin (), points.end ());
+    std::sort (sorted.begin (), sorted.end (), [] (const QPointF &a, const QPointF &b)
+        { return a.x () < b.x () || (a.x () == b.x () && a.y () < b.y ()); });
+
+    sorted.erase (std::unique (sorted.begin (), sorted.end (), [] (const QPointF &a, const QPointF &b)
+        { return a.x () == b.x () && a.y () == b.y (); }), sorted.end ());
+
+    if (sorted.size () < 3)
+        return QPolygonF (sorted);
+
+    // The lower chain is built from left to right and the upper one back from right to left, each
+    //  dropping the points that don't turn counter-clockwise
+    QPolygonF hull;
+    hull.reserve (sorted.size () + 1);
+
+    for (int pass = 0; pass < 2; pass++)
+    {
+        const int start = hull.size ();
+
+        for (int i = 0; i < sorted.size (); i++)
+        {
+            const QPointF &point = sorted.at (pass == 0 ? i : sorted.size () - 1 - i);
+
+            while (hull.size () >= start + 2 && cross (hull.at (hull.size () - 2), hull.last (), point) <= 0.0)
+                hull.removeLast ();
+
+            hull.append (point);
+        }
+
+        // The last point of each chain starts the other one
+        hull.removeLast ();
+    }
+
+    return hull;
+}
+
+/**
+ * Finds the oriented box of least area around the given convex hull. One of its sides always lies
+ *  along an edge of the hull, so only those orientations are tried.
+ *
+ * @param hull - The convex hull, as returned by {@link #convexHull}
+ *
+ * @return The oriented box of least area, with its width along the edge it lies on
+ */
+Aerodlyn::BoundingVolumes::OrientedBox Aerodlyn::BoundingVolumes::minimumAreaBox (const QPolygonF &hull)
+{
+    OrientedBox best;
+    const int count = hull.size ();
+
+    if (count == 0)
+        return best;
+
+    if (count < 3)
+    {
+        const QPointF edge = hull.last () - hull.first ();
+
+        best.center = (hull.first () + hull.last ()) / 2.0;
+        best.size   = QSizeF (std::hypot (edge.x (), edge.y ()), 0.0);
+        best.angle  = std::atan2 (edge.y (), edge.x ());
+
+        return best;
+    }
+
+    const auto dot = [] (const QPointF &a, const QPointF &b) { return a.x () * b.x () + a.y () * b.y (); };
+
+    // The calipers touch the hull at the point furthest along the edge, the one furthest from it and the
+    //  one furthest back along it. Each only moves forward as the edges turn, so after finding them for
+    //  the first edge, every edge costs constant time on average.
+    int calipers [3] = { 0, 0, 0 };
+    double bestArea = -1.0;
+
+    for (int i = 0; i < count; i++)
+    {
+        const QPointF &origin = hull.at (i);
+        const QPointF edge    = hull.at ((i + 1) % count) - origin;
+
+        const QPointF along  = edge / std::hypot (edge.x (), edge.y ());
+        const QPointF across (-along.y (), along.x ());
+
+        // How far each caliper's point extends, the hull lying to the left of its edges
+        const auto extent = [&] (const int caliper, const int index)
+        {
+            const QPointF offset = hull.at (index) - origin;
+            return caliper == 0 ? dot (offset, along) : caliper == 1 ? dot (offset, across) : -dot (offset, along);
+        };
+
+        for (int caliper = 0; caliper < 3; caliper++)
+        {
+            int &index = calipers [caliper];
+
+            if (i == 0)
+            {
+                for (int j = 1; j < count; j++)
+                {
+                    if (extent (caliper, j) > extent (caliper, index))
+                        index = j;
+                }
+            }
+
+            for (int steps = 0; steps < count && extent (caliper, (index + 1) % count) > extent (caliper, index); steps++)
+                index = (index + 1) % count;
+        }
+
+        const double maxAlong = extent (0, calipers [0]);
+        const double height   = extent (1, calipers [1]);
+        const double minAlong = -extent (2, calipers [2]);
+        const double width    = maxAlong - minAlong;
+
+        if (bestArea < 0.0 || width * height < bestArea)
+        {
+            bestArea    = width * height;
+            best.center = origin + along * ((minAlong + maxAlong) / 2.0) + across * (height / 2.0);
+            best.size   = QSizeF (width, height);
+            best.angle  = std::atan2 (along.y (), along.x ());
+        }
+    }
+
+    return best;
+}
+
+/**
+ * Finds the smallest circle enclosing the given points.
+ *
+ * @param points - The points to enclose
+ *
+ * @return The smallest enclosing circle
+ */
+Aerodlyn::BoundingVolumes::Circle Aerodlyn::BoundingVolumes::minimumEnclosingCircle (const QPolygonF &points)
+{
+    if (points.isEmpty ())
+        return Circle ();
+
+    // Welzl's algorithm takes expected linear time on points in a random order
+    QVector <QPointF> shuffled (points.begin (), points.end ());
+    std::shuffle (shuffled.begin (), shuffled.end (), std::mt19937 (SHUFFLE_SEED));
+
+    // Each point outside of the circle so far lies on the boundary of the circle of the points up to
+    //  it, which is found the same way with that point fixed (and then with two points fixed)
+    Circle circle = { shuffled.first (), 0.0 };
+
+    for (int i = 1; i < shuffled.size (); i++)
+    {
+        if (encloses (circle, shuffled.at (i)))
+            continue;
+
+        circle = { shuffled.at (i), 0.0 };
+
+        for (int j = 0; j < i; j++)
+        {
+            if (encloses (circle, shuffled.at (j)))
+                continue;
+
+            circle = circleThrough (shuffled.at (i), shuffled.at (j));
+
+            for (int k = 0; k < j; k++)
+            {
+                if (!encloses (circle, shuffled.at (k)))
+                    circle = circleThrough (shuffled.at (i), shuffled.at (j), shuffled.at (k));
+            }
+        }
+    }
+
+    return circle;
+}
+
+/* Private Methods */
+/**
+ * Returns the smallest circle through the given points, which has them as a diameter.
+ *
+ * @param a - The first point
+ * @param b - The second point
+ *
+ * @return The circle through the points
+ */
+Aerodlyn::BoundingVolumes::Circle Aerodlyn::BoundingVolumes::circleThrough (const QPointF &a, const QPointF &b)
+{
+    const QPointF center = (a + b) / 2.0;
+    return { center, std::hypot (a.x () - center.x (), a.y () - center.y ()) };
+}
+
+/**
+ * Returns the circle through the given points. Collinear points have no such circle, so the one
+ *  with the two furthest apart as a diameter is returned instead.
+ *
+ * @param a - The first point
+ * @param b - The second point
+ * @param c - The third point
+ *
+ * @return The circle through the points
+ */
+Aerodlyn::BoundingVolumes::Circle Aerodlyn::BoundingVolumes::circleThrough (const QPointF &a, const QPointF &b,
+    const QPointF &c)
+{
+    const QPointF ab = b - a, ac = c - a;
+    const double d = 2.0 * (ab.x () * ac.y () - ab.y () * ac.x ());
+
+    if (d == 0.0)
+    {
+        const Circle circles [] = { circleThrough (a, b), circleThrough (a, c), circleThrough (b, c) };
+        return *std::max_element (std::begin (circles), std::end (circles),
+            [] (const Circle &first, const Circle &second) { return first.radius < second.radius; });
+    }
+
+    // The center relative to a, where the perpendicular bisectors of ab and ac meet
+    const double abLength = QPointF::dotProduct (ab, ab), acLength = QPointF::dotProduct (ac, ac);
+    const QPointF offset ((ac.y () * abLength - ab.y () * acLength) / d, (ab.x () * acLength - ac.x () * abLength) / d);
+
+    return { a + offset, std::hypot (offset.x (), offset.y ()) };
+}
+
+/**
+ * Determines if the given point lies within the given circle, allowing for rounding.
+ *
+ * @param circle - The circle
+ * @param point  - The point
+ *
+ * @return True if the point is within the circle, false otherwise
+ */
+bool Aerodlyn::BoundingVolumes::encloses (const Circle &circle, const QPointF &point)
+{
+    const double distance = std::hypot (point.x () - circle.center.x (), point.y () - circle.center.y ());
+    return distance <= circle.radius * (1.0 + EPSILON) + EPSILON;
+}
+
+/**
+ * Returns twice the signed area of the triangle through the given points, which is positive if
+ *  they turn counter-clockwise (with y pointing up).
+ *
+ * @param o - The first point
+ * @param a - The second point
+ * @param b - The third point
+ *
+ * @return Twice the signed area of the triangle
+ */
+double Aerodlyn::BoundingVolumes::cross (const QPointF &o, const QPointF &a, const QPointF &b)
+    { return (a.x () - o.x ()) * (b.y () - o.y ()) - (a.y () - o.y ()) * (b.x () - o.x ()); }
@@ -0,0 +1,157 @@
+#ifndef BOUNDING_VOLUMES_H
+#define BOUNDING_VOLUMES_H
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+#include <QPointF>
+#include <QPolygonF>
+#include <QRectF>
+#include <QSizeF>
+#include <QVector>
+
+namespace Aerodlyn
+{
+    /**
+     * Computes simple shapes enclosing a region, for the broad phase of collision tests: its convex hull
+     *  (by Andrew's monotone chain), its bounding box, the oriented box of least area (by rotating
+     *  calipers around the hull) and the smallest enclosing circle (by Welzl's algorithm, over the
+     *  vertices of the hull in a shuffled order). Every shape encloses all of the vertices of the region,
+     *  whatever their order.
+     *
+     * @author  Patrick Jahnig (Aerodlyn)
+     * @version 2026.10.19
+     */
+    class BoundingVolumes
+    {
+        public: // Types
+            /**
+             * A box rotated by the given angle (in radians, from the x axis towards the y axis) around its
+             *  center, before which its width lies along the x axis.
+             */
+            struct OrientedBox
+            {
+                QPointF center;
+                QSizeF  size;
+
+                double  angle  = 0.0;
+            };
+
+            /**
+             * A circle, given by its center and radius.
+             */
+            struct Circle
+            {
+                QPointF center;
+
+                double  radius = 0.0;
+            };
+
+            /**
+             * Every shape enclosing a region. Regions without vertices have an empty hull, and every other
+             *  shape of theirs is empty and at the origin.
+             */
+            struct Volumes
+            {
+                QPolygonF   hull;
+                QRectF      box;
+
+                OrientedBox orientedBox;
+                Circle      circle;
+            };
+
+        public: // Methods
+            /**
+             * Computes every shape enclosing the given region.
+             *
+             * @param region - The region to enclose
+             *
+             * @return The shapes enclosing the region
+             */
+            static Volumes compute (const QPolygonF &region);
+
+            /**
+             * Computes the convex hull of the given points.
+             *
+             * @param points - The points to enclose
+             *
+             * @return The vertices of the hull, counter-clockwise (with y pointing up) from the lowest of
+             *  the leftmost points, without repeated or collinear vertices
+             */
+            static QPolygonF convexHull (const QPolygonF &points);
+
+            /**
+             * Finds the oriented box of least area around the given convex hull. One of its sides always lies
+             *  along an edge of the hull, so only those orientations are tried.
+             *
+             * @param hull - The convex hull, as returned by {@link #convexHull}
+             *
+             * @return The oriented box of least area, with its width along the edge it lies on
+             */
+            static OrientedBox minimumAreaBox (const QPolygonF &hull);
+
+            /**
+             * Finds the smallest circle enclosing the given points.
+             *
+             * @param points - The points to enclose
+             *
+             * @return The smallest enclosing circle
+             */
+            static Circle minimumEnclosingCircle (const QPolygonF &points);
+
+        private: // Methods
+            /**
+             * Returns the smallest circle through the given points, which has them as a diameter.
+             *
+             * @param a - The first point
+             * @param b - The second point
+             *
+             * @return The circle through the points
+             */
+            static Circle circleThrough (const QPointF &a, const QPointF &b);
+
+            /**
+             * Returns the circle through the given points. Collinear points have no such circle, so the one
+             *  with the two furthest apart as a diameter is returned instead.
+             *
+             * @param a - The first point
+             * @param b - The second point
+             * @param c - The third point
+             *
+             * @return The circle through the points
+             */
+            static Circle circleThrough (const QPointF &a, const QPointF &b, const QPointF &c);
+
+            /**
+             * Determines if the given point lies within the given circle, allowing for rounding.
+             *
+             * @param circle - The circle
+             * @param point  - The point
+             *
+             * @return True if the point is within the circle, false otherwise
+             */
+            static bool encloses (const Circle &circle, const QPointF &point);
+
+            /**
+             * Returns twice the signed area of the triangle through the given points, which is positive if
+             *  they turn counter-clockwise (with y pointing up).
+             *
+             * @param o - The first point
+             * @param a - The second point
+             * @param b - The third point
+             *
+             * @return Twice the signed area of the triangle
+             */
+            static double cross (const QPointF &o, const QPointF &a, const QPointF &b);
+
+        private: // Variables
+            // Relative to the radius, for points that round to just outside of a circle through them
+            static constexpr double EPSILON = 1e-9;
+
+            // The points are shuffled the same way every time, so exports don't change unless the regions do
+            static constexpr unsigned SHUFFLE_SEED = 0x41455230; // "AER0"
+    };
+}
+
+#endif // BOUNDING_VOLUMES_H
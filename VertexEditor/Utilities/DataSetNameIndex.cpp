@@ -0,0 +1,143 @@
+#include "DataSetNameIndex.h"
+
+/**
+ * A case-insensitive index over the names of the data sets in a {@link VertexDataSetCollection},
+ *  answering prefix queries with a binary search over the sorted, case-folded names and substring
+ *  queries with a trigram index.
+ *
+ * @author  Patrick Jahnig (Aerodlyn)
+ * @version 2026.10.19
+ */
+
+/* Public Methods */
+/**
+ * Discards the current contents of the index and indexes the names of every data set in the
+ *  given collection.
+ *
+ * @param collection - The collection whose names should be indexed
+ */
+void Aerodlyn::DataSetNameIndex::rebuild (const VertexDataSetCollection &collection)
+{
+    names.clear ();
+    sortedNames.clear ();
+    trigrams.clear ();
+
+    names.reserve (collection.length ());
+    sortedNames.reserve (collection.length ());
+
+    for (int i = 0; i < collection.length (); i++)
+    {
+        const QString folded = collection.at (i).name.toCaseFolded ();
+
+        names.append (folded);
+        sortedNames.append ({ folded, i });
+
+        // Indices are visited in ascending order, so every posting list stays sorted
+        for (int j = 0; j + 3 <= folded.length (); j++)
+        {
+            QVector <int> &postings = trigrams [trigramKey (folded, j)];
+            if (postings.isEmpty () || postings.last () != i)
+                postings.append (i);
+        }
+    }
+
+    std::sort (sortedNames.begin (), sortedNames.end ());
+}
+
+/**
+ * Returns the indices, in ascending order, of every data set whose name starts with the given
+ *  prefix, ignoring case.
+ *
+ * @param prefix - The prefix to match
+ *
+ * @return The sorted indices of the matching data sets
+ */
+QVector <int> Aerodlyn::DataSetNameIndex::findPrefix (const QString &prefix) const
+{
+    const QString folded = prefix.toCaseFolded ();
+
+    auto it = std::lower_bound (sortedNames.constBegin (), sortedNames.constEnd (), folded,
+        [] (const std::pair <QString, int> &entry, const QString &value) { return entry.first < value; });
+
+    QVector <int> result;
+    for (; it != sortedNames.constEnd () && it->first.startsWith (folded); it++)
+        result.append (it->second);
+
+    std::sort (result.begin (), result.end ());
+    return result;
+}
+
+/**
+ * Returns the indices, in ascending order, of every data set whose name contains the given
+ *  text, ignoring case.
+ *
+ * @param text - The text to match
+ *
+ * @return The sorted indices of the matching data sets
+ */
+QVector <int> Aerodlyn::DataSetNameIndex::findSubstring (const QString &text) const
+{
+    const QString folded = text.toCaseFolded ();
+    QVector <int> result;
+
+    // Too short to contain a trigram, so every name has to be checked
+    if (folded.length () < 3)
+    {
+        for (int i = 0; i < names.size (); i++)
+        {
+            if (names.at (i).contains (folded))
+                result.append (i);
+        }
+
+        return result;
+    }
+
+    // Intersect the posting lists of every trigram in the text, starting from the shortest one
+    QVector <const QVector <int> *> postings;
+    for (int j = 0; j + 3 <= folded.length (); j++)
+    {
+        const auto it = trigrams.constFind (trigramKey (folded, j));
+        if (it == trigrams.constEnd ())
+            return result;
+
+        postings.append (&*it);
+    }
+
+    std::sort (postings.begin (), postings.end (),
+        [] (const QVector <int> *a, const QVector <int> *b) { return a->size () < b->size (); });
+
+    QVector <int> candidates = *postings.first (), intersection;
+    for (int j = 1; j < postings.size () && !candidates.isEmpty (); j++)
+    {
+        intersection.clear ();
+        std::set_intersection (candidates.constBegin (), candidates.constEnd (),
+            postings.at (j)->constBegin (), postings.at (j)->constEnd (), std::back_inserter (intersection));
+
+        std::swap (candidates, intersection);
+    }
+
+    // Sharing every trigram doesn't guarantee that they are adjacent, so candidates are verified
+    for (const int index : candidates)
+    {
+        if (names.at (index).contains (folded))
+            result.append (index);
+    }
+
+    return result;
+}
+
+/* Private Methods */
+/**
+ * Returns the key of the trigram starting at the given position of the given (case-folded) text.
+ *
+ * @param text     - The text containing the trigram
+ * @param position - The position of the first character of the trigram
+ *
+ * @return The key of the trigram
+ */
+quint64 Aerodlyn::DataSetNameIndex::trigramKey (const QString &text, const int position)
+{
+    return (static_cast <quint64> (text.at (position).unicode ()) << 32) |
+           (static_cast <quint64> (text.at (position + 1).unicode ()) << 16) |
+            static_cast <quint64> (text.at (position + 2).unicode ());
+}
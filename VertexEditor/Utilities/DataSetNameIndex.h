@@ -0,0 +1,75 @@
+#ifndef DATA_SET_NAME_INDEX_H
+#define DATA_SET_NAME_INDEX_H
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+#include <QHash>
+#include <QString>
+#include <QVector>
+
+#include "VertexDataSetCollection.h"
+
+namespace Aerodlyn
+{
+    /**
+     * A case-insensitive index over the names of the data sets in a {@link VertexDataSetCollection},
+     *  answering prefix queries with a binary search over the sorted, case-folded names and substring
+     *  queries with a trigram index.
+     *
+     * @author  Patrick Jahnig (Aerodlyn)
+     * @version 2026.10.19
+     */
+    class DataSetNameIndex
+    {
+        public: // Methods
+            /**
+             * Discards the current contents of the index and indexes the names of every data set in the
+             *  given collection.
+             *
+             * @param collection - The collection whose names should be indexed
+             */
+            void rebuild (const VertexDataSetCollection &collection);
+
+            /**
+             * Returns the indices, in ascending order, of every data set whose name starts with the given
+             *  prefix, ignoring case.
+             *
+             * @param prefix - The prefix to match
+             *
+             * @return The sorted indices of the matching data sets
+             */
+            QVector <int> findPrefix (const QString &prefix) const;
+
+            /**
+             * Returns the indices, in ascending order, of every data set whose name contains the given
+             *  text, ignoring case.
+             *
+             * @param text - The text to match
+             *
+             * @return The sorted indices of the matching data sets
+             */
+            QVector <int> findSubstring (const QString &text) const;
+
+        private: // Methods
+            /**
+             * Returns the key of the trigram starting at the given position of the given (case-folded) text.
+             *
+             * @param text     - The text containing the trigram
+             * @param position - The position of the first character of the trigram
+             *
+             * @return The key of the trigram
+             */
+            static quint64 trigramKey (const QString &text, const int position);
+
+        private: // Variables
+            QVector <QString>                   names;
+
+            QVector <std::pair <QString, int>>  sortedNames;
+
+            QHash <quint64, QVector <int>>      trigrams;
+    };
+}
+
+#endif // DATA_SET_NAME_INDEX_H
@@ -0,0 +1,499 @@
+#include "DataSetRTree.h"
+
+/**
+ * An R-tree over the bounding boxes of data sets, keyed by name, for finding the data sets near a
+ *  point or a box without looking at every data set. The tree is bulk loaded with the
+ *  Sort-Tile-Recursive algorithm, and data sets can then be inserted, moved and removed one at a
+ *  time. Nodes emptied by removals are dropped, but underfull nodes aren't merged, so the tree is
+ *  bulk loaded again once as many data sets were removed as it holds.
+ *
+ * @author  Patrick Jahnig (Aerodlyn)
+ * @version 2026.10.19
+ */
+
+/* Public Methods */
+/**
+ * Removes every data set from the tree.
+ */
+void Aerodlyn::DataSetRTree::clear ()
+{
+    root     = -1;
+    removals = 0;
+
+    entryIndex.clear ();
+    entries.clear ();
+    freeEntries.clear ();
+    nodes.clear ();
+    freeNodes.clear ();
+}
+
+/**
+ * Replaces the contents of the tree with the given data sets, packing them into as few nodes as
+ *  possible. Much faster than inserting them one at a time, and gives a better tree.
+ *
+ * @param dataSets - The name and bounding box of each data set, with no name repeated
+ */
+void Aerodlyn::DataSetRTree::build (const QVector <QPair <QString, QRectF>> &dataSets)
+{
+    AERO_PROFILE_SCOPE ("DataSetRTree::build");
+
+    clear ();
+    if (dataSets.isEmpty ())
+        return;
+
+    entries.reserve (dataSets.size ());
+    entryIndex.reserve (dataSets.size ());
+
+    QVector <int> items;
+    items.reserve (dataSets.size ());
+
+    for (int i = 0; i < dataSets.size (); i++)
+    {
+        entries.append ({ -1, dataSets.at (i).first, dataSets.at (i).second });
+        entryIndex.insert (dataSets.at (i).first, i);
+        items.append (i);
+    }
+
+    QVector <int> level = pack (std::move (items), true);
+    while (level.size () > 1)
+        level = pack (std::move (level), false);
+
+    root = level.first ();
+}
+
+/**
+ * Inserts the data set with the given name, or moves it if the tree already holds it.
+ *
+ * @param name   - The name of the data set
+ * @param bounds - The bounding box of the data set
+ */
+void Aerodlyn::DataSetRTree::insert (const QString &name, const QRectF &bounds)
+{
+    const auto it = entryIndex.constFind (name);
+    if (it != entryIndex.constEnd ())
+    {
+        // Small edits rarely move a data set out of its leaf, in which case the tree keeps its shape
+        Entry &entry = entries [it.value ()];
+        if (encloses (nodes.at (entry.leaf).bounds, bounds))
+        {
+            entry.bounds = bounds;
+            return;
+        }
+
+        remove (name);
+    }
+
+    if (root == -1)
+        root = allocateNode (true, -1);
+
+    const int leaf = chooseLeaf (bounds);
+
+    int entry = entries.size ();
+    if (!freeEntries.isEmpty ())
+        entry = freeEntries.takeLast ();
+
+    else
+        entries.append (Entry ());
+
+    entries [entry] = { leaf, name, bounds };
+    entryIndex.insert (name, entry);
+    nodes [leaf].children.append (entry);
+
+    // Only an empty root can be a leaf without children, in which case it takes the new bounds as is
+    for (int node = leaf; node != -1; node = nodes.at (node).parent)
+    {
+        const bool first = node == leaf && nodes.at (node).children.size () == 1;
+        nodes [node].bounds = first ? bounds : unite (nodes.at (node).bounds, bounds);
+    }
+
+    if (nodes.at (leaf).children.size () > MAX_CHILDREN)
+        split (leaf);
+}
+
+/**
+ * Removes the data set with the given name.
+ *
+ * @param name - The name of the data set to remove
+ *
+ * @return True if the data set was removed, false if the tree doesn't hold it
+ */
+bool Aerodlyn::DataSetRTree::remove (const QString &name)
+{
+    const auto it = entryIndex.find (name);
+    if (it == entryIndex.end ())
+        return false;
+
+    const int entry = it.value ();
+    entryIndex.erase (it);
+
+    int node = entries.at (entry).leaf;
+    nodes [node].children.removeOne (entry);
+
+    entries [entry] = Entry ();
+    freeEntries.append (entry);
+
+    // Emptied nodes are dropped, all the way up to the root
+    while (node != root && nodes.at (node).children.isEmpty ())
+    {
+        const int parent = nodes.at (node).parent;
+        nodes [parent].children.removeOne (node);
+
+        nodes [node] = Node ();
+        freeNodes.append (node);
+
+        node = parent;
+    }
+
+    if (nodes.at (root).children.isEmpty ())
+    {
+        clear ();
+        return true;
+    }
+
+    refit (node);
+
+    // A root with a single child only adds a level to every query
+    while (!nodes.at (root).leaf && nodes.at (root).children.size () == 1)
+    {
+        const int child = nodes.at (root).children.first ();
+
+        nodes [root] = Node ();
+        freeNodes.append (root);
+
+        root = child;
+        nodes [root].parent = -1;
+    }
+
+    // Underfull nodes slow queries down, so the tree is packed again once they could be common
+    if (++removals > entryIndex.size () && entryIndex.size () > MAX_CHILDREN)
+    {
+        QVector <QPair <QString, QRectF>> remaining;
+        remaining.reserve (entryIndex.size ());
+
+        for (auto i = entryIndex.constBegin (); i != entryIndex.constEnd (); i++)
+            remaining.append ({ i.key (), entries.at (i.value ()).bounds });
+
+        build (remaining);
+    }
+
+    return true;
+}
+
+/**
+ * Returns the number of data sets in the tree.
+ *
+ * @return The number of data sets in the tree
+ */
+int Aerodlyn::DataSetRTree::size () const
+    { return entryIndex.size (); }
+
+/**
+ * Returns the names of the data sets whose bounding boxes touch the given box.
+ *
+ * @param box - The box to search
+ *
+ * @return The names of the data sets found, sorted
+ */
+QStringList Aerodlyn::DataSetRTree::query (const QRectF &box) const
+{
+    QStringList found;
+    if (root == -1)
+        return found;
+
+    QVarLengthArray <int, 64> pending;
+    pending.append (root);
+
+    while (!pending.isEmpty ())
+    {
+        const Node &node = nodes.at (pending.last ());
+        pending.removeLast ();
+
+        if (!touches (node.bounds, box))
+            continue;
+
+        for (const int child : node.children)
+        {
+            if (!node.leaf)
+                pending.append (child);
+
+            else if (touches (entries.at (child).bounds, box))
+                found.append (entries.at (child).name);
+        }
+    }
+
+    std::sort (found.begin (), found.end ());
+    return found;
+}
+
+/**
+ * Returns the names of the data sets whose bounding boxes contain the given point, including
+ *  along their edges.
+ *
+ * @param point - The point to search
+ *
+ * @return The names of the data sets found, sorted
+ */
+QStringList Aerodlyn::DataSetRTree::query (const QPointF &point) const
+    { return query (QRectF (point, point)); }
+
+/* Private Methods */
+/**
+ * Packs the given entries (or nodes) into parent nodes of up to {@link #MAX_CHILDREN} children
+ *  each, tiling them first into vertical slices and then into runs within each slice.
+ *
+ * @param items - The entries (or nodes) to pack
+ * @param leaf  - True if the items are entries, false if they are nodes
+ *
+ * @return The parent nodes
+ */
+QVector <int> Aerodlyn::DataSetRTree::pack (QVector <int> items, const bool leaf)
+{
+    const int count      = items.size ();
+    const int parents    = (count + MAX_CHILDREN - 1) / MAX_CHILDREN;
+    const int sliceSize  = static_cast <int> (std::ceil (std::sqrt (static_cast <double> (parents)))) * MAX_CHILDREN;
+
+    const auto byX = [this, leaf] (const int a, const int b)
+        { return itemBounds (a, leaf).center ().x () < itemBounds (b, leaf).center ().x (); };
+    const auto byY = [this, leaf] (const int a, const int b)
+        { return itemBounds (a, leaf).center ().y () < itemBounds (b, leaf).center ().y (); };
+
+    std::sort (items.begin (), items.end (), byX);
+
+    QVector <int> packed;
+    packed.reserve (parents);
+
+    for (int slice = 0; slice < count; slice += sliceSize)
+    {
+        const int sliceEnd = std::min (slice + sliceSize, count);
+        std::sort (items.begin () + slice, items.begin () + sliceEnd, byY);
+
+        for (int first = slice; first < sliceEnd; first += MAX_CHILDREN)
+        {
+            const int node = allocateNode (leaf, -1);
+
+            for (int i = first; i < std::min (first + MAX_CHILDREN, sliceEnd); i++)
+            {
+                nodes [node].children.append (items.at (i));
+
+                if (leaf)
+                    entries [items.at (i)].leaf = node;
+
+                else
+                    nodes [items.at (i)].parent = node;
+            }
+
+            nodes [node].bounds = boundsOf (node);
+            packed.append (node);
+        }
+    }
+
+    return packed;
+}
+
+/**
+ * Returns the leaf whose bounding box grows the least by adding the given bounding box,
+ *  descending from the root.
+ *
+ * @param bounds - The bounding box to add
+ *
+ * @return The leaf to add the bounding box to
+ */
+int Aerodlyn::DataSetRTree::chooseLeaf (const QRectF &bounds) const
+{
+    int node = root;
+
+    while (!nodes.at (node).leaf)
+    {
+        int best = -1;
+        double bestGrowth = 0.0, bestArea = 0.0;
+
+        // Ties (such as boxes already holding the bounds) go to the smallest box
+        for (const int child : nodes.at (node).children)
+        {
+            const QRectF &current = nodes.at (child).bounds;
+            const QRectF grown    = unite (current, bounds);
+
+            const double area   = current.width () * current.height ();
+            const double growth = grown.width () * grown.height () - area;
+
+            if (best == -1 || growth < bestGrowth || (growth == bestGrowth && area < bestArea))
+            {
+                best       = child;
+                bestGrowth = growth;
+                bestArea   = area;
+            }
+        }
+
+        node = best;
+    }
+
+    return node;
+}
+
+/**
+ * Splits the given overflowing node in two along the axis its children are most spread out on,
+ *  splitting its parent in turn if that overflows.
+ *
+ * @param node - The node to split
+ */
+void Aerodlyn::DataSetRTree::split (const int node)
+{
+    const bool leaf = nodes.at (node).leaf;
+    QVector <int> children = nodes.at (node).children;
+
+    QRectF centers = QRectF (itemBounds (children.first (), leaf).center (), QSizeF ());
+    for (const int child : children)
+    {
+        const QPointF center = itemBounds (child, leaf).center ();
+        centers = unite (centers, QRectF (center, center));
+    }
+
+    const bool alongX = centers.width () >= centers.height ();
+    std::sort (children.begin (), children.end (), [this, leaf, alongX] (const int a, const int b)
+    {
+        const QPointF first = itemBounds (a, leaf).center (), second = itemBounds (b, leaf).center ();
+        return alongX ? first.x () < second.x () : first.y () < second.y ();
+    });
+
+    int parent = nodes.at (node).parent;
+    if (parent == -1)
+    {
+        parent = allocateNode (false, -1);
+        nodes [parent].children.append (node);
+        nodes [node].parent = parent;
+
+        root = parent;
+    }
+
+    const int sibling = allocateNode (leaf, parent);
+    const int half    = children.size () / 2;
+
+    nodes [node].children    = children.mid (0, half);
+    nodes [sibling].children = children.mid (half);
+    nodes [parent].children.append (sibling);
+
+    for (const int child : nodes.at (sibling).children)
+    {
+        if (leaf)
+            entries [child].leaf = sibling;
+
+        else
+            nodes [child].parent = sibling;
+    }
+
+    // The parent still holds the same boxes, unless it is the new root
+    nodes [node].bounds    = boundsOf (node);
+    nodes [sibling].bounds = boundsOf (sibling);
+    nodes [parent].bounds  = boundsOf (parent);
+
+    if (nodes.at (parent).children.size () > MAX_CHILDREN)
+        split (parent);
+}
+
+/**
+ * Recomputes the bounding box of the given node, and of each of its ancestors, from their
+ *  children.
+ *
+ * @param node - The node to start from
+ */
+void Aerodlyn::DataSetRTree::refit (int node)
+{
+    for (; node != -1; node = nodes.at (node).parent)
+        nodes [node].bounds = boundsOf (node);
+}
+
+/**
+ * Returns a node to use, reusing a freed one if there is one.
+ *
+ * @param leaf   - True if the node is a leaf, false otherwise
+ * @param parent - The parent of the node, or -1 for the root
+ *
+ * @return The index of the node
+ */
+int Aerodlyn::DataSetRTree::allocateNode (const bool leaf, const int parent)
+{
+    int node = nodes.size ();
+    if (!freeNodes.isEmpty ())
+        node = freeNodes.takeLast ();
+
+    else
+        nodes.append (Node ());
+
+    nodes [node].leaf   = leaf;
+    nodes [node].parent = parent;
+
+    return node;
+}
+
+/**
+ * Returns the smallest box holding every child of the given node, which must have children.
+ *
+ * @param node - The node
+ *
+ * @return The bounding box of the node's children
+ */
+QRectF Aerodlyn::DataSetRTree::boundsOf (const int node) const
+{
+    const Node &n = nodes.at (node);
+
+    QRectF bounds = itemBounds (n.children.first (), n.leaf);
+    for (const int child : n.children)
+        bounds = unite (bounds, itemBounds (child, n.leaf));
+
+    return bounds;
+}
+
+/**
+ * Returns the bounding box of the given entry or node.
+ *
+ * @param item - The entry (or node)
+ * @param leaf - True if the item is an entry, false if it is a node
+ *
+ * @return The bounding box of the item
+ */
+const QRectF &Aerodlyn::DataSetRTree::itemBounds (const int item, const bool leaf) const
+    { return leaf ? entries.at (item).bounds : nodes.at (item).bounds; }
+
+/**
+ * Returns the smallest box holding both of the given boxes. Unlike {@link QRectF#united},
+ *  this doesn't ignore boxes without width or height.
+ *
+ * @param a - The first box
+ * @param b - The second box
+ *
+ * @return The union of the boxes
+ */
+QRectF Aerodlyn::DataSetRTree::unite (const QRectF &a, const QRectF &b)
+{
+    return QRectF (QPointF (std::min (a.left (), b.left ()), std::min (a.top (), b.top ())),
+                   QPointF (std::max (a.right (), b.right ()), std::max (a.bottom (), b.bottom ())));
+}
+
+/**
+ * Determines if the first of the given boxes holds the second.
+ *
+ * @param outer - The box that may hold the other
+ * @param inner - The box that may be held
+ *
+ * @return True if the inner box lies within the outer box, false otherwise
+ */
+bool Aerodlyn::DataSetRTree::encloses (const QRectF &outer, const QRectF &inner)
+{
+    return outer.left () <= inner.left () && inner.right () <= outer.right () &&
+           outer.top () <= inner.top () && inner.bottom () <= outer.bottom ();
+}
+
+/**
+ * Determines if the given boxes overlap or touch. Unlike {@link QRectF#intersects}, this is
+ *  also true for boxes without width or height.
+ *
+ * @param a - The first box
+ * @param b - The second box
+ *
+ * @return True if the boxes overlap or touch, false otherwise
+ */
+bool Aerodlyn::DataSetRTree::touches (const QRectF &a, const QRectF &b)
+{
+    return a.left () <= b.right () && b.left () <= a.right () &&
+           a.top () <= b.bottom () && b.top () <= a.bottom ();
+}
@@ -0,0 +1,235 @@
+#ifndef DATA_SET_R_TREE_H
+#define DATA_SET_R_TREE_H
+
+#include <algorithm>
+#include <cmath>
+
+#include <QHash>
+#include <QPair>
+#include <QPointF>
+#include <QRectF>
+#include <QSizeF>
+#include <QString>
+#include <QStringList>
+#include <QVarLengthArray>
+#include <QVector>
+
+#include "Root/Profiler.h"
+
+namespace Aerodlyn
+{
+    /**
+     * An R-tree over the bounding boxes of data sets, keyed by name, for finding the data sets near a
+     *  point or a box without looking at every data set. The tree is bulk loaded with the
+     *  Sort-Tile-Recursive algorithm, and data sets can then be inserted, moved and removed one at a
+     *  time. Nodes emptied by removals are dropped, but underfull nodes aren't merged, so the tree is
+     *  bulk loaded again once as many data sets were removed as it holds.
+     *
+     * Bounding boxes may have no width or height (such as the bounds of a single vertex), and a box
+     *  is found by every query it touches, including along its edges.
+     *
+     * @author  Patrick Jahnig (Aerodlyn)
+     * @version 2026.10.19
+     */
+    class DataSetRTree
+    {
+        public: // Methods
+            /**
+             * Removes every data set from the tree.
+             */
+            void clear ();
+
+            /**
+             * Replaces the contents of the tree with the given data sets, packing them into as few nodes as
+             *  possible. Much faster than inserting them one at a time, and gives a better tree.
+             *
+             * @param dataSets - The name and bounding box of each data set, with no name repeated
+             */
+            void build (const QVector <QPair <QString, QRectF>> &dataSets);
+
+            /**
+             * Inserts the data set with the given name, or moves it if the tree already holds it.
+             *
+             * @param name   - The name of the data set
+             * @param bounds - The bounding box of the data set
+             */
+            void insert (const QString &name, const QRectF &bounds);
+
+            /**
+             * Removes the data set with the given name.
+             *
+             * @param name - The name of the data set to remove
+             *
+             * @return True if the data set was removed, false if the tree doesn't hold it
+             */
+            bool remove (const QString &name);
+
+            /**
+             * Returns the number of data sets in the tree.
+             *
+             * @return The number of data sets in the tree
+             */
+            int size () const;
+
+            /**
+             * Returns the names of the data sets whose bounding boxes touch the given box.
+             *
+             * @param box - The box to search
+             *
+             * @return The names of the data sets found, sorted
+             */
+            QStringList query (const QRectF &box) const;
+
+            /**
+             * Returns the names of the data sets whose bounding boxes contain the given point, including
+             *  along their edges.
+             *
+             * @param point - The point to search
+             *
+             * @return The names of the data sets found, sorted
+             */
+            QStringList query (const QPointF &point) const;
+
+        private: // Types
+            /**
+             * A node of the tree, whose children are entries if it is a leaf and nodes otherwise.
+             */
+            struct Node
+            {
+                bool            leaf     = true;
+
+                int             parent   = -1;
+
+                QRectF          bounds;
+
+                QVector <int>   children;
+            };
+
+            /**
+             * A data set held by a leaf of the tree.
+             */
+            struct Entry
+            {
+                int             leaf     = -1;
+
+                QString         name;
+
+                QRectF          bounds;
+            };
+
+        private: // Methods
+            /**
+             * Packs the given entries (or nodes) into parent nodes of up to {@link #MAX_CHILDREN} children
+             *  each, tiling them first into vertical slices and then into runs within each slice.
+             *
+             * @param items - The entries (or nodes) to pack
+             * @param leaf  - True if the items are entries, false if they are nodes
+             *
+             * @return The parent nodes
+             */
+            QVector <int> pack (QVector <int> items, const bool leaf);
+
+            /**
+             * Returns the leaf whose bounding box grows the least by adding the given bounding box,
+             *  descending from the root.
+             *
+             * @param bounds - The bounding box to add
+             *
+             * @return The leaf to add the bounding box to
+             */
+            int chooseLeaf (const QRectF &bounds) const;
+
+            /**
+             * Splits the given overflowing node in two along the axis its children are most spread out on,
+             *  splitting its parent in turn if that overflows.
+             *
+             * @param node - The node to split
+             */
+            void split (const int node);
+
+            /**
+             * Recomputes the bounding box of the given node, and of each of its ancestors, from their
+             *  children.
+             *
+             * @param node - The node to start from
+             */
+            void refit (int node);
+
+            /**
+             * Returns a node to use, reusing a freed one if there is one.
+             *
+             * @param leaf   - True if the node is a leaf, false otherwise
+             * @param parent - The parent of the node, or -1 for the root
+             *
+             * @return The index of the node
+             */
+            int allocateNode (const bool leaf, const int parent);
+
+            /**
+             * Returns the smallest box holding every child of the given node, which must have children.
+             *
+             * @param node - The node
+             *
+             * @return The bounding box of the node's children
+             */
+            QRectF boundsOf (const int node) const;
+
+            /**
+             * Returns the bounding box of the given entry or node.
+             *
+             * @param item - The entry (or node)
+             * @param leaf - True if the item is an entry, false if it is a node
+             *
+             * @return The bounding box of the item
+             */
+            const QRectF &itemBounds (const int item, const bool leaf) const;
+
+            /**
+             * Returns the smallest box holding both of the given boxes. Unlike {@link QRectF#united},
+             *  this doesn't ignore boxes without width or height.
+             *
+             * @param a - The first box
+             * @param b - The second box
+             *
+             * @return The union of the boxes
+             */
+            static QRectF unite (const QRectF &a, const QRectF &b);
+
+            /**
+             * Determines if the first of the given boxes holds the second.
+             *
+             * @param outer - The box that may hold the other
+             * @param inner - The box that may be held
+             *
+             * @return True if the inner box lies within the outer box, false otherwise
+             */
+            static bool encloses (const QRectF &outer, const QRectF &inner);
+
+            /**
+             * Determines if the given boxes overlap or touch. Unlike {@link QRectF#intersects}, this is
+             *  also true for boxes without width or height.
+             *
+             * @param a - The first box
+             * @param b - The second box
+             *
+             * @return True if the boxes overlap or touch, false otherwise
+             */
+            static bool touches (const QRectF &a, const QRectF &b);
+
+        private: // Variables
+            int                         root         = -1;
+            int                         removals     = 0;
+
+            QHash <QString, int>        entryIndex;
+
+            QVector <Entry>             entries;
+            QVector <int>               freeEntries;
+
+            QVector <Node>              nodes;
+            QVector <int>               freeNodes;
+
+            static constexpr int        MAX_CHILDREN = 16;
+    };
+}
+
+#endif // DATA_SET_R_TREE_H
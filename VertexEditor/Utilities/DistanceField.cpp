@@ -0,0 +1,287 @@
+#include "DistanceField.h"
+
+/**
+ * Generates signed distance fields of the regions of data sets (e.g. for outlines and soft collision
+ *  in shaders). Each pixel holds the distance from its center to the edge of the region, negative
+ *  inside the region and positive outside of it.
+ *
+ * The region is rasterized at the resolution of the field, and the exact Euclidean distance from
+ *  every pixel to the nearest pixel on the other side of the edge is found with the transform of
+ *  Felzenszwalb and Huttenlocher: a pass over every column followed by a pass over every row, each
+ *  taking linear time and spread across the available cores. The edge is taken to lie halfway
+ *  between neighbouring pixels on either side of it.
+ *
+ * @author  Patrick Jahnig (Aerodlyn)
+ * @version 2026.10.19
+ */
+
+/* Public Methods */
+/**
+ * Generates the signed distance field of the given region. Points of the region are scaled by
+ *  the given scale before being placed in the field, so a scale of 2 gives twice the resolution.
+ *  Pixels with nothing on the other side of the edge within the field (all of them, for a region
+ *  that encloses nothing or covers the whole field) are given the length of the diagonal of the
+ *  field, which no other distance reaches, in the units of the region.
+ *
+ * @param region - The region to generate the field of
+ * @param size   - The size of the field, in pixels
+ * @param origin - The position in the field of the origin of the region's coordinates
+ * @param scale  - The number of pixels of the field per unit of the region's coordinates
+ *
+ * @return The signed distance field of the region, which is empty if the size is empty or the
+ *  scale isn't positive
+ */
+Aerodlyn::DistanceField::Field Aerodlyn::DistanceField::generate (const QPolygonF &region, const QSize &size,
+    const QPointF &origin, const double scale)
+{
+    AERO_PROFILE_SCOPE ("DistanceField::generate");
+
+    Field field;
+
+    if (size.isEmpty () || scale <= 0.0)
+        return field;
+
+    field.width     = size.width ();
+    field.height    = size.height ();
+    field.distances = QVector <float> (field.width * field.height);
+
+    QPolygonF scaled;
+    scaled.reserve (region.size ());
+
+    for (const QPointF &point : region)
+        scaled.append (point * scale);
+
+    const RegionRasterizer::Mask mask = RegionRasterizer::rasterize (scaled, size, origin,
+        RegionRasterizer::Format::Byte);
+
+    // The squared distance from every pixel inside to the nearest pixel outside, and the other way around
+    QVector <float> toOutside (field.width * field.height), toInside (field.width * field.height);
+
+    for (int y = 0; y < field.height; y++)
+    {
+        const char *row = mask.data.constData () + static_cast <qsizetype> (y) * mask.stride;
+
+        for (int x = 0; x < field.width; x++)
+        {
+            const bool inside = row [x] != 0;
+
+            toOutside [y * field.width + x] = inside ? UNREACHED : 0.0f;
+            toInside [y * field.width + x]  = inside ? 0.0f : UNREACHED;
+        }
+    }
+
+    // Every task reads and writes its own column (or row) only, so the vectors are never detached
+    //  concurrently
+    float *grids [2] = { toOutside.data (), toInside.data () };
+    const int width = field.width, height = field.height;
+
+    QVector <int> columns (width);
+    std::iota (columns.begin (), columns.end (), 0);
+
+    QtConcurrent::blockingMap (columns, [&] (const int &x)
+    {
+        QVector <float> column (height);
+        QVector <double> input (height), boundaries (height + 1);
+        QVector <int> vertices (height);
+
+        for (float *grid : grids)
+        {
+            for (int y = 0; y < height; y++)
+                column [y] = grid [y * width + x];
+
+            transform (column.data (), height, input.data (), vertices.data (), boundaries.data ());
+
+            for (int y = 0; y < height; y++)
+                grid [y * width + x] = column.at (y);
+        }
+    });
+
+    QVector <int> rows (height);
+    std::iota (rows.begin (), rows.end (), 0);
+
+    QtConcurrent::blockingMap (rows, [&] (const int &y)
+    {
+        QVector <double> input (width), boundaries (width + 1);
+        QVector <int> vertices (width);
+
+        for (float *grid : grids)
+            transform (grid + static_cast <qsizetype> (y) * width, width, input.data (), vertices.data (), boundaries.data ());
+    });
+
+    // Distances between pixel centers are half a pixel longer than the distances to the edge between them.
+    //  Pixels that no pixel on the other side was found for still hold the square root of UNREACHED, so
+    //  every distance is clamped to the diagonal of the field.
+    const double diagonal = std::hypot (width, height);
+
+    for (int i = 0; i < field.distances.size (); i++)
+    {
+        const double distance = toInside.at (i) == 0.0f ? -(std::sqrt (toOutside.at (i)) - 0.5) :
+            std::sqrt (toInside.at (i)) - 0.5;
+
+        field.distances [i] = static_cast <float> (std::clamp (distance, -diagonal, diagonal) / scale);
+    }
+
+    return field;
+}
+
+/**
+ * Generates the signed distance field of the region of every data set in the given collection
+ *  and writes each to a file in the given directory named after its data set (see
+ *  {@link RegionRasterizer#fileName}). The fields are generated one at a time, each spread across
+ *  the available cores, so only one is held at once.
+ *
+ * @param collection - The data sets to generate the fields of
+ * @param size       - The size of the fields, in pixels
+ * @param origin     - The position in the fields of the origin of the regions' coordinates
+ * @param scale      - The number of pixels of the fields per unit of the regions' coordinates
+ * @param spread     - The distance from the edge mapped to black or white, for byte encoding
+ * @param encoding   - The file format to write the fields in
+ * @param directory  - The directory to write the fields to
+ *
+ * @return The names of the data sets whose fields couldn't be written
+ */
+QStringList Aerodlyn::DistanceField::exportAll (const VertexDataSetCollection &collection, const QSize &size,
+    const QPointF &origin, const double scale, const double spread, const Encoding encoding, const QDir &directory)
+{
+    AERO_PROFILE_SCOPE ("DistanceField::exportAll");
+
+    QStringList failed;
+
+    for (int i = 0; i < collection.length (); i++)
+    {
+        const VertexDataSet &set = collection.at (i);
+
+        const QString filename = RegionRasterizer::fileName (set.name) + (encoding == Encoding::Byte ? ".png" : ".pfm");
+
+        if (!save (generate (set.region, size, origin, scale), directory.filePath (filename), encoding, spread))
+            failed.append (set.name);
+    }
+
+    return failed;
+}
+
+/**
+ * Converts the given field to a grayscale image, with the edge at mid gray and the inside of the
+ *  region brighter. Distances beyond the given spread are clamped to black or white.
+ *
+ * @param field  - The field to convert
+ * @param spread - The distance from the edge mapped to black (outside) or white (inside)
+ *
+ * @return The field as an image
+ */
+QImage Aerodlyn::DistanceField::toImage (const Field &field, const double spread)
+{
+    if (field.width == 0 || field.height == 0 || spread <= 0.0)
+        return QImage ();
+
+    QImage image (field.width, field.height, QImage::Format_Grayscale8);
+    const double factor = 127.5 / spread;
+
+    for (int y = 0; y < field.height; y++)
+    {
+        uchar *row = image.scanLine (y);
+        const float *distances = field.distances.constData () + static_cast <qsizetype> (y) * field.width;
+
+        for (int x = 0; x < field.width; x++)
+            row [x] = static_cast <uchar> (std::clamp (std::round (127.5 - distances [x] * factor), 0.0, 255.0));
+    }
+
+    return image;
+}
+
+/**
+ * Writes the given field to the given file in the given file format. Byte fields are written
+ *  as grayscale PNG images, and float fields as little-endian portable float maps (PFM), which
+ *  store their rows from the bottom up.
+ *
+ * @param field    - The field to write
+ * @param filepath - The path of the file to write to
+ * @param encoding - The file format to write the field in
+ * @param spread   - The distance from the edge mapped to black or white, for byte encoding
+ *
+ * @return True if the field was written, false otherwise
+ */
+bool Aerodlyn::DistanceField::save (const Field &field, const QString &filepath, const Encoding encoding,
+    const double spread)
+{
+    if (encoding == Encoding::Byte)
+        return toImage (field, spread).save (filepath, "PNG");
+
+    QFile file (filepath);
+    if (!file.open (QIODevice::WriteOnly))
+        return false;
+
+    // A negative scale marks the samples as little-endian
+    const QByteArray header = QString ("Pf\n%1 %2\n-1.0\n").arg (field.width).arg (field.height).toUtf8 ();
+    if (file.write (header) != header.size ())
+        return false;
+
+    QDataStream stream (&file);
+    stream.setByteOrder (QDataStream::LittleEndian);
+    stream.setFloatingPointPrecision (QDataStream::SinglePrecision);
+
+    for (int y = field.height - 1; y >= 0; y--)
+    {
+        for (int x = 0; x < field.width; x++)
+            stream << field.distances.at (y * field.width + x);
+    }
+
+    return stream.status () == QDataStream::Ok;
+}
+
+/* Private Methods */
+/**
+ * Replaces each of the given squared distances with the smallest squared distance found by
+ *  adding the squared offset to any other, the one-dimensional transform of Felzenszwalb and
+ *  Huttenlocher. Takes the lower envelope of the parabolas rooted at each sample.
+ *
+ * @param values     - The squared distances to transform, read from and written to
+ * @param length     - The number of squared distances
+ * @param input      - Scratch space for length values
+ * @param vertices   - Scratch space for length indices
+ * @param boundaries - Scratch space for length + 1 values
+ */
+void Aerodlyn::DistanceField::transform (float *values, const int length, double *input, int *vertices,
+    double *boundaries)
+{
+    if (length == 0)
+        return;
+
+    std::copy (values, values + length, input);
+
+    // The parabola rooted at vertices [k] is the lowest between boundaries [k] and boundaries [k + 1]
+    int k = 0;
+    vertices [0]   = 0;
+    boundaries [0] = -std::numeric_limits <double>::infinity ();
+    boundaries [1] = std::numeric_limits <double>::infinity ();
+
+    // Where the parabola rooted at q rises above the one rooted at v
+    const auto crossingOf = [input] (const int q, const int v)
+    {
+        return ((input [q] + static_cast <double> (q) * q) - (input [v] + static_cast <double> (v) * v)) / (2.0 * (q - v));
+    };
+
+    for (int q = 1; q < length; q++)
+    {
+        // Parabolas hidden below the new one are dropped from the envelope, which never empties as the
+        //  first boundary is infinitely far
+        double crossing = crossingOf (q, vertices [k]);
+        while (crossing <= boundaries [k])
+            crossing = crossingOf (q, vertices [--k]);
+
+        k++;
+        vertices [k]       = q;
+        boundaries [k]     = crossing;
+        boundaries [k + 1] = std::numeric_limits <double>::infinity ();
+    }
+
+    k = 0;
+    for (int q = 0; q < length; q++)
+    {
+        while (boundaries [k + 1] < q)
+            k++;
+
+        const double offset = q - vertices [k];
+        values [q] = static_cast <float> (offset * offset + input [vertices [k]]);
+    }
+}
@@ -0,0 +1,145 @@
+#ifndef DISTANCE_FIELD_H
+#define DISTANCE_FIELD_H
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+#include <QDataStream>
+#include <QDir>
+#include <QFile>
+#include <QImage>
+#include <QPointF>
+#include <QPolygonF>
+#include <QSize>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+#include <QtConcurrent>
+
+#include "Root/Profiler.h"
+
+#include "RegionRasterizer.h"
+#include "VertexDataSetCollection.h"
+
+namespace Aerodlyn
+{
+    /**
+     * Generates signed distance fields of the regions of data sets (e.g. for outlines and soft collision
+     *  in shaders). Each pixel holds the distance from its center to the edge of the region, negative
+     *  inside the region and positive outside of it.
+     *
+     * The region is rasterized at the resolution of the field, and the exact Euclidean distance from
+     *  every pixel to the nearest pixel on the other side of the edge is found with the transform of
+     *  Felzenszwalb and Huttenlocher: a pass over every column followed by a pass over every row, each
+     *  taking linear time and spread across the available cores. The edge is taken to lie halfway
+     *  between neighbouring pixels on either side of it.
+     *
+     * @author  Patrick Jahnig (Aerodlyn)
+     * @version 2026.10.19
+     */
+    class DistanceField
+    {
+        public: // Types
+            /**
+             * The file format that fields are exported in.
+             */
+            enum class Encoding { Byte, Float };
+
+            /**
+             * A signed distance field, with the distance of each pixel in the units of the region's
+             *  coordinates. Rows are stored one after the other, from the top.
+             */
+            struct Field
+            {
+                int             width  = 0;
+                int             height = 0;
+
+                QVector <float> distances;
+            };
+
+        public: // Methods
+            /**
+             * Generates the signed distance field of the given region. Points of the region are scaled by
+             *  the given scale before being placed in the field, so a scale of 2 gives twice the resolution.
+             *  Pixels with nothing on the other side of the edge within the field (all of them, for a region
+             *  that encloses nothing or covers the whole field) are given the length of the diagonal of the
+             *  field, which no other distance reaches, in the units of the region.
+             *
+             * @param region - The region to generate the field of
+             * @param size   - The size of the field, in pixels
+             * @param origin - The position in the field of the origin of the region's coordinates
+             * @param scale  - The number of pixels of the field per unit of the region's coordinates
+             *
+             * @return The signed distance field of the region, which is empty if the size is empty or the
+             *  scale isn't positive
+             */
+            static Field generate (const QPolygonF &region, const QSize &size, const QPointF &origin, const double scale);
+
+            /**
+             * Generates the signed distance field of the region of every data set in the given collection
+             *  and writes each to a file in the given directory named after its data set (see
+             *  {@link RegionRasterizer#fileName}). The fields are generated one at a time, each spread across
+             *  the available cores, so only one is held at once.
+             *
+             * @param collection - The data sets to generate the fields of
+             * @param size       - The size of the fields, in pixels
+             * @param origin     - The position in the fields of the origin of the regions' coordinates
+             * @param scale      - The number of pixels of the fields per unit of the regions' coordinates
+             * @param spread     - The distance from the edge mapped to black or white, for byte encoding
+             * @param encoding   - The file format to write the fields in
+             * @param directory  - The directory to write the fields to
+             *
+             * @return The names of the data sets whose fields couldn't be written
+             */
+            static QStringList exportAll (const VertexDataSetCollection &collection, const QSize &size,
+                const QPointF &origin, const double scale, const double spread, const Encoding encoding,
+                const QDir &directory);
+
+            /**
+             * Converts the given field to a grayscale image, with the edge at mid gray and the inside of the
+             *  region brighter. Distances beyond the given spread are clamped to black or white.
+             *
+             * @param field  - The field to convert
+             * @param spread - The distance from the edge mapped to black (outside) or white (inside)
+             *
+             * @return The field as an image
+             */
+            static QImage toImage (const Field &field, const double spread);
+
+            /**
+             * Writes the given field to the given file in the given file format. Byte fields are written
+             *  as grayscale PNG images, and float fields as little-endian portable float maps (PFM), which
+             *  store their rows from the bottom up.
+             *
+             * @param field    - The field to write
+             * @param filepath - The path of the file to write to
+             * @param encoding - The file format to write the field in
+             * @param spread   - The distance from the edge mapped to black or white, for byte encoding
+             *
+             * @return True if the field was written, false otherwise
+             */
+            static bool save (const Field &field, const QString &filepath, const Encoding encoding, const double spread);
+
+        private: // Methods
+            /**
+             * Replaces each of the given squared distances with the smallest squared distance found by
+             *  adding the squared offset to any other, the one-dimensional transform of Felzenszwalb and
+             *  Huttenlocher. Takes the lower envelope of the parabolas rooted at each sample.
+             *
+             * @param values     - The squared distances to transform, read from and written to
+             * @param length     - The number of squared distances
+             * @param input      - Scratch space for length values
+             * @param vertices   - Scratch space for length indices
+             * @param boundaries - Scratch space for length + 1 values
+             */
+            static void transform (float *values, const int length, double *input, int *vertices, double *boundaries);
+
+        private: // Variables
+            // Stands for no pixel on the other side of the edge, while leaving room to add squared offsets
+            static constexpr float UNREACHED = 1e20f;
+    };
+}
+
+#endif // DISTANCE_FIELD_H
@@ -0,0 +1,434 @@
+#include "HeaderExporter.h"
+
+/**
+ * Exports the data sets of a {@link VertexDataSetCollection} as a self-contained C++17 header, so
+ *  that games can link regions directly into read-only data instead of parsing them at startup.
+ *  Each region becomes a constexpr array of points, listed in a constexpr table sorted by name
+ *  that is searched with a constexpr binary search, so lookups by a constant name are resolved at
+ *  compile time. Alongside its points, each region carries the shapes enclosing it (see
+ *  {@link BoundingVolumes}) for the broad phase of collision tests.
+ *
+ * @author  Patrick Jahnig (Aerodlyn)
+ * @version 2026.10.19
+ */
+
+/* Public Methods */
+/**
+ * Generates the header for the given collection.
+ *
+ * @param collection    - The collection to export
+ * @param namespaceName - The namespace to generate the header in, which must be a valid
+ *                          C++ identifier (see {@link #namespaceFor})
+ *
+ * @return The contents of the header
+ */
+QByteArray Aerodlyn::HeaderExporter::generate (const VertexDataSetCollection &collection, const QString &namespaceName)
+{
+    AERO_PROFILE_SCOPE ("HeaderExporter::generate");
+
+    // The lookup compares names as std::string_view, which orders them by their UTF-8 bytes rather
+    //  than by the UTF-16 order of the collection
+    QVector <QPair <QByteArray, int>> order;
+    order.reserve (collection.length ());
+
+    int points = 0;
+    for (int i = 0; i < collection.length (); i++)
+    {
+        order.append ({ collection.at (i).name.toUtf8 (), i });
+        points += collection.at (i).region.size () * (1 + collection.at (i).attributes.channelCount ());
+    }
+
+    std::sort (order.begin (), order.end ());
+
+    // The hulls are part of every region, so they are computed for all of them at once
+    collection.updateVolumes ();
+
+    QByteArray out;
+    out.reserve (2048 + order.size () * 256 + points * 64);
+
+    out.append ("// Generated by AeroHelper ").append (Utils::getVersion ().toUtf8 ())
+       .append (". Do not edit, export the data sets again instead.\n"
+                "#pragma once\n"
+                "\n"
+                "#include <array>\n"
+                "#include <cstddef>\n"
+                "#include <string_view>\n"
+                "\n"
+                "namespace ").append (namespaceName.toUtf8 ()).append ("\n"
+                "{\n"
+                "    struct Point\n"
+                "    {\n"
+                "        float x;\n"
+                "        float y;\n"
+                "    };\n"
+                "\n"
+                "    struct Box\n"
+                "    {\n"
+                "        Point topLeft;\n"
+                "        Point bottomRight;\n"
+                "    };\n"
+                "\n"
+                "    // Rotated by angle (in radians, from the x axis towards the y axis) around its center, before\n"
+                "    //  which its width lies along the x axis\n"
+                "    struct OrientedBox\n"
+                "    {\n"
+                "        Point center;\n"
+                "        float width;\n"
+                "        float height;\n"
+                "        float angle;\n"
+                "    };\n"
+                "\n"
+                "    struct Circle\n"
+                "    {\n"
+                "        Point center;\n"
+                "        float radius;\n"
+                "    };\n"
+                "\n"
+                "    enum class AttributeType { Flag, Integer, Scalar, Vector };\n"
+                "\n"
+                "    // One value per point of its region, in ints for flags (0 or 1) and integers, or in floats for\n"
+                "    //  scalars and vectors (two per point, x then y)\n"
+                "    struct Attribute\n"
+                "    {\n"
+                "        std::string_view name;\n"
+                "        AttributeType    type;\n"
+                "        const int        *ints;\n"
+                "        const float      *floats;\n"
+                "    };\n"
+                "\n"
+                "    // The hull, box, oriented box (of least area) and circle (the smallest) all enclose the points\n"
+                "    struct Region\n"
+                "    {\n"
+                "        std::string_view name;\n"
+                "        const Point      *points;\n"
+                "        std::size_t      size;\n"
+                "        const Point      *hull;\n"
+                "        std::size_t      hullSize;\n"
+                "        Box              box;\n"
+                "        OrientedBox      orientedBox;\n"
+                "        Circle           circle;\n"
+                "        const Attribute  *attributes;\n"
+                "        std::size_t      attributeCount;\n"
+                "    };\n"
+                "\n"
+                "    namespace Data\n"
+                "    {\n");
+
+    for (int i = 0; i < order.size (); i++)
+    {
+        const QPolygonF &region = collection.at (order.at (i).second).region;
+        if (region.isEmpty ())
+            continue;
+
+        appendPoints (out, "region" + QByteArray::number (i), region);
+        appendPoints (out, "hull" + QByteArray::number (i), collection.volumesAt (order.at (i).second).hull);
+
+        const VertexAttributes &attributes = collection.at (order.at (i).second).attributes;
+        if (attributes.isEmpty ())
+            continue;
+
+        QByteArray table;
+        for (int c = 0; c < attributes.channelCount (); c++)
+        {
+            const VertexAttributes::Channel &channel = attributes.channel (c);
+            const QByteArray values = "attribute" + QByteArray::number (i) + "_" + QByteArray::number (c);
+
+            table.append ("\n            { ");
+            appendLiteral (table, channel.name);
+            table.append (", AttributeType::").append (VertexAttributes::typeName (channel.type).toUtf8 ());
+
+            if (!channel.integers.isEmpty ())
+            {
+                appendInts (out, values, channel.integers);
+                table.append (", ").append (values).append (", nullptr }");
+            }
+
+            else
+            {
+                appendFloats (out, values, channel.reals);
+                table.append (", nullptr, ").append (values).append (" }");
+            }
+
+            table.append (c + 1 < attributes.channelCount () ? "," : "");
+        }
+
+        out.append ("        inline constexpr Attribute attributes").append (QByteArray::number (i)).append (" [] =\n"
+                    "        {").append (table).append ("\n        };\n");
+    }
+
+    out.append ("    }\n"
+                "\n"
+                "    inline constexpr std::size_t regionCount = ").append (QByteArray::number (order.size ())).append (";\n"
+                "\n"
+                "    // Sorted by name, for find\n"
+                "    inline constexpr std::array <Region, regionCount> regions =\n"
+                "    {");
+
+    if (!order.isEmpty ())
+        out.append ("{");
+
+    for (int i = 0; i < order.size (); i++)
+    {
+        const int size = collection.at (order.at (i).second).region.size ();
+        const BoundingVolumes::Volumes &volumes = collection.volumesAt (order.at (i).second);
+
+        out.append ("\n        { ");
+        appendLiteral (out, collection.at (order.at (i).second).name);
+        out.append (", ").append (size == 0 ? QByteArray ("nullptr") : "Data::region" + QByteArray::number (i))
+           .append (", ").append (QByteArray::number (size))
+           .append (", ").append (size == 0 ? QByteArray ("nullptr") : "Data::hull" + QByteArray::number (i))
+           .append (", ").append (QByteArray::number (volumes.hull.size ())).append (",\n          { ");
+
+        // The shapes go on a line of their own, in the order of the fields of Region
+        appendPoint (out, volumes.box.topLeft ());
+        out.append (", ");
+        appendPoint (out, volumes.box.bottomRight ());
+        out.append (" }, { ");
+        appendPoint (out, volumes.orientedBox.center);
+        out.append (", ");
+        appendFloat (out, volumes.orientedBox.size.width ());
+        out.append (", ");
+        appendFloat (out, volumes.orientedBox.size.height ());
+        out.append (", ");
+        appendFloat (out, volumes.orientedBox.angle);
+        out.append (" }, { ");
+        appendPoint (out, volumes.circle.center);
+        out.append (", ");
+        appendFloat (out, volumes.circle.radius);
+
+        // Channels of an empty region have no values, so they aren't written
+        const int attributeCount = size == 0 ? 0 : collection.at (order.at (i).second).attributes.channelCount ();
+        out.append (" }, ").append (attributeCount == 0 ? QByteArray ("nullptr") : "Data::attributes" + QByteArray::number (i))
+           .append (", ").append (QByteArray::number (attributeCount));
+        out.append (i + 1 < order.size () ? " }," : " }");
+    }
+
+    if (!order.isEmpty ())
+        out.append ("\n    }");
+
+    out.append ("};\n"
+                "\n"
+                "    // Returns the region with the given name, or null if there is none. Resolved at compile time\n"
+                "    //  when the name is a constant.\n"
+                "    constexpr const Region *find (std::string_view name)\n"
+                "    {\n"
+                "        std::size_t first = 0, last = regionCount;\n"
+                "        while (first < last)\n"
+                "        {\n"
+                "            const std::size_t middle = first + (last - first) / 2;\n"
+                "\n"
+                "            if (regions [middle].name < name)\n"
+                "                first = middle + 1;\n"
+                "\n"
+                "            else\n"
+                "                last = middle;\n"
+                "        }\n"
+                "\n"
+                "        return first < regionCount && regions [first].name == name ? &regions [first] : nullptr;\n"
+                "    }\n"
+                "\n"
+                "    // Returns the attribute of the given region with the given name, or null if there is none\n"
+                "    constexpr const Attribute *findAttribute (const Region &region, std::string_view name)\n"
+                "    {\n"
+                "        for (std::size_t i = 0; i < region.attributeCount; i++)\n"
+                "        {\n"
+                "            if (region.attributes [i].name == name)\n"
+                "                return &region.attributes [i];\n"
+                "        }\n"
+                "\n"
+                "        return nullptr;\n"
+                "    }\n"
+                "}\n");
+
+    return out;
+}
+
+/**
+ * Generates the header for the given collection and writes it to the given file. The file is
+ *  replaced atomically, so a failed export leaves the previous header intact. The namespace is
+ *  derived from the name of the file.
+ *
+ * @param filepath   - The path of the header to write
+ * @param collection - The collection to export
+ *
+ * @return True if the header was written, false otherwise
+ */
+bool Aerodlyn::HeaderExporter::save (const QString &filepath, const VertexDataSetCollection &collection)
+{
+    AERO_PROFILE_SCOPE ("HeaderExporter::save");
+
+    const QByteArray header = generate (collection, namespaceFor (filepath));
+
+    QSaveFile file (filepath);
+    if (!file.open (QIODevice::WriteOnly))
+        return false;
+
+    return file.write (header) == header.size () && file.commit ();
+}
+
+/**
+ * Returns a valid C++ identifier derived from the given file name, for use as the namespace
+ *  of the header written to it. Characters that can't be part of an identifier become
+ *  underscores, and a leading digit is prefixed with one.
+ *
+ * @param filepath - The path of the header
+ *
+ * @return The namespace for the header
+ */
+QString Aerodlyn::HeaderExporter::namespaceFor (const QString &filepath)
+{
+    QString name = QFileInfo (filepath).completeBaseName ();
+
+    for (int i = 0; i < name.size (); i++)
+    {
+        const QChar c = name.at (i);
+        if (c.unicode () > 0x7F || !(c.isLetterOrNumber () || c == '_'))
+            name [i] = '_';
+    }
+
+    if (name.isEmpty () || name.at (0).isDigit ())
+        name.prepend ('_');
+
+    return name;
+}
+
+/* Private Methods */
+/**
+ * Appends the given name to the given output as a C++ string literal. Anything but printable
+ *  ASCII is written as an octal escape, so the literal means the same UTF-8 bytes whatever
+ *  character set the compiler reads the header in.
+ *
+ * @param out  - The output to append to
+ * @param name - The name to append
+ */
+void Aerodlyn::HeaderExporter::appendLiteral (QByteArray &out, const QString &name)
+{
+    static const char DIGITS [] = "01234567";
+
+    out.append ('"');
+    for (const char c : name.toUtf8 ())
+    {
+        const uchar byte = static_cast <uchar> (c);
+
+        if (byte == '"' || byte == '\\')
+            out.append ('\\').append (c);
+
+        // Octal escapes always have three digits, so a digit after one isn't taken as part of it
+        else if (byte < 0x20 || byte > 0x7E)
+            out.append ('\\').append (DIGITS [byte >> 6]).append (DIGITS [(byte >> 3) & 7]).append (DIGITS [byte & 7]);
+
+        else
+            out.append (c);
+    }
+
+    out.append ('"');
+}
+
+/**
+ * Appends the given points to the given output as a constexpr array with the given name.
+ *
+ * @param out    - The output to append to
+ * @param name   - The name of the array
+ * @param points - The points to append, of which there must be at least one
+ */
+void Aerodlyn::HeaderExporter::appendPoints (QByteArray &out, const QByteArray &name, const QPolygonF &points)
+{
+    out.append ("        inline constexpr Point ").append (name).append (" [] =\n"
+                "        {");
+
+    for (int v = 0; v < points.size (); v++)
+    {
+        // Long regions are wrapped, four points to a line
+        out.append (v % 4 == 0 ? "\n            " : " ");
+        appendPoint (out, points.at (v));
+        out.append (v + 1 < points.size () ? "," : "");
+    }
+
+    out.append ("\n        };\n");
+}
+
+/**
+ * Appends the given point to the given output as a braced pair of C++ float literals.
+ *
+ * @param out   - The output to append to
+ * @param point - The point to append
+ */
+void Aerodlyn::HeaderExporter::appendPoint (QByteArray &out, const QPointF &point)
+{
+    out.append ("{ ");
+    appendFloat (out, point.x ());
+    out.append (", ");
+    appendFloat (out, point.y ());
+    out.append (" }");
+}
+
+/**
+ * Appends the given coordinate to the given output as a C++ float literal. C++ has no literals
+ *  for infinities or NaN, so values beyond the range of a float are clamped to the largest float
+ *  (of their sign), and NaN is written as zero.
+ *
+ * @param out   - The output to append to
+ * @param value - The coordinate to append
+ */
+void Aerodlyn::HeaderExporter::appendFloat (QByteArray &out, const double value)
+{
+    // Converting a double beyond the range of a float is undefined, so it is clamped first
+    const double largest = std::numeric_limits <float>::max ();
+    const float clamped  = std::isnan (value) ? 0.0f : static_cast <float> (std::clamp (value, -largest, largest));
+
+    // Nine significant digits are enough for any float to round-trip
+    const QByteArray digits = QByteArray::number (static_cast <double> (clamped), 'g', 9);
+    out.append (digits);
+
+    // A literal needs a point or an exponent to be a float
+    if (!digits.contains ('.') && !digits.contains ('e'))
+        out.append (".0");
+
+    out.append ('f');
+}
+
+/**
+ * Appends the given values to the given output as a constexpr array of ints with the given name.
+ *
+ * @param out    - The output to append to
+ * @param name   - The name of the array
+ * @param values - The values to append, of which there must be at least one
+ */
+void Aerodlyn::HeaderExporter::appendInts (QByteArray &out, const QByteArray &name, const QVector <qint32> &values)
+{
+    out.append ("        inline constexpr int ").append (name).append (" [] =\n"
+                "        {");
+
+    for (int v = 0; v < values.size (); v++)
+    {
+        out.append (v % 16 == 0 ? "\n            " : " ");
+        out.append (QByteArray::number (values.at (v)));
+        out.append (v + 1 < values.size () ? "," : "");
+    }
+
+    out.append ("\n        };\n");
+}
+
+/**
+ * Appends the given values to the given output as a constexpr array of floats with the given
+ *  name.
+ *
+ * @param out    - The output to append to
+ * @param name   - The name of the array
+ * @param values - The values to append, of which there must be at least one
+ */
+void Aerodlyn::HeaderExporter::appendFloats (QByteArray &out, const QByteArray &name, const QVector <float> &values)
+{
+    out.append ("        inline constexpr float ").append (name).append (" [] =\n"
+                "        {");
+
+    for (int v = 0; v < values.size (); v++)
+    {
+        // Eight to a line, so vectors stay on the line of their first component
+        out.append (v % 8 == 0 ? "\n            " : " ");
+        appendFloat (out, values.at (v));
+        out.append (v + 1 < values.size () ? "," : "");
+    }
+
+    out.append ("\n        };\n");
+}
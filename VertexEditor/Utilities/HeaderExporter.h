@@ -0,0 +1,145 @@
+#ifndef HEADER_EXPORTER_H
+#define HEADER_EXPORTER_H
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <QByteArray>
+#include <QFileInfo>
+#include <QIODevice>
+#include <QPair>
+#include <QPointF>
+#include <QPolygonF>
+#include <QSaveFile>
+#include <QString>
+#include <QVector>
+
+#include "Root/Profiler.h"
+#include "Root/Utils.h"
+
+#include "BoundingVolumes.h"
+#include "VertexAttributes.h"
+#include "VertexDataSetCollection.h"
+
+namespace Aerodlyn
+{
+    /**
+     * Exports the data sets of a {@link VertexDataSetCollection} as a self-contained C++17 header, so
+     *  that games can link regions directly into read-only data instead of parsing them at startup.
+     *  Each region becomes a constexpr array of points, listed in a constexpr table sorted by name
+     *  that is searched with a constexpr binary search, so lookups by a constant name are resolved at
+     *  compile time. Alongside its points, each region carries the shapes enclosing it (see
+     *  {@link BoundingVolumes}) for the broad phase of collision tests:
+     *
+     *      constexpr const Regions::Region *player = Regions::find ("Player");
+     *      static_assert (player != nullptr && player->size == 8);
+     *      static_assert (player->circle.radius < 64.0f);
+     *
+     * Coordinates are written as floats, relative to the center of the image, with enough digits for
+     *  every float to round-trip. Vertex attributes (see {@link VertexAttributes}) are written as one
+     *  array per channel, found by name with findAttribute:
+     *
+     *      constexpr const Regions::Attribute *oneWay = Regions::findAttribute (*player, "oneWay");
+     *      static_assert (oneWay != nullptr && oneWay->ints [0] == 1);
+     *
+     * @author  Patrick Jahnig (Aerodlyn)
+     * @version 2026.10.19
+     */
+    class HeaderExporter
+    {
+        public: // Methods
+            /**
+             * Generates the header for the given collection.
+             *
+             * @param collection    - The collection to export
+             * @param namespaceName - The namespace to generate the header in, which must be a valid
+             *                          C++ identifier (see {@link #namespaceFor})
+             *
+             * @return The contents of the header
+             */
+            static QByteArray generate (const VertexDataSetCollection &collection, const QString &namespaceName);
+
+            /**
+             * Generates the header for the given collection and writes it to the given file. The file is
+             *  replaced atomically, so a failed export leaves the previous header intact. The namespace is
+             *  derived from the name of the file.
+             *
+             * @param filepath   - The path of the header to write
+             * @param collection - The collection to export
+             *
+             * @return True if the header was written, false otherwise
+             */
+            static bool save (const QString &filepath, const VertexDataSetCollection &collection);
+
+            /**
+             * Returns a valid C++ identifier derived from the given file name, for use as the namespace
+             *  of the header written to it. Characters that can't be part of an identifier become
+             *  underscores, and a leading digit is prefixed with one.
+             *
+             * @param filepath - The path of the header
+             *
+             * @return The namespace for the header
+             */
+            static QString namespaceFor (const QString &filepath);
+
+        private: // Methods
+            /**
+             * Appends the given name to the given output as a C++ string literal. Anything but printable
+             *  ASCII is written as an octal escape, so the literal means the same UTF-8 bytes whatever
+             *  character set the compiler reads the header in.
+             *
+             * @param out  - The output to append to
+             * @param name - The name to append
+             */
+            static void appendLiteral (QByteArray &out, const QString &name);
+
+            /**
+             * Appends the given points to the given output as a constexpr array with the given name.
+             *
+             * @param out    - The output to append to
+             * @param name   - The name of the array
+             * @param points - The points to append, of which there must be at least one
+             */
+            static void appendPoints (QByteArray &out, const QByteArray &name, const QPolygonF &points);
+
+            /**
+             * Appends the given point to the given output as a braced pair of C++ float literals.
+             *
+             * @param out   - The output to append to
+             * @param point - The point to append
+             */
+            static void appendPoint (QByteArray &out, const QPointF &point);
+
+            /**
+             * Appends the given coordinate to the given output as a C++ float literal. C++ has no literals
+             *  for infinities or NaN, so values beyond the range of a float are clamped to the largest float
+             *  (of their sign), and NaN is written as zero.
+             *
+             * @param out   - The output to append to
+             * @param value - The coordinate to append
+             */
+            static void appendFloat (QByteArray &out, const double value);
+
+            /**
+             * Appends the given values to the given output as a constexpr array of ints with the given name.
+             *
+             * @param out    - The output to append to
+             * @param name   - The name of the array
+             * @param values - The values to append, of which there must be at least one
+             */
+            static void appendInts (QByteArray &out, const QByteArray &name, const QVector <qint32> &values);
+
+            /**
+             * Appends the given values to the given output as a constexpr array of floats with the given
+             *  name.
+             *
+             * @param out    - The output to append to
+             * @param name   - The name of the array
+             * @param values - The values to append, of which there must be at least one
+             */
+            static void appendFloats (QByteArray &out, const QByteArray &name, const QVector <float> &values);
+    };
+}
+
+#endif // HEADER_EXPORTER_H
@@ -0,0 +1,88 @@
+#ifndef LIVE_PREVIEW_LAYOUT_H
+#define LIVE_PREVIEW_LAYOUT_H
+
+#include <atomic>
+
+#include <QDir>
+#include <QString>
+#include <QtGlobal>
+
+namespace Aerodlyn
+{
+    /**
+     * The header at the start of the shared memory segment written by {@link LivePreviewFeed}, which
+     *  readers (such as a running game) map to pick up edits without any file I/O or parsing. Every
+     *  value is in the native byte order, as the segment never leaves the machine.
+     *
+     * The header is followed by {@link #size} bytes holding {@link #count} data sets, sorted by name.
+     *  Each data set is a name (a u16 byte count followed by UTF-8), a vertex count (u32) and the x
+     *  and y (f32) of each vertex, relative to the center of the image. Nothing is aligned, so
+     *  readers should copy values out rather than cast pointers into the segment.
+     *
+     * The segment is guarded by a seqlock rather than a lock, so neither side ever waits on the other:
+     *  the writer makes {@link #sequence} odd, writes, and then makes it even again. A reader copies
+     *  the segment between two reads of the sequence, and retries if they differ or are odd:
+     *
+     *      do
+     *      {
+     *          begin = header->sequence.load (std::memory_order_acquire);
+     *          ... copy the header fields and the data sets out of the segment ...
+     *          std::atomic_thread_fence (std::memory_order_acquire);
+     *      }
+     *      while ((begin & 1) != 0 || header->sequence.load (std::memory_order_relaxed) != begin);
+     *
+     * @author  Patrick Jahnig (Aerodlyn)
+     * @version 2026.10.19
+     */
+    struct LivePreviewHeader
+    {
+        quint32                 magic;
+        quint32                 version;
+
+        std::atomic <quint32>   sequence;
+
+        quint32                 flags;
+
+        quint64                 revision;
+
+        quint32                 capacity;
+        quint32                 size;
+        quint32                 count;
+
+        quint32                 reserved [7];
+
+        static constexpr quint32 MAGIC    = 0x564C4841; // "AHLV"
+        static constexpr quint32 VERSION  = 1;
+
+        /**
+         * Set once the data sets no longer fit into the segment, in which case the data sets in it are
+         *  left as they were until they fit again.
+         */
+        static constexpr quint32 OVERFLOWED = 1;
+
+        /**
+         * Set once the editor stops publishing, after which the segment is never written again.
+         */
+        static constexpr quint32 CLOSED     = 2;
+
+        /**
+         * Returns the native key the editor publishes under. On Unix, this is a file in the temporary
+         *  directory that is passed to ftok (with the id 'Q'), and elsewhere it is the name of the segment.
+         *
+         * @return The default native key of the segment
+         */
+        static QString defaultKey ()
+        {
+#if defined (Q_OS_UNIX)
+            return QDir::temp ().filePath ("AeroHelper.LivePreview");
+#else
+            return QStringLiteral ("AeroHelper.LivePreview");
+#endif
+        }
+    };
+
+    static_assert (sizeof (LivePreviewHeader) == 64, "The live preview header must stay 64 bytes");
+    static_assert (std::atomic <quint32>::is_always_lock_free, "The seqlock must be lock-free to be shared");
+}
+
+#endif // LIVE_PREVIEW_LAYOUT_H
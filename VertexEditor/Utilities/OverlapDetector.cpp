@@ -0,0 +1,290 @@
+#include "OverlapDetector.h"
+
+/**
+ * Finds the data sets whose regions overlap, treating each region as a closed polygon filled with
+ *  the even-odd rule. Regions that only touch along their edges or at a vertex don't overlap.
+ *
+ * The pairs of regions whose bounding boxes overlap are found by sweep and prune: the boxes are
+ *  sorted by their left side, and each is only compared with the boxes still open when it is met.
+ *  Each of those pairs is then tested on its own, in parallel across the available cores, by
+ *  sweeping the edges of both regions near the overlap of their boxes in the same way. Regions
+ *  whose edges cross overlap, and regions whose edges don't meet at all overlap if one contains
+ *  the other. Only regions whose edges touch without crossing are clipped to find out.
+ *
+ * Like {@link RegionClipper}, this doesn't resolve edges of the same region that overlap each
+ *  other (such as a spike folding back onto itself), so such a region may be reported to overlap
+ *  another where those edges enclose nothing.
+ *
+ * @author  Patrick Jahnig (Aerodlyn)
+ * @version 2026.10.19
+ */
+
+/* Public Methods */
+/**
+ * Finds every pair of data sets in the given collection whose regions overlap. Regions with
+ *  less than three vertices enclose nothing, and never overlap.
+ *
+ * @param collection - The data sets to search
+ *
+ * @return The names of the overlapping data sets, each pair sorted and the pairs sorted by the
+ *  first name, then the second
+ */
+QVector <QPair <QString, QString>> Aerodlyn::OverlapDetector::findOverlaps (const VertexDataSetCollection &collection)
+{
+    AERO_PROFILE_SCOPE ("OverlapDetector::findOverlaps");
+
+    // The cached bounding boxes are used for the broad phase only, as they are computed lazily and
+    //  can't be read from the worker threads
+    QVector <Box> boxes;
+    boxes.reserve (collection.length ());
+
+    for (int i = 0; i < collection.length (); i++)
+    {
+        if (collection.at (i).region.size () < 3)
+            continue;
+
+        const QRectF bounds = collection.geometryAt (i).bounds ();
+        boxes.append ({ bounds.left (), bounds.top (), bounds.right (), bounds.bottom (), i });
+    }
+
+    QVector <QPair <int, int>> candidates;
+    sweep (boxes, [&candidates] (const Box &a, const Box &b)
+    {
+        candidates.append (qMakePair (std::min (a.index, b.index), std::max (a.index, b.index)));
+        return true;
+    });
+
+    QVector <char> overlapping (candidates.size ());
+    QVector <int> indices (candidates.size ());
+    std::iota (indices.begin (), indices.end (), 0);
+
+    // Every task writes to its own element, so the vector is never detached or resized concurrently
+    char *results = overlapping.data ();
+    QtConcurrent::blockingMap (indices, [&] (const int &index)
+    {
+        const QPair <int, int> &candidate = candidates.at (index);
+        results [index] = overlaps (collection.at (candidate.first).region, collection.at (candidate.second).region);
+    });
+
+    // The data sets are sorted by name, so sorting the pairs by index sorts them by name
+    QVector <QPair <int, int>> found;
+    for (int i = 0; i < candidates.size (); i++)
+    {
+        if (overlapping.at (i))
+            found.append (candidates.at (i));
+    }
+
+    std::sort (found.begin (), found.end ());
+
+    QVector <QPair <QString, QString>> pairs;
+    pairs.reserve (found.size ());
+
+    for (const QPair <int, int> &pair : found)
+        pairs.append (qMakePair (collection.at (pair.first).name, collection.at (pair.second).name));
+
+    return pairs;
+}
+
+/**
+ * Determines if the given regions overlap.
+ *
+ * @param a - The first region
+ * @param b - The second region
+ *
+ * @return True if the regions share any area, false otherwise
+ */
+bool Aerodlyn::OverlapDetector::overlaps (const QPolygonF &a, const QPolygonF &b)
+{
+    if (a.size () < 3 || b.size () < 3)
+        return false;
+
+    const Box boundsA = boundsOf (a), boundsB = boundsOf (b);
+    const Box common  = { std::max (boundsA.left, boundsB.left), std::max (boundsA.top, boundsB.top),
+                          std::min (boundsA.right, boundsB.right), std::min (boundsA.bottom, boundsB.bottom), -1 };
+
+    // The insides of the regions lie strictly within their bounding boxes
+    if (common.left >= common.right || common.top >= common.bottom)
+        return false;
+
+    // Edges can only meet within the overlap of the bounding boxes, so the others are left out. Edges
+    //  of b are told apart from those of a by a negative index
+    QVector <Box> edges;
+    const auto addEdges = [&edges, &common] (const QPolygonF &region, const int sign)
+    {
+        for (int i = 0; i < region.size (); i++)
+        {
+            const QPointF &from = region.at (i), &to = region.at ((i + 1) % region.size ());
+
+            const Box edge = { std::min (from.x (), to.x ()), std::min (from.y (), to.y ()),
+                               std::max (from.x (), to.x ()), std::max (from.y (), to.y ()), sign * (i + 1) };
+
+            if (edge.left <= common.right && edge.right >= common.left && edge.top <= common.bottom
+                && edge.bottom >= common.top)
+                edges.append (edge);
+        }
+    };
+
+    addEdges (a, 1);
+    addEdges (b, -1);
+
+    bool touching = false;
+    const bool crossing = !sweep (edges, [&] (const Box &first, const Box &second)
+    {
+        if ((first.index > 0) == (second.index > 0))
+            return true;
+
+        const int edgeA = std::abs (first.index > 0 ? first.index : second.index) - 1;
+        const int edgeB = std::abs (first.index > 0 ? second.index : first.index) - 1;
+
+        const Contact met = contact (a.at (edgeA), a.at ((edgeA + 1) % a.size ()), b.at (edgeB),
+            b.at ((edgeB + 1) % b.size ()));
+
+        touching |= met == Contact::Touch;
+        return met != Contact::Cross;
+    });
+
+    if (crossing)
+        return true;
+
+    // Edges that touch without crossing may still bound a shared area (such as two copies of the same
+    //  region), which only clipping tells apart from regions that merely touch
+    if (touching)
+        return !RegionClipper::clip (a, b, RegionClipper::Operation::Intersection).isEmpty ();
+
+    // The edges of either region lie entirely inside or entirely outside of the other region
+    return inside (b, a.first ()) || inside (a, b.first ());
+}
+
+/* Private Methods */
+/**
+ * Sorts the given boxes by their left side, and calls the given function with every pair of
+ *  boxes that overlap or touch, until it returns false.
+ *
+ * @param boxes - The boxes to sweep, which are sorted in place
+ * @param visit - The function to call with each pair of boxes, returning false to stop
+ *
+ * @return False if the sweep was stopped, true otherwise
+ */
+template <typename Visitor>
+bool Aerodlyn::OverlapDetector::sweep (QVector <Box> &boxes, Visitor visit)
+{
+    std::sort (boxes.begin (), boxes.end (), [] (const Box &a, const Box &b) { return a.left < b.left; });
+
+    // The boxes that the sweep line still crosses
+    QVector <const Box *> open;
+
+    for (const Box &box : boxes)
+    {
+        for (int i = 0; i < open.size ();)
+        {
+            const Box *other = open.at (i);
+
+            // Boxes are met in order of their left side, so a box closed before this one is closed
+            //  before every later one as well
+            if (other->right < box.left)
+            {
+                open [i] = open.last ();
+                open.removeLast ();
+                continue;
+            }
+
+            if (other->top <= box.bottom && box.top <= other->bottom && !visit (*other, box))
+                return false;
+
+            i++;
+        }
+
+        open.append (&box);
+    }
+
+    return true;
+}
+
+/**
+ * Returns the bounding box of the given region, computed exactly from its vertices.
+ *
+ * @param region - The region, which must not be empty
+ *
+ * @return The bounding box of the region, with an index of -1
+ */
+Aerodlyn::OverlapDetector::Box Aerodlyn::OverlapDetector::boundsOf (const QPolygonF &region)
+{
+    Box box = { region.first ().x (), region.first ().y (), region.first ().x (), region.first ().y (), -1 };
+
+    for (const QPointF &point : region)
+    {
+        box.left   = std::min (box.left, point.x ());
+        box.top    = std::min (box.top, point.y ());
+        box.right  = std::max (box.right, point.x ());
+        box.bottom = std::max (box.bottom, point.y ());
+    }
+
+    return box;
+}
+
+/**
+ * Determines how the segment from a1 to a2 meets the segment from b1 to b2.
+ *
+ * @param a1 - The start of the first segment
+ * @param a2 - The end of the first segment
+ * @param b1 - The start of the second segment
+ * @param b2 - The end of the second segment
+ *
+ * @return Cross if the segments cross at a point inside both, Touch if they meet otherwise and
+ *  None if they don't meet
+ */
+Aerodlyn::OverlapDetector::Contact Aerodlyn::OverlapDetector::contact (const QPointF &a1, const QPointF &a2,
+    const QPointF &b1, const QPointF &b2)
+{
+    const auto side = [] (const QPointF &from, const QPointF &to, const QPointF &point)
+    {
+        const double cross = (to.x () - from.x ()) * (point.y () - from.y ()) - (to.y () - from.y ()) * (point.x () - from.x ());
+        return (cross > 0.0) - (cross < 0.0);
+    };
+
+    // Whether a point on the line through a segment lies within the segment
+    const auto within = [] (const QPointF &from, const QPointF &to, const QPointF &point)
+    {
+        return std::min (from.x (), to.x ()) <= point.x () && point.x () <= std::max (from.x (), to.x ())
+            && std::min (from.y (), to.y ()) <= point.y () && point.y () <= std::max (from.y (), to.y ());
+    };
+
+    const int a1Side = side (b1, b2, a1), a2Side = side (b1, b2, a2);
+    const int b1Side = side (a1, a2, b1), b2Side = side (a1, a2, b2);
+
+    if (a1Side * a2Side < 0 && b1Side * b2Side < 0)
+        return Contact::Cross;
+
+    if ((a1Side == 0 && within (b1, b2, a1)) || (a2Side == 0 && within (b1, b2, a2))
+        || (b1Side == 0 && within (a1, a2, b1)) || (b2Side == 0 && within (a1, a2, b2)))
+        return Contact::Touch;
+
+    return Contact::None;
+}
+
+/**
+ * Determines if the given point is inside the given region, with the even-odd rule. The point
+ *  must not lie on an edge of the region.
+ *
+ * @param region - The region
+ * @param point  - The point to test
+ *
+ * @return True if the point is inside the region, false otherwise
+ */
+bool Aerodlyn::OverlapDetector::inside (const QPolygonF &region, const QPointF &point)
+{
+    bool in = false;
+
+    for (int i = 0, j = region.size () - 1; i < region.size (); j = i++)
+    {
+        const QPointF &a = region.at (i), &b = region.at (j);
+
+        // Each edge counts once where it crosses the horizontal line through the point, as its
+        //  vertices are taken to lie just above that line if they are on it
+        if ((a.y () > point.y ()) != (b.y () > point.y ())
+            && point.x () < a.x () + (point.y () - a.y ()) * (b.x () - a.x ()) / (b.y () - a.y ()))
+            in = !in;
+    }
+
+    return in;
+}
@@ -0,0 +1,127 @@
+#ifndef OVERLAP_DETECTOR_H
+#define OVERLAP_DETECTOR_H
+
+#include <algorithm>
+#include <numeric>
+
+#include <QPair>
+#include <QPointF>
+#include <QPolygonF>
+#include <QString>
+#include <QVector>
+#include <QtConcurrent>
+
+#include "Root/Profiler.h"
+
+#include "RegionClipper.h"
+#include "VertexDataSetCollection.h"
+
+namespace Aerodlyn
+{
+    /**
+     * Finds the data sets whose regions overlap, treating each region as a closed polygon filled with
+     *  the even-odd rule. Regions that only touch along their edges or at a vertex don't overlap.
+     *
+     * The pairs of regions whose bounding boxes overlap are found by sweep and prune: the boxes are
+     *  sorted by their left side, and each is only compared with the boxes still open when it is met.
+     *  Each of those pairs is then tested on its own, in parallel across the available cores, by
+     *  sweeping the edges of both regions near the overlap of their boxes in the same way. Regions
+     *  whose edges cross overlap, and regions whose edges don't meet at all overlap if one contains
+     *  the other. Only regions whose edges touch without crossing are clipped to find out.
+     *
+     * Like {@link RegionClipper}, this doesn't resolve edges of the same region that overlap each
+     *  other (such as a spike folding back onto itself), so such a region may be reported to overlap
+     *  another where those edges enclose nothing.
+     *
+     * @author  Patrick Jahnig (Aerodlyn)
+     * @version 2026.10.19
+     */
+    class OverlapDetector
+    {
+        public: // Methods
+            /**
+             * Finds every pair of data sets in the given collection whose regions overlap. Regions with
+             *  less than three vertices enclose nothing, and never overlap.
+             *
+             * @param collection - The data sets to search
+             *
+             * @return The names of the overlapping data sets, each pair sorted and the pairs sorted by the
+             *  first name, then the second
+             */
+            static QVector <QPair <QString, QString>> findOverlaps (const VertexDataSetCollection &collection);
+
+            /**
+             * Determines if the given regions overlap.
+             *
+             * @param a - The first region
+             * @param b - The second region
+             *
+             * @return True if the regions share any area, false otherwise
+             */
+            static bool overlaps (const QPolygonF &a, const QPolygonF &b);
+
+        private: // Types
+            /**
+             * The bounding box of a region or an edge, along with what it bounds.
+             */
+            struct Box
+            {
+                double left, top, right, bottom;
+
+                int    index;
+            };
+
+            /**
+             * How two edges meet.
+             */
+            enum class Contact { None, Touch, Cross };
+
+        private: // Methods
+            /**
+             * Sorts the given boxes by their left side, and calls the given function with every pair of
+             *  boxes that overlap or touch, until it returns false.
+             *
+             * @param boxes - The boxes to sweep, which are sorted in place
+             * @param visit - The function to call with each pair of boxes, returning false to stop
+             *
+             * @return False if the sweep was stopped, true otherwise
+             */
+            template <typename Visitor>
+            static bool sweep (QVector <Box> &boxes, Visitor visit);
+
+            /**
+             * Returns the bounding box of the given region, computed exactly from its vertices.
+             *
+             * @param region - The region, which must not be empty
+             *
+             * @return The bounding box of the region, with an index of -1
+             */
+            static Box boundsOf (const QPolygonF &region);
+
+            /**
+             * Determines how the segment from a1 to a2 meets the segment from b1 to b2.
+             *
+             * @param a1 - The start of the first segment
+             * @param a2 - The end of the first segment
+             * @param b1 - The start of the second segment
+             * @param b2 - The end of the second segment
+             *
+             * @return Cross if the segments cross at a point inside both, Touch if they meet otherwise and
+             *  None if they don't meet
+             */
+            static Contact contact (const QPointF &a1, const QPointF &a2, const QPointF &b1, const QPointF &b2);
+
+            /**
+             * Determines if the given point is inside the given region, with the even-odd rule. The point
+             *  must not lie on an edge of the region.
+             *
+             * @param region - The region
+             * @param point  - The point to test
+             *
+             * @return True if the point is inside the region, false otherwise
+             */
+            static bool inside (const QPolygonF &region, const QPointF &point);
+    };
+}
+
+#endif // OVERLAP_DETECTOR_H
@@ -0,0 +1,415 @@
+#include "ProjectFile.h"
+
+/**
+ * Reads and writes the data sets of a {@link VertexDataSetCollection} as a project file made of
+ *  chunks, one per data set. Saving appends chunks for only the data sets that changed (and a
+ *  tombstone chunk for each removed one), where the last chunk for a name wins when loading. Once
+ *  most of the file is superseded chunks, the next save compacts it by rewriting only the live
+ *  chunks.
+ *
+ * All values are little-endian. The file starts with the magic "AHPJ" and a version, followed by
+ *  chunks that each start with their type and the size of their payload. A data set chunk holds the
+ *  name, the points, and (since version 2) the attribute channels, each as its name, its type and
+ *  its values as 32-bit integers or floats. Version 1 chunks end after the points, and load without
+ *  attributes.
+ *
+ * @author  Patrick Jahnig (Aerodlyn)
+ * @version 2026.10.19
+ */
+
+/* Public Methods */
+/**
+ * Replaces the data sets of the given collection with the ones in the given project file. A
+ *  chunk cut short by an interrupted save or corrupt, and everything after it, is ignored,
+ *  which {@link #isPartial} reports.
+ *
+ * @param filepath   - The path of the project file to load
+ * @param collection - The collection to load the data sets into
+ *
+ * @return True if the file was loaded, false if it couldn't be read or isn't a project file (in
+ *  which case the collection is left untouched)
+ */
+bool Aerodlyn::ProjectFile::load (const QString &filepath, VertexDataSetCollection &collection)
+{
+    AERO_PROFILE_SCOPE ("ProjectFile::load");
+
+    QFile file (filepath);
+    if (!file.open (QIODevice::ReadOnly))
+        return false;
+
+    const QByteArray contents = file.readAll ();
+    if (contents.size () < HEADER_SIZE)
+        return false;
+
+    QDataStream header (contents);
+    header.setByteOrder (QDataStream::LittleEndian);
+
+    quint32 magic, version;
+    header >> magic >> version;
+
+    if (magic != MAGIC || version > VERSION)
+        return false;
+
+    QMap <QString, QPolygonF> regions;
+    QHash <QString, VertexAttributes> attributes;
+    QHash <QString, qint64> chunks;
+
+    qint64 offset = HEADER_SIZE;
+    while (contents.size () - offset >= CHUNK_HEADER_SIZE)
+    {
+        QDataStream chunkHeader (contents.mid (static_cast <int> (offset), CHUNK_HEADER_SIZE));
+        chunkHeader.setByteOrder (QDataStream::LittleEndian);
+
+        quint32 type, size;
+        chunkHeader >> type >> size;
+
+        if (contents.size () - offset - CHUNK_HEADER_SIZE < size)
+            break;
+
+        QDataStream payload (contents.mid (static_cast <int> (offset + CHUNK_HEADER_SIZE), static_cast <int> (size)));
+        payload.setByteOrder (QDataStream::LittleEndian);
+
+        // A chunk of an unknown type (from a newer version) is skipped over. A chunk that can't be read
+        //  is corrupt, so it isn't applied, and it ends the load like a chunk cut short
+        if (type == DataSetChunk || type == TombstoneChunk)
+        {
+            QString name;
+            payload >> name;
+
+            if (payload.status () != QDataStream::Ok)
+                break;
+
+            if (type == DataSetChunk)
+            {
+                quint32 count;
+                payload >> count;
+
+                // Every point takes 16 bytes, so a count the rest of the chunk can't hold is corrupt (and
+                //  mustn't be reserved)
+                if (payload.status () != QDataStream::Ok || count > (size - payload.device ()->pos ()) / POINT_SIZE)
+                    break;
+
+                QPolygonF region;
+                region.reserve (static_cast <int> (count));
+
+                for (quint32 i = 0; i < count; i++)
+                {
+                    double x, y;
+                    payload >> x >> y;
+                    region.append (QPointF (x, y));
+                }
+
+                // Version 1 chunks end after the points
+                VertexAttributes channels;
+                if (!payload.atEnd ())
+                    channels = readAttributes (payload, region.size ());
+
+                if (payload.status () != QDataStream::Ok)
+                    break;
+
+                regions.insert (name, region);
+                attributes.insert (name, channels);
+                chunks.insert (name, CHUNK_HEADER_SIZE + size);
+            }
+
+            else
+            {
+                regions.remove (name);
+                attributes.remove (name);
+                chunks.remove (name);
+            }
+        }
+
+        offset += CHUNK_HEADER_SIZE + size;
+    }
+
+    collection.removeAll ();
+    collection.addAll (regions.keys ());
+
+    for (auto it = regions.constBegin (); it != regions.constEnd (); it++)
+    {
+        collection.get (it.key ())->get () = it.value ();
+        collection.attributes (it.key ())->get () = attributes.value (it.key ());
+    }
+
+    collection.markClean ();
+
+    liveChunks = chunks;
+    liveBytes  = 0;
+    for (const qint64 size : chunks)
+        liveBytes += size;
+
+    // Appending after a cut short or corrupt chunk would hide the new chunks from the next load, so
+    //  the next save rewrites the file instead
+    partial        = offset != contents.size ();
+    fileBytes      = offset;
+    this->filepath = partial ? QString () : filepath;
+
+    return true;
+}
+
+/**
+ * Saves the changes made to the given collection since it was last saved or loaded to the given
+ *  project file, by appending chunks for only the changed data sets. The whole file is
+ *  rewritten instead if it isn't the one last saved or loaded, or once it is mostly made of
+ *  superseded chunks.
+ *
+ * @param filepath   - The path of the project file to save to
+ * @param collection - The collection to save
+ *
+ * @return True if the collection was saved, false otherwise
+ */
+bool Aerodlyn::ProjectFile::save (const QString &filepath, VertexDataSetCollection &collection)
+{
+    AERO_PROFILE_SCOPE ("ProjectFile::save");
+
+    if (filepath != this->filepath || !QFile::exists (filepath))
+        return compact (filepath, collection);
+
+    // Tombstones come first, so that a data set removed and then added again is kept
+    QByteArray appended;
+    for (const QString &name : collection.removedNames ())
+    {
+        if (liveChunks.contains (name))
+        {
+            liveBytes -= liveChunks.take (name);
+            appended.append (tombstoneChunk (name));
+        }
+    }
+
+    for (int i = 0; i < collection.length (); i++)
+    {
+        if (!collection.isDirty (i))
+            continue;
+
+        const VertexDataSet &set = collection.at (i);
+        const QByteArray chunk = dataSetChunk (set);
+
+        liveBytes += chunk.size () - liveChunks.value (set.name, 0);
+        liveChunks.insert (set.name, chunk.size ());
+        appended.append (chunk);
+    }
+
+    const qint64 projectedBytes = fileBytes + appended.size ();
+    if (projectedBytes > COMPACTION_MINIMUM && liveBytes < projectedBytes * COMPACTION_RATIO)
+        return compact (filepath, collection);
+
+    if (!appended.isEmpty ())
+    {
+        QFile file (filepath);
+        if (!file.open (QIODevice::WriteOnly | QIODevice::Append) || file.write (appended) != appended.size ()
+            || !file.flush ())
+        {
+            // The file may now end with a partial chunk, so the next save rewrites it
+            this->filepath.clear ();
+            return false;
+        }
+
+        fileBytes = projectedBytes;
+    }
+
+    collection.markClean ();
+    return true;
+}
+
+/**
+ * Rewrites the given project file with a single chunk for each data set in the given collection.
+ *  The file is replaced atomically, so an interrupted rewrite leaves the old file intact.
+ *
+ * @param filepath   - The path of the project file to write
+ * @param collection - The collection to write
+ *
+ * @return True if the collection was written, false otherwise
+ */
+bool Aerodlyn::ProjectFile::compact (const QString &filepath, VertexDataSetCollection &collection)
+{
+    AERO_PROFILE_SCOPE ("ProjectFile::compact");
+
+    this->filepath.clear ();
+    liveChunks.clear ();
+    liveBytes = 0;
+
+    QSaveFile file (filepath);
+    if (!file.open (QIODevice::WriteOnly))
+        return false;
+
+    QByteArray header;
+    QDataStream stream (&header, QIODevice::WriteOnly);
+    stream.setByteOrder (QDataStream::LittleEndian);
+    stream << MAGIC << VERSION;
+
+    bool written = file.write (header) == header.size ();
+    for (int i = 0; i < collection.length () && written; i++)
+    {
+        const QByteArray chunk = dataSetChunk (collection.at (i));
+
+        written = file.write (chunk) == chunk.size ();
+        liveChunks.insert (collection.at (i).name, chunk.size ());
+        liveBytes += chunk.size ();
+    }
+
+    if (!written || !file.commit ())
+    {
+        liveChunks.clear ();
+        liveBytes = 0;
+
+        return false;
+    }
+
+    fileBytes      = HEADER_SIZE + liveBytes;
+    this->filepath = filepath;
+
+    collection.markClean ();
+    return true;
+}
+
+/**
+ * Returns the path of the project file last saved or loaded.
+ *
+ * @return The path of the current project file, or an empty string if there is none
+ */
+const QString &Aerodlyn::ProjectFile::path () const
+    { return filepath; }
+
+/**
+ * Determines if the project file last loaded was only partly loaded, as a chunk in it was cut
+ *  short or corrupt.
+ *
+ * @return True if chunks of the last loaded file were ignored, false otherwise
+ */
+bool Aerodlyn::ProjectFile::isPartial () const
+    { return partial; }
+
+/* Private Methods */
+/**
+ * Serializes the given data set as a chunk, including the chunk header.
+ *
+ * @param set - The data set to serialize
+ *
+ * @return The chunk of the data set
+ */
+QByteArray Aerodlyn::ProjectFile::dataSetChunk (const VertexDataSet &set)
+{
+    QByteArray payload;
+    QDataStream stream (&payload, QIODevice::WriteOnly);
+    stream.setByteOrder (QDataStream::LittleEndian);
+
+    stream << set.name << static_cast <quint32> (set.region.size ());
+    for (const QPointF &point : set.region)
+        stream << point.x () << point.y ();
+
+    writeAttributes (stream, set.attributes);
+
+    QByteArray chunk;
+    QDataStream header (&chunk, QIODevice::WriteOnly);
+    header.setByteOrder (QDataStream::LittleEndian);
+    header << static_cast <quint32> (DataSetChunk) << static_cast <quint32> (payload.size ());
+
+    return chunk.append (payload);
+}
+
+/**
+ * Serializes a chunk recording that the data set with the given name was removed, including
+ *  the chunk header.
+ *
+ * @param name - The name of the removed data set
+ *
+ * @return The tombstone chunk
+ */
+QByteArray Aerodlyn::ProjectFile::tombstoneChunk (const QString &name)
+{
+    QByteArray payload;
+    QDataStream stream (&payload, QIODevice::WriteOnly);
+    stream.setByteOrder (QDataStream::LittleEndian);
+    stream << name;
+
+    QByteArray chunk;
+    QDataStream header (&chunk, QIODevice::WriteOnly);
+    header.setByteOrder (QDataStream::LittleEndian);
+    header << static_cast <quint32> (TombstoneChunk) << static_cast <quint32> (payload.size ());
+
+    return chunk.append (payload);
+}
+
+/**
+ * Writes the attribute channels of a data set to the given data set chunk payload, as the number
+ *  of channels followed by each channel's name, type and values.
+ *
+ * @param stream     - The stream of the payload, after the points
+ * @param attributes - The attributes to write
+ */
+void Aerodlyn::ProjectFile::writeAttributes (QDataStream &stream, const VertexAttributes &attributes)
+{
+    stream << static_cast <quint32> (attributes.channelCount ());
+
+    // Attribute values are stored as 32-bit floats, unlike the points
+    stream.setFloatingPointPrecision (QDataStream::SinglePrecision);
+
+    for (int i = 0; i < attributes.channelCount (); i++)
+    {
+        const VertexAttributes::Channel &channel = attributes.channel (i);
+        stream << channel.name << static_cast <quint8> (channel.type);
+
+        for (const qint32 value : channel.integers)
+            stream << value;
+
+        for (const float value : channel.reals)
+            stream << value;
+    }
+
+    stream.setFloatingPointPrecision (QDataStream::DoublePrecision);
+}
+
+/**
+ * Reads the attribute channels written by {@link #writeAttributes}. A channel of an unknown type
+ *  (from a newer version) ends the channels, as its values can't be skipped over.
+ *
+ * @param stream      - The stream of the payload, after the points
+ * @param vertexCount - The number of points of the data set
+ *
+ * @return The attributes read
+ */
+Aerodlyn::VertexAttributes Aerodlyn::ProjectFile::readAttributes (QDataStream &stream, const int vertexCount)
+{
+    VertexAttributes attributes;
+
+    quint32 count;
+    stream >> count;
+
+    stream.setFloatingPointPrecision (QDataStream::SinglePrecision);
+
+    for (quint32 i = 0; i < count && stream.status () == QDataStream::Ok; i++)
+    {
+        VertexAttributes::Channel channel;
+
+        quint8 type;
+        stream >> channel.name >> type;
+
+        if (type > static_cast <quint8> (VertexAttributes::Type::Vector))
+            break;
+
+        channel.type = static_cast <VertexAttributes::Type> (type);
+
+        const int values = vertexCount * VertexAttributes::components (channel.type);
+        if (channel.type == VertexAttributes::Type::Flag || channel.type == VertexAttributes::Type::Integer)
+        {
+            channel.integers.resize (values);
+            for (qint32 &value : channel.integers)
+                stream >> value;
+        }
+
+        else
+        {
+            channel.reals.resize (values);
+            for (float &value : channel.reals)
+                stream >> value;
+        }
+
+        if (stream.status () == QDataStream::Ok)
+            attributes.addChannel (std::move (channel));
+    }
+
+    stream.setFloatingPointPrecision (QDataStream::DoublePrecision);
+
+    return attributes;
+}
@@ -0,0 +1,156 @@
+#ifndef PROJECT_FILE_H
+#define PROJECT_FILE_H
+
+#include <QByteArray>
+#include <QDataStream>
+#include <QFile>
+#include <QHash>
+#include <QIODevice>
+#include <QMap>
+#include <QPointF>
+#include <QPolygonF>
+#include <QSaveFile>
+#include <QString>
+
+#include "Root/Profiler.h"
+
+#include "VertexAttributes.h"
+#include "VertexDataSetCollection.h"
+
+namespace Aerodlyn
+{
+    /**
+     * Reads and writes the data sets of a {@link VertexDataSetCollection} as a project file made of
+     *  chunks, one per data set. Saving appends chunks for only the data sets that changed (and a
+     *  tombstone chunk for each removed one), where the last chunk for a name wins when loading. Once
+     *  most of the file is superseded chunks, the next save compacts it by rewriting only the live
+     *  chunks.
+     *
+     * All values are little-endian. The file starts with the magic "AHPJ" and a version, followed by
+     *  chunks that each start with their type and the size of their payload. A data set chunk holds the
+     *  name, the points, and (since version 2) the attribute channels, each as its name, its type and
+     *  its values as 32-bit integers or floats. Version 1 chunks end after the points, and load without
+     *  attributes.
+     *
+     * @author  Patrick Jahnig (Aerodlyn)
+     * @version 2026.10.19
+     */
+    class ProjectFile
+    {
+        public: // Methods
+            /**
+             * Replaces the data sets of the given collection with the ones in the given project file. A
+             *  chunk cut short by an interrupted save or corrupt, and everything after it, is ignored,
+             *  which {@link #isPartial} reports.
+             *
+             * @param filepath   - The path of the project file to load
+             * @param collection - The collection to load the data sets into
+             *
+             * @return True if the file was loaded, false if it couldn't be read or isn't a project file (in
+             *  which case the collection is left untouched)
+             */
+            bool load (const QString &filepath, VertexDataSetCollection &collection);
+
+            /**
+             * Saves the changes made to the given collection since it was last saved or loaded to the given
+             *  project file, by appending chunks for only the changed data sets. The whole file is
+             *  rewritten instead if it isn't the one last saved or loaded, or once it is mostly made of
+             *  superseded chunks.
+             *
+             * @param filepath   - The path of the project file to save to
+             * @param collection - The collection to save
+             *
+             * @return True if the collection was saved, false otherwise
+             */
+            bool save (const QString &filepath, VertexDataSetCollection &collection);
+
+            /**
+             * Rewrites the given project file with a single chunk for each data set in the given collection.
+             *  The file is replaced atomically, so an interrupted rewrite leaves the old file intact.
+             *
+             * @param filepath   - The path of the project file to write
+             * @param collection - The collection to write
+             *
+             * @return True if the collection was written, false otherwise
+             */
+            bool compact (const QString &filepath, VertexDataSetCollection &collection);
+
+            /**
+             * Returns the path of the project file last saved or loaded.
+             *
+             * @return The path of the current project file, or an empty string if there is none
+             */
+            const QString &path () const;
+
+            /**
+             * Determines if the project file last loaded was only partly loaded, as a chunk in it was cut
+             *  short or corrupt.
+             *
+             * @return True if chunks of the last loaded file were ignored, false otherwise
+             */
+            bool isPartial () const;
+
+        private: // Types
+            enum ChunkType : quint32 { DataSetChunk = 1, TombstoneChunk = 2 };
+
+        private: // Methods
+            /**
+             * Serializes the given data set as a chunk, including the chunk header.
+             *
+             * @param set - The data set to serialize
+             *
+             * @return The chunk of the data set
+             */
+            static QByteArray dataSetChunk (const VertexDataSet &set);
+
+            /**
+             * Serializes a chunk recording that the data set with the given name was removed, including
+             *  the chunk header.
+             *
+             * @param name - The name of the removed data set
+             *
+             * @return The tombstone chunk
+             */
+            static QByteArray tombstoneChunk (const QString &name);
+
+            /**
+             * Writes the attribute channels of a data set to the given data set chunk payload, as the number
+             *  of channels followed by each channel's name, type and values.
+             *
+             * @param stream     - The stream of the payload, after the points
+             * @param attributes - The attributes to write
+             */
+            static void writeAttributes (QDataStream &stream, const VertexAttributes &attributes);
+
+            /**
+             * Reads the attribute channels written by {@link #writeAttributes}. A channel of an unknown type
+             *  (from a newer version) ends the channels, as its values can't be skipped over.
+             *
+             * @param stream      - The stream of the payload, after the points
+             * @param vertexCount - The number of points of the data set
+             *
+             * @return The attributes read
+             */
+            static VertexAttributes readAttributes (QDataStream &stream, const int vertexCount);
+
+        private: // Variables
+            qint64                             fileBytes  = 0;
+            qint64                             liveBytes  = 0;
+
+            bool                               partial    = false;
+
+            QHash <QString, qint64>            liveChunks;
+
+            QString                            filepath;
+
+            static constexpr quint32           MAGIC              = 0x4A504841; // "AHPJ"
+            static constexpr quint32           VERSION            = 2;
+            static constexpr qint64            HEADER_SIZE        = 8;
+            static constexpr qint64            CHUNK_HEADER_SIZE  = 8;
+            static constexpr qint64            POINT_SIZE         = 16;
+            static constexpr qint64            COMPACTION_MINIMUM = 64 * 1024;
+            static constexpr double            COMPACTION_RATIO   = 0.5;
+    };
+}
+
+#endif // PROJECT_FILE_H
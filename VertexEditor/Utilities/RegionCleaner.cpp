@@ -0,0 +1,320 @@
+#include "RegionCleaner.h"
+
+/**
+ * Tidies up regions traced by hand, which often have vertices a pixel apart and mixed winding
+ *  orders, before they reach a triangulator. Cleaning a region:
+ *
+ *  - Merges vertices within a distance of each other, each onto the first of them in the region.
+ *      Vertices are found through a spatial hash with cells as wide as that distance, so only
+ *      the vertices in the nine cells around a vertex are compared with it.
+ *  - Removes vertices that don't turn, including repeated vertices and the tips of spikes that
+ *      fold straight back.
+ *  - Reverses the region if it winds the other way, keeping its first vertex. Regions that
+ *      enclose no area have no winding, and are left as they are.
+ *
+ * Each cleaned vertex keeps track of the vertex it came from, so per-vertex attributes can follow
+ *  their vertices through a clean.
+ *
+ * Each step takes linear time (expected, for the spatial hash), and whole collections are cleaned
+ *  in parallel across the available cores.
+ *
+ * @author  Patrick Jahnig (Aerodlyn)
+ * @version 2026.10.19
+ */
+
+/* Public Methods */
+/**
+ * Cleans the given region.
+ *
+ * @param region    - The region to clean
+ * @param tolerance - The distance within which vertices are merged, or 0 to only merge
+ *                      repeated vertices
+ * @param winding   - The winding order to give the region, or None to keep its own
+ * @param summary   - Counts what changed, added to what it already holds
+ *
+ * @return The cleaned region
+ */
+QPolygonF Aerodlyn::RegionCleaner::clean (const QPolygonF &region, const double tolerance,
+    const RegionGeometry::Winding winding, Summary &summary)
+{
+    QVector <int> sources;
+    return clean (region, tolerance, winding, summary, sources);
+}
+
+/**
+ * Cleans the given region, recording the vertex each cleaned vertex came from.
+ *
+ * @param region    - The region to clean
+ * @param tolerance - The distance within which vertices are merged, or 0 to only merge
+ *                      repeated vertices
+ * @param winding   - The winding order to give the region, or None to keep its own
+ * @param summary   - Counts what changed, added to what it already holds
+ * @param sources   - Set to the index in the given region of each vertex of the cleaned region
+ *
+ * @return The cleaned region
+ */
+QPolygonF Aerodlyn::RegionCleaner::clean (const QPolygonF &region, const double tolerance,
+    const RegionGeometry::Winding winding, Summary &summary, QVector <int> &sources)
+{
+    QPolygonF cleaned = removeCollinear (mergeVertices (region, tolerance, summary, sources), summary, sources);
+
+    RegionGeometry geometry;
+    geometry.update (cleaned);
+
+    if (winding != RegionGeometry::Winding::None && geometry.winding () != RegionGeometry::Winding::None &&
+        geometry.winding () != winding)
+    {
+        std::reverse (cleaned.begin () + 1, cleaned.end ());
+        std::reverse (sources.begin () + 1, sources.end ());
+        summary.reversedRegions++;
+    }
+
+    return cleaned;
+}
+
+/**
+ * Cleans the region of every data set in the given collection, moving the attributes of the
+ *  data sets along with their vertices and marking the data sets that changed as dirty.
+ *
+ * @param collection - The data sets to clean
+ * @param tolerance  - The distance within which vertices are merged, or 0 to only merge
+ *                      repeated vertices
+ * @param winding    - The winding order to give every region, or None to keep their own
+ *
+ * @return What changed, across every data set
+ */
+Aerodlyn::RegionCleaner::Summary Aerodlyn::RegionCleaner::cleanAll (VertexDataSetCollection &collection,
+    const double tolerance, const RegionGeometry::Winding winding)
+{
+    AERO_PROFILE_SCOPE ("RegionCleaner::cleanAll");
+
+    const int count = collection.length ();
+
+    QVector <QPolygonF> cleaned (count);
+    QVector <Summary> summaries (count);
+    QVector <QVector <int>> sources (count);
+
+    // Every task writes to its own elements only, so the vectors are detached up front
+    QPolygonF *regions     = cleaned.data ();
+    Summary *changes       = summaries.data ();
+    QVector <int> *origins = sources.data ();
+
+    QVector <int> indices (count);
+    std::iota (indices.begin (), indices.end (), 0);
+
+    const VertexDataSetCollection &sets = collection;
+    QtConcurrent::blockingMap (indices, [&] (const int &index)
+        { regions [index] = clean (sets.at (index).region, tolerance, winding, changes [index], origins [index]); });
+
+    Summary summary;
+    for (int i = 0; i < count; i++)
+    {
+        // Merged vertices may only have moved, which no count shows
+        const QPolygonF &region = collection.at (i).region;
+        if (std::equal (region.begin (), region.end (), cleaned.at (i).begin (), cleaned.at (i).end (), isSame))
+            continue;
+
+        const Summary &changed = summaries.at (i);
+
+        summary.mergedVertices    += changed.mergedVertices;
+        summary.collinearVertices += changed.collinearVertices;
+        summary.reversedRegions   += changed.reversedRegions;
+
+        // Regions are only swapped in, so every data set stays where it is. Merging and reversing
+        //  reorder the vertices, which truncating the attributes (as marking dirty does) wouldn't follow
+        const QString name = collection.at (i).name;
+        collection.get (name)->get () = cleaned.at (i);
+        collection.attributes (name)->get ().remap (sources.at (i));
+        collection.markDirty (name);
+
+        summary.changed.append (name);
+    }
+
+    return summary;
+}
+
+/* Private Methods */
+/**
+ * Moves every vertex of the given region onto the first vertex in the region within the given
+ *  distance of it, if that isn't itself, and drops vertices that end up repeating the one
+ *  before them.
+ *
+ * @param region    - The region to merge the vertices of
+ * @param tolerance - The distance within which vertices are merged, or 0 to only drop repeats
+ * @param summary   - Counts the vertices dropped
+ * @param sources   - Set to the index in the given region of each vertex of the merged region
+ *
+ * @return The region with its vertices merged
+ */
+QPolygonF Aerodlyn::RegionCleaner::mergeVertices (const QPolygonF &region, const double tolerance, Summary &summary,
+    QVector <int> &sources)
+{
+    QPolygonF merged;
+    merged.reserve (region.size ());
+
+    sources.clear ();
+    sources.reserve (region.size ());
+
+    // The vertices that weren't merged onto another, chained from the last one added in each cell
+    QVector <QPointF> kept;
+    QVector <int> nextInCell;
+    QHash <quint64, int> cells;
+
+    const auto keyOf = [] (const qint64 x, const qint64 y)
+        { return (static_cast <quint64> (static_cast <quint32> (x)) << 32) | static_cast <quint32> (y); };
+
+    if (tolerance > 0.0)
+    {
+        kept.reserve (region.size ());
+        nextInCell.reserve (region.size ());
+        cells.reserve (region.size ());
+    }
+
+    for (int i = 0; i < region.size (); i++)
+    {
+        const QPointF &vertex = region.at (i);
+        QPointF position = vertex;
+
+        if (tolerance > 0.0)
+        {
+            const qint64 cellX = static_cast <qint64> (std::floor (vertex.x () / tolerance));
+            const qint64 cellY = static_cast <qint64> (std::floor (vertex.y () / tolerance));
+
+            // Vertices kept earlier have lower indices, so the lowest one in reach came first
+            int found = -1;
+            for (qint64 y = cellY - 1; y <= cellY + 1; y++)
+            {
+                for (qint64 x = cellX - 1; x <= cellX + 1; x++)
+                {
+                    for (int k = cells.value (keyOf (x, y), -1); k != -1; k = nextInCell.at (k))
+                    {
+                        const QPointF offset = kept.at (k) - vertex;
+                        if ((found == -1 || k < found) && std::hypot (offset.x (), offset.y ()) <= tolerance)
+                            found = k;
+                    }
+                }
+            }
+
+            if (found == -1)
+            {
+                const quint64 key = keyOf (cellX, cellY);
+
+                nextInCell.append (cells.value (key, -1));
+                cells.insert (key, kept.size ());
+                kept.append (vertex);
+            }
+
+            else
+                position = kept.at (found);
+        }
+
+        // A vertex merged onto another keeps its own attributes, as only its position changes
+        if (merged.isEmpty () || !isSame (merged.last (), position))
+        {
+            merged.append (position);
+            sources.append (i);
+        }
+    }
+
+    // The region is closed, so the last vertex may repeat the first one too
+    while (merged.size () > 1 && isSame (merged.last (), merged.first ()))
+    {
+        merged.removeLast ();
+        sources.removeLast ();
+    }
+
+    summary.mergedVertices += region.size () - merged.size ();
+    return merged;
+}
+
+/**
+ * Removes the vertices of the given region that don't turn, around the closing edge as well.
+ *
+ * @param region  - The region to remove the vertices of
+ * @param summary - Counts the vertices removed
+ * @param sources - The source index of each vertex of the given region, reduced to those of the
+ *                  vertices kept
+ *
+ * @return The region without the vertices that don't turn
+ */
+QPolygonF Aerodlyn::RegionCleaner::removeCollinear (const QPolygonF &region, Summary &summary, QVector <int> &sources)
+{
+    QPolygonF kept;
+    kept.reserve (region.size ());
+
+    QVector <int> keptSources;
+    keptSources.reserve (region.size ());
+
+    // Each vertex is only tested once the next one that is kept is known, so a run of vertices along
+    //  a line is removed back to its start
+    for (int i = 0; i < region.size (); i++)
+    {
+        const QPointF &vertex = region.at (i);
+        while (kept.size () >= 2 && isCollinear (kept.at (kept.size () - 2), kept.last (), vertex))
+        {
+            kept.removeLast ();
+            keptSources.removeLast ();
+        }
+
+        kept.append (vertex);
+        keptSources.append (sources.at (i));
+    }
+
+    // The vertices around the closing edge are tested against the other end of the region
+    int first = 0;
+    while (kept.size () - first >= 3)
+    {
+        if (isCollinear (kept.at (kept.size () - 2), kept.last (), kept.at (first)))
+        {
+            kept.removeLast ();
+            keptSources.removeLast ();
+        }
+
+        else if (isCollinear (kept.last (), kept.at (first), kept.at (first + 1)))
+            first++;
+
+        else
+            break;
+    }
+
+    if (kept.size () - first == 2 && isSame (kept.last (), kept.at (first)))
+    {
+        kept.removeLast ();
+        keptSources.removeLast ();
+    }
+
+    kept    = kept.mid (first);
+    sources = keptSources.mid (first);
+    summary.collinearVertices += region.size () - kept.size ();
+
+    return kept;
+}
+
+/**
+ * Determines if the path from a through b to c goes straight on or folds straight back at b,
+ *  allowing for rounding. Repeated points never turn.
+ *
+ * @param a - The point before
+ * @param b - The point tested
+ * @param c - The point after
+ *
+ * @return True if the path doesn't turn at b, false otherwise
+ */
+bool Aerodlyn::RegionCleaner::isCollinear (const QPointF &a, const QPointF &b, const QPointF &c)
+{
+    const QPointF in = b - a, out = c - b;
+    const double cross = in.x () * out.y () - in.y () * out.x ();
+
+    return std::abs (cross) <= COLLINEAR_EPSILON * std::hypot (in.x (), in.y ()) * std::hypot (out.x (), out.y ());
+}
+
+/**
+ * Determines if the given points are exactly the same, unlike the fuzzy comparison of QPointF.
+ *
+ * @param a - The first point
+ * @param b - The second point
+ *
+ * @return True if the points are the same, false otherwise
+ */
+bool Aerodlyn::RegionCleaner::isSame (const QPointF &a, const QPointF &b)
+    { return a.x () == b.x () && a.y () == b.y (); }
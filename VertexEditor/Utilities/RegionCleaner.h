@@ -0,0 +1,161 @@
+#ifndef REGION_CLEANER_H
+#define REGION_CLEANER_H
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+#include <QHash>
+#include <QPointF>
+#include <QPolygonF>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+#include <QtConcurrent>
+
+#include "Root/Profiler.h"
+
+#include "RegionGeometry.h"
+#include "VertexDataSetCollection.h"
+
+namespace Aerodlyn
+{
+    /**
+     * Tidies up regions traced by hand, which often have vertices a pixel apart and mixed winding
+     *  orders, before they reach a triangulator. Cleaning a region:
+     *
+     *  - Merges vertices within a distance of each other, each onto the first of them in the region.
+     *      Vertices are found through a spatial hash with cells as wide as that distance, so only
+     *      the vertices in the nine cells around a vertex are compared with it.
+     *  - Removes vertices that don't turn, including repeated vertices and the tips of spikes that
+     *      fold straight back.
+     *  - Reverses the region if it winds the other way, keeping its first vertex. Regions that
+     *      enclose no area have no winding, and are left as they are.
+     *
+     * Each cleaned vertex keeps track of the vertex it came from, so per-vertex attributes can follow
+     *  their vertices through a clean.
+     *
+     * Each step takes linear time (expected, for the spatial hash), and whole collections are cleaned
+     *  in parallel across the available cores.
+     *
+     * @author  Patrick Jahnig (Aerodlyn)
+     * @version 2026.10.19
+     */
+    class RegionCleaner
+    {
+        public: // Types
+            /**
+             * What cleaning one or more regions changed.
+             */
+            struct Summary
+            {
+                // Vertices dropped by merging, not counting those only moved onto another
+                int         mergedVertices    = 0;
+                int         collinearVertices = 0;
+                int         reversedRegions   = 0;
+
+                // The names of the data sets that changed, sorted, when cleaning a collection
+                QStringList changed;
+            };
+
+        public: // Methods
+            /**
+             * Cleans the given region.
+             *
+             * @param region    - The region to clean
+             * @param tolerance - The distance within which vertices are merged, or 0 to only merge
+             *                      repeated vertices
+             * @param winding   - The winding order to give the region, or None to keep its own
+             * @param summary   - Counts what changed, added to what it already holds
+             *
+             * @return The cleaned region
+             */
+            static QPolygonF clean (const QPolygonF &region, const double tolerance, const RegionGeometry::Winding winding,
+                Summary &summary);
+
+            /**
+             * Cleans the given region, recording the vertex each cleaned vertex came from.
+             *
+             * @param region    - The region to clean
+             * @param tolerance - The distance within which vertices are merged, or 0 to only merge
+             *                      repeated vertices
+             * @param winding   - The winding order to give the region, or None to keep its own
+             * @param summary   - Counts what changed, added to what it already holds
+             * @param sources   - Set to the index in the given region of each vertex of the cleaned region
+             *
+             * @return The cleaned region
+             */
+            static QPolygonF clean (const QPolygonF &region, const double tolerance, const RegionGeometry::Winding winding,
+                Summary &summary, QVector <int> &sources);
+
+            /**
+             * Cleans the region of every data set in the given collection, moving the attributes of the
+             *  data sets along with their vertices and marking the data sets that changed as dirty.
+             *
+             * @param collection - The data sets to clean
+             * @param tolerance  - The distance within which vertices are merged, or 0 to only merge
+             *                      repeated vertices
+             * @param winding    - The winding order to give every region, or None to keep their own
+             *
+             * @return What changed, across every data set
+             */
+            static Summary cleanAll (VertexDataSetCollection &collection, const double tolerance,
+                const RegionGeometry::Winding winding);
+
+        private: // Methods
+            /**
+             * Moves every vertex of the given region onto the first vertex in the region within the given
+             *  distance of it, if that isn't itself, and drops vertices that end up repeating the one
+             *  before them.
+             *
+             * @param region    - The region to merge the vertices of
+             * @param tolerance - The distance within which vertices are merged, or 0 to only drop repeats
+             * @param summary   - Counts the vertices dropped
+             * @param sources   - Set to the index in the given region of each vertex of the merged region
+             *
+             * @return The region with its vertices merged
+             */
+            static QPolygonF mergeVertices (const QPolygonF &region, const double tolerance, Summary &summary,
+                QVector <int> &sources);
+
+            /**
+             * Removes the vertices of the given region that don't turn, around the closing edge as well.
+             *
+             * @param region  - The region to remove the vertices of
+             * @param summary - Counts the vertices removed
+             * @param sources - The source index of each vertex of the given region, reduced to those of the
+             *                  vertices kept
+             *
+             * @return The region without the vertices that don't turn
+             */
+            static QPolygonF removeCollinear (const QPolygonF &region, Summary &summary, QVector <int> &sources);
+
+            /**
+             * Determines if the path from a through b to c goes straight on or folds straight back at b,
+             *  allowing for rounding. Repeated points never turn.
+             *
+             * @param a - The point before
+             * @param b - The point tested
+             * @param c - The point after
+             *
+             * @return True if the path doesn't turn at b, false otherwise
+             */
+            static bool isCollinear (const QPointF &a, const QPointF &b, const QPointF &c);
+
+            /**
+             * Determines if the given points are exactly the same, unlike the fuzzy comparison of QPointF.
+             *
+             * @param a - The first point
+             * @param b - The second point
+             *
+             * @return True if the points are the same, false otherwise
+             */
+            static bool isSame (const QPointF &a, const QPointF &b);
+
+        private: // Variables
+            // The sine of the sharpest turn that is still taken as going straight, allowing for rounding
+            static constexpr double COLLINEAR_EPSILON = 1e-9;
+    };
+}
+
+#endif // REGION_CLEANER_H
@@ -0,0 +1,839 @@
+#include "RegionClipper.h"
+
+/**
+ * Computes the union, intersection, difference or exclusive or of two regions, treating each as a
+ *  closed polygon filled with the even-odd rule (so self-intersecting regions are handled like
+ *  everywhere else). Uses the sweep of Martínez, Rueda and Feito, which subdivides the edges of
+ *  both regions at their intersections while sweeping a line across them, and keeps the pieces
+ *  that belong to the result. This takes O((n + k) log n) for n edges with k intersections, so
+ *  regions with tens of thousands of vertices are clipped interactively.
+ *
+ * @author  Patrick Jahnig (Aerodlyn)
+ * @version 2026.10.19
+ */
+
+/* Constructors/Deconstructors */
+/**
+ * Creates a new {@link RegionClipper} instance for a single operation.
+ *
+ * @param operation - The operation to apply
+ * @param extent    - The largest absolute coordinate of either region
+ */
+Aerodlyn::RegionClipper::RegionClipper (const Operation operation, const double extent) : operation (operation),
+    snapStep (std::ldexp (1.0, std::ilogb (std::max (extent, std::numeric_limits <double>::min ())) + 1 - SNAP_BITS)) {}
+
+/* Public Methods */
+/**
+ * Applies the given operation to the given regions. Regions with less than three vertices
+ *  enclose nothing, and are treated as empty.
+ *
+ * @param subject   - The region to clip (the one subtracted from, for a difference)
+ * @param clipping  - The region to clip with
+ * @param operation - The operation to apply
+ *
+ * @return The contours of the result, which together enclose the result with the even-odd rule
+ */
+QVector <QPolygonF> Aerodlyn::RegionClipper::clip (const QPolygonF &subject, const QPolygonF &clipping, const Operation operation)
+{
+    AERO_PROFILE_SCOPE ("RegionClipper::clip");
+
+    const bool subjectEmpty  = subject.size () < 3;
+    const bool clippingEmpty = clipping.size () < 3;
+
+    if (subjectEmpty || clippingEmpty)
+    {
+        if (operation == Operation::Intersection || (subjectEmpty && clippingEmpty))
+            return {};
+
+        if (operation == Operation::Difference)
+            return subjectEmpty ? QVector <QPolygonF> () : QVector <QPolygonF> { subject };
+
+        return { subjectEmpty ? clipping : subject };
+    }
+
+    const QRectF subjectBounds  = subject.boundingRect ();
+    const QRectF clippingBounds = clipping.boundingRect ();
+
+    // Regions whose bounding boxes don't meet can't change each other
+    if (subjectBounds.left () > clippingBounds.right () || clippingBounds.left () > subjectBounds.right () ||
+        subjectBounds.top () > clippingBounds.bottom () || clippingBounds.top () > subjectBounds.bottom ())
+    {
+        if (operation == Operation::Intersection)
+            return {};
+
+        if (operation == Operation::Difference)
+            return { subject };
+
+        return { subject, clipping };
+    }
+
+    // The right of a bounding box is its left plus its width, which may round away from the
+    //  rightmost vertex the sweep compares against
+    const auto byX = [] (const QPointF &a, const QPointF &b) { return a.x () < b.x (); };
+    const double subjectRight  = std::max_element (subject.begin (), subject.end (), byX)->x ();
+    const double clippingRight = std::max_element (clipping.begin (), clipping.end (), byX)->x ();
+
+    const QRectF bounds = subjectBounds.united (clippingBounds);
+    const double extent = std::max ({ std::abs (bounds.left ()), std::abs (bounds.right ()), std::abs (bounds.top ()),
+        std::abs (bounds.bottom ()) });
+
+    RegionClipper clipper (operation, extent);
+    clipper.addRegion (subject, true);
+    clipper.addRegion (clipping, false);
+
+    return clipper.connectEdges (clipper.sweep (subjectRight, clippingRight));
+}
+
+/**
+ * Joins the given contours into a single region. Each contour after the first is reached from
+ *  the first vertex of the first contour by a bridge that is walked there and back, so the
+ *  even-odd rule fills the region exactly like the contours (only the outline shows the
+ *  bridges).
+ *
+ * @param contours - The contours to join
+ *
+ * @return The joined region, or an empty region if there are no contours
+ */
+QPolygonF Aerodlyn::RegionClipper::merge (const QVector <QPolygonF> &contours)
+{
+    if (contours.size () < 2)
+        return contours.isEmpty () ? QPolygonF () : contours.first ();
+
+    const QPointF anchor = contours.first ().first ();
+    QPolygonF region;
+
+    for (int i = 0; i < contours.size (); i++)
+    {
+        // Each contour is closed explicitly, so that the bridge leaves from where it arrived
+        region += contours.at (i);
+        region << contours.at (i).first ();
+
+        if (i > 0)
+            region << anchor;
+    }
+
+    // The last bridge ends on the first vertex, which the region closes onto anyway
+    region.removeLast ();
+    return region;
+}
+
+/* Private Methods */
+/**
+ * Orders events the way the sweep meets them, for the event queue (which pops the greatest,
+ *  so this compares the other way around).
+ */
+bool Aerodlyn::RegionClipper::LaterEvent::operator () (const SweepEvent *a, const SweepEvent *b) const
+    { return compareEvents (a, b) > 0; }
+
+/**
+ * Orders the edges crossing the sweep line from bottom to top, by their left events.
+ */
+bool Aerodlyn::RegionClipper::LowerSegment::operator () (const SweepEvent *a, const SweepEvent *b) const
+    { return clipper->compareSegments (a, b) < 0; }
+
+/**
+ * Adds the edges of the given region to the event queue.
+ *
+ * @param region  - The region to add
+ * @param subject - True if the region is the subject, false if it is the clipping region
+ */
+void Aerodlyn::RegionClipper::addRegion (const QPolygonF &region, const bool subject)
+{
+    for (int i = 0, size = region.size (); i < size; i++)
+    {
+        const QPointF &a = region.at (i);
+        const QPointF &b = region.at ((i + 1) % size);
+
+        // Repeated vertices give edges without length, which enclose nothing
+        if (same (a, b))
+            continue;
+
+        SweepEvent *start = createEvent (a, true, nullptr, subject);
+        SweepEvent *end   = createEvent (b, true, start, subject);
+        start->other = end;
+
+        if (compareEvents (start, end) < 0)
+            end->left = false;
+
+        else
+            start->left = false;
+
+        // Every piece the edge is split into remembers it, to intersect it with others exactly
+        const SweepEvent *first = start->left ? start : end;
+        start->lineStart = end->lineStart = first->point;
+        start->lineEnd   = end->lineEnd   = first->other->point;
+
+        queue.push (start);
+        queue.push (end);
+    }
+}
+
+/**
+ * Sweeps a line across the queued edges from left to right, subdividing them where they
+ *  intersect and deciding which pieces belong to the result. The sweep stops early once the
+ *  rest of the edges can't be part of an intersection or difference.
+ *
+ * @param subjectRight  - The right of the bounding box of the subject
+ * @param clippingRight - The right of the bounding box of the clipping region
+ *
+ * @return The events in the order they were met
+ */
+std::vector <Aerodlyn::RegionClipper::SweepEvent *> Aerodlyn::RegionClipper::sweep (const double subjectRight, const double clippingRight)
+{
+    const double rightBound = std::min (subjectRight, clippingRight);
+
+    std::vector <SweepEvent *> sorted;
+    std::set <SweepEvent *, LowerSegment> status (LowerSegment { this });
+
+    sorted.reserve (events.size ());
+
+    while (!queue.empty ())
+    {
+        SweepEvent *event = queue.top ();
+        queue.pop ();
+
+        event->processed = true;
+        sorted.push_back (event);
+
+        if ((operation == Operation::Intersection && event->point.x () > rightBound) ||
+            (operation == Operation::Difference && event->point.x () > subjectRight))
+            break;
+
+        if (event->left)
+        {
+            const auto position = status.insert (event).first;
+            const auto next     = std::next (position);
+
+            SweepEvent *below = position != status.begin () ? *std::prev (position) : nullptr;
+            SweepEvent *above = next != status.end () ? *next : nullptr;
+
+            computeFields (event, below);
+
+            if (above != nullptr && possibleIntersection (event, above) == 2)
+            {
+                computeFields (event, below);
+                computeFields (above, event);
+            }
+
+            if (below != nullptr && possibleIntersection (below, event) == 2)
+            {
+                const auto belowPosition = std::prev (position);
+                const SweepEvent *belowBelow = belowPosition != status.begin () ? *std::prev (belowPosition) : nullptr;
+
+                computeFields (below, belowBelow);
+                computeFields (event, below);
+            }
+        }
+
+        else
+        {
+            const auto position = status.find (event->other);
+
+            if (position == status.end ())
+                continue;
+
+            const auto next = std::next (position);
+
+            SweepEvent *below = position != status.begin () ? *std::prev (position) : nullptr;
+            SweepEvent *above = next != status.end () ? *next : nullptr;
+
+            status.erase (position);
+
+            if (below != nullptr && above != nullptr)
+                possibleIntersection (below, above);
+        }
+    }
+
+    return sorted;
+}
+
+/**
+ * Decides whether the sweep line is inside either region just below the edge of the given left
+ *  event, from the edge below it, and whether the edge belongs to the result.
+ *
+ * @param event    - The left event of the edge
+ * @param previous - The left event of the edge below it, or null if there is none
+ */
+void Aerodlyn::RegionClipper::computeFields (SweepEvent *event, const SweepEvent *previous) const
+{
+    if (previous == nullptr)
+    {
+        event->inOut      = false;
+        event->otherInOut = true;
+    }
+
+    else
+    {
+        // A vertical edge below doesn't separate the inside from the outside of its region. Edges
+        //  narrower than a step of the snapping grid count as vertical, as they are after splitting.
+        const bool vertical = std::abs (previous->point.x () - previous->other->point.x ()) <= snapStep;
+
+        if (event->subject == previous->subject)
+        {
+            event->inOut      = vertical ? previous->inOut : !previous->inOut;
+            event->otherInOut = previous->otherInOut;
+        }
+
+        else
+        {
+            event->inOut      = !previous->otherInOut;
+            event->otherInOut = vertical ? !previous->inOut : previous->inOut;
+        }
+    }
+
+    event->inResult = inResult (event);
+}
+
+/**
+ * Determines if the edge of the given left event belongs to the result.
+ *
+ * @param event - The left event of the edge
+ *
+ * @return True if the edge belongs to the result, false otherwise
+ */
+bool Aerodlyn::RegionClipper::inResult (const SweepEvent *event) const
+{
+    switch (event->type)
+    {
+        case EdgeType::Normal:
+            switch (operation)
+            {
+                case Operation::Union:
+                    return event->otherInOut;
+
+                case Operation::Intersection:
+                    return !event->otherInOut;
+
+                case Operation::Difference:
+                    return event->subject == event->otherInOut;
+
+                case Operation::Xor:
+                    return true;
+            }
+
+            return false;
+
+        case EdgeType::SameTransition:
+            return operation == Operation::Union || operation == Operation::Intersection;
+
+        case EdgeType::DifferentTransition:
+            return operation == Operation::Difference;
+
+        case EdgeType::NonContributing:
+            return false;
+    }
+
+    return false;
+}
+
+/**
+ * Subdivides the edges of the given left events where they intersect or overlap.
+ *
+ * @param a - The left event of the lower edge
+ * @param b - The left event of the upper edge
+ *
+ * @return 0 if the edges don't intersect (or only share an endpoint), 1 if they cross, 2 if
+ *  edges of different regions overlap from a shared left endpoint and 3 if they overlap otherwise
+ */
+int Aerodlyn::RegionClipper::possibleIntersection (SweepEvent *a, SweepEvent *b)
+{
+    QPointF intersection [2];
+    const int count = intersect (a, b, intersection);
+
+    if (count == 0)
+        return 0;
+
+    if (count == 1 && (same (a->point, b->point) || same (a->other->point, b->other->point)))
+        return 0;
+
+    if (count == 1)
+    {
+        // A point computed from nearly parallel edges may be snapped onto an endpoint of the other
+        //  edge that lies beyond this one, which mustn't split it
+        if (splits (a, intersection [0]))
+            divideSegment (a, intersection [0]);
+
+        if (splits (b, intersection [0]))
+            divideSegment (b, intersection [0]);
+
+        return 1;
+    }
+
+    // The edges overlap, so only one of them is kept along the overlap. The endpoints are gathered
+    //  in sweep order, leaving out the ones they share. Overlapping edges of the same region are
+    //  split alike but both kept, as they cancel out with the even-odd rule, which the fields
+    //  computed from the edges below already account for.
+    const bool sameRegion = a->subject == b->subject;
+
+    SweepEvent *ends [4];
+    int endCount = 0;
+
+    const bool leftCoincide  = same (a->point, b->point);
+    const bool rightCoincide = same (a->other->point, b->other->point);
+
+    if (!leftCoincide)
+    {
+        const bool aFirst = compareEvents (a, b) < 0;
+        ends [endCount++] = aFirst ? a : b;
+        ends [endCount++] = aFirst ? b : a;
+    }
+
+    if (!rightCoincide)
+    {
+        const bool aFirst = compareEvents (a->other, b->other) < 0;
+        ends [endCount++] = aFirst ? a->other : b->other;
+        ends [endCount++] = aFirst ? b->other : a->other;
+    }
+
+    if (leftCoincide)
+    {
+        if (!sameRegion)
+        {
+            b->type = EdgeType::NonContributing;
+            a->type = a->inOut == b->inOut ? EdgeType::SameTransition : EdgeType::DifferentTransition;
+        }
+
+        if (!rightCoincide)
+            divideSegment (ends [1]->other, ends [0]->point);
+
+        return sameRegion ? 3 : 2;
+    }
+
+    if (rightCoincide)
+    {
+        divideSegment (ends [0], ends [1]->point);
+        return 3;
+    }
+
+    // One edge holds the other if it both starts first and ends last
+    if (ends [0] != ends [3]->other)
+    {
+        divideSegment (ends [0], ends [1]->point);
+        divideSegment (ends [1], ends [2]->point);
+        return 3;
+    }
+
+    divideSegment (ends [0], ends [1]->point);
+    divideSegment (ends [3]->other, ends [2]->point);
+    return 3;
+}
+
+/**
+ * Splits the edge of the given left event in two at the given point, queueing the events of the
+ *  new endpoints.
+ *
+ * @param event - The left event of the edge
+ * @param point - The point to split at, which lies on the edge
+ */
+void Aerodlyn::RegionClipper::divideSegment (SweepEvent *event, const QPointF &point)
+{
+    SweepEvent *right = createEvent (point, false, event, event->subject);
+    SweepEvent *left  = createEvent (point, true, event->other, event->subject);
+
+    right->lineStart = left->lineStart = event->lineStart;
+    right->lineEnd   = left->lineEnd   = event->lineEnd;
+
+    // Rounding the split point may move it past the old right endpoint, which then starts the piece
+    if (compareEvents (left, event->other) > 0)
+    {
+        event->other->left = true;
+        left->left = false;
+    }
+
+    event->other->other = left;
+    event->other = right;
+
+    queue.push (left);
+    queue.push (right);
+}
+
+/**
+ * Links the edges of the result into closed contours.
+ *
+ * @param sorted - The events in the order the sweep met them
+ *
+ * @return The contours of the result
+ */
+QVector <QPolygonF> Aerodlyn::RegionClipper::connectEdges (const std::vector <SweepEvent *> &sorted) const
+{
+    // Edges whose right endpoint wasn't reached before the sweep stopped lie outside the result
+    std::vector <SweepEvent *> result;
+
+    for (SweepEvent *event : sorted)
+    {
+        if (event->left ? event->inResult && event->other->processed : event->other->inResult)
+            result.push_back (event);
+    }
+
+    // Only the events at each point need to be next to each other, so they are ordered by point alone
+    std::stable_sort (result.begin (), result.end (), [] (const SweepEvent *a, const SweepEvent *b)
+        { return a->point.x () < b->point.x () || (a->point.x () == b->point.x () && a->point.y () < b->point.y ()); });
+
+    const int size = static_cast <int> (result.size ());
+
+    for (int i = 0; i < size; i++)
+        result [i]->position = i;
+
+    // Each event then holds the position of the other endpoint of its edge
+    for (SweepEvent *event : result)
+    {
+        if (!event->left)
+            std::swap (event->position, event->other->position);
+    }
+
+    QVector <QPolygonF> contours;
+    std::vector <bool> used (result.size (), false);
+
+    for (int i = 0; i < size; i++)
+    {
+        if (used [i])
+            continue;
+
+        QPolygonF contour;
+        int position = i;
+
+        // Walks along an edge, then leaves its far endpoint along any edge not walked yet, until the
+        //  contour has come back to where it started
+        while (position >= 0)
+        {
+            contour << result [position]->point;
+            used [position] = true;
+
+            position = result [position]->position;
+            used [position] = true;
+
+            const QPointF &point = result [position]->point;
+            int next = -1;
+
+            for (int j = position + 1; j < size && same (result [j]->point, point) && next < 0; j++)
+            {
+                if (!used [j])
+                    next = j;
+            }
+
+            for (int j = position - 1; j >= 0 && same (result [j]->point, point) && next < 0; j--)
+            {
+                if (!used [j])
+                    next = j;
+            }
+
+            position = next;
+        }
+
+        if (contour.size () >= 3)
+            contours.append (contour);
+    }
+
+    return contours;
+}
+
+/**
+ * Creates an event owned by this clipper.
+ *
+ * @param point   - The endpoint of the edge
+ * @param left    - True if the endpoint is the left one of its edge, false otherwise
+ * @param other   - The event of the other endpoint, if it exists already
+ * @param subject - True if the edge belongs to the subject, false otherwise
+ *
+ * @return The created event
+ */
+Aerodlyn::RegionClipper::SweepEvent *Aerodlyn::RegionClipper::createEvent (const QPointF &point, const bool left,
+    SweepEvent *other, const bool subject)
+{
+    // A deque never moves its elements, so the events can point at each other
+    events.emplace_back ();
+
+    SweepEvent *event = &events.back ();
+    event->point   = point;
+    event->left    = left;
+    event->other   = other;
+    event->subject = subject;
+
+    return event;
+}
+
+/**
+ * Compares the given events in the order the sweep meets them: by x, then y, then right
+ *  endpoints before left ones, then lower edges first.
+ *
+ * @param a - The first event
+ * @param b - The second event
+ *
+ * @return A positive number if a comes after b, a negative number otherwise
+ */
+int Aerodlyn::RegionClipper::compareEvents (const SweepEvent *a, const SweepEvent *b)
+{
+    if (a->point.x () != b->point.x ())
+        return a->point.x () > b->point.x () ? 1 : -1;
+
+    if (a->point.y () != b->point.y ())
+        return a->point.y () > b->point.y () ? 1 : -1;
+
+    if (a->left != b->left)
+        return a->left ? 1 : -1;
+
+    if (signedArea (a->point, a->other->point, b->other->point) != 0.0)
+        return isBelow (a, b->other->point) ? -1 : 1;
+
+    // Collinear edges from the same point are ordered subject first, and otherwise by identity so
+    //  that the order stays consistent
+    if (a->subject != b->subject)
+        return a->subject ? -1 : 1;
+
+    return std::less <const SweepEvent *> () (a, b) ? -1 : 1;
+}
+
+/**
+ * Compares the edges of the given left events by their height on the sweep line.
+ *
+ * @param a - The left event of the first edge
+ * @param b - The left event of the second edge
+ *
+ * @return A negative number if a is below b, a positive number if it is above and 0 if they
+ *  are the same edge
+ */
+int Aerodlyn::RegionClipper::compareSegments (const SweepEvent *a, const SweepEvent *b) const
+{
+    if (a == b)
+        return 0;
+
+    if (!collinear (a->point, a->other->point, b->point, b->other->point))
+    {
+        if (same (a->point, b->point))
+            return isBelow (a, b->other->point) ? -1 : 1;
+
+        if (a->point.x () == b->point.x ())
+            return a->point.y () < b->point.y () ? -1 : 1;
+
+        // Whichever edge was met later is compared against the earlier one at its left endpoint, or at
+        //  its right endpoint if it starts on the earlier one
+        if (compareEvents (a, b) > 0)
+            return isBelow (b, liesOn (b, a->point) ? a->other->point : a->point) ? 1 : -1;
+
+        return isBelow (a, liesOn (a, b->point) ? b->other->point : b->point) ? -1 : 1;
+    }
+
+    // The edges are collinear
+    if (a->subject != b->subject)
+        return a->subject ? -1 : 1;
+
+    if (same (a->point, b->point))
+        return std::less <const SweepEvent *> () (a, b) ? -1 : 1;
+
+    return compareEvents (a, b) > 0 ? 1 : -1;
+}
+
+/**
+ * Intersects the edges of the given left events.
+ *
+ * @param a            - The left event of the first edge
+ * @param b            - The left event of the second edge
+ * @param intersection - Receives the intersection point, or the ends of the overlap
+ *
+ * @return The number of points written: 0 if the edges don't meet, 1 if they meet in a point and
+ *  2 if they overlap
+ */
+int Aerodlyn::RegionClipper::intersect (const SweepEvent *a, const SweepEvent *b, QPointF intersection [2]) const
+{
+    const QPointF &a1 = a->point, &a2 = a->other->point;
+    const QPointF &b1 = b->point, &b2 = b->other->point;
+
+    const QPointF va = a2 - a1;
+    const QPointF vb = b2 - b1;
+    const QPointF e  = b1 - a1;
+
+    const double cross  = va.x () * vb.y () - va.y () * vb.x ();
+    const bool   onLine = collinear (a1, a2, b1, b2);
+
+    if (!onLine && cross != 0.0)
+    {
+        // The point is computed from the input edges the pieces were split from, always in the same
+        //  order, so that pieces of the same two edges meet at exactly the same point however often
+        //  they were split before
+        const bool    swapped = before (b->lineStart, a->lineStart) ||
+            (same (b->lineStart, a->lineStart) && before (b->lineEnd, a->lineEnd));
+        const QPointF &l1 = swapped ? b->lineStart : a->lineStart, &l2 = swapped ? b->lineEnd : a->lineEnd;
+        const QPointF &m1 = swapped ? a->lineStart : b->lineStart, &m2 = swapped ? a->lineEnd : b->lineEnd;
+
+        const QPointF vl = l2 - l1;
+        const QPointF vm = m2 - m1;
+        const QPointF el = m1 - l1;
+
+        const double lineCross = vl.x () * vm.y () - vl.y () * vm.x ();
+        const QPointF point    = lineCross != 0.0 ? l1 + ((el.x () * vm.y () - el.y () * vm.x ()) / lineCross) * vl :
+            a1 + ((e.x () * vb.y () - e.y () * vb.x ()) / cross) * va;
+
+        // Snapping moves points by up to a step, so pieces are allowed to miss by a little more
+        const double slack  = 2.0 * snapStep;
+        const auto   within = [slack, &point] (const QPointF &from, const QPointF &to)
+        {
+            return point.x () >= std::min (from.x (), to.x ()) - slack && point.x () <= std::max (from.x (), to.x ()) + slack
+                && point.y () >= std::min (from.y (), to.y ()) - slack && point.y () <= std::max (from.y (), to.y ()) + slack;
+        };
+
+        if (!within (a1, a2) || !within (b1, b2))
+            return 0;
+
+        // Computed points are snapped onto an endpoint they round to just beside, and onto a fine grid
+        //  otherwise, so that the points where several edges meet come out exactly equal. Otherwise
+        //  they would split edges into slivers that intersect again and again.
+        for (const QPointF *end : { &a1, &a2, &b1, &b2 })
+        {
+            if ((point - *end).manhattanLength () <= slack)
+            {
+                intersection [0] = *end;
+                return 1;
+            }
+        }
+
+        // Snapping to the grid mustn't move the point beyond either edge along the sweep, or a nearly
+        //  vertical edge wouldn't be split where the other edge crosses it
+        const double low  = std::max (std::min (a1.x (), a2.x ()), std::min (b1.x (), b2.x ()));
+        const double high = std::min (std::max (a1.x (), a2.x ()), std::max (b1.x (), b2.x ()));
+        const double x    = std::round (point.x () / snapStep) * snapStep;
+
+        intersection [0] = QPointF (low <= high ? std::clamp (x, low, high) : x, std::round (point.y () / snapStep) * snapStep);
+        return 1;
+    }
+
+    // Parallel segments only meet if they lie on the same line
+    if (!onLine)
+        return 0;
+
+    const double lengthSquared = QPointF::dotProduct (va, va);
+    const double sb1 = QPointF::dotProduct (va, e) / lengthSquared;
+    const double sb2 = sb1 + QPointF::dotProduct (va, vb) / lengthSquared;
+
+    const double sMin = std::min (sb1, sb2);
+    const double sMax = std::max (sb1, sb2);
+
+    if (sMin > 1.0 || sMax < 0.0)
+        return 0;
+
+    const auto pointAt = [&] (const double s)
+    {
+        if (s <= 0.0)
+            return a1;
+
+        if (s >= 1.0)
+            return a2;
+
+        return s == sb1 ? b1 : b2;
+    };
+
+    intersection [0] = pointAt (sMin);
+
+    if (sMin == 1.0 || sMax == 0.0)
+        return 1;
+
+    intersection [1] = pointAt (sMax);
+    return 2;
+}
+
+/**
+ * Returns twice the signed area of the triangle through the given points, which is positive if
+ *  they turn counter-clockwise (with y pointing up).
+ *
+ * @param p0 - The first point
+ * @param p1 - The second point
+ * @param p2 - The third point
+ *
+ * @return Twice the signed area of the triangle
+ */
+double Aerodlyn::RegionClipper::signedArea (const QPointF &p0, const QPointF &p1, const QPointF &p2)
+    { return (p0.x () - p2.x ()) * (p1.y () - p2.y ()) - (p1.x () - p2.x ()) * (p0.y () - p2.y ()); }
+
+/**
+ * Determines if the edge of the given event lies below the given point.
+ *
+ * @param event - An event of the edge
+ * @param point - The point
+ *
+ * @return True if the edge is below the point, false otherwise
+ */
+bool Aerodlyn::RegionClipper::isBelow (const SweepEvent *event, const QPointF &point)
+{
+    return event->left ? signedArea (event->point, event->other->point, point) > 0.0 :
+        signedArea (event->other->point, event->point, point) > 0.0;
+}
+
+/**
+ * Determines if the given point lies on the line through the edge of the given event, up to the
+ *  grid intersections are snapped to.
+ *
+ * @param event - An event of the edge
+ * @param point - The point
+ *
+ * @return True if the point lies on the line, false otherwise
+ */
+bool Aerodlyn::RegionClipper::liesOn (const SweepEvent *event, const QPointF &point) const
+    { return liesOn (event->point, event->other->point, point); }
+
+/**
+ * Determines if the given point lies on the line through the given points, up to the grid
+ *  intersections are snapped to.
+ *
+ * @param from  - A point on the line
+ * @param to    - Another point on the line
+ * @param point - The point
+ *
+ * @return True if the point lies on the line, false otherwise
+ */
+bool Aerodlyn::RegionClipper::liesOn (const QPointF &from, const QPointF &to, const QPointF &point) const
+{
+    // Twice the area of the triangle is the length of the edge times the distance from the line
+    const double length = (to - from).manhattanLength ();
+    return std::abs (signedArea (from, to, point)) <= length * snapStep;
+}
+
+/**
+ * Determines if the segment from a1 to a2 and the segment from b1 to b2 lie on the same line, up
+ *  to the grid intersections are snapped to. Pieces of a split edge may be a step off the line
+ *  through the others, and must still be seen to overlap them.
+ *
+ * @param a1 - The start of the first segment
+ * @param a2 - The end of the first segment
+ * @param b1 - The start of the second segment
+ * @param b2 - The end of the second segment
+ *
+ * @return True if the segments lie on the same line, false otherwise
+ */
+bool Aerodlyn::RegionClipper::collinear (const QPointF &a1, const QPointF &a2, const QPointF &b1, const QPointF &b2) const
+{
+    return (liesOn (a1, a2, b1) && liesOn (a1, a2, b2)) || (liesOn (b1, b2, a1) && liesOn (b1, b2, a2));
+}
+
+/**
+ * Determines if the given point lies strictly between the endpoints of the edge of the given left
+ *  event in the order the sweep meets them, so that splitting the edge there leaves two pieces.
+ *
+ * @param event - The left event of the edge
+ * @param point - The point
+ *
+ * @return True if the point lies between the endpoints, false otherwise
+ */
+bool Aerodlyn::RegionClipper::splits (const SweepEvent *event, const QPointF &point)
+    { return before (event->point, point) && before (point, event->other->point); }
+
+/**
+ * Determines if the sweep meets the first given point before the second, by x and then y.
+ *
+ * @param a - The first point
+ * @param b - The second point
+ *
+ * @return True if a comes before b, false otherwise
+ */
+bool Aerodlyn::RegionClipper::before (const QPointF &a, const QPointF &b)
+    { return a.x () < b.x () || (a.x () == b.x () && a.y () < b.y ()); }
+
+/**
+ * Determines if the given points are exactly equal. Unlike the == operator of
+ *  {@link QPointF}, this doesn't compare fuzzily, which the sweep relies on.
+ *
+ * @param a - The first point
+ * @param b - The second point
+ *
+ * @return True if the points are equal, false otherwise
+ */
+bool Aerodlyn::RegionClipper::same (const QPointF &a, const QPointF &b)
+    { return a.x () == b.x () && a.y () == b.y (); }
@@ -0,0 +1,356 @@
+#ifndef REGION_CLIPPER_H
+#define REGION_CLIPPER_H
+
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <iterator>
+#include <limits>
+#include <queue>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include <QPointF>
+#include <QPolygonF>
+#include <QRectF>
+#include <QVector>
+
+#include "Root/Profiler.h"
+
+namespace Aerodlyn
+{
+    /**
+     * Computes the union, intersection, difference or exclusive or of two regions, treating each as a
+     *  closed polygon filled with the even-odd rule (so self-intersecting regions are handled like
+     *  everywhere else). Uses the sweep of Martínez, Rueda and Feito, which subdivides the edges of
+     *  both regions at their intersections while sweeping a line across them, and keeps the pieces
+     *  that belong to the result. This takes O((n + k) log n) for n edges with k intersections, so
+     *  regions with tens of thousands of vertices are clipped interactively.
+     *
+     * The result is made of one or more contours, which {@link #merge} joins into a single region.
+     *  Intersections are snapped to a fine grid scaled to the extent of the regions, so that edges
+     *  meeting in a single point are all split at exactly that point, and each point is computed from
+     *  the original edges rather than the pieces already split off them. Edges of the same region
+     *  that overlap each other (such as a spike folding back onto itself) aren't fully resolved, and
+     *  may leave stray edges in the result.
+     *
+     * @author  Patrick Jahnig (Aerodlyn)
+     * @version 2026.10.19
+     */
+    class RegionClipper
+    {
+        public: // Types
+            enum class Operation { Union, Intersection, Difference, Xor };
+
+        public: // Methods
+            /**
+             * Applies the given operation to the given regions. Regions with less than three vertices
+             *  enclose nothing, and are treated as empty.
+             *
+             * @param subject   - The region to clip (the one subtracted from, for a difference)
+             * @param clipping  - The region to clip with
+             * @param operation - The operation to apply
+             *
+             * @return The contours of the result, which together enclose the result with the even-odd rule
+             */
+            static QVector <QPolygonF> clip (const QPolygonF &subject, const QPolygonF &clipping, const Operation operation);
+
+            /**
+             * Joins the given contours into a single region. Each contour after the first is reached from
+             *  the first vertex of the first contour by a bridge that is walked there and back, so the
+             *  even-odd rule fills the region exactly like the contours (only the outline shows the
+             *  bridges).
+             *
+             * @param contours - The contours to join
+             *
+             * @return The joined region, or an empty region if there are no contours
+             */
+            static QPolygonF merge (const QVector <QPolygonF> &contours);
+
+        private: // Types
+            /**
+             * How an edge that overlaps an edge of the other region contributes to the result. Only one
+             *  of the two overlapping edges is kept, as they coincide.
+             */
+            enum class EdgeType { Normal, NonContributing, SameTransition, DifferentTransition };
+
+            /**
+             * An endpoint of an edge, as met by the sweep line.
+             */
+            struct SweepEvent
+            {
+                bool            left        = false;
+                bool            subject     = false;
+                bool            processed   = false;
+
+                // Whether the sweep line enters (false) or leaves (true) this edge's region, or the
+                //  other region, just below this edge
+                bool            inOut       = false;
+                bool            otherInOut  = false;
+                bool            inResult    = false;
+
+                int             position    = -1;
+
+                EdgeType        type        = EdgeType::Normal;
+
+                QPointF         point;
+
+                // The endpoints of the input edge this edge was split from, in the order the sweep
+                //  meets them
+                QPointF         lineStart, lineEnd;
+
+                SweepEvent      *other      = nullptr;
+            };
+
+            /**
+             * Orders events the way the sweep meets them, for the event queue (which pops the greatest,
+             *  so this compares the other way around).
+             */
+            struct LaterEvent
+            {
+                bool operator () (const SweepEvent *a, const SweepEvent *b) const;
+            };
+
+            /**
+             * Orders the edges crossing the sweep line from bottom to top, by their left events.
+             */
+            struct LowerSegment
+            {
+                const RegionClipper *clipper;
+
+                bool operator () (const SweepEvent *a, const SweepEvent *b) const;
+            };
+
+        private: // Constructors/Deconstructors
+            /**
+             * Creates a new {@link RegionClipper} instance for a single operation.
+             *
+             * @param operation - The operation to apply
+             * @param extent    - The largest absolute coordinate of either region
+             */
+            RegionClipper (const Operation operation, const double extent);
+
+        private: // Methods
+            /**
+             * Adds the edges of the given region to the event queue.
+             *
+             * @param region  - The region to add
+             * @param subject - True if the region is the subject, false if it is the clipping region
+             */
+            void addRegion (const QPolygonF &region, const bool subject);
+
+            /**
+             * Sweeps a line across the queued edges from left to right, subdividing them where they
+             *  intersect and deciding which pieces belong to the result. The sweep stops early once the
+             *  rest of the edges can't be part of an intersection or difference.
+             *
+             * @param subjectRight  - The right of the bounding box of the subject
+             * @param clippingRight - The right of the bounding box of the clipping region
+             *
+             * @return The events in the order they were met
+             */
+            std::vector <SweepEvent *> sweep (const double subjectRight, const double clippingRight);
+
+            /**
+             * Decides whether the sweep line is inside either region just below the edge of the given left
+             *  event, from the edge below it, and whether the edge belongs to the result.
+             *
+             * @param event    - The left event of the edge
+             * @param previous - The left event of the edge below it, or null if there is none
+             */
+            void computeFields (SweepEvent *event, const SweepEvent *previous) const;
+
+            /**
+             * Determines if the edge of the given left event belongs to the result.
+             *
+             * @param event - The left event of the edge
+             *
+             * @return True if the edge belongs to the result, false otherwise
+             */
+            bool inResult (const SweepEvent *event) const;
+
+            /**
+             * Subdivides the edges of the given left events where they intersect or overlap.
+             *
+             * @param a - The left event of the lower edge
+             * @param b - The left event of the upper edge
+             *
+             * @return 0 if the edges don't intersect (or only share an endpoint), 1 if they cross, 2 if
+             *  edges of different regions overlap from a shared left endpoint and 3 if they overlap otherwise
+             */
+            int possibleIntersection (SweepEvent *a, SweepEvent *b);
+
+            /**
+             * Splits the edge of the given left event in two at the given point, queueing the events of the
+             *  new endpoints.
+             *
+             * @param event - The left event of the edge
+             * @param point - The point to split at, which lies on the edge
+             */
+            void divideSegment (SweepEvent *event, const QPointF &point);
+
+            /**
+             * Links the edges of the result into closed contours.
+             *
+             * @param sorted - The events in the order the sweep met them
+             *
+             * @return The contours of the result
+             */
+            QVector <QPolygonF> connectEdges (const std::vector <SweepEvent *> &sorted) const;
+
+            /**
+             * Creates an event owned by this clipper.
+             *
+             * @param point   - The endpoint of the edge
+             * @param left    - True if the endpoint is the left one of its edge, false otherwise
+             * @param other   - The event of the other endpoint, if it exists already
+             * @param subject - True if the edge belongs to the subject, false otherwise
+             *
+             * @return The created event
+             */
+            SweepEvent *createEvent (const QPointF &point, const bool left, SweepEvent *other, const bool subject);
+
+            /**
+             * Compares the given events in the order the sweep meets them: by x, then y, then right
+             *  endpoints before left ones, then lower edges first.
+             *
+             * @param a - The first event
+             * @param b - The second event
+             *
+             * @return A positive number if a comes after b, a negative number otherwise
+             */
+            static int compareEvents (const SweepEvent *a, const SweepEvent *b);
+
+            /**
+             * Compares the edges of the given left events by their height on the sweep line.
+             *
+             * @param a - The left event of the first edge
+             * @param b - The left event of the second edge
+             *
+             * @return A negative number if a is below b, a positive number if it is above and 0 if they
+             *  are the same edge
+             */
+            int compareSegments (const SweepEvent *a, const SweepEvent *b) const;
+
+            /**
+             * Intersects the edges of the given left events.
+             *
+             * @param a            - The left event of the first edge
+             * @param b            - The left event of the second edge
+             * @param intersection - Receives the intersection point, or the ends of the overlap
+             *
+             * @return The number of points written: 0 if the edges don't meet, 1 if they meet in a point and
+             *  2 if they overlap
+             */
+            int intersect (const SweepEvent *a, const SweepEvent *b, QPointF intersection [2]) const;
+
+            /**
+             * Returns twice the signed area of the triangle through the given points, which is positive if
+             *  they turn counter-clockwise (with y pointing up).
+             *
+             * @param p0 - The first point
+             * @param p1 - The second point
+             * @param p2 - The third point
+             *
+             * @return Twice the signed area of the triangle
+             */
+            static double signedArea (const QPointF &p0, const QPointF &p1, const QPointF &p2);
+
+            /**
+             * Determines if the edge of the given event lies below the given point.
+             *
+             * @param event - An event of the edge
+             * @param point - The point
+             *
+             * @return True if the edge is below the point, false otherwise
+             */
+            static bool isBelow (const SweepEvent *event, const QPointF &point);
+
+            /**
+             * Determines if the given point lies on the line through the edge of the given event, up to the
+             *  grid intersections are snapped to.
+             *
+             * @param event - An event of the edge
+             * @param point - The point
+             *
+             * @return True if the point lies on the line, false otherwise
+             */
+            bool liesOn (const SweepEvent *event, const QPointF &point) const;
+
+            /**
+             * Determines if the given point lies on the line through the given points, up to the grid
+             *  intersections are snapped to.
+             *
+             * @param from  - A point on the line
+             * @param to    - Another point on the line
+             * @param point - The point
+             *
+             * @return True if the point lies on the line, false otherwise
+             */
+            bool liesOn (const QPointF &from, const QPointF &to, const QPointF &point) const;
+
+            /**
+             * Determines if the segment from a1 to a2 and the segment from b1 to b2 lie on the same line, up
+             *  to the grid intersections are snapped to. Pieces of a split edge may be a step off the line
+             *  through the others, and must still be seen to overlap them.
+             *
+             * @param a1 - The start of the first segment
+             * @param a2 - The end of the first segment
+             * @param b1 - The start of the second segment
+             * @param b2 - The end of the second segment
+             *
+             * @return True if the segments lie on the same line, false otherwise
+             */
+            bool collinear (const QPointF &a1, const QPointF &a2, const QPointF &b1, const QPointF &b2) const;
+
+            /**
+             * Determines if the given point lies strictly between the endpoints of the edge of the given
+             *  left event in the order the sweep meets them, so that splitting the edge there leaves two
+             *  pieces.
+             *
+             * @param event - The left event of the edge
+             * @param point - The point
+             *
+             * @return True if the point lies between the endpoints, false otherwise
+             */
+            static bool splits (const SweepEvent *event, const QPointF &point);
+
+            /**
+             * Determines if the sweep meets the first given point before the second, by x and then y.
+             *
+             * @param a - The first point
+             * @param b - The second point
+             *
+             * @return True if a comes before b, false otherwise
+             */
+            static bool before (const QPointF &a, const QPointF &b);
+
+            /**
+             * Determines if the given points are exactly equal. Unlike the == operator of
+             *  {@link QPointF}, this doesn't compare fuzzily, which the sweep relies on.
+             *
+             * @param a - The first point
+             * @param b - The second point
+             *
+             * @return True if the points are equal, false otherwise
+             */
+            static bool same (const QPointF &a, const QPointF &b);
+
+        private: // Variables
+            const Operation                                                     operation;
+
+            // The spacing of the grid intersections are snapped to
+            const double                                                        snapStep;
+
+            std::deque <SweepEvent>                                             events;
+
+            std::priority_queue <SweepEvent *, std::vector <SweepEvent *>, LaterEvent> queue;
+
+            // The grid has 2^SNAP_BITS steps across the extent of the regions, a power of two so that
+            //  snapped coordinates are exact
+            static constexpr int                                                SNAP_BITS = 40;
+    };
+}
+
+#endif // REGION_CLIPPER_H
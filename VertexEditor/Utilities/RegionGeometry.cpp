@@ -0,0 +1,255 @@
+#include "RegionGeometry.h"
+
+/**
+ * A cache of the geometry derived from a region (its bounding box, area, centroid, perimeter, winding
+ *  order, a path for painting it, slabs for point-in-polygon tests and the shapes enclosing it),
+ *  treating the region as a closed polygon. The values are computed on the first request after
+ *  an invalidation, and moving a single vertex updates them in constant time instead of
+ *  recomputing them.
+ *
+ * @author  Patrick Jahnig (Aerodlyn)
+ * @version 2026.10.19
+ */
+
+/* Public Methods */
+/**
+ * Discards the cached values, so that they are recomputed on the next request.
+ */
+void Aerodlyn::RegionGeometry::invalidate ()
+{
+    valid        = false;
+    pathValid    = false;
+    volumesValid = false;
+
+    slabIndex.invalidate ();
+}
+
+/**
+ * Computes the cached values from the given region if they were invalidated since they were
+ *  last computed.
+ *
+ * @param region - The region the values are derived from
+ */
+void Aerodlyn::RegionGeometry::update (const QPolygonF &region)
+{
+    if (valid && count == region.size ())
+        return;
+
+    count        = region.size ();
+    crossSum     = 0.0;
+    perimeterSum = 0.0;
+    centroidSum  = QPointF ();
+    vertexSum    = QPointF ();
+    boundingBox  = region.boundingRect ();
+
+    for (int i = 0; i < count; i++)
+    {
+        vertexSum += region.at (i);
+        accumulateEdge (region.at (i), region.at ((i + 1) % count), 1.0);
+    }
+
+    valid = true;
+}
+
+/**
+ * Updates the cached values after the vertex at the given index of the given region moved from
+ *  the given position, which is cheaper than recomputing them. Does nothing if the values
+ *  haven't been computed yet.
+ *
+ * @param region - The region, with the vertex already at its new position
+ * @param index  - The index of the vertex that moved
+ * @param from   - The position the vertex moved from
+ */
+void Aerodlyn::RegionGeometry::moveVertex (const QPolygonF &region, const int index, const QPointF &from)
+{
+    // The slabs are built separately from the other values, so they are patched even if those aren't
+    slabIndex.moveVertex (region, index, from);
+
+    // Any vertex may end up on the hull, which every enclosing shape is derived from. The path is
+    //  built separately from the other values too, so it can't be patched if they can't be
+    volumesValid = false;
+
+    if (!valid || count != region.size ())
+    {
+        pathValid = false;
+        return;
+    }
+
+    // The edges of tiny regions share endpoints, so they are cheaper to recompute than to patch
+    if (count < 3)
+    {
+        invalidate ();
+        update (region);
+
+        return;
+    }
+
+    const QPointF &to   = region.at (index);
+    const QPointF &prev = region.at ((index + count - 1) % count);
+    const QPointF &next = region.at ((index + 1) % count);
+
+    accumulateEdge (prev, from, -1.0);
+    accumulateEdge (from, next, -1.0);
+    accumulateEdge (prev, to, 1.0);
+    accumulateEdge (to, next, 1.0);
+
+    vertexSum += to - from;
+
+    // The path closes with an explicit line back to the first vertex, which moves with it
+    if (pathValid)
+    {
+        regionPath.setElementPositionAt (index, to.x (), to.y ());
+        if (index == 0)
+            regionPath.setElementPositionAt (count, to.x (), to.y ());
+    }
+
+    // Moving a vertex off the edge of the bounding box may shrink it, which needs every vertex
+    const bool onEdge = from.x () == boundingBox.left () || from.x () == boundingBox.right () ||
+                        from.y () == boundingBox.top () || from.y () == boundingBox.bottom ();
+
+    if (onEdge)
+        boundingBox = region.boundingRect ();
+
+    // QRectF::united ignores rectangles without width and height, such as a single point, so the
+    //  bounding box is grown by hand
+    else
+        boundingBox = QRectF (QPointF (std::min (boundingBox.left (), to.x ()), std::min (boundingBox.top (), to.y ())),
+                              QPointF (std::max (boundingBox.right (), to.x ()), std::max (boundingBox.bottom (), to.y ())));
+}
+
+/**
+ * Returns the bounding box of the region. The region must have been given to {@link #update}.
+ *
+ * @return The bounding box of the region
+ */
+QRectF Aerodlyn::RegionGeometry::bounds () const
+    { return boundingBox; }
+
+/**
+ * Returns the area enclosed by the region. The region must have been given to {@link #update}.
+ *
+ * @return The unsigned area of the region
+ */
+double Aerodlyn::RegionGeometry::area () const
+    { return std::abs (crossSum) / 2.0; }
+
+/**
+ * Returns the centroid of the area enclosed by the region, or the average of its vertices if it
+ *  encloses no area. The region must have been given to {@link #update}.
+ *
+ * @return The centroid of the region
+ */
+QPointF Aerodlyn::RegionGeometry::centroid () const
+{
+    if (count == 0)
+        return QPointF ();
+
+    if (std::abs (crossSum) < EPSILON)
+        return vertexSum / count;
+
+    return centroidSum / (3.0 * crossSum);
+}
+
+/**
+ * Returns the length of the edges of the region, including the one closing it. The region must
+ *  have been given to {@link #update}.
+ *
+ * @return The perimeter of the region
+ */
+double Aerodlyn::RegionGeometry::perimeter () const
+    { return perimeterSum; }
+
+/**
+ * Returns the winding order of the region. The region must have been given to {@link #update}.
+ *
+ * @return The winding order of the region
+ */
+Aerodlyn::RegionGeometry::Winding Aerodlyn::RegionGeometry::winding () const
+{
+    if (count < 3 || std::abs (crossSum) < EPSILON)
+        return Winding::None;
+
+    // With y pointing down, a positive shoelace sum goes clockwise on screen
+    return crossSum > 0.0 ? Winding::Clockwise : Winding::CounterClockwise;
+}
+
+/**
+ * Returns a closed path through the vertices of the given region, built on the first request after
+ *  an invalidation.
+ *
+ * @param region - The region the path goes through
+ *
+ * @return The path of the region
+ */
+const QPainterPath &Aerodlyn::RegionGeometry::path (const QPolygonF &region)
+{
+    if (pathValid && regionPath.elementCount () == region.size () + 1)
+        return regionPath;
+
+    regionPath = QPainterPath ();
+    if (!region.isEmpty ())
+    {
+        regionPath.moveTo (region.at (0));
+
+        for (int i = 1; i < region.size (); i++)
+            regionPath.lineTo (region.at (i));
+
+        regionPath.lineTo (region.at (0));
+    }
+
+    pathValid = true;
+    return regionPath;
+}
+
+/**
+ * Returns the slabs that speed up point-in-polygon tests on the given region (see
+ *  {@link RegionSlabIndex}), built on the first request after an invalidation.
+ *
+ * @param region - The region the slabs are built from
+ *
+ * @return The slabs of the region
+ */
+const Aerodlyn::RegionSlabIndex &Aerodlyn::RegionGeometry::slabs (const QPolygonF &region)
+{
+    if (!slabIndex.isValid (region.size ()))
+        slabIndex.rebuild (region);
+
+    return slabIndex;
+}
+
+/**
+ * Returns the shapes enclosing the given region (see {@link BoundingVolumes}), computed on the
+ *  first request after an invalidation or a move of any vertex.
+ *
+ * @param region - The region to enclose
+ *
+ * @return The shapes enclosing the region
+ */
+const Aerodlyn::BoundingVolumes::Volumes &Aerodlyn::RegionGeometry::volumes (const QPolygonF &region)
+{
+    if (!volumesValid)
+    {
+        regionVolumes = BoundingVolumes::compute (region);
+        volumesValid  = true;
+    }
+
+    return regionVolumes;
+}
+
+/* Private Methods */
+/**
+ * Adds (or, with a sign of -1, removes) the contribution of the edge from a to b to the sums
+ *  the values are derived from.
+ *
+ * @param a    - The start of the edge
+ * @param b    - The end of the edge
+ * @param sign - 1 to add the edge, -1 to remove it
+ */
+void Aerodlyn::RegionGeometry::accumulateEdge (const QPointF &a, const QPointF &b, const double sign)
+{
+    const double cross = a.x () * b.y () - b.x () * a.y ();
+
+    crossSum     += sign * cross;
+    centroidSum  += sign * cross * (a + b);
+    perimeterSum += sign * std::hypot (b.x () - a.x (), b.y () - a.y ());
+}
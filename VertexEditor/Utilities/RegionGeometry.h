@@ -0,0 +1,164 @@
+#ifndef REGION_GEOMETRY_H
+#define REGION_GEOMETRY_H
+
+#include <algorithm>
+#include <cmath>
+
+#include <QPainterPath>
+#include <QPointF>
+#include <QPolygonF>
+#include <QRectF>
+
+#include "BoundingVolumes.h"
+#include "RegionSlabIndex.h"
+
+namespace Aerodlyn
+{
+    /**
+     * A cache of the geometry derived from a region (its bounding box, area, centroid, perimeter, winding
+     *  order, a path for painting it, slabs for point-in-polygon tests and the shapes enclosing it),
+     *  treating the region as a closed polygon. The values are computed on the first request after
+     *  an invalidation, and moving a single vertex updates them in constant time instead of
+     *  recomputing them.
+     *
+     * @author  Patrick Jahnig (Aerodlyn)
+     * @version 2026.10.19
+     */
+    class RegionGeometry
+    {
+        public: // Types
+            /**
+             * The order the vertices of a region go around it in, as seen on screen (where y points down).
+             *  Regions with less than three vertices or no area have no winding.
+             */
+            enum class Winding { None, Clockwise, CounterClockwise };
+
+        public: // Methods
+            /**
+             * Discards the cached values, so that they are recomputed on the next request.
+             */
+            void invalidate ();
+
+            /**
+             * Computes the cached values from the given region if they were invalidated since they were
+             *  last computed.
+             *
+             * @param region - The region the values are derived from
+             */
+            void update (const QPolygonF &region);
+
+            /**
+             * Updates the cached values after the vertex at the given index of the given region moved from
+             *  the given position, which is cheaper than recomputing them. Does nothing if the values
+             *  haven't been computed yet.
+             *
+             * @param region - The region, with the vertex already at its new position
+             * @param index  - The index of the vertex that moved
+             * @param from   - The position the vertex moved from
+             */
+            void moveVertex (const QPolygonF &region, const int index, const QPointF &from);
+
+            /**
+             * Returns the bounding box of the region. The region must have been given to {@link #update}.
+             *
+             * @return The bounding box of the region
+             */
+            QRectF bounds () const;
+
+            /**
+             * Returns the area enclosed by the region. The region must have been given to {@link #update}.
+             *
+             * @return The unsigned area of the region
+             */
+            double area () const;
+
+            /**
+             * Returns the centroid of the area enclosed by the region, or the average of its vertices if it
+             *  encloses no area. The region must have been given to {@link #update}.
+             *
+             * @return The centroid of the region
+             */
+            QPointF centroid () const;
+
+            /**
+             * Returns the length of the edges of the region, including the one closing it. The region must
+             *  have been given to {@link #update}.
+             *
+             * @return The perimeter of the region
+             */
+            double perimeter () const;
+
+            /**
+             * Returns the winding order of the region. The region must have been given to {@link #update}.
+             *
+             * @return The winding order of the region
+             */
+            Winding winding () const;
+
+            /**
+             * Returns a closed path through the vertices of the given region, built on the first request after
+             *  an invalidation.
+             *
+             * @param region - The region the path goes through
+             *
+             * @return The path of the region
+             */
+            const QPainterPath &path (const QPolygonF &region);
+
+            /**
+             * Returns the slabs that speed up point-in-polygon tests on the given region (see
+             *  {@link RegionSlabIndex}), built on the first request after an invalidation.
+             *
+             * @param region - The region the slabs are built from
+             *
+             * @return The slabs of the region
+             */
+            const RegionSlabIndex &slabs (const QPolygonF &region);
+
+            /**
+             * Returns the shapes enclosing the given region (see {@link BoundingVolumes}), computed on the
+             *  first request after an invalidation or a move of any vertex.
+             *
+             * @param region - The region to enclose
+             *
+             * @return The shapes enclosing the region
+             */
+            const BoundingVolumes::Volumes &volumes (const QPolygonF &region);
+
+        private: // Methods
+            /**
+             * Adds (or, with a sign of -1, removes) the contribution of the edge from a to b to the sums
+             *  the values are derived from.
+             *
+             * @param a    - The start of the edge
+             * @param b    - The end of the edge
+             * @param sign - 1 to add the edge, -1 to remove it
+             */
+            void accumulateEdge (const QPointF &a, const QPointF &b, const double sign);
+
+        private: // Variables
+            bool                pathValid    = false;
+            bool                valid        = false;
+            bool                volumesValid = false;
+
+            int                 count        = 0;
+
+            double              crossSum     = 0.0;
+            double              perimeterSum = 0.0;
+
+            QPointF             centroidSum;
+            QPointF             vertexSum;
+
+            QPainterPath        regionPath;
+
+            QRectF              boundingBox;
+
+            RegionSlabIndex     slabIndex;
+
+            BoundingVolumes::Volumes regionVolumes;
+
+            static constexpr double EPSILON  = 1e-9;
+    };
+}
+
+#endif // REGION_GEOMETRY_H
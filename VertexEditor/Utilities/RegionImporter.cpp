@@ -0,0 +1,1445 @@
+#include "RegionImporter.h"
+
+/**
+ * Imports regions from the polygon formats of other tools, as data sets ready to be added to a
+ *  {@link VertexDataSetCollection} in bulk (see {@link VertexDataSetCollection#insertAll}):
+ *
+ *  - PhysicsEditor and Box2D JSON: every array of points ({"x": 1, "y": 2} objects, or flat
+ *      x, y pairs of at least three points) and every pair of "x" and "y" arrays becomes a region.
+ *      A region is named after the "name" member of the nearest object holding it, or else the
+ *      nearest member name that isn't part of the format (such as a body under "bodies").
+ *  - Tiled maps and tilesets (TMX and TSX): every polygon, polyline, rectangle and ellipse object
+ *      becomes a region, named after the object, or else after its tile or its id. The objects of
+ *      a tile are placed on that tile in the image of its tileset.
+ *  - SVG: every path (each of its subpaths), polygon, polyline and rectangle becomes a region,
+ *      named after its id. Transforms are applied, and curves and arcs are flattened.
+ *
+ * Files are read in chunks as they are parsed, so memory holds the regions found rather than the
+ *  files themselves, and several files are read in parallel. Source coordinates are taken to be
+ *  image pixels, moved so that the given origin becomes the center of the image. Names lose their
+ *  whitespace like typed names do, and repeated names within a file are numbered ("Name_2").
+ *
+ * Errors carry the file and line they were found at. A file that can't be parsed adds no data
+ *  sets, while an element that can't be read (such as a malformed path) is skipped on its own.
+ *
+ * @author  Patrick Jahnig (Aerodlyn)
+ * @version 2026.10.19
+ */
+
+namespace
+{
+    /**
+     * Splits JSON read from a device into tokens, reading the device a chunk at a time. Strings are
+     *  unescaped into UTF-8, and left for the caller to decode only if it needs them.
+     */
+    class JsonTokenizer
+    {
+        public:
+            enum Token { BeginObject, EndObject, BeginArray, EndArray, Colon, Comma, String, Number, Literal, End, Invalid };
+
+            explicit JsonTokenizer (QIODevice &device) : device (device)
+                { buffer.reserve (CHUNK_SIZE); }
+
+            /**
+             * Reads the next token. The text of strings, numbers and literals is then in {@link #text}.
+             */
+            Token next ()
+            {
+                int c = get ();
+                while (c == ' ' || c == '\t' || c == '\r' || c == '\n')
+                {
+                    if (c == '\n')
+                        currentLine++;
+
+                    c = get ();
+                }
+
+                tokenLine = currentLine;
+
+                switch (c)
+                {
+                    case -1:  return End;
+                    case '{': return BeginObject;
+                    case '}': return EndObject;
+                    case '[': return BeginArray;
+                    case ']': return EndArray;
+                    case ':': return Colon;
+                    case ',': return Comma;
+                    case '"': return readString ();
+                }
+
+                if (c == '-' || (c >= '0' && c <= '9'))
+                    return readNumber (c);
+
+                if (c >= 'a' && c <= 'z')
+                    return readLiteral (c);
+
+                message = QString ("Unexpected character '%1'").arg (QChar (c));
+                return Invalid;
+            }
+
+            const QByteArray &text () const
+                { return value; }
+
+            double number () const
+                { return parsed; }
+
+            qint64 line () const
+                { return tokenLine; }
+
+            const QString &error () const
+                { return message; }
+
+        private:
+            int get ()
+            {
+                if (position == buffer.size () && !refill ())
+                    return -1;
+
+                return static_cast <unsigned char> (buffer.constData () [position++]);
+            }
+
+            int peek ()
+            {
+                if (position == buffer.size () && !refill ())
+                    return -1;
+
+                return static_cast <unsigned char> (buffer.constData () [position]);
+            }
+
+            bool refill ()
+            {
+                buffer.resize (CHUNK_SIZE);
+
+                const qint64 size = device.read (buffer.data (), CHUNK_SIZE);
+                buffer.resize (static_cast <int> (std::max <qint64> (size, 0)));
+                position = 0;
+
+                return !buffer.isEmpty ();
+            }
+
+            Token readString ()
+            {
+                value.clear ();
+
+                for (int c = get (); c != '"'; c = get ())
+                {
+                    if (c == -1 || c == '\n')
+                    {
+                        message = "Unterminated string";
+                        return Invalid;
+                    }
+
+                    if (c < 0x20)
+                    {
+                        message = "Unescaped control character in string";
+                        return Invalid;
+                    }
+
+                    if (c != '\\')
+                    {
+                        value.append (static_cast <char> (c));
+                        continue;
+                    }
+
+                    switch (c = get ())
+                    {
+                        case '"':
+                        case '\\':
+                        case '/': value.append (static_cast <char> (c)); break;
+                        case 'b': value.append ('\b'); break;
+                        case 'f': value.append ('\f'); break;
+                        case 'n': value.append ('\n'); break;
+                        case 'r': value.append ('\r'); break;
+                        case 't': value.append ('\t'); break;
+
+                        case 'u':
+                        {
+                            int unit = readHex ();
+                            QString units (QChar (static_cast <ushort> (unit)));
+
+                            // A surrogate pair is two escapes, which are decoded together
+                            if (unit >= 0 && QChar::isHighSurrogate (static_cast <uint> (unit)) && peek () == '\\')
+                            {
+                                get ();
+                                unit = get () == 'u' ? readHex () : -1;
+                                units.append (QChar (static_cast <ushort> (unit)));
+                            }
+
+                            if (unit < 0)
+                            {
+                                message = "Invalid escape in string";
+                                return Invalid;
+                            }
+
+                            value.append (units.toUtf8 ());
+                            break;
+                        }
+
+                        default:
+                            message = "Invalid escape in string";
+                            return Invalid;
+                    }
+                }
+
+                return String;
+            }
+
+            // The four digits of a \u escape, or -1 if they aren't hexadecimal
+            int readHex ()
+            {
+                int unit = 0;
+                for (int i = 0; i < 4; i++)
+                {
+                    const int c = get ();
+                    const int digit = c >= '0' && c <= '9' ? c - '0' : c >= 'a' && c <= 'f' ? c - 'a' + 10 :
+                                      c >= 'A' && c <= 'F' ? c - 'A' + 10 : -1;
+
+                    if (digit < 0)
+                        return -1;
+
+                    unit = unit * 16 + digit;
+                }
+
+                return unit;
+            }
+
+            Token readNumber (const int first)
+            {
+                value = QByteArray (1, static_cast <char> (first));
+
+                for (int c = peek (); (c >= '0' && c <= '9') || c == '.' || c == 'e' || c == 'E' || c == '+' || c == '-'; c = peek ())
+                    value.append (static_cast <char> (get ()));
+
+                bool ok = false;
+                parsed = value.toDouble (&ok);
+
+                if (!ok)
+                {
+                    message = QString ("Malformed number '%1'").arg (QString::fromLatin1 (value));
+                    return Invalid;
+                }
+
+                return Number;
+            }
+
+            Token readLiteral (const int first)
+            {
+                value = QByteArray (1, static_cast <char> (first));
+
+                for (int c = peek (); c >= 'a' && c <= 'z'; c = peek ())
+                    value.append (static_cast <char> (get ()));
+
+                if (value != "true" && value != "false" && value != "null")
+                {
+                    message = QString ("Unexpected '%1'").arg (QString::fromLatin1 (value));
+                    return Invalid;
+                }
+
+                return Literal;
+            }
+
+            static constexpr int CHUNK_SIZE = 64 * 1024;
+
+            QIODevice  &device;
+
+            QByteArray buffer;
+            QByteArray value;
+
+            int        position    = 0;
+
+            qint64     currentLine = 1;
+            qint64     tokenLine   = 1;
+
+            double     parsed      = 0.0;
+
+            QString    message;
+    };
+
+    /**
+     * An object or array being read from JSON, with what is known so far about the regions in it.
+     */
+    struct JsonFrame
+    {
+        bool             object   = false;
+
+        // Objects: the name of the current member, and the members that can make up points and regions
+        QByteArray       key;
+        QString          name;
+
+        bool             hasX     = false;
+        bool             hasY     = false;
+        bool             hasXs    = false;
+        bool             hasYs    = false;
+
+        double           x        = 0.0;
+        double           y        = 0.0;
+
+        QVector <double> xs;
+        QVector <double> ys;
+
+        // Arrays: how many elements were read, and how many of them were points or numbers. The points
+        //  and numbers are only kept while every element so far was one
+        int              elements = 0;
+        int              points   = 0;
+        int              numbers  = 0;
+
+        QPolygonF        polygon;
+
+        QVector <double> values;
+
+        // The regions found within that aren't named yet, as indices into the result
+        QVector <int>    unnamed;
+    };
+
+    /**
+     * Determines if the given JSON member name is part of a format, rather than the name of a body.
+     */
+    bool isFormatKey (const QByteArray &key)
+    {
+        return key == "bodies" || key == "body" || key == "fixtures" || key == "fixture" || key == "polygons"
+            || key == "polygon" || key == "shape" || key == "shapes" || key == "vertices" || key == "hull"
+            || key == "points" || key == "chain" || key == "data" || key == "x" || key == "y";
+    }
+
+    /**
+     * Reads the numbers, flags, commands and punctuation of SVG path data, point lists and
+     *  transform lists.
+     */
+    class PathScanner
+    {
+        public:
+            explicit PathScanner (const QString &text) : text (text) {}
+
+            bool atEnd ()
+            {
+                skipSeparators ();
+                return position >= text.size ();
+            }
+
+            bool atCommand ()
+            {
+                skipSeparators ();
+                return position < text.size () && text.at (position).isLetter () && text.at (position) != 'e'
+                    && text.at (position) != 'E';
+            }
+
+            QChar take ()
+                { return text.at (position++); }
+
+            bool take (const QChar expected)
+            {
+                skipSeparators ();
+                if (position >= text.size () || text.at (position) != expected)
+                    return false;
+
+                position++;
+                return true;
+            }
+
+            QString identifier ()
+            {
+                skipSeparators ();
+
+                const int start = position;
+                while (position < text.size () && text.at (position).isLetter ())
+                    position++;
+
+                return text.mid (start, position - start);
+            }
+
+            bool number (double &value)
+            {
+                skipSeparators ();
+
+                const int start = position;
+                if (position < text.size () && (text.at (position) == '+' || text.at (position) == '-'))
+                    position++;
+
+                const int digits = skipDigits () + (position < text.size () && text.at (position) == '.' ? (position++, skipDigits ()) : 0);
+                if (digits == 0)
+                {
+                    position = start;
+                    return false;
+                }
+
+                // An exponent needs digits, otherwise the 'e' is left for whatever follows
+                if (position < text.size () && (text.at (position) == 'e' || text.at (position) == 'E'))
+                {
+                    const int exponent = position++;
+                    if (position < text.size () && (text.at (position) == '+' || text.at (position) == '-'))
+                        position++;
+
+                    if (skipDigits () == 0)
+                        position = exponent;
+                }
+
+                bool ok = false;
+                value = text.midRef (start, position - start).toDouble (&ok);
+
+                return ok;
+            }
+
+            // Arc flags may be written without separators ("a5 5 0 105 5"), so they are read one digit at a time
+            bool flag (bool &value)
+            {
+                skipSeparators ();
+                if (position >= text.size () || (text.at (position) != '0' && text.at (position) != '1'))
+                    return false;
+
+                value = text.at (position++) == '1';
+                return true;
+            }
+
+        private:
+            void skipSeparators ()
+            {
+                while (position < text.size () && (text.at (position).isSpace () || text.at (position) == ','))
+                    position++;
+            }
+
+            int skipDigits ()
+            {
+                const int start = position;
+                while (position < text.size () && text.at (position).isDigit ())
+                    position++;
+
+                return position - start;
+            }
+
+            const QString &text;
+
+            int           position = 0;
+    };
+
+    /**
+     * Appends a cubic Bézier curve from the given start point, flattened into the given number of lines.
+     */
+    void appendCubic (QPolygonF &polygon, const QPointF &from, const QPointF &control1, const QPointF &control2,
+        const QPointF &to, const int segments)
+    {
+        for (int i = 1; i <= segments; i++)
+        {
+            const double t = static_cast <double> (i) / segments, u = 1.0 - t;
+            polygon.append (u * u * u * from + 3.0 * u * u * t * control1 + 3.0 * u * t * t * control2 + t * t * t * to);
+        }
+    }
+
+    /**
+     * Appends a quadratic Bézier curve from the given start point, flattened into the given number of
+     *  lines.
+     */
+    void appendQuadratic (QPolygonF &polygon, const QPointF &from, const QPointF &control, const QPointF &to,
+        const int segments)
+    {
+        for (int i = 1; i <= segments; i++)
+        {
+            const double t = static_cast <double> (i) / segments, u = 1.0 - t;
+            polygon.append (u * u * from + 2.0 * u * t * control + t * t * to);
+        }
+    }
+
+    /**
+     * Appends an SVG elliptical arc from the given start point, flattened into lines, by converting it
+     *  from endpoints to a center as the SVG specification does (appendix F.6.5).
+     */
+    void appendArc (QPolygonF &polygon, const QPointF &from, double rx, double ry, const double angle,
+        const bool largeArc, const bool sweep, const QPointF &to, const int turnSegments)
+    {
+        rx = std::abs (rx);
+        ry = std::abs (ry);
+
+        if (from == to)
+            return;
+
+        if (rx == 0.0 || ry == 0.0)
+        {
+            polygon.append (to);
+            return;
+        }
+
+        const double phi = qDegreesToRadians (angle), cosPhi = std::cos (phi), sinPhi = std::sin (phi);
+        const double dx = (from.x () - to.x ()) / 2.0, dy = (from.y () - to.y ()) / 2.0;
+        const double x1 = cosPhi * dx + sinPhi * dy, y1 = -sinPhi * dx + cosPhi * dy;
+
+        // Radii too small to reach the end point are scaled up until they just do
+        const double lambda = (x1 * x1) / (rx * rx) + (y1 * y1) / (ry * ry);
+        if (lambda > 1.0)
+        {
+            rx *= std::sqrt (lambda);
+            ry *= std::sqrt (lambda);
+        }
+
+        const double numerator   = rx * rx * ry * ry - rx * rx * y1 * y1 - ry * ry * x1 * x1;
+        const double denominator = rx * rx * y1 * y1 + ry * ry * x1 * x1;
+        const double coefficient = (largeArc == sweep ? -1.0 : 1.0) * std::sqrt (std::max (0.0, numerator / denominator));
+
+        const double cx1 = coefficient * rx * y1 / ry, cy1 = -coefficient * ry * x1 / rx;
+        const double cx = cosPhi * cx1 - sinPhi * cy1 + (from.x () + to.x ()) / 2.0;
+        const double cy = sinPhi * cx1 + cosPhi * cy1 + (from.y () + to.y ()) / 2.0;
+
+        const double start = std::atan2 ((y1 - cy1) / ry, (x1 - cx1) / rx);
+        double delta = std::atan2 ((-y1 - cy1) / ry, (-x1 - cx1) / rx) - start;
+
+        if (!sweep && delta > 0.0)
+            delta -= 2.0 * M_PI;
+
+        else if (sweep && delta < 0.0)
+            delta += 2.0 * M_PI;
+
+        const int segments = std::max (1, static_cast <int> (std::ceil (std::abs (delta) / (2.0 * M_PI) * turnSegments)));
+        for (int i = 1; i < segments; i++)
+        {
+            const double theta = start + delta * i / segments;
+            polygon.append (QPointF (cx + rx * std::cos (theta) * cosPhi - ry * std::sin (theta) * sinPhi,
+                                     cy + rx * std::cos (theta) * sinPhi + ry * std::sin (theta) * cosPhi));
+        }
+
+        polygon.append (to);
+    }
+}
+
+/* Public Methods */
+/**
+ * Returns the error as "file:line: message", the way compilers report them.
+ *
+ * @return The error as text
+ */
+QString Aerodlyn::RegionImporter::Error::toString () const
+{
+    if (line > 0)
+        return QString ("%1:%2: %3").arg (filepath).arg (line).arg (message);
+
+    return QString ("%1: %2").arg (filepath, message);
+}
+
+/**
+ * Returns the format of the file at the given filepath, going by its suffix.
+ *
+ * @param filepath - The path of the file
+ *
+ * @return The format of the file, or UnknownFormat if it isn't one that can be imported
+ */
+Aerodlyn::RegionImporter::Format Aerodlyn::RegionImporter::formatOf (const QString &filepath)
+{
+    const QString suffix = QFileInfo (filepath).suffix ().toLower ();
+
+    if (suffix == "json")
+        return Box2DJson;
+
+    if (suffix == "tmx" || suffix == "tsx")
+        return TiledMap;
+
+    if (suffix == "svg")
+        return Svg;
+
+    return UnknownFormat;
+}
+
+/**
+ * Imports the regions of the file at the given filepath.
+ *
+ * @param filepath - The path of the file to import
+ * @param origin   - The point in source coordinates that becomes the center of the image
+ *
+ * @return The data sets imported, and the errors found
+ */
+Aerodlyn::RegionImporter::Result Aerodlyn::RegionImporter::read (const QString &filepath, const QPointF &origin)
+{
+    AERO_PROFILE_SCOPE ("RegionImporter::read");
+
+    Result result;
+
+    const Format format = formatOf (filepath);
+    if (format == UnknownFormat)
+    {
+        result.errors.append ({ filepath, 0, "Not a PhysicsEditor, Box2D, Tiled or SVG file" });
+        return result;
+    }
+
+    QFile file (filepath);
+    if (!file.open (QIODevice::ReadOnly))
+    {
+        result.errors.append ({ filepath, 0, QString ("Couldn't be read (%1)").arg (file.errorString ()) });
+        return result;
+    }
+
+    const bool parsed = format == Box2DJson ? readJson (file, filepath, origin, result) :
+                        format == TiledMap  ? readTiled (file, filepath, origin, result) :
+                                              readSvg (file, filepath, origin, result);
+
+    // Half a file would be harder to notice and fix than none of it
+    if (!parsed)
+        result.dataSets.clear ();
+
+    else
+        numberRepeatedNames (result);
+
+    return result;
+}
+
+/**
+ * Imports the regions of every file at the given filepaths, reading the files in parallel.
+ *
+ * @param filepaths - The paths of the files to import
+ * @param origin    - The point in source coordinates that becomes the center of the image
+ *
+ * @return The data sets imported, in the order of the files, and the errors found
+ */
+Aerodlyn::RegionImporter::Result Aerodlyn::RegionImporter::readAll (const QStringList &filepaths, const QPointF &origin)
+{
+    AERO_PROFILE_SCOPE ("RegionImporter::readAll");
+
+    QVector <Result> results (filepaths.size ());
+    QVector <int> indices (filepaths.size ());
+    std::iota (indices.begin (), indices.end (), 0);
+
+    // Every task writes to its own element, so the vector is never detached or resized concurrently
+    Result *imported = results.data ();
+    QtConcurrent::blockingMap (indices, [&] (const int &index)
+        { imported [index] = read (filepaths.at (index), origin); });
+
+    int count = 0;
+    for (const Result &result : results)
+        count += result.dataSets.size ();
+
+    Result all;
+    all.dataSets.reserve (count);
+
+    for (const Result &result : results)
+    {
+        all.dataSets += result.dataSets;
+        all.errors   += result.errors;
+    }
+
+    return all;
+}
+
+/* Private Methods */
+/**
+ * Imports the regions of the given PhysicsEditor or Box2D JSON file.
+ *
+ * @param device   - The opened file
+ * @param filepath - The path of the file, for errors
+ * @param origin   - The point in source coordinates that becomes the center of the image
+ * @param result   - Where the data sets and errors are added
+ *
+ * @return True if the file was parsed, false if it is malformed
+ */
+bool Aerodlyn::RegionImporter::readJson (QIODevice &device, const QString &filepath, const QPointF &origin,
+    Result &result)
+{
+    AERO_PROFILE_SCOPE ("RegionImporter::readJson");
+
+    enum Expect { Value, ValueOrEnd, Key, KeyOrEnd, Colon, CommaOrEnd, Done };
+
+    JsonTokenizer tokenizer (device);
+
+    // Only the objects and arrays enclosing the current token are kept, never the whole document
+    QVector <JsonFrame> stack;
+    QVector <int> unnamed;
+
+    const auto fail = [&] (const QString &message)
+    {
+        result.errors.append ({ filepath, tokenizer.line (), message });
+        return false;
+    };
+
+    const auto addRegion = [&] (QPolygonF polygon, QVector <int> &pending)
+    {
+        if (polygon.size () < 3)
+            return;
+
+        polygon.translate (-origin);
+
+        pending.append (result.dataSets.size ());
+        result.dataSets.append ({ QString (), std::move (polygon) });
+    };
+
+    const auto nameRegions = [&] (QVector <int> &pending, const QString &name)
+    {
+        const QString cleaned = cleanName (name);
+        for (const int index : pending)
+            result.dataSets [index].name = cleaned;
+
+        pending.clear ();
+    };
+
+    // Regions found within a closed object or array are named by it, or left for the ones around it
+    const auto close = [&] ()
+    {
+        JsonFrame child = std::move (stack.last ());
+        stack.removeLast ();
+
+        JsonFrame *parent = stack.isEmpty () ? nullptr : &stack.last ();
+        bool point = false;
+
+        if (child.object)
+        {
+            if (child.hasXs && child.hasYs && child.xs.size () == child.ys.size ())
+            {
+                QPolygonF polygon;
+                polygon.reserve (child.xs.size ());
+
+                for (int i = 0; i < child.xs.size (); i++)
+                    polygon.append (QPointF (child.xs.at (i), child.ys.at (i)));
+
+                addRegion (std::move (polygon), child.unnamed);
+            }
+
+            if (!child.name.isEmpty ())
+                nameRegions (child.unnamed, child.name);
+
+            point = child.hasX && child.hasY;
+        }
+
+        else if (child.elements >= 3 && child.points == child.elements)
+            addRegion (std::move (child.polygon), child.unnamed);
+
+        else if (child.elements > 0 && child.numbers == child.elements)
+        {
+            if (parent != nullptr && parent->object && (parent->key == "x" || parent->key == "y"))
+            {
+                (parent->key == "x" ? parent->xs : parent->ys) = std::move (child.values);
+                (parent->key == "x" ? parent->hasXs : parent->hasYs) = true;
+            }
+
+            else if (child.elements % 2 == 0)
+            {
+                QPolygonF polygon;
+                polygon.reserve (child.elements / 2);
+
+                for (int i = 0; i + 1 < child.values.size (); i += 2)
+                    polygon.append (QPointF (child.values.at (i), child.values.at (i + 1)));
+
+                addRegion (std::move (polygon), child.unnamed);
+            }
+        }
+
+        if (parent == nullptr)
+        {
+            unnamed += child.unnamed;
+            return;
+        }
+
+        if (!parent->object)
+        {
+            if (point && parent->points == parent->elements - 1)
+            {
+                parent->points++;
+                parent->polygon.append (QPointF (child.x, child.y));
+            }
+
+            else
+                parent->polygon.clear ();
+
+            parent->values.clear ();
+        }
+
+        if (parent->object && !parent->key.isEmpty () && !isFormatKey (parent->key))
+            nameRegions (child.unnamed, QString::fromUtf8 (parent->key));
+
+        else
+            parent->unnamed += child.unnamed;
+    };
+
+    Expect expect = Value;
+    while (expect != Done)
+    {
+        const JsonTokenizer::Token token = tokenizer.next ();
+
+        if (token == JsonTokenizer::Invalid)
+            return fail (tokenizer.error ());
+
+        if (token == JsonTokenizer::End)
+            return fail ("Unexpected end of file");
+
+        switch (expect)
+        {
+            case Value:
+            case ValueOrEnd:
+                if (token == JsonTokenizer::EndArray && expect == ValueOrEnd)
+                    close ();
+
+                else if (token == JsonTokenizer::BeginObject || token == JsonTokenizer::BeginArray)
+                {
+                    if (!stack.isEmpty () && !stack.last ().object)
+                        stack.last ().elements++;
+
+                    stack.append (JsonFrame ());
+                    stack.last ().object = token == JsonTokenizer::BeginObject;
+
+                    expect = stack.last ().object ? KeyOrEnd : ValueOrEnd;
+                    continue;
+                }
+
+                else if (token == JsonTokenizer::String || token == JsonTokenizer::Number || token == JsonTokenizer::Literal)
+                {
+                    if (!stack.isEmpty () && stack.last ().object)
+                    {
+                        JsonFrame &top = stack.last ();
+
+                        if (token == JsonTokenizer::Number && top.key == "x")
+                        {
+                            top.x    = tokenizer.number ();
+                            top.hasX = true;
+                        }
+
+                        else if (token == JsonTokenizer::Number && top.key == "y")
+                        {
+                            top.y    = tokenizer.number ();
+                            top.hasY = true;
+                        }
+
+                        else if (token == JsonTokenizer::String && top.key == "name")
+                            top.name = QString::fromUtf8 (tokenizer.text ());
+                    }
+
+                    else if (!stack.isEmpty ())
+                    {
+                        JsonFrame &top = stack.last ();
+
+                        if (token == JsonTokenizer::Number && top.numbers == top.elements)
+                        {
+                            top.numbers++;
+                            top.values.append (tokenizer.number ());
+                        }
+
+                        else
+                            top.values.clear ();
+
+                        top.elements++;
+                        top.polygon.clear ();
+                    }
+                }
+
+                else
+                    return fail ("Expected a value");
+
+                expect = stack.isEmpty () ? Done : CommaOrEnd;
+                break;
+
+            case Key:
+            case KeyOrEnd:
+                if (token == JsonTokenizer::EndObject && expect == KeyOrEnd)
+                {
+                    close ();
+                    expect = stack.isEmpty () ? Done : CommaOrEnd;
+                }
+
+                else if (token == JsonTokenizer::String)
+                {
+                    stack.last ().key = tokenizer.text ();
+                    expect = Colon;
+                }
+
+                else
+                    return fail ("Expected a member name");
+
+                break;
+
+            case Colon:
+                if (token != JsonTokenizer::Colon)
+                    return fail ("Expected ':'");
+
+                expect = Value;
+                break;
+
+            case CommaOrEnd:
+                if (token == JsonTokenizer::Comma)
+                    expect = stack.last ().object ? Key : Value;
+
+                else if ((token == JsonTokenizer::EndObject && stack.last ().object)
+                    || (token == JsonTokenizer::EndArray && !stack.last ().object))
+                {
+                    close ();
+                    expect = stack.isEmpty () ? Done : CommaOrEnd;
+                }
+
+                else
+                    return fail (stack.last ().object ? "Expected ',' or '}'" : "Expected ',' or ']'");
+
+                break;
+
+            case Done:
+                break;
+        }
+    }
+
+    if (tokenizer.next () != JsonTokenizer::End)
+        return fail ("Unexpected data after the end of the document");
+
+    // Regions nothing named are named after the file
+    nameRegions (unnamed, QFileInfo (filepath).completeBaseName ());
+    return true;
+}
+
+/**
+ * Imports the regions of the objects of the given Tiled map or tileset.
+ *
+ * @param device   - The opened file
+ * @param filepath - The path of the file, for errors
+ * @param origin   - The point in source coordinates that becomes the center of the image
+ * @param result   - Where the data sets and errors are added
+ *
+ * @return True if the file was parsed, false if it is malformed
+ */
+bool Aerodlyn::RegionImporter::readTiled (QIODevice &device, const QString &filepath, const QPointF &origin,
+    Result &result)
+{
+    AERO_PROFILE_SCOPE ("RegionImporter::readTiled");
+
+    enum Shape { Rectangle, Ellipse, Points, NoShape };
+
+    QXmlStreamReader xml (&device);
+
+    // Layers and groups may be offset, and nest. The objects of a tile are placed on its tile in the
+    //  image of the tileset, which is laid out as a grid
+    QVector <QPointF> offsets = { QPointF () };
+
+    QSizeF tileSize;
+    int columns = 0, margin = 0, spacing = 0;
+
+    QString tileName, objectName;
+    QPointF position;
+    QSizeF size;
+    QPolygonF points;
+
+    double rotation = 0.0;
+    Shape shape = NoShape;
+    bool inObject = false;
+
+    while (!xml.atEnd ())
+    {
+        xml.readNext ();
+
+        if (xml.isStartElement ())
+        {
+            const QXmlStreamAttributes attributes = xml.attributes ();
+            const QStringRef name = xml.name ();
+
+            if (name == "tileset")
+            {
+                tileSize = QSizeF (attributes.value ("tilewidth").toDouble (), attributes.value ("tileheight").toDouble ());
+                columns  = attributes.value ("columns").toInt ();
+                margin   = attributes.value ("margin").toInt ();
+                spacing  = attributes.value ("spacing").toInt ();
+            }
+
+            // Tilesets older than the columns attribute only give the width of their image. A tileset
+            //  of separate images (no columns) has its objects placed on the image of their tile
+            else if (name == "image" && tileName.isEmpty () && columns == 0 && tileSize.width () > 0.0)
+            {
+                const int width = attributes.value ("width").toInt ();
+                columns = static_cast <int> ((width - 2 * margin + spacing) / (tileSize.width () + spacing));
+            }
+
+            else if (name == "tile")
+            {
+                tileName = QString ("tile%1").arg (attributes.value ("id").toString ());
+
+                const int id = attributes.value ("id").toInt ();
+                const QPointF tile = columns <= 0 ? QPointF () : QPointF (margin + id % columns * (tileSize.width () + spacing),
+                                                                          margin + id / columns * (tileSize.height () + spacing));
+                offsets.append (offsets.last () + tile);
+            }
+
+            else if (name == "objectgroup" || name == "group")
+            {
+                offsets.append (offsets.last () + QPointF (attributes.value ("offsetx").toDouble (),
+                                                           attributes.value ("offsety").toDouble ()));
+            }
+
+            else if (name == "object")
+            {
+                inObject   = true;
+                objectName = attributes.value ("name").toString ();
+                position   = QPointF (attributes.value ("x").toDouble (), attributes.value ("y").toDouble ()) + offsets.last ();
+                size       = QSizeF (attributes.value ("width").toDouble (), attributes.value ("height").toDouble ());
+                rotation   = attributes.value ("rotation").toDouble ();
+
+                // Tile objects show an image rather than a shape
+                shape = attributes.hasAttribute ("gid") ? NoShape : Rectangle;
+
+                if (objectName.isEmpty ())
+                    objectName = tileName.isEmpty () ? QString ("object%1").arg (attributes.value ("id").toString ()) : tileName;
+            }
+
+            else if (inObject && (name == "polygon" || name == "polyline"))
+            {
+                points = parsePoints (attributes.value ("points").toString ());
+                shape  = Points;
+
+                if (points.isEmpty ())
+                {
+                    result.errors.append ({ filepath, xml.lineNumber (), QString ("Malformed points of '%1'").arg (objectName) });
+                    shape = NoShape;
+                }
+            }
+
+            else if (inObject && name == "ellipse")
+                shape = Ellipse;
+
+            else if (inObject && (name == "point" || name == "text"))
+                shape = NoShape;
+        }
+
+        else if (xml.isEndElement ())
+        {
+            const QStringRef name = xml.name ();
+
+            if (name == "tileset")
+            {
+                tileSize = QSizeF ();
+                columns  = margin = spacing = 0;
+            }
+
+            else if (name == "tile" && offsets.size () > 1)
+            {
+                tileName.clear ();
+                offsets.removeLast ();
+            }
+
+            else if ((name == "objectgroup" || name == "group") && offsets.size () > 1)
+                offsets.removeLast ();
+
+            else if (name == "object")
+            {
+                QPolygonF polygon;
+
+                if (shape == Points)
+                    polygon = points;
+
+                else if (shape == Rectangle && size.width () > 0.0 && size.height () > 0.0)
+                    polygon = QPolygonF (QRectF (QPointF (), size)).mid (0, 4);
+
+                else if (shape == Ellipse && size.width () > 0.0 && size.height () > 0.0)
+                {
+                    for (int i = 0; i < TURN_SEGMENTS; i++)
+                    {
+                        const double angle = 2.0 * M_PI * i / TURN_SEGMENTS;
+                        polygon.append (QPointF (size.width () / 2.0 * (1.0 + std::cos (angle)),
+                                                 size.height () / 2.0 * (1.0 + std::sin (angle))));
+                    }
+                }
+
+                // Objects are rotated clockwise (in degrees) around their position
+                if (polygon.size () >= 3)
+                {
+                    QTransform transform;
+                    transform.translate (position.x () - origin.x (), position.y () - origin.y ());
+                    transform.rotate (rotation);
+
+                    result.dataSets.append ({ cleanName (objectName), transform.map (polygon) });
+                }
+
+                inObject = false;
+            }
+        }
+    }
+
+    if (xml.hasError ())
+    {
+        result.errors.append ({ filepath, xml.lineNumber (), xml.errorString () });
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * Imports the regions of the shapes of the given SVG file.
+ *
+ * @param device   - The opened file
+ * @param filepath - The path of the file, for errors
+ * @param origin   - The point in source coordinates that becomes the center of the image
+ * @param result   - Where the data sets and errors are added
+ *
+ * @return True if the file was parsed, false if it is malformed
+ */
+bool Aerodlyn::RegionImporter::readSvg (QIODevice &device, const QString &filepath, const QPointF &origin,
+    Result &result)
+{
+    AERO_PROFILE_SCOPE ("RegionImporter::readSvg");
+
+    QXmlStreamReader xml (&device);
+
+    // The transform of every open element, combined with the ones of the elements around it
+    QVector <QTransform> transforms = { QTransform::fromTranslate (-origin.x (), -origin.y ()) };
+    int unnamedShapes = 0;
+
+    while (!xml.atEnd ())
+    {
+        xml.readNext ();
+
+        if (xml.isEndElement ())
+        {
+            transforms.removeLast ();
+            continue;
+        }
+
+        if (!xml.isStartElement ())
+            continue;
+
+        const QStringRef name = xml.name ();
+
+        // Definitions are only drawn where they are used, so they aren't regions of their own
+        if (name == "defs" || name == "clipPath" || name == "mask" || name == "symbol" || name == "pattern"
+            || name == "marker")
+        {
+            xml.skipCurrentElement ();
+            continue;
+        }
+
+        const QXmlStreamAttributes attributes = xml.attributes ();
+
+        bool ok = true;
+        const QTransform own = attributes.hasAttribute ("transform") ?
+            parseTransform (attributes.value ("transform").toString (), ok) : QTransform ();
+
+        if (!ok)
+            result.errors.append ({ filepath, xml.lineNumber (), "Malformed transform, ignored" });
+
+        transforms.append (own * transforms.last ());
+
+        QVector <QPolygonF> polygons;
+        QString error;
+
+        if (name == "path")
+            error = parsePathData (attributes.value ("d").toString (), polygons);
+
+        else if (name == "polygon" || name == "polyline")
+        {
+            polygons.append (parsePoints (attributes.value ("points").toString ()));
+            if (polygons.last ().isEmpty ())
+                error = "Malformed points";
+        }
+
+        else if (name == "rect")
+        {
+            const QRectF rect (attributes.value ("x").toDouble (), attributes.value ("y").toDouble (),
+                attributes.value ("width").toDouble (), attributes.value ("height").toDouble ());
+
+            if (!rect.isEmpty ())
+                polygons.append (QPolygonF (rect).mid (0, 4));
+        }
+
+        else
+            continue;
+
+        QString id = cleanName (attributes.value ("id").toString ());
+        if (id.isEmpty ())
+            id = QString ("%1%2").arg (name.toString ()).arg (++unnamedShapes);
+
+        if (!error.isEmpty ())
+        {
+            result.errors.append ({ filepath, xml.lineNumber (), QString ("%1 in '%2', skipped").arg (error, id) });
+            continue;
+        }
+
+        for (const QPolygonF &polygon : polygons)
+        {
+            if (polygon.size () >= 3)
+                result.dataSets.append ({ id, transforms.last ().map (polygon) });
+        }
+    }
+
+    if (xml.hasError ())
+    {
+        result.errors.append ({ filepath, xml.lineNumber (), xml.errorString () });
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * Parses the given SVG path data into one polygon per subpath, flattening curves and arcs.
+ *
+ * @param data     - The path data, as in the "d" attribute of a path
+ * @param polygons - Where the polygons are added
+ *
+ * @return An empty string if the path data was parsed, or what is wrong with it otherwise
+ */
+QString Aerodlyn::RegionImporter::parsePathData (const QString &data, QVector <QPolygonF> &polygons)
+{
+    PathScanner scanner (data);
+
+    QPolygonF subpath;
+    QPointF current, start, control;
+    QChar command;
+    char previous = 0;
+
+    // Regions are closed anyway, so a subpath ending where it started loses its last point
+    const auto finishSubpath = [&] ()
+    {
+        if (subpath.size () > 1 && subpath.first () == subpath.last ())
+            subpath.removeLast ();
+
+        if (subpath.size () >= 3)
+            polygons.append (subpath);
+
+        subpath.clear ();
+    };
+
+    while (!scanner.atEnd ())
+    {
+        if (scanner.atCommand ())
+            command = scanner.take ();
+
+        else if (command.isNull ())
+            return "Path data doesn't start with a command";
+
+        else if (command.toUpper () == 'Z')
+            return "Expected a command after 'Z'";
+
+        // Coordinates repeated after a move are lines
+        else if (command == 'M')
+            command = 'L';
+
+        else if (command == 'm')
+            command = 'l';
+
+        const QPointF base = command.isLower () ? current : QPointF ();
+        const char type = command.toUpper ().toLatin1 ();
+
+        double x1 = 0.0, y1 = 0.0, x2 = 0.0, y2 = 0.0, x = 0.0, y = 0.0, rx = 0.0, ry = 0.0, angle = 0.0;
+        bool largeArc = false, sweep = false;
+
+        switch (type)
+        {
+            case 'M':
+                if (!scanner.number (x) || !scanner.number (y))
+                    return "Expected a point after 'M'";
+
+                finishSubpath ();
+                current = start = base + QPointF (x, y);
+                subpath.append (current);
+                break;
+
+            case 'L':
+                if (!scanner.number (x) || !scanner.number (y))
+                    return "Expected a point after 'L'";
+
+                current = base + QPointF (x, y);
+                subpath.append (current);
+                break;
+
+            case 'H':
+                if (!scanner.number (x))
+                    return "Expected a coordinate after 'H'";
+
+                current.setX (base.x () + x);
+                subpath.append (current);
+                break;
+
+            case 'V':
+                if (!scanner.number (y))
+                    return "Expected a coordinate after 'V'";
+
+                current.setY (base.y () + y);
+                subpath.append (current);
+                break;
+
+            case 'C':
+            case 'S':
+                if (type == 'C' && (!scanner.number (x1) || !scanner.number (y1)))
+                    return "Expected a control point after 'C'";
+
+                if (!scanner.number (x2) || !scanner.number (y2) || !scanner.number (x) || !scanner.number (y))
+                    return QString ("Expected points after '%1'").arg (type);
+
+                {
+                    // A smooth curve mirrors the last control point of the curve before it, if any
+                    const QPointF control1 = type == 'C' ? base + QPointF (x1, y1) :
+                        previous == 'C' || previous == 'S' ? 2.0 * current - control : current;
+
+                    control = base + QPointF (x2, y2);
+                    appendCubic (subpath, current, control1, control, base + QPointF (x, y), CURVE_SEGMENTS);
+                    current = base + QPointF (x, y);
+                }
+                break;
+
+            case 'Q':
+            case 'T':
+                if (type == 'Q' && (!scanner.number (x1) || !scanner.number (y1)))
+                    return "Expected a control point after 'Q'";
+
+                if (!scanner.number (x) || !scanner.number (y))
+                    return QString ("Expected a point after '%1'").arg (type);
+
+                control = type == 'Q' ? base + QPointF (x1, y1) :
+                    previous == 'Q' || previous == 'T' ? 2.0 * current - control : current;
+
+                appendQuadratic (subpath, current, control, base + QPointF (x, y), CURVE_SEGMENTS);
+                current = base + QPointF (x, y);
+                break;
+
+            case 'A':
+                if (!scanner.number (rx) || !scanner.number (ry) || !scanner.number (angle) || !scanner.flag (largeArc)
+                    || !scanner.flag (sweep) || !scanner.number (x) || !scanner.number (y))
+                    return "Expected an arc after 'A'";
+
+                appendArc (subpath, current, rx, ry, angle, largeArc, sweep, base + QPointF (x, y), TURN_SEGMENTS);
+                current = base + QPointF (x, y);
+                break;
+
+            case 'Z':
+                finishSubpath ();
+
+                // Anything but a move after closing starts from where the subpath started
+                current = start;
+                subpath.append (current);
+                break;
+
+            default:
+                return QString ("Unsupported path command '%1'").arg (command);
+        }
+
+        previous = type;
+    }
+
+    finishSubpath ();
+    return QString ();
+}
+
+/**
+ * Parses a list of points, as in the "points" attribute of SVG polygons or Tiled polygon
+ *  objects: coordinates separated by commas or whitespace.
+ *
+ * @param points - The list of points
+ *
+ * @return The points, or an empty polygon if the list is malformed
+ */
+QPolygonF Aerodlyn::RegionImporter::parsePoints (const QString &points)
+{
+    PathScanner scanner (points);
+    QPolygonF polygon;
+
+    while (!scanner.atEnd ())
+    {
+        double x, y;
+        if (!scanner.number (x) || !scanner.number (y))
+            return QPolygonF ();
+
+        polygon.append (QPointF (x, y));
+    }
+
+    return polygon;
+}
+
+/**
+ * Parses an SVG transform list, as in the "transform" attribute.
+ *
+ * @param transform - The transform list
+ * @param ok        - Set to false if the transform list is malformed
+ *
+ * @return The transform, applied right to left as SVG does
+ */
+QTransform Aerodlyn::RegionImporter::parseTransform (const QString &transform, bool &ok)
+{
+    PathScanner scanner (transform);
+    QTransform result;
+
+    ok = false;
+    while (!scanner.atEnd ())
+    {
+        const QString function = scanner.identifier ();
+        if (!scanner.take ('('))
+            return QTransform ();
+
+        QVector <double> arguments;
+        for (double value; scanner.number (value);)
+            arguments.append (value);
+
+        if (!scanner.take (')'))
+            return QTransform ();
+
+        const int count = arguments.size ();
+        QTransform item;
+
+        if (function == "matrix" && count == 6)
+            item = QTransform (arguments [0], arguments [1], arguments [2], arguments [3], arguments [4], arguments [5]);
+
+        else if (function == "translate" && (count == 1 || count == 2))
+            item = QTransform::fromTranslate (arguments [0], count == 2 ? arguments [1] : 0.0);
+
+        else if (function == "scale" && (count == 1 || count == 2))
+            item = QTransform::fromScale (arguments [0], count == 2 ? arguments [1] : arguments [0]);
+
+        else if (function == "rotate" && (count == 1 || count == 3))
+        {
+            const QPointF pivot = count == 3 ? QPointF (arguments [1], arguments [2]) : QPointF ();
+            item.translate (pivot.x (), pivot.y ()).rotate (arguments [0]).translate (-pivot.x (), -pivot.y ());
+        }
+
+        else if (function == "skewX" && count == 1)
+            item = QTransform (1.0, 0.0, std::tan (qDegreesToRadians (arguments [0])), 1.0, 0.0, 0.0);
+
+        else if (function == "skewY" && count == 1)
+            item = QTransform (1.0, std::tan (qDegreesToRadians (arguments [0])), 0.0, 1.0, 0.0, 0.0);
+
+        else
+            return QTransform ();
+
+        // The later transforms of the list are applied first
+        result = item * result;
+    }
+
+    ok = true;
+    return result;
+}
+
+/**
+ * Returns the given name as a data set name, without whitespace or the separator of typed names.
+ *
+ * @param name - The name to clean
+ *
+ * @return The cleaned name
+ */
+QString Aerodlyn::RegionImporter::cleanName (const QString &name)
+{
+    QString cleaned;
+    cleaned.reserve (name.size ());
+
+    for (const QChar c : name)
+    {
+        if (!c.isSpace () && c != ';')
+            cleaned.append (c);
+    }
+
+    return cleaned;
+}
+
+/**
+ * Numbers the repeated names among the data sets of the given result, which holds a single file,
+ *  so that every data set of the file has its own name.
+ *
+ * @param result - The result holding the data sets
+ */
+void Aerodlyn::RegionImporter::numberRepeatedNames (Result &result)
+{
+    QSet <QString> taken;
+    for (int i = 0; i < result.dataSets.size (); i++)
+        taken.insert (result.dataSets.at (i).name);
+
+    // The first data set with a name keeps it, and the others take the next number not in use
+    QHash <QString, int> counts;
+    for (int i = 0; i < result.dataSets.size (); i++)
+    {
+        const QString name = result.dataSets.at (i).name;
+
+        int &count = counts [name];
+        if (++count == 1)
+            continue;
+
+        QString numbered;
+        do
+            numbered = QString ("%1_%2").arg (name).arg (count++);
+        while (taken.contains (numbered));
+
+        count--;
+        taken.insert (numbered);
+        result.dataSets [i].name = numbered;
+    }
+}
@@ -0,0 +1,212 @@
+#ifndef REGION_IMPORTER_H
+#define REGION_IMPORTER_H
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+#include <QByteArray>
+#include <QFile>
+#include <QFileInfo>
+#include <QHash>
+#include <QIODevice>
+#include <QPointF>
+#include <QPolygonF>
+#include <QRectF>
+#include <QSet>
+#include <QSizeF>
+#include <QString>
+#include <QStringList>
+#include <QTransform>
+#include <QVector>
+#include <QXmlStreamReader>
+#include <QtConcurrent>
+#include <QtMath>
+
+#include "Root/Profiler.h"
+
+#include "VertexDataSet.h"
+
+namespace Aerodlyn
+{
+    /**
+     * Imports regions from the polygon formats of other tools, as data sets ready to be added to a
+     *  {@link VertexDataSetCollection} in bulk (see {@link VertexDataSetCollection#insertAll}):
+     *
+     *  - PhysicsEditor and Box2D JSON: every array of points ({"x": 1, "y": 2} objects, or flat
+     *      x, y pairs of at least three points) and every pair of "x" and "y" arrays becomes a region.
+     *      A region is named after the "name" member of the nearest object holding it, or else the
+     *      nearest member name that isn't part of the format (such as a body under "bodies").
+     *  - Tiled maps and tilesets (TMX and TSX): every polygon, polyline, rectangle and ellipse object
+     *      becomes a region, named after the object, or else after its tile or its id. The objects of
+     *      a tile are placed on that tile in the image of its tileset.
+     *  - SVG: every path (each of its subpaths), polygon, polyline and rectangle becomes a region,
+     *      named after its id. Transforms are applied, and curves and arcs are flattened.
+     *
+     * Files are read in chunks as they are parsed, so memory holds the regions found rather than the
+     *  files themselves, and several files are read in parallel. Source coordinates are taken to be
+     *  image pixels, moved so that the given origin becomes the center of the image. Names lose their
+     *  whitespace like typed names do, and repeated names within a file are numbered ("Name_2").
+     *
+     * Errors carry the file and line they were found at. A file that can't be parsed adds no data
+     *  sets, while an element that can't be read (such as a malformed path) is skipped on its own.
+     *
+     * @author  Patrick Jahnig (Aerodlyn)
+     * @version 2026.10.19
+     */
+    class RegionImporter
+    {
+        public: // Types
+            enum Format { Box2DJson, TiledMap, Svg, UnknownFormat };
+
+            /**
+             * An error found while importing, at a line of a file.
+             */
+            struct Error
+            {
+                QString filepath;
+
+                // Starting at 1, or 0 if the error isn't tied to a line (such as a file that can't be opened)
+                qint64  line = 0;
+
+                QString message;
+
+                /**
+                 * Returns the error as "file:line: message", the way compilers report them.
+                 *
+                 * @return The error as text
+                 */
+                QString toString () const;
+            };
+
+            /**
+             * The data sets imported from one or more files, and the errors found doing so.
+             */
+            struct Result
+            {
+                QVector <VertexDataSet> dataSets;
+                QVector <Error>         errors;
+            };
+
+        public: // Methods
+            /**
+             * Returns the format of the file at the given filepath, going by its suffix.
+             *
+             * @param filepath - The path of the file
+             *
+             * @return The format of the file, or UnknownFormat if it isn't one that can be imported
+             */
+            static Format formatOf (const QString &filepath);
+
+            /**
+             * Imports the regions of the file at the given filepath.
+             *
+             * @param filepath - The path of the file to import
+             * @param origin   - The point in source coordinates that becomes the center of the image
+             *
+             * @return The data sets imported, and the errors found
+             */
+            static Result read (const QString &filepath, const QPointF &origin = QPointF ());
+
+            /**
+             * Imports the regions of every file at the given filepaths, reading the files in parallel.
+             *
+             * @param filepaths - The paths of the files to import
+             * @param origin    - The point in source coordinates that becomes the center of the image
+             *
+             * @return The data sets imported, in the order of the files, and the errors found
+             */
+            static Result readAll (const QStringList &filepaths, const QPointF &origin = QPointF ());
+
+        private: // Methods
+            /**
+             * Imports the regions of the given PhysicsEditor or Box2D JSON file.
+             *
+             * @param device   - The opened file
+             * @param filepath - The path of the file, for errors
+             * @param origin   - The point in source coordinates that becomes the center of the image
+             * @param result   - Where the data sets and errors are added
+             *
+             * @return True if the file was parsed, false if it is malformed
+             */
+            static bool readJson (QIODevice &device, const QString &filepath, const QPointF &origin, Result &result);
+
+            /**
+             * Imports the regions of the objects of the given Tiled map or tileset.
+             *
+             * @param device   - The opened file
+             * @param filepath - The path of the file, for errors
+             * @param origin   - The point in source coordinates that becomes the center of the image
+             * @param result   - Where the data sets and errors are added
+             *
+             * @return True if the file was parsed, false if it is malformed
+             */
+            static bool readTiled (QIODevice &device, const QString &filepath, const QPointF &origin, Result &result);
+
+            /**
+             * Imports the regions of the shapes of the given SVG file.
+             *
+             * @param device   - The opened file
+             * @param filepath - The path of the file, for errors
+             * @param origin   - The point in source coordinates that becomes the center of the image
+             * @param result   - Where the data sets and errors are added
+             *
+             * @return True if the file was parsed, false if it is malformed
+             */
+            static bool readSvg (QIODevice &device, const QString &filepath, const QPointF &origin, Result &result);
+
+            /**
+             * Parses the given SVG path data into one polygon per subpath, flattening curves and arcs.
+             *
+             * @param data     - The path data, as in the "d" attribute of a path
+             * @param polygons - Where the polygons are added
+             *
+             * @return An empty string if the path data was parsed, or what is wrong with it otherwise
+             */
+            static QString parsePathData (const QString &data, QVector <QPolygonF> &polygons);
+
+            /**
+             * Parses a list of points, as in the "points" attribute of SVG polygons or Tiled polygon
+             *  objects: coordinates separated by commas or whitespace.
+             *
+             * @param points - The list of points
+             *
+             * @return The points, or an empty polygon if the list is malformed
+             */
+            static QPolygonF parsePoints (const QString &points);
+
+            /**
+             * Parses an SVG transform list, as in the "transform" attribute.
+             *
+             * @param transform - The transform list
+             * @param ok        - Set to false if the transform list is malformed
+             *
+             * @return The transform, applied right to left as SVG does
+             */
+            static QTransform parseTransform (const QString &transform, bool &ok);
+
+            /**
+             * Returns the given name as a data set name, without whitespace or the separator of typed names.
+             *
+             * @param name - The name to clean
+             *
+             * @return The cleaned name
+             */
+            static QString cleanName (const QString &name);
+
+            /**
+             * Numbers the repeated names among the data sets of the given result, which holds a single file,
+             *  so that every data set of the file has its own name.
+             *
+             * @param result - The result holding the data sets
+             */
+            static void numberRepeatedNames (Result &result);
+
+        private: // Variables
+            // Segments a curve of a path is flattened into, and segments per full turn of an arc or ellipse
+            static constexpr int    CURVE_SEGMENTS = 16;
+            static constexpr int    TURN_SEGMENTS  = 32;
+    };
+}
+
+#endif // REGION_IMPORTER_H
@@ -0,0 +1,278 @@
+#include "RegionRasterizer.h"
+
+/**
+ * Rasterizes the regions of data sets into per-pixel coverage masks (e.g. for collision), using an
+ *  even-odd scanline fill sampled at pixel centers. Each row of a mask is filled one span at a time,
+ *  and spans are written whole bytes (or words) at a time rather than pixel by pixel.
+ *
+ * @author  Patrick Jahnig (Aerodlyn)
+ * @version 2026.10.19
+ */
+
+/* Public Methods */
+/**
+ * Rasterizes the given region into a mask of the given size.
+ *
+ * @param region - The region to rasterize
+ * @param size   - The size of the mask, in pixels
+ * @param origin - The position in the mask of the origin of the region's coordinates
+ * @param format - The number of bits to use per pixel
+ *
+ * @return The coverage mask of the region
+ */
+Aerodlyn::RegionRasterizer::Mask Aerodlyn::RegionRasterizer::rasterize (const QPolygonF &region, const QSize &size,
+    const QPointF &origin, const Format format)
+{
+    AERO_PROFILE_SCOPE ("RegionRasterizer::rasterize");
+
+    Mask mask;
+    mask.format = format;
+    mask.width  = std::max (size.width (), 0);
+    mask.height = std::max (size.height (), 0);
+    mask.stride = format == Format::Bit ? ((mask.width + 63) / 64) * 8 : (mask.width + 3) & ~3;
+    mask.data   = QByteArray (mask.stride * mask.height, '\0');
+
+    const int length = region.size ();
+    if (length < 3 || mask.width == 0 || mask.height == 0)
+        return mask;
+
+    // Horizontal edges never cross a scanline, so they are left out
+    QVector <Edge> edges;
+    edges.reserve (length);
+
+    double minY = region.at (0).y () + origin.y (), maxY = minY;
+    for (int i = 0; i < length; i++)
+    {
+        QPointF a = region.at (i) + origin, b = region.at ((i + 1) % length) + origin;
+
+        minY = std::min (minY, a.y ());
+        maxY = std::max (maxY, a.y ());
+
+        if (a.y () == b.y ())
+            continue;
+
+        if (a.y () > b.y ())
+            std::swap (a, b);
+
+        edges.append ({ a.x (), a.y (), b.y (), (b.x () - a.x ()) / (b.y () - a.y ()) });
+    }
+
+    std::sort (edges.begin (), edges.end (), [] (const Edge &a, const Edge &b) { return a.y0 < b.y0; });
+
+    // Rows whose centers lie within the vertical extent of the region
+    const int firstRow = static_cast <int> (std::clamp (std::ceil (minY - 0.5), 0.0, static_cast <double> (mask.height)));
+    const int endRow   = static_cast <int> (std::clamp (std::ceil (maxY - 0.5), 0.0, static_cast <double> (mask.height)));
+
+    uchar *data = reinterpret_cast <uchar *> (mask.data.data ());
+    const double width = mask.width;
+
+    QVector <const Edge *> active;
+    QVector <double> crossings;
+    int next = 0;
+
+    for (int y = firstRow; y < endRow; y++)
+    {
+        const double center = y + 0.5;
+
+        // Edges are sorted by their top, so they become active in order and leave once passed
+        for (; next < edges.size () && edges.at (next).y0 <= center; next++)
+            active.append (&edges.at (next));
+
+        active.erase (std::remove_if (active.begin (), active.end (),
+            [center] (const Edge *edge) { return edge->y1 <= center; }), active.end ());
+
+        crossings.clear ();
+        for (const Edge *edge : active)
+            crossings.append (edge->x0 + (center - edge->y0) * edge->slope);
+
+        std::sort (crossings.begin (), crossings.end ());
+
+        uchar *row = data + static_cast <qsizetype> (y) * mask.stride;
+        for (int i = 0; i + 1 < crossings.size (); i += 2)
+        {
+            const int start = static_cast <int> (std::clamp (std::ceil (crossings.at (i) - 0.5), 0.0, width));
+            const int end   = static_cast <int> (std::clamp (std::ceil (crossings.at (i + 1) - 0.5), 0.0, width));
+
+            if (start >= end)
+                continue;
+
+            if (format == Format::Bit)
+                fillBits (row, start, end);
+
+            else
+                std::memset (row + start, 0xFF, static_cast <size_t> (end - start));
+        }
+    }
+
+    return mask;
+}
+
+/**
+ * Rasterizes the region of every data set in the given collection and writes each mask to a
+ *  file in the given directory named after its data set (see {@link #fileName}), in parallel
+ *  across the available cores. Masks are written as soon as they are rasterized, so only a few
+ *  are held at once.
+ *
+ * @param collection - The data sets to rasterize
+ * @param size       - The size of the masks, in pixels
+ * @param origin     - The position in the masks of the origin of the regions' coordinates
+ * @param format     - The number of bits to use per pixel
+ * @param encoding   - The file format to write the masks in
+ * @param directory  - The directory to write the masks to
+ *
+ * @return The names of the data sets whose masks couldn't be written
+ */
+QStringList Aerodlyn::RegionRasterizer::exportAll (const VertexDataSetCollection &collection, const QSize &size,
+    const QPointF &origin, const Format format, const Encoding encoding, const QDir &directory)
+{
+    AERO_PROFILE_SCOPE ("RegionRasterizer::exportAll");
+
+    QStringList failed;
+    QMutex mutex;
+
+    QVector <int> indices (collection.length ());
+    std::iota (indices.begin (), indices.end (), 0);
+
+    QtConcurrent::blockingMap (indices, [&] (const int &index)
+    {
+        const VertexDataSet &set = collection.at (index);
+
+        const QString filename = fileName (set.name) + (encoding == Encoding::Png ? ".png" : ".mask");
+
+        if (!save (rasterize (set.region, size, origin, format), directory.filePath (filename), encoding))
+        {
+            const QMutexLocker locker (&mutex);
+            failed.append (set.name);
+        }
+    });
+
+    failed.sort ();
+    return failed;
+}
+
+/**
+ * Converts the given mask to an image, which is a 1-bit image for bit masks and a grayscale
+ *  image for byte masks.
+ *
+ * @param mask - The mask to convert
+ *
+ * @return The mask as an image
+ */
+QImage Aerodlyn::RegionRasterizer::toImage (const Mask &mask)
+{
+    if (mask.width == 0 || mask.height == 0)
+        return QImage ();
+
+    const bool bits = mask.format == Format::Bit;
+
+    QImage image (mask.width, mask.height, bits ? QImage::Format_MonoLSB : QImage::Format_Grayscale8);
+    if (bits)
+    {
+        image.setColorCount (2);
+        image.setColor (0, qRgb (0, 0, 0));
+        image.setColor (1, qRgb (255, 255, 255));
+    }
+
+    const size_t rowBytes = static_cast <size_t> (bits ? (mask.width + 7) / 8 : mask.width);
+    for (int y = 0; y < mask.height; y++)
+        std::memcpy (image.scanLine (y), mask.data.constData () + static_cast <qsizetype> (y) * mask.stride, rowBytes);
+
+    return image;
+}
+
+/**
+ * Writes the given mask to the given file in the given file format. Packed masks are a
+ *  little-endian header ("AHMK", version, width, height, bits per pixel, stride) followed by
+ *  the rows of the mask as they are stored.
+ *
+ * @param mask     - The mask to write
+ * @param filepath - The path of the file to write to
+ * @param encoding - The file format to write the mask in
+ *
+ * @return True if the mask was written, false otherwise
+ */
+bool Aerodlyn::RegionRasterizer::save (const Mask &mask, const QString &filepath, const Encoding encoding)
+{
+    if (encoding == Encoding::Png)
+        return toImage (mask).save (filepath, "PNG");
+
+    QFile file (filepath);
+    if (!file.open (QIODevice::WriteOnly))
+        return false;
+
+    QDataStream stream (&file);
+    stream.setByteOrder (QDataStream::LittleEndian);
+
+    stream << PACKED_MAGIC << PACKED_VERSION
+           << static_cast <quint32> (mask.width) << static_cast <quint32> (mask.height)
+           << static_cast <quint32> (mask.format == Format::Bit ? 1 : 8) << static_cast <quint32> (mask.stride);
+    stream.writeRawData (mask.data.constData (), mask.data.size ());
+
+    return stream.status () == QDataStream::Ok;
+}
+
+/**
+ * Returns the given data set name as a file name that is valid on every platform. Characters
+ *  that can't be part of a file name on Windows (and '%' itself) become "%XX" escapes of their
+ *  code, as do a trailing dot and the first letter of a reserved device name such as "CON", so
+ *  distinct names always give distinct file names.
+ *
+ * @param name - The name of the data set
+ *
+ * @return The file name, without a suffix
+ */
+QString Aerodlyn::RegionRasterizer::fileName (const QString &name)
+{
+    static const QString RESERVED_CHARACTERS = "%/\\:*?\"<>|";
+    static const QStringList RESERVED_NAMES = { "CON", "PRN", "AUX", "NUL", "COM1", "COM2", "COM3", "COM4", "COM5",
+        "COM6", "COM7", "COM8", "COM9", "LPT1", "LPT2", "LPT3", "LPT4", "LPT5", "LPT6", "LPT7", "LPT8", "LPT9" };
+
+    const auto escape = [] (const QChar c) { return QString ("%%1").arg (c.unicode (), 2, 16, QChar ('0')).toUpper (); };
+
+    // Windows reserves device names whatever their suffix, so "nul.v2" is as reserved as "NUL"
+    const bool reserved = RESERVED_NAMES.contains (name.section ('.', 0, 0), Qt::CaseInsensitive);
+
+    QString filename;
+    filename.reserve (name.size ());
+
+    for (int i = 0; i < name.size (); i++)
+    {
+        const QChar c = name.at (i);
+
+        if (c.unicode () < 0x20 || RESERVED_CHARACTERS.contains (c) || (i == 0 && reserved) ||
+            (i + 1 == name.size () && c == '.'))
+            filename.append (escape (c));
+
+        else
+            filename.append (c);
+    }
+
+    return filename;
+}
+
+/* Private Methods */
+/**
+ * Sets the pixels in the range [start, end) of the given row of a bit mask.
+ *
+ * @param row   - The first byte of the row
+ * @param start - The first pixel to set
+ * @param end   - The pixel after the last one to set
+ */
+void Aerodlyn::RegionRasterizer::fillBits (uchar *row, const int start, const int end)
+{
+    const int first = start >> 3, last = (end - 1) >> 3;
+
+    const uchar head = static_cast <uchar> (0xFF << (start & 7));
+    const uchar tail = static_cast <uchar> (0xFF >> (7 - ((end - 1) & 7)));
+
+    if (first == last)
+    {
+        row [first] |= head & tail;
+        return;
+    }
+
+    // Only the partial bytes at either end need masking, everything between is one bulk write
+    row [first] |= head;
+    std::memset (row + first + 1, 0xFF, static_cast <size_t> (last - first - 1));
+    row [last] |= tail;
+}
@@ -0,0 +1,154 @@
+#ifndef REGION_RASTERIZER_H
+#define REGION_RASTERIZER_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <numeric>
+
+#include <QByteArray>
+#include <QDataStream>
+#include <QDir>
+#include <QFile>
+#include <QImage>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QPointF>
+#include <QPolygonF>
+#include <QSize>
+#include <QStringList>
+#include <QVector>
+#include <QtConcurrent>
+
+#include "Root/Profiler.h"
+
+#include "VertexDataSetCollection.h"
+
+namespace Aerodlyn
+{
+    /**
+     * Rasterizes the regions of data sets into per-pixel coverage masks (e.g. for collision), using an
+     *  even-odd scanline fill sampled at pixel centers. Each row of a mask is filled one span at a time,
+     *  and spans are written whole bytes (or words) at a time rather than pixel by pixel.
+     *
+     * @author  Patrick Jahnig (Aerodlyn)
+     * @version 2026.10.19
+     */
+    class RegionRasterizer
+    {
+        public: // Types
+            /**
+             * The number of bits used per pixel of a mask.
+             */
+            enum class Format { Bit, Byte };
+
+            /**
+             * The file format that masks are exported in.
+             */
+            enum class Encoding { Png, Packed };
+
+            /**
+             * A coverage mask. Bit masks store one bit per pixel, least significant bit first, while byte
+             *  masks store 0 or 255 per pixel. Rows are stride bytes apart, padded to 64 bits for bit masks
+             *  and 32 bits for byte masks.
+             */
+            struct Mask
+            {
+                Format     format = Format::Bit;
+
+                int        width  = 0;
+                int        height = 0;
+                int        stride = 0;
+
+                QByteArray data;
+            };
+
+        public: // Methods
+            /**
+             * Rasterizes the given region into a mask of the given size.
+             *
+             * @param region - The region to rasterize
+             * @param size   - The size of the mask, in pixels
+             * @param origin - The position in the mask of the origin of the region's coordinates
+             * @param format - The number of bits to use per pixel
+             *
+             * @return The coverage mask of the region
+             */
+            static Mask rasterize (const QPolygonF &region, const QSize &size, const QPointF &origin, const Format format);
+
+            /**
+             * Rasterizes the region of every data set in the given collection and writes each mask to a
+             *  file in the given directory named after its data set (see {@link #fileName}), in parallel
+             *  across the available cores. Masks are written as soon as they are rasterized, so only a few
+             *  are held at once.
+             *
+             * @param collection - The data sets to rasterize
+             * @param size       - The size of the masks, in pixels
+             * @param origin     - The position in the masks of the origin of the regions' coordinates
+             * @param format     - The number of bits to use per pixel
+             * @param encoding   - The file format to write the masks in
+             * @param directory  - The directory to write the masks to
+             *
+             * @return The names of the data sets whose masks couldn't be written
+             */
+            static QStringList exportAll (const VertexDataSetCollection &collection, const QSize &size,
+                const QPointF &origin, const Format format, const Encoding encoding, const QDir &directory);
+
+            /**
+             * Converts the given mask to an image, which is a 1-bit image for bit masks and a grayscale
+             *  image for byte masks.
+             *
+             * @param mask - The mask to convert
+             *
+             * @return The mask as an image
+             */
+            static QImage toImage (const Mask &mask);
+
+            /**
+             * Writes the given mask to the given file in the given file format. Packed masks are a
+             *  little-endian header ("AHMK", version, width, height, bits per pixel, stride) followed by
+             *  the rows of the mask as they are stored.
+             *
+             * @param mask     - The mask to write
+             * @param filepath - The path of the file to write to
+             * @param encoding - The file format to write the mask in
+             *
+             * @return True if the mask was written, false otherwise
+             */
+            static bool save (const Mask &mask, const QString &filepath, const Encoding encoding);
+
+            /**
+             * Returns the given data set name as a file name that is valid on every platform. Characters
+             *  that can't be part of a file name on Windows (and '%' itself) become "%XX" escapes of their
+             *  code, as do a trailing dot and the first letter of a reserved device name such as "CON", so
+             *  distinct names always give distinct file names.
+             *
+             * @param name - The name of the data set
+             *
+             * @return The file name, without a suffix
+             */
+            static QString fileName (const QString &name);
+
+        private: // Types
+            struct Edge
+            {
+                double x0, y0, y1, slope;
+            };
+
+        private: // Methods
+            /**
+             * Sets the pixels in the range [start, end) of the given row of a bit mask.
+             *
+             * @param row   - The first byte of the row
+             * @param start - The first pixel to set
+             * @param end   - The pixel after the last one to set
+             */
+            static void fillBits (uchar *row, const int start, const int end);
+
+        private: // Variables
+            static constexpr quint32 PACKED_MAGIC   = 0x4B4D4841; // "AHMK"
+            static constexpr quint32 PACKED_VERSION = 1;
+    };
+}
+
+#endif // REGION_RASTERIZER_H
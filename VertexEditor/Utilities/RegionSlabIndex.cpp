@@ -0,0 +1,168 @@
+#include "RegionSlabIndex.h"
+
+/**
+ * Speeds up point-in-polygon tests on a region by cutting its bounding box into horizontal slabs,
+ *  each listing the edges that reach into it. A test then only casts its ray against the edges of
+ *  the slab the point is in, rather than against every edge. Treats the region as a closed polygon
+ *  filled with the even-odd rule, like {@link QPolygonF#containsPoint} with Qt::OddEvenFill.
+ *
+ * @author  Patrick Jahnig (Aerodlyn)
+ * @version 2026.10.19
+ */
+
+/* Public Methods */
+/**
+ * Discards the slabs, so that tests fall back to checking every edge until {@link #rebuild}.
+ */
+void Aerodlyn::RegionSlabIndex::invalidate ()
+    { valid = false; }
+
+/**
+ * Determines if the slabs were built for a region with the given number of vertices, and haven't
+ *  been invalidated since.
+ *
+ * @param count - The number of vertices of the region
+ *
+ * @return True if the slabs are up to date, false otherwise
+ */
+bool Aerodlyn::RegionSlabIndex::isValid (const int count) const
+    { return valid && this->count == count; }
+
+/**
+ * Rebuilds the slabs from the given region. Regions with few edges get no slabs, as checking
+ *  every edge is as fast.
+ *
+ * @param region - The region to build the slabs from
+ */
+void Aerodlyn::RegionSlabIndex::rebuild (const QPolygonF &region)
+{
+    count = region.size ();
+    valid = true;
+    slabs.clear ();
+
+    if (count < MIN_EDGES)
+        return;
+
+    // About two edges start in each slab, so a test usually checks a handful of edges
+    const QRectF bounds = region.boundingRect ();
+    const int slabCount = qBound (1, count / 2, MAX_SLABS);
+
+    top        = bounds.top ();
+    slabHeight = bounds.height () > 0.0 ? bounds.height () / slabCount : 1.0;
+    slabs.resize (slabCount);
+
+    for (int i = 0; i < count; i++)
+        placeEdge (i, region.at (i), region.at ((i + 1) % count), true);
+}
+
+/**
+ * Moves the two edges of the vertex at the given index of the given region between slabs after
+ *  it moved from the given position. Does nothing if the slabs aren't up to date.
+ *
+ * @param region - The region, with the vertex already at its new position
+ * @param index  - The index of the vertex that moved
+ * @param from   - The position the vertex moved from
+ */
+void Aerodlyn::RegionSlabIndex::moveVertex (const QPolygonF &region, const int index, const QPointF &from)
+{
+    if (!isValid (region.size ()) || slabs.isEmpty ())
+        return;
+
+    const int prev = (index + count - 1) % count;
+    const int next = (index + 1) % count;
+
+    placeEdge (prev, region.at (prev), from, false);
+    placeEdge (index, from, region.at (next), false);
+    placeEdge (prev, region.at (prev), region.at (index), true);
+    placeEdge (index, region.at (index), region.at (next), true);
+}
+
+/**
+ * Determines if the given point is inside the given region, using the slabs if they are up to
+ *  date and checking every edge otherwise.
+ *
+ * @param region - The region the slabs were built from
+ * @param point  - The point to test
+ *
+ * @return True if the point is inside the region, false otherwise
+ */
+bool Aerodlyn::RegionSlabIndex::contains (const QPolygonF &region, const QPointF &point) const
+{
+    bool inside = false;
+
+    if (isValid (region.size ()) && !slabs.isEmpty ())
+    {
+        for (const int edge : slabs.at (slabOf (point.y ())))
+        {
+            if (crosses (region.at (edge), region.at ((edge + 1) % count), point))
+                inside = !inside;
+        }
+
+        return inside;
+    }
+
+    for (int i = 0, size = region.size (); i < size; i++)
+    {
+        if (crosses (region.at (i), region.at ((i + 1) % size), point))
+            inside = !inside;
+    }
+
+    return inside;
+}
+
+/* Private Methods */
+/**
+ * Returns the slab the given y coordinate falls into, clamped to the slabs there are.
+ *
+ * @param y - The y coordinate
+ *
+ * @return The index of the slab
+ */
+int Aerodlyn::RegionSlabIndex::slabOf (const double y) const
+{
+    // Clamped before converting, as coordinates far outside the slabs don't fit into an int
+    const double slab = std::floor ((y - top) / slabHeight);
+    return static_cast <int> (qBound (0.0, slab, static_cast <double> (slabs.size () - 1)));
+}
+
+/**
+ * Adds (or removes) the edge starting at the given index to (or from) every slab between the y
+ *  coordinates of the given endpoints.
+ *
+ * @param edge - The index of the edge, which is also the index of its first vertex
+ * @param a    - The start of the edge
+ * @param b    - The end of the edge
+ * @param add  - True to add the edge, false to remove it
+ */
+void Aerodlyn::RegionSlabIndex::placeEdge (const int edge, const QPointF &a, const QPointF &b, const bool add)
+{
+    const int first = slabOf (std::min (a.y (), b.y ()));
+    const int last  = slabOf (std::max (a.y (), b.y ()));
+
+    for (int slab = first; slab <= last; slab++)
+    {
+        if (add)
+            slabs [slab].append (edge);
+
+        else
+            slabs [slab].removeOne (edge);
+    }
+}
+
+/**
+ * Determines if a ray cast from the given point towards positive x crosses the edge from a to b.
+ *
+ * @param a     - The start of the edge
+ * @param b     - The end of the edge
+ * @param point - The origin of the ray
+ *
+ * @return True if the ray crosses the edge, false otherwise
+ */
+bool Aerodlyn::RegionSlabIndex::crosses (const QPointF &a, const QPointF &b, const QPointF &point)
+{
+    // Treating each edge as half-open in y counts a vertex lying on the ray once, not twice
+    if ((a.y () > point.y ()) == (b.y () > point.y ()))
+        return false;
+
+    return point.x () < a.x () + (point.y () - a.y ()) * (b.x () - a.x ()) / (b.y () - a.y ());
+}
@@ -0,0 +1,122 @@
+#ifndef REGION_SLAB_INDEX_H
+#define REGION_SLAB_INDEX_H
+
+#include <algorithm>
+#include <cmath>
+
+#include <QPointF>
+#include <QPolygonF>
+#include <QRectF>
+#include <QVector>
+#include <QtGlobal>
+
+namespace Aerodlyn
+{
+    /**
+     * Speeds up point-in-polygon tests on a region by cutting its bounding box into horizontal slabs,
+     *  each listing the edges that reach into it. A test then only casts its ray against the edges of
+     *  the slab the point is in, rather than against every edge. Treats the region as a closed polygon
+     *  filled with the even-odd rule, like {@link QPolygonF#containsPoint} with Qt::OddEvenFill.
+     *
+     * Moving a vertex moves its two edges between slabs without rebuilding the others. Edges that
+     *  leave the slabs are kept in the first or last one, so the index stays correct (if slower) until
+     *  it is rebuilt.
+     *
+     * @author  Patrick Jahnig (Aerodlyn)
+     * @version 2026.10.19
+     */
+    class RegionSlabIndex
+    {
+        public: // Methods
+            /**
+             * Discards the slabs, so that tests fall back to checking every edge until {@link #rebuild}.
+             */
+            void invalidate ();
+
+            /**
+             * Determines if the slabs were built for a region with the given number of vertices, and haven't
+             *  been invalidated since.
+             *
+             * @param count - The number of vertices of the region
+             *
+             * @return True if the slabs are up to date, false otherwise
+             */
+            bool isValid (const int count) const;
+
+            /**
+             * Rebuilds the slabs from the given region. Regions with few edges get no slabs, as checking
+             *  every edge is as fast.
+             *
+             * @param region - The region to build the slabs from
+             */
+            void rebuild (const QPolygonF &region);
+
+            /**
+             * Moves the two edges of the vertex at the given index of the given region between slabs after
+             *  it moved from the given position. Does nothing if the slabs aren't up to date.
+             *
+             * @param region - The region, with the vertex already at its new position
+             * @param index  - The index of the vertex that moved
+             * @param from   - The position the vertex moved from
+             */
+            void moveVertex (const QPolygonF &region, const int index, const QPointF &from);
+
+            /**
+             * Determines if the given point is inside the given region, using the slabs if they are up to
+             *  date and checking every edge otherwise.
+             *
+             * @param region - The region the slabs were built from
+             * @param point  - The point to test
+             *
+             * @return True if the point is inside the region, false otherwise
+             */
+            bool contains (const QPolygonF &region, const QPointF &point) const;
+
+        private: // Methods
+            /**
+             * Returns the slab the given y coordinate falls into, clamped to the slabs there are.
+             *
+             * @param y - The y coordinate
+             *
+             * @return The index of the slab
+             */
+            int slabOf (const double y) const;
+
+            /**
+             * Adds (or removes) the edge starting at the given index to (or from) every slab between the y
+             *  coordinates of the given endpoints.
+             *
+             * @param edge - The index of the edge, which is also the index of its first vertex
+             * @param a    - The start of the edge
+             * @param b    - The end of the edge
+             * @param add  - True to add the edge, false to remove it
+             */
+            void placeEdge (const int edge, const QPointF &a, const QPointF &b, const bool add);
+
+            /**
+             * Determines if a ray cast from the given point towards positive x crosses the edge from a to b.
+             *
+             * @param a     - The start of the edge
+             * @param b     - The end of the edge
+             * @param point - The origin of the ray
+             *
+             * @return True if the ray crosses the edge, false otherwise
+             */
+            static bool crosses (const QPointF &a, const QPointF &b, const QPointF &point);
+
+        private: // Variables
+            bool                    valid        = false;
+
+            int                     count        = 0;
+
+            double                  top          = 0.0;
+            double                  slabHeight   = 1.0;
+
+            QVector <QVector <int>> slabs;
+
+            static constexpr int    MIN_EDGES    = 16;
+            static constexpr int    MAX_SLABS    = 1024;
+    };
+}
+
+#endif // REGION_SLAB_INDEX_H
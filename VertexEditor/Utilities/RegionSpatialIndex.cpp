@@ -0,0 +1,164 @@
+#include "RegionSpatialIndex.h"
+
+#include <algorithm>
+
+#include "Root/Utils.h"
+
+/**
+ * A uniform grid over the vertices of a single region, used to answer hit-tests and rectangle or
+ *  lasso queries without scanning every vertex of the region.
+ *
+ * @author  Patrick Jahnig (Aerodlyn)
+ * @version 2026.10.19
+ */
+
+/* Constructors/Deconstructors */
+/**
+ * Creates a new, empty {@link RegionSpatialIndex} instance.
+ *
+ * @param cellSize - The width and height of a single grid cell
+ */
+Aerodlyn::RegionSpatialIndex::RegionSpatialIndex (const double cellSize) : cellSize (cellSize) {}
+
+/* Public Methods */
+/**
+ * Discards the current contents of the index and indexes every vertex of the given region.
+ *
+ * @param region - The region whose vertices should be indexed
+ */
+void Aerodlyn::RegionSpatialIndex::rebuild (const QPolygonF &region)
+{
+    cells.clear ();
+    indexedSize = region.size ();
+
+    for (int i = 0; i < indexedSize; i++)
+    {
+        const QPointF &point = region.at (i);
+        cells [cellKey (cellCoordinate (point.x ()), cellCoordinate (point.y ()))].append (i);
+    }
+}
+
+/**
+ * Returns the index of the first vertex (lowest index) that lies within the circle defined by
+ *  the given center and radius.
+ *
+ * @param region - The region that was indexed
+ * @param center - The center of the circle to test
+ * @param radius - The radius of the circle to test
+ *
+ * @return The index of the hit vertex, or -1 if no vertex lies within the circle
+ */
+int Aerodlyn::RegionSpatialIndex::hitTest (const QPolygonF &region, const QPointF &center, const double radius) const
+{
+    const int minX = cellCoordinate (center.x () - radius), maxX = cellCoordinate (center.x () + radius);
+    const int minY = cellCoordinate (center.y () - radius), maxY = cellCoordinate (center.y () + radius);
+
+    int hit = -1;
+    for (int cx = minX; cx <= maxX; cx++)
+    {
+        for (int cy = minY; cy <= maxY; cy++)
+        {
+            const auto cell = cells.constFind (cellKey (cx, cy));
+            if (cell == cells.constEnd ())
+                continue;
+
+            for (const int index : *cell)
+            {
+                if ((hit == -1 || index < hit) && Utils::isInCircle (region.at (index), center, radius))
+                    hit = index;
+            }
+        }
+    }
+
+    return hit;
+}
+
+/**
+ * Returns the indices, in ascending order, of every vertex that lies within the given rectangle.
+ *
+ * @param region - The region that was indexed
+ * @param rect   - The rectangle to query
+ *
+ * @return The sorted indices of the vertices within the given rectangle
+ */
+QVector <int> Aerodlyn::RegionSpatialIndex::queryRect (const QPolygonF &region, const QRectF &rect) const
+{
+    const QRectF normalized = rect.normalized ();
+
+    const int minX = cellCoordinate (normalized.left ()), maxX = cellCoordinate (normalized.right ());
+    const int minY = cellCoordinate (normalized.top ()), maxY = cellCoordinate (normalized.bottom ());
+
+    QVector <int> result;
+    for (int cx = minX; cx <= maxX; cx++)
+    {
+        for (int cy = minY; cy <= maxY; cy++)
+        {
+            const auto cell = cells.constFind (cellKey (cx, cy));
+            if (cell == cells.constEnd ())
+                continue;
+
+            for (const int index : *cell)
+            {
+                const QPointF &point = region.at (index);
+
+                if (point.x () >= normalized.left () && point.x () <= normalized.right () &&
+                    point.y () >= normalized.top () && point.y () <= normalized.bottom ())
+                    result.append (index);
+            }
+        }
+    }
+
+    std::sort (result.begin (), result.end ());
+    return result;
+}
+
+/**
+ * Returns the indices, in ascending order, of every vertex that lies within the given lasso
+ *  polygon (using the odd-even fill rule).
+ *
+ * @param region - The region that was indexed
+ * @param lasso  - The closed lasso polygon to query
+ *
+ * @return The sorted indices of the vertices within the given lasso
+ */
+QVector <int> Aerodlyn::RegionSpatialIndex::queryPolygon (const QPolygonF &region, const QPolygonF &lasso) const
+{
+    if (lasso.size () < 3)
+        return QVector <int> ();
+
+    QVector <int> result = queryRect (region, lasso.boundingRect ());
+    result.erase (std::remove_if (result.begin (), result.end (),
+        [&] (const int index) { return !lasso.containsPoint (region.at (index), Qt::OddEvenFill); }), result.end ());
+
+    return result;
+}
+
+/**
+ * Returns the number of vertices that were indexed by the last call to {@link #rebuild}.
+ *
+ * @return The number of indexed vertices
+ */
+int Aerodlyn::RegionSpatialIndex::size () const
+    { return indexedSize; }
+
+/* Private Methods */
+/**
+ * Returns the key of the cell at the given grid coordinates.
+ *
+ * @param cx - The column of the cell
+ * @param cy - The row of the cell
+ *
+ * @return The key of the cell
+ */
+quint64 Aerodlyn::RegionSpatialIndex::cellKey (const int cx, const int cy) const
+    { return (static_cast <quint64> (static_cast <quint32> (cx)) << 32) | static_cast <quint32> (cy); }
+
+/**
+ * Returns the grid coordinate (column or row) that contains the given value.
+ *
+ * @param value - The x or y coordinate to convert
+ *
+ * @return The grid coordinate containing the given value
+ */
+int Aerodlyn::RegionSpatialIndex::cellCoordinate (const double value) const
+    { return static_cast <int> (std::floor (value / cellSize)); }
@@ -0,0 +1,108 @@
+#ifndef REGION_SPATIAL_INDEX_H
+#define REGION_SPATIAL_INDEX_H
+
+#include <cmath>
+
+#include <QHash>
+#include <QPointF>
+#include <QPolygonF>
+#include <QRectF>
+#include <QVector>
+
+namespace Aerodlyn
+{
+    /**
+     * A uniform grid over the vertices of a single region, used to answer hit-tests and rectangle or
+     *  lasso queries without scanning every vertex of the region.
+     *
+     * @author  Patrick Jahnig (Aerodlyn)
+     * @version 2026.10.19
+     */
+    class RegionSpatialIndex
+    {
+        public: // Constructors/Deconstructors
+            /**
+             * Creates a new, empty {@link RegionSpatialIndex} instance.
+             *
+             * @param cellSize - The width and height of a single grid cell
+             */
+            RegionSpatialIndex (const double cellSize = 32.0);
+
+        public: // Methods
+            /**
+             * Discards the current contents of the index and indexes every vertex of the given region.
+             *
+             * @param region - The region whose vertices should be indexed
+             */
+            void rebuild (const QPolygonF &region);
+
+            /**
+             * Returns the index of the first vertex (lowest index) that lies within the circle defined by
+             *  the given center and radius.
+             *
+             * @param region - The region that was indexed
+             * @param center - The center of the circle to test
+             * @param radius - The radius of the circle to test
+             *
+             * @return The index of the hit vertex, or -1 if no vertex lies within the circle
+             */
+            int hitTest (const QPolygonF &region, const QPointF &center, const double radius) const;
+
+            /**
+             * Returns the indices, in ascending order, of every vertex that lies within the given rectangle.
+             *
+             * @param region - The region that was indexed
+             * @param rect   - The rectangle to query
+             *
+             * @return The sorted indices of the vertices within the given rectangle
+             */
+            QVector <int> queryRect (const QPolygonF &region, const QRectF &rect) const;
+
+            /**
+             * Returns the indices, in ascending order, of every vertex that lies within the given lasso
+             *  polygon (using the odd-even fill rule).
+             *
+             * @param region - The region that was indexed
+             * @param lasso  - The closed lasso polygon to query
+             *
+             * @return The sorted indices of the vertices within the given lasso
+             */
+            QVector <int> queryPolygon (const QPolygonF &region, const QPolygonF &lasso) const;
+
+            /**
+             * Returns the number of vertices that were indexed by the last call to {@link #rebuild}.
+             *
+             * @return The number of indexed vertices
+             */
+            int size () const;
+
+        private: // Methods
+            /**
+             * Returns the key of the cell at the given grid coordinates.
+             *
+             * @param cx - The column of the cell
+             * @param cy - The row of the cell
+             *
+             * @return The key of the cell
+             */
+            quint64 cellKey (const int cx, const int cy) const;
+
+            /**
+             * Returns the grid coordinate (column or row) that contains the given value.
+             *
+             * @param value - The x or y coordinate to convert
+             *
+             * @return The grid coordinate containing the given value
+             */
+            int cellCoordinate (const double value) const;
+
+        private: // Variables
+            int                              indexedSize = 0;
+
+            double                           cellSize;
+
+            QHash <quint64, QVector <int>>   cells;
+    };
+}
+
+#endif // REGION_SPATIAL_INDEX_H
@@ -0,0 +1,345 @@
+#include "SpriteSheet.h"
+
+/**
+ * Slices a sprite sheet into frames, either on a grid or around the opaque parts of the image, and
+ *  carries a region traced on one frame over to the others. Each vertex of the region is moved by
+ *  the offset between the frames, then snapped to the outline of the sprite in its new frame: the
+ *  nearest pixel on that outline takes the place of the nearest one in the frame it was traced on,
+ *  so a region traced loosely around a sprite stays just as loose around the others.
+ *
+ * A pixel is opaque if its alpha is above a threshold, and on the outline if it is opaque and next
+ *  to a pixel that isn't, or to the edge of its frame. Images without an alpha channel are opaque
+ *  everywhere, so their frames are outlined by their edges.
+ *
+ * @author  Patrick Jahnig (Aerodlyn)
+ * @version 2026.10.19
+ */
+
+/* Public Methods */
+/**
+ * Slices an image of the given size into a grid of equally sized frames, row by row. Pixels
+ *  left over on the right or at the bottom don't belong to any frame.
+ *
+ * @param size    - The size of the image
+ * @param columns - The number of frames across
+ * @param rows    - The number of frames down
+ *
+ * @return The frames, or none if the image is smaller than the grid
+ */
+QVector <QRect> Aerodlyn::SpriteSheet::gridFrames (const QSize &size, const int columns, const int rows)
+{
+    QVector <QRect> frames;
+    if (columns <= 0 || rows <= 0)
+        return frames;
+
+    const int width = size.width () / columns, height = size.height () / rows;
+    if (width == 0 || height == 0)
+        return frames;
+
+    frames.reserve (columns * rows);
+    for (int row = 0; row < rows; row++)
+    {
+        for (int column = 0; column < columns; column++)
+            frames.append (QRect (column * width, row * height, width, height));
+    }
+
+    return frames;
+}
+
+/**
+ * Finds the frames of the given image around its opaque parts. Every group of opaque pixels
+ *  touching each other (diagonally too) is boxed, and boxes that overlap are joined, so parts of
+ *  a sprite that don't touch stay in the same frame as long as they overlap its box. The frames
+ *  are sorted row by row, each row going from left to right.
+ *
+ * @param image - The image to slice
+ *
+ * @return The frames of the image
+ */
+QVector <QRect> Aerodlyn::SpriteSheet::detectFrames (const QImage &image)
+{
+    AERO_PROFILE_SCOPE ("SpriteSheet::detectFrames");
+
+    const QImage alpha = image.convertToFormat (QImage::Format_Alpha8);
+    const int width = alpha.width (), height = alpha.height ();
+
+    QVector <QRect> boxes;
+    QBitArray visited (width * height);
+    QVector <int> pending;
+
+    // Each group is flooded from its first pixel in reading order, so every pixel is visited once
+    for (int y = 0; y < height; y++)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            if (visited.testBit (y * width + x) || !isOpaque (alpha, x, y))
+                continue;
+
+            int left = x, top = y, right = x, bottom = y;
+
+            visited.setBit (y * width + x);
+            pending.append (y * width + x);
+
+            while (!pending.isEmpty ())
+            {
+                const int index = pending.takeLast ();
+                const int px = index % width, py = index / width;
+
+                left   = std::min (left, px);
+                right  = std::max (right, px);
+                top    = std::min (top, py);
+                bottom = std::max (bottom, py);
+
+                for (int ny = std::max (py - 1, 0); ny <= std::min (py + 1, height - 1); ny++)
+                {
+                    for (int nx = std::max (px - 1, 0); nx <= std::min (px + 1, width - 1); nx++)
+                    {
+                        if (!visited.testBit (ny * width + nx) && isOpaque (alpha, nx, ny))
+                        {
+                            visited.setBit (ny * width + nx);
+                            pending.append (ny * width + nx);
+                        }
+                    }
+                }
+            }
+
+            boxes.append (QRect (left, top, right - left + 1, bottom - top + 1));
+        }
+    }
+
+    // Joining two boxes may make the result overlap a box that neither overlapped, so boxes are
+    //  joined until none overlap
+    for (bool joined = true; joined; )
+    {
+        joined = false;
+        std::sort (boxes.begin (), boxes.end (), [] (const QRect &a, const QRect &b) { return a.left () < b.left (); });
+
+        for (int i = 0; i < boxes.size (); i++)
+        {
+            for (int j = i + 1; j < boxes.size () && boxes.at (j).left () <= boxes.at (i).right (); )
+            {
+                if (boxes.at (i).intersects (boxes.at (j)))
+                {
+                    boxes [i] = boxes.at (i).united (boxes.at (j));
+                    boxes.remove (j);
+                    joined = true;
+                }
+
+                else
+                    j++;
+            }
+        }
+    }
+
+    // A box starts a new row unless its middle is within the height of the first box of the row
+    std::sort (boxes.begin (), boxes.end (), [] (const QRect &a, const QRect &b)
+        { return a.top () < b.top () || (a.top () == b.top () && a.left () < b.left ()); });
+
+    for (int first = 0; first < boxes.size (); )
+    {
+        const QRect &start = boxes.at (first);
+
+        int last = first + 1;
+        while (last < boxes.size () && boxes.at (last).top () + boxes.at (last).height () / 2 <= start.bottom ())
+            last++;
+
+        std::sort (boxes.begin () + first, boxes.begin () + last, [] (const QRect &a, const QRect &b)
+            { return a.left () < b.left (); });
+
+        first = last;
+    }
+
+    return boxes;
+}
+
+/**
+ * Returns the index of the frame containing the given point.
+ *
+ * @param frames - The frames to search
+ * @param point  - The point, in the image's pixel coordinates
+ *
+ * @return The index of the first frame containing the point, -1 if none does
+ */
+int Aerodlyn::SpriteSheet::frameAt (const QVector <QRect> &frames, const QPointF &point)
+{
+    for (int i = 0; i < frames.size (); i++)
+    {
+        const QRect &frame = frames.at (i);
+
+        if (point.x () >= frame.left () && point.x () < frame.left () + frame.width () &&
+            point.y () >= frame.top () && point.y () < frame.top () + frame.height ())
+            return i;
+    }
+
+    return -1;
+}
+
+/**
+ * Carries the given region, traced on one frame, over to every frame of the given image, one
+ *  frame per task across the available cores. Vertices further than the given distance from
+ *  the outline in either frame are only moved by the offset between the frames.
+ *
+ * @param region - The region to carry over
+ * @param image  - The image the frames are in
+ * @param origin - The position in the image of the origin of the region's coordinates
+ * @param frames - The frames of the image
+ * @param source - The index of the frame the region was traced on, which must be valid
+ * @param reach  - How far from each vertex the outline is searched for, in pixels
+ *
+ * @return The region in each frame, the region itself for the frame it was traced on
+ */
+QVector <QPolygonF> Aerodlyn::SpriteSheet::propagate (const QPolygonF &region, const QImage &image,
+    const QPointF &origin, const QVector <QRect> &frames, const int source, const int reach)
+{
+    AERO_PROFILE_SCOPE ("SpriteSheet::propagate");
+
+    const QImage alpha = image.convertToFormat (QImage::Format_Alpha8);
+    const QRect from = frames.at (source).intersected (alpha.rect ());
+
+    // Where each vertex lies relative to the outline of the frame it was traced on, which is the
+    //  same for every other frame
+    QVector <std::optional <QPointF>> anchors;
+    anchors.reserve (region.size ());
+
+    for (const QPointF &vertex : region)
+        anchors.append (nearestOutline (alpha, from, vertex + origin, reach));
+
+    QVector <QPolygonF> regions (frames.size ());
+    QPolygonF *results = regions.data ();
+
+    QVector <int> indices (frames.size ());
+    std::iota (indices.begin (), indices.end (), 0);
+
+    QtConcurrent::blockingMap (indices, [&] (const int &index)
+    {
+        if (index == source)
+        {
+            results [index] = region;
+            return;
+        }
+
+        const QRect to = frames.at (index).intersected (alpha.rect ());
+        const QPointF offset (frames.at (index).left () - frames.at (source).left (),
+                              frames.at (index).top () - frames.at (source).top ());
+
+        QPolygonF &moved = results [index];
+        moved.reserve (region.size ());
+
+        for (int i = 0; i < region.size (); i++)
+        {
+            const QPointF position = region.at (i) + origin + offset;
+            const std::optional <QPointF> outline = anchors.at (i).has_value () ?
+                nearestOutline (alpha, to, position, reach) : std::nullopt;
+
+            moved.append ((outline.has_value () ? *outline + (region.at (i) + origin - *anchors.at (i)) : position) - origin);
+        }
+    });
+
+    return regions;
+}
+
+/* Private Methods */
+/**
+ * Determines if the pixel at the given position of the given alpha mask is opaque.
+ *
+ * @param alpha - The alpha mask of the image, with one byte per pixel
+ * @param x     - The x position of the pixel, which must be within the mask
+ * @param y     - The y position of the pixel, which must be within the mask
+ *
+ * @return True if the pixel is opaque, false otherwise
+ */
+bool Aerodlyn::SpriteSheet::isOpaque (const QImage &alpha, const int x, const int y)
+    { return alpha.constScanLine (y) [x] > ALPHA_THRESHOLD; }
+
+/**
+ * Determines if the pixel at the given position of the given alpha mask is on the outline of
+ *  the sprite in the given frame.
+ *
+ * @param alpha - The alpha mask of the image, with one byte per pixel
+ * @param frame - The frame the pixel is in
+ * @param x     - The x position of the pixel, which must be within the frame
+ * @param y     - The y position of the pixel, which must be within the frame
+ *
+ * @return True if the pixel is on the outline, false otherwise
+ */
+bool Aerodlyn::SpriteSheet::isOutline (const QImage &alpha, const QRect &frame, const int x, const int y)
+{
+    if (!isOpaque (alpha, x, y))
+        return false;
+
+    if (x == frame.left () || x == frame.right () || y == frame.top () || y == frame.bottom ())
+        return true;
+
+    return !isOpaque (alpha, x - 1, y) || !isOpaque (alpha, x + 1, y) || !isOpaque (alpha, x, y - 1) ||
+           !isOpaque (alpha, x, y + 1);
+}
+
+/**
+ * Finds the pixel on the outline of the sprite in the given frame nearest to the given point,
+ *  searching outwards one ring of pixels at a time.
+ *
+ * @param alpha - The alpha mask of the image, with one byte per pixel
+ * @param frame - The frame to search, which must be within the mask
+ * @param point - The point, in the image's pixel coordinates
+ * @param reach - How far from the point to search, in pixels
+ *
+ * @return The center of the nearest pixel on the outline, or an empty optional if there is none
+ *  within reach
+ */
+std::optional <QPointF> Aerodlyn::SpriteSheet::nearestOutline (const QImage &alpha, const QRect &frame,
+    const QPointF &point, const int reach)
+{
+    if (frame.isEmpty ())
+        return std::nullopt;
+
+    const int cx = static_cast <int> (std::floor (point.x ())), cy = static_cast <int> (std::floor (point.y ()));
+
+    std::optional <QPointF> nearest;
+    double nearestDistance = std::numeric_limits <double>::infinity ();
+
+    const auto visit = [&] (const int x, const int y)
+    {
+        if (!isOutline (alpha, frame, x, y))
+            return;
+
+        const QPointF center (x + 0.5, y + 0.5);
+        const double distance = std::hypot (center.x () - point.x (), center.y () - point.y ());
+
+        if (distance < nearestDistance)
+        {
+            nearest         = center;
+            nearestDistance = distance;
+        }
+    };
+
+    for (int ring = 0; ring <= reach; ring++)
+    {
+        // Pixels in a ring are at least half a pixel less than its number away
+        if (nearestDistance <= ring - 0.5)
+            break;
+
+        const int left = std::max (cx - ring, frame.left ()), right  = std::min (cx + ring, frame.right ());
+        const int top  = std::max (cy - ring, frame.top ()),  bottom = std::min (cy + ring, frame.bottom ());
+
+        // Only the pixels on the ring itself, as the ones inside it were searched already
+        for (int y = top; y <= bottom; y++)
+        {
+            if (y == cy - ring || y == cy + ring)
+            {
+                for (int x = left; x <= right; x++)
+                    visit (x, y);
+            }
+
+            else
+            {
+                if (cx - ring >= left)
+                    visit (cx - ring, y);
+
+                if (cx + ring <= right)
+                    visit (cx + ring, y);
+            }
+        }
+    }
+
+    return nearest;
+}
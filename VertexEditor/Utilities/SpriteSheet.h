@@ -0,0 +1,138 @@
+#ifndef SPRITE_SHEET_H
+#define SPRITE_SHEET_H
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <optional>
+
+#include <QBitArray>
+#include <QImage>
+#include <QPoint>
+#include <QPointF>
+#include <QPolygonF>
+#include <QRect>
+#include <QSize>
+#include <QVector>
+#include <QtConcurrent>
+
+#include "Root/Profiler.h"
+
+namespace Aerodlyn
+{
+    /**
+     * Slices a sprite sheet into frames, either on a grid or around the opaque parts of the image, and
+     *  carries a region traced on one frame over to the others. Each vertex of the region is moved by
+     *  the offset between the frames, then snapped to the outline of the sprite in its new frame: the
+     *  nearest pixel on that outline takes the place of the nearest one in the frame it was traced on,
+     *  so a region traced loosely around a sprite stays just as loose around the others.
+     *
+     * A pixel is opaque if its alpha is above a threshold, and on the outline if it is opaque and next
+     *  to a pixel that isn't, or to the edge of its frame. Images without an alpha channel are opaque
+     *  everywhere, so their frames are outlined by their edges.
+     *
+     * @author  Patrick Jahnig (Aerodlyn)
+     * @version 2026.10.19
+     */
+    class SpriteSheet
+    {
+        public: // Methods
+            /**
+             * Slices an image of the given size into a grid of equally sized frames, row by row. Pixels
+             *  left over on the right or at the bottom don't belong to any frame.
+             *
+             * @param size    - The size of the image
+             * @param columns - The number of frames across
+             * @param rows    - The number of frames down
+             *
+             * @return The frames, or none if the image is smaller than the grid
+             */
+            static QVector <QRect> gridFrames (const QSize &size, const int columns, const int rows);
+
+            /**
+             * Finds the frames of the given image around its opaque parts. Every group of opaque pixels
+             *  touching each other (diagonally too) is boxed, and boxes that overlap are joined, so parts of
+             *  a sprite that don't touch stay in the same frame as long as they overlap its box. The frames
+             *  are sorted row by row, each row going from left to right.
+             *
+             * @param image - The image to slice
+             *
+             * @return The frames of the image
+             */
+            static QVector <QRect> detectFrames (const QImage &image);
+
+            /**
+             * Returns the index of the frame containing the given point.
+             *
+             * @param frames - The frames to search
+             * @param point  - The point, in the image's pixel coordinates
+             *
+             * @return The index of the first frame containing the point, -1 if none does
+             */
+            static int frameAt (const QVector <QRect> &frames, const QPointF &point);
+
+            /**
+             * Carries the given region, traced on one frame, over to every frame of the given image, one
+             *  frame per task across the available cores. Vertices further than the given distance from
+             *  the outline in either frame are only moved by the offset between the frames.
+             *
+             * @param region - The region to carry over
+             * @param image  - The image the frames are in
+             * @param origin - The position in the image of the origin of the region's coordinates
+             * @param frames - The frames of the image
+             * @param source - The index of the frame the region was traced on, which must be valid
+             * @param reach  - How far from each vertex the outline is searched for, in pixels
+             *
+             * @return The region in each frame, the region itself for the frame it was traced on
+             */
+            static QVector <QPolygonF> propagate (const QPolygonF &region, const QImage &image, const QPointF &origin,
+                const QVector <QRect> &frames, const int source, const int reach);
+
+        private: // Methods
+            /**
+             * Determines if the pixel at the given position of the given alpha mask is opaque.
+             *
+             * @param alpha - The alpha mask of the image, with one byte per pixel
+             * @param x     - The x position of the pixel, which must be within the mask
+             * @param y     - The y position of the pixel, which must be within the mask
+             *
+             * @return True if the pixel is opaque, false otherwise
+             */
+            static bool isOpaque (const QImage &alpha, const int x, const int y);
+
+            /**
+             * Determines if the pixel at the given position of the given alpha mask is on the outline of
+             *  the sprite in the given frame.
+             *
+             * @param alpha - The alpha mask of the image, with one byte per pixel
+             * @param frame - The frame the pixel is in
+             * @param x     - The x position of the pixel, which must be within the frame
+             * @param y     - The y position of the pixel, which must be within the frame
+             *
+             * @return True if the pixel is on the outline, false otherwise
+             */
+            static bool isOutline (const QImage &alpha, const QRect &frame, const int x, const int y);
+
+            /**
+             * Finds the pixel on the outline of the sprite in the given frame nearest to the given point,
+             *  searching outwards one ring of pixels at a time.
+             *
+             * @param alpha - The alpha mask of the image, with one byte per pixel
+             * @param frame - The frame to search, which must be within the mask
+             * @param point - The point, in the image's pixel coordinates
+             * @param reach - How far from the point to search, in pixels
+             *
+             * @return The center of the nearest pixel on the outline, or an empty optional if there is none
+             *  within reach
+             */
+            static std::optional <QPointF> nearestOutline (const QImage &alpha, const QRect &frame, const QPointF &point,
+                const int reach);
+
+        private: // Variables
+            // The alpha above which a pixel belongs to a sprite, allowing for faint antialiased edges
+            static constexpr int ALPHA_THRESHOLD = 8;
+    };
+}
+
+#endif // SPRITE_SHEET_H
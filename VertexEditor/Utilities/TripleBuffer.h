@@ -0,0 +1,79 @@
+#ifndef TRIPLE_BUFFER_H
+#define TRIPLE_BUFFER_H
+
+#include <atomic>
+
+namespace Aerodlyn
+{
+    /**
+     * Hands values from one thread to another without either of them ever waiting on the other. The
+     *  writer fills its back slot and publishes it, the reader takes the latest published value into
+     *  its front slot, and a third slot in the middle is swapped between them with a single atomic
+     *  exchange. Values published before the reader took them are dropped, so the reader only ever
+     *  sees the latest one.
+     *
+     * Each slot is only ever touched by the side that holds it, so values may be reused in place
+     *  (such as painting into the same image again) without copying them. Only one thread may write,
+     *  and only one may read.
+     *
+     * @author  Patrick Jahnig (Aerodlyn)
+     * @version 2026.10.19
+     */
+    template <typename T>
+    class TripleBuffer
+    {
+        public: // Methods
+            /**
+             * Returns the slot the writer fills before publishing it. Only the writer may call this.
+             *
+             * @return The back slot
+             */
+            T &back ()
+                { return slots [backIndex]; }
+
+            /**
+             * Publishes the back slot, replacing any value the reader hasn't taken yet, and gives the
+             *  writer another slot to fill. Only the writer may call this.
+             */
+            void publish ()
+                { backIndex = middle.exchange (backIndex | FRESH, std::memory_order_acq_rel) & INDEX_MASK; }
+
+            /**
+             * Takes the latest published value into the front slot, if one was published since the last
+             *  time. Only the reader may call this.
+             *
+             * @return True if a new value was taken, false if the front slot is still the latest
+             */
+            bool take ()
+            {
+                if ((middle.load (std::memory_order_acquire) & FRESH) == 0)
+                    return false;
+
+                frontIndex = middle.exchange (frontIndex, std::memory_order_acq_rel) & INDEX_MASK;
+                return true;
+            }
+
+            /**
+             * Returns the slot holding the value the reader last took, which the reader may also change.
+             *  Only the reader may call this.
+             *
+             * @return The front slot
+             */
+            T &front ()
+                { return slots [frontIndex]; }
+
+        private: // Variables
+            // The middle index holds this bit while its slot was published and not taken yet
+            static constexpr int               FRESH      = 4;
+            static constexpr int               INDEX_MASK = 3;
+
+            int                                backIndex  = 0;
+            int                                frontIndex = 2;
+
+            std::atomic <int>                  middle     { 1 };
+
+            T                                  slots [3];
+    };
+}
+
+#endif // TRIPLE_BUFFER_H
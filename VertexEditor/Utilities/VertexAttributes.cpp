@@ -0,0 +1,349 @@
+#include "VertexAttributes.h"
+
+/**
+ * Typed per-vertex attributes of a region (such as materials, one-way flags or normals), which a
+ *  QPolygonF can't hold. Each attribute is a named channel storing its values in one array of its
+ *  own, parallel to the vertices of the region, so reading a channel for every vertex walks
+ *  contiguous memory. Vectors store their two components next to each other.
+ *
+ * A data set without attributes holds only the empty (shared) vector of channels, so it allocates
+ *  nothing. The channels must be kept as long as the region, see {@link #insertVertex},
+ *  {@link #removeVertex}, {@link #remap} and {@link #resize}.
+ *
+ * @author  Patrick Jahnig (Aerodlyn)
+ * @version 2026.10.19
+ */
+
+namespace
+{
+    bool isIntegral (const Aerodlyn::VertexAttributes::Type type)
+        { return type == Aerodlyn::VertexAttributes::Type::Flag || type == Aerodlyn::VertexAttributes::Type::Integer; }
+}
+
+/* Public Methods */
+/**
+ * Determines if there are no channels.
+ *
+ * @return True if there are no channels, false otherwise
+ */
+bool Aerodlyn::VertexAttributes::isEmpty () const
+    { return channels.isEmpty (); }
+
+/**
+ * Returns the number of channels.
+ *
+ * @return The number of channels
+ */
+int Aerodlyn::VertexAttributes::channelCount () const
+    { return channels.size (); }
+
+/**
+ * Returns the channel at the given index.
+ *
+ * @param index - The index of the channel, which must be valid
+ *
+ * @return The channel at the given index
+ */
+const Aerodlyn::VertexAttributes::Channel &Aerodlyn::VertexAttributes::channel (const int index) const
+    { return channels.at (index); }
+
+/**
+ * Returns the index of the channel with the given name.
+ *
+ * @param name - The name of the channel to find
+ *
+ * @return The index of the channel if one exists with the given name, -1 otherwise
+ */
+int Aerodlyn::VertexAttributes::indexOf (const QString &name) const
+{
+    for (int i = 0; i < channels.size (); i++)
+    {
+        if (channels.at (i).name == name)
+            return i;
+    }
+
+    return -1;
+}
+
+/**
+ * Adds a channel with the given name and type, with a value of zero (or false) for each of the
+ *  given number of vertices.
+ *
+ * @param name        - The name of the channel
+ * @param type        - The type of the values of the channel
+ * @param vertexCount - The number of vertices of the region
+ *
+ * @return True if the channel was added, false if the name is empty or already in use
+ */
+bool Aerodlyn::VertexAttributes::addChannel (const QString &name, const Type type, const int vertexCount)
+{
+    Channel channel;
+    channel.name = name;
+    channel.type = type;
+
+    if (isIntegral (type))
+        channel.integers.fill (0, vertexCount);
+
+    else
+        channel.reals.fill (0.0f, vertexCount * components (type));
+
+    return addChannel (std::move (channel));
+}
+
+/**
+ * Adds the given channel, values included.
+ *
+ * @param channel - The channel to add, whose array for its type must hold a value (or vector)
+ *                  for every vertex of the region
+ *
+ * @return True if the channel was added, false if its name is empty or already in use
+ */
+bool Aerodlyn::VertexAttributes::addChannel (Channel channel)
+{
+    if (channel.name.isEmpty () || indexOf (channel.name) != -1)
+        return false;
+
+    // Only the array for its type is kept, so the other one allocates nothing
+    if (isIntegral (channel.type))
+        channel.reals.clear ();
+
+    else
+        channel.integers.clear ();
+
+    channels.append (std::move (channel));
+    return true;
+}
+
+/**
+ * Removes the channel with the given name.
+ *
+ * @param name - The name of the channel to remove
+ *
+ * @return True if the channel was removed, false if none has the given name
+ */
+bool Aerodlyn::VertexAttributes::removeChannel (const QString &name)
+{
+    const int index = indexOf (name);
+    if (index == -1)
+        return false;
+
+    channels.remove (index);
+    return true;
+}
+
+/**
+ * Returns the names of the channels, in the order they were added.
+ *
+ * @return The names of the channels
+ */
+QStringList Aerodlyn::VertexAttributes::names () const
+{
+    QStringList names;
+    for (const Channel &channel : channels)
+        names.append (channel.name);
+
+    return names;
+}
+
+/**
+ * Returns a component of the value of the given channel for the given vertex.
+ *
+ * @param channel   - The index of the channel, which must be valid
+ * @param vertex    - The index of the vertex, which must be valid
+ * @param component - 0, or 1 for the second component of a vector
+ *
+ * @return The value, with flags as 0 or 1
+ */
+double Aerodlyn::VertexAttributes::value (const int channel, const int vertex, const int component) const
+{
+    const Channel &values = channels.at (channel);
+
+    if (isIntegral (values.type))
+        return values.integers.at (vertex);
+
+    return values.reals.at (vertex * components (values.type) + component);
+}
+
+/**
+ * Sets a component of the value of the given channel for the given vertex. Values are converted
+ *  to the type of the channel, with any nonzero value being a set flag.
+ *
+ * @param channel   - The index of the channel, which must be valid
+ * @param vertex    - The index of the vertex, which must be valid
+ * @param value     - The new value
+ * @param component - 0, or 1 for the second component of a vector
+ */
+void Aerodlyn::VertexAttributes::setValue (const int channel, const int vertex, const double value, const int component)
+{
+    Channel &values = channels [channel];
+
+    if (values.type == Type::Flag)
+        values.integers [vertex] = value != 0.0 ? 1 : 0;
+
+    else if (values.type == Type::Integer)
+        values.integers [vertex] = static_cast <qint32> (std::lround (value));
+
+    else
+        values.reals [vertex * components (values.type) + component] = static_cast <float> (value);
+}
+
+/**
+ * Inserts a vertex with a value of zero (or false) in every channel before the given index, to
+ *  match a vertex inserted into the region.
+ *
+ * @param index - The index of the new vertex, from 0 to the number of vertices
+ */
+void Aerodlyn::VertexAttributes::insertVertex (const int index)
+{
+    // Checked first, as iterating mutably would detach the shared empty vector
+    if (channels.isEmpty ())
+        return;
+
+    for (Channel &channel : channels)
+    {
+        if (isIntegral (channel.type))
+            channel.integers.insert (index, 0);
+
+        else
+            channel.reals.insert (index * components (channel.type), components (channel.type), 0.0f);
+    }
+}
+
+/**
+ * Removes the vertex at the given index from every channel, to match a vertex removed from the
+ *  region.
+ *
+ * @param index - The index of the vertex to remove, which must be valid
+ */
+void Aerodlyn::VertexAttributes::removeVertex (const int index)
+{
+    if (channels.isEmpty ())
+        return;
+
+    for (Channel &channel : channels)
+    {
+        if (isIntegral (channel.type))
+            channel.integers.remove (index);
+
+        else
+            channel.reals.remove (index * components (channel.type), components (channel.type));
+    }
+}
+
+/**
+ * Rebuilds every channel from the values of the given vertices, to follow a region rebuilt from
+ *  some of its vertices (in any order).
+ *
+ * @param sources - For each vertex of the new region, the index of the vertex it was before, which
+ *                  must be valid
+ */
+void Aerodlyn::VertexAttributes::remap (const QVector <int> &sources)
+{
+    if (channels.isEmpty ())
+        return;
+
+    for (Channel &channel : channels)
+    {
+        const int width = components (channel.type);
+
+        if (isIntegral (channel.type))
+        {
+            QVector <qint32> values;
+            values.reserve (sources.size ());
+
+            for (const int source : sources)
+                values.append (channel.integers.at (source));
+
+            channel.integers = values;
+        }
+
+        else
+        {
+            QVector <float> values;
+            values.reserve (sources.size () * width);
+
+            for (const int source : sources)
+            {
+                for (int i = 0; i < width; i++)
+                    values.append (channel.reals.at (source * width + i));
+            }
+
+            channel.reals = values;
+        }
+    }
+}
+
+/**
+ * Truncates every channel, or pads it with zeros (or false), to the given number of vertices.
+ *  Keeps the channels aligned after the region was replaced or cleared.
+ *
+ * @param vertexCount - The number of vertices of the region
+ */
+void Aerodlyn::VertexAttributes::resize (const int vertexCount)
+{
+    if (channels.isEmpty ())
+        return;
+
+    // QVector::resize value-initializes new elements, so padding is zeros
+    for (Channel &channel : channels)
+    {
+        if (isIntegral (channel.type))
+            channel.integers.resize (vertexCount);
+
+        else
+            channel.reals.resize (vertexCount * components (channel.type));
+    }
+}
+
+/**
+ * Determines if the given attributes have the same channels, holding the same values.
+ *
+ * @param other - The attributes to compare with
+ *
+ * @return True if the attributes are equal, false otherwise
+ */
+bool Aerodlyn::VertexAttributes::operator== (const VertexAttributes &other) const
+{
+    if (channels.size () != other.channels.size ())
+        return false;
+
+    for (int i = 0; i < channels.size (); i++)
+    {
+        const Channel &a = channels.at (i), &b = other.channels.at (i);
+
+        if (a.name != b.name || a.type != b.type || a.integers != b.integers || a.reals != b.reals)
+            return false;
+    }
+
+    return true;
+}
+
+/**
+ * Returns the number of components of a value of the given type.
+ *
+ * @param type - The type of a channel
+ *
+ * @return 2 for vectors, 1 otherwise
+ */
+int Aerodlyn::VertexAttributes::components (const Type type)
+    { return type == Type::Vector ? 2 : 1; }
+
+/**
+ * Returns the name of the given type, for showing to the user.
+ *
+ * @param type - The type of a channel
+ *
+ * @return The name of the type
+ */
+QString Aerodlyn::VertexAttributes::typeName (const Type type)
+{
+    switch (type)
+    {
+        case Type::Flag:    return "Flag";
+        case Type::Integer: return "Integer";
+        case Type::Scalar:  return "Scalar";
+        case Type::Vector:  return "Vector";
+    }
+
+    return QString ();
+}
@@ -0,0 +1,206 @@
+#ifndef VERTEX_ATTRIBUTES_H
+#define VERTEX_ATTRIBUTES_H
+
+#include <cmath>
+
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+namespace Aerodlyn
+{
+    /**
+     * Typed per-vertex attributes of a region (such as materials, one-way flags or normals), which a
+     *  QPolygonF can't hold. Each attribute is a named channel storing its values in one array of its
+     *  own, parallel to the vertices of the region, so reading a channel for every vertex walks
+     *  contiguous memory. Vectors store their two components next to each other.
+     *
+     * A data set without attributes holds only the empty (shared) vector of channels, so it allocates
+     *  nothing. The channels must be kept as long as the region, see {@link #insertVertex},
+     *  {@link #removeVertex}, {@link #remap} and {@link #resize}.
+     *
+     * @author  Patrick Jahnig (Aerodlyn)
+     * @version 2026.10.19
+     */
+    class VertexAttributes
+    {
+        public: // Types
+            /**
+             * The type of the values of a channel. Flags and integers are stored as integers, scalars and
+             *  vectors (two components) as floats. The values are part of the project file format.
+             */
+            enum class Type : quint8 { Flag = 0, Integer = 1, Scalar = 2, Vector = 3 };
+
+            /**
+             * A named attribute with one value (or vector) per vertex. Only the array matching its type is
+             *  used.
+             */
+            struct Channel
+            {
+                QString          name;
+
+                Type             type = Type::Scalar;
+
+                QVector <qint32> integers;
+                QVector <float>  reals;
+            };
+
+        public: // Methods
+            /**
+             * Determines if there are no channels.
+             *
+             * @return True if there are no channels, false otherwise
+             */
+            bool isEmpty () const;
+
+            /**
+             * Returns the number of channels.
+             *
+             * @return The number of channels
+             */
+            int channelCount () const;
+
+            /**
+             * Returns the channel at the given index.
+             *
+             * @param index - The index of the channel, which must be valid
+             *
+             * @return The channel at the given index
+             */
+            const Channel &channel (const int index) const;
+
+            /**
+             * Returns the index of the channel with the given name.
+             *
+             * @param name - The name of the channel to find
+             *
+             * @return The index of the channel if one exists with the given name, -1 otherwise
+             */
+            int indexOf (const QString &name) const;
+
+            /**
+             * Adds a channel with the given name and type, with a value of zero (or false) for each of the
+             *  given number of vertices.
+             *
+             * @param name        - The name of the channel
+             * @param type        - The type of the values of the channel
+             * @param vertexCount - The number of vertices of the region
+             *
+             * @return True if the channel was added, false if the name is empty or already in use
+             */
+            bool addChannel (const QString &name, const Type type, const int vertexCount);
+
+            /**
+             * Adds the given channel, values included.
+             *
+             * @param channel - The channel to add, whose array for its type must hold a value (or vector)
+             *                  for every vertex of the region
+             *
+             * @return True if the channel was added, false if its name is empty or already in use
+             */
+            bool addChannel (Channel channel);
+
+            /**
+             * Removes the channel with the given name.
+             *
+             * @param name - The name of the channel to remove
+             *
+             * @return True if the channel was removed, false if none has the given name
+             */
+            bool removeChannel (const QString &name);
+
+            /**
+             * Returns the names of the channels, in the order they were added.
+             *
+             * @return The names of the channels
+             */
+            QStringList names () const;
+
+            /**
+             * Returns a component of the value of the given channel for the given vertex.
+             *
+             * @param channel   - The index of the channel, which must be valid
+             * @param vertex    - The index of the vertex, which must be valid
+             * @param component - 0, or 1 for the second component of a vector
+             *
+             * @return The value, with flags as 0 or 1
+             */
+            double value (const int channel, const int vertex, const int component = 0) const;
+
+            /**
+             * Sets a component of the value of the given channel for the given vertex. Values are converted
+             *  to the type of the channel, with any nonzero value being a set flag.
+             *
+             * @param channel   - The index of the channel, which must be valid
+             * @param vertex    - The index of the vertex, which must be valid
+             * @param value     - The new value
+             * @param component - 0, or 1 for the second component of a vector
+             */
+            void setValue (const int channel, const int vertex, const double value, const int component = 0);
+
+            /**
+             * Inserts a vertex with a value of zero (or false) in every channel before the given index, to
+             *  match a vertex inserted into the region.
+             *
+             * @param index - The index of the new vertex, from 0 to the number of vertices
+             */
+            void insertVertex (const int index);
+
+            /**
+             * Removes the vertex at the given index from every channel, to match a vertex removed from the
+             *  region.
+             *
+             * @param index - The index of the vertex to remove, which must be valid
+             */
+            void removeVertex (const int index);
+
+            /**
+             * Rebuilds every channel from the values of the given vertices, to follow a region rebuilt from
+             *  some of its vertices (in any order).
+             *
+             * @param sources - For each vertex of the new region, the index of the vertex it was before, which
+             *                  must be valid
+             */
+            void remap (const QVector <int> &sources);
+
+            /**
+             * Truncates every channel, or pads it with zeros (or false), to the given number of vertices.
+             *  Keeps the channels aligned after the region was replaced or cleared.
+             *
+             * @param vertexCount - The number of vertices of the region
+             */
+            void resize (const int vertexCount);
+
+            /**
+             * Determines if the given attributes have the same channels, holding the same values.
+             *
+             * @param other - The attributes to compare with
+             *
+             * @return True if the attributes are equal, false otherwise
+             */
+            bool operator== (const VertexAttributes &other) const;
+
+            /**
+             * Returns the number of components of a value of the given type.
+             *
+             * @param type - The type of a channel
+             *
+             * @return 2 for vectors, 1 otherwise
+             */
+            static int components (const Type type);
+
+            /**
+             * Returns the name of the given type, for showing to the user.
+             *
+             * @param type - The type of a channel
+             *
+             * @return The name of the type
+             */
+            static QString typeName (const Type type);
+
+        private: // Variables
+            QVector <Channel> channels;
+    };
+}
+
+#endif // VERTEX_ATTRIBUTES_H
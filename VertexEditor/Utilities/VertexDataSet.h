@@ -4,19 +4,30 @@
 #include <QString>
 #include <QPolygonF>
 
+#include "RegionGeometry.h"
+#include "VertexAttributes.h"
+
 namespace Aerodlyn
 {
     /**
      * A pair that is the representation of a series of points making up a polygonal region of
-     *  vertices, with a name.
+     *  vertices, with a name, and optional attributes per vertex. Also tracks whether the data set
+     *  changed since it was last saved, and caches the geometry derived from its region.
      *
      * @author  Patrick Jahnig (Aerodlyn)
-     * @version 2019.01.14
+     * @version 2026.10.19
      */
     struct VertexDataSet
     {
         QString   name;
         QPolygonF region;
+
+        // Kept as long as the region (see VertexDataSetCollection#markDirty), empty unless added
+        VertexAttributes attributes = VertexAttributes ();
+
+        bool      dirty = true;
+
+        mutable RegionGeometry geometry = RegionGeometry ();
     };
 }
 
@@ -1,10 +1,13 @@
 #include "VertexDataSetCollection.h"
 
 /**
- * Represents a collection of data sets, each identified by a user-typed name.
+ * Represents a collection of data sets, each identified by a user-typed name. Data sets are kept
+ *  sorted by name, so lookups by name are binary searches, and are indexed by their bounding boxes
+ *  (see {@link DataSetRTree}), so finding the data sets at a point doesn't look at every data set.
+ *  The index catches up with edits on the next query, only reinserting the data sets that changed.
  *
  * @author  Patrick Jahnig (Aerodlyn)
- * @version 2020.01.16
+ * @version 2026.10.19
  */
 
 /* Public Methods */
@@ -18,13 +21,9 @@
  */
 bool Aerodlyn::VertexDataSetCollection::contains (const QString &name) const
 {
-    for (auto it = sets.begin (); it != sets.end (); it++)
-    {
-        if (it->name.compare (name) == 0)
-            return true;
-    }
+    AERO_PROFILE_SCOPE ("VertexDataSetCollection::contains");
 
-    return false;
+    return indexOf (name) != -1;
 }
 
 /**
@@ -37,16 +36,72 @@ bool Aerodlyn::VertexDataSetCollection::contains (const QString &name) const
  */
 bool Aerodlyn::VertexDataSetCollection::remove (const QString &name)
 {
-    for (int i = 0; i < sets.length (); i++)
+    AERO_PROFILE_SCOPE ("VertexDataSetCollection::remove");
+
+    return removeAt (indexOf (name));
+}
+
+/**
+ * Removes the vertex data set at the given index.
+ *
+ * @param index - The index of the data set to remove
+ *
+ * @return True if the data set was removed (i.e. the given index was valid), false otherwise
+ */
+bool Aerodlyn::VertexDataSetCollection::removeAt (const int index)
+{
+    if (index < 0 || index >= sets.length ())
+        return false;
+
+    removed.append (sets.at (index).name);
+    invalidateBounds (sets.at (index).name);
+    sets.remove (index);
+    revisionCount++;
+
+    return true;
+}
+
+/**
+ * Removes every data set from this collection.
+ */
+void Aerodlyn::VertexDataSetCollection::removeAll ()
+{
+    AERO_PROFILE_SCOPE ("VertexDataSetCollection::removeAll");
+
+    for (const VertexDataSet &set : sets)
+        removed.append (set.name);
+
+    sets.clear ();
+    revisionCount++;
+
+    boundsIndexed = false;
+    boundsIndex.clear ();
+    staleBounds.clear ();
+}
+
+/**
+ * Clears the region of every data set in this collection, keeping the data sets themselves.
+ */
+void Aerodlyn::VertexDataSetCollection::clearAll ()
+{
+    AERO_PROFILE_SCOPE ("VertexDataSetCollection::clearAll");
+
+    for (VertexDataSet &set : sets)
     {
-        if (sets.at (i).name.compare (name) == 0)
+        if (!set.region.isEmpty ())
         {
-            sets.remove (i);
-            return true;
+            set.region.clear ();
+            set.attributes.resize (0);
+            set.geometry.invalidate ();
+            set.dirty = true;
         }
     }
 
-    return false;
+    revisionCount++;
+
+    boundsIndexed = false;
+    boundsIndex.clear ();
+    staleBounds.clear ();
 }
 
 /**
@@ -60,22 +115,138 @@ bool Aerodlyn::VertexDataSetCollection::remove (const QString &name)
  */
 int Aerodlyn::VertexDataSetCollection::add (const QString name)
 {
-    auto it = sets.begin ();
-    for (; it != sets.end (); it++)
+    AERO_PROFILE_SCOPE ("VertexDataSetCollection::add");
+
+    const auto it = lowerBound (name);
+    if (it != sets.end () && it->name.compare (name) == 0)
+        return -1;
+
+    const int index = static_cast <int> (std::distance (sets.constBegin (), it));
+    sets.insert (index, { name, QPolygonF () });
+    revisionCount++;
+
+    return index;
+}
+
+/**
+ * Creates and adds a new vertex data set for each of the given names, merging them into the
+ *  collection in a single pass rather than inserting them one at a time. Names that are repeated
+ *  within the batch or already in use are skipped.
+ *
+ * @param names - The names of the data sets to create and add
+ *
+ * @return The names that weren't added because they were repeated or already in use, sorted
+ *  alphabetically and listed once each
+ */
+QStringList Aerodlyn::VertexDataSetCollection::addAll (QStringList names)
+{
+    AERO_PROFILE_SCOPE ("VertexDataSetCollection::addAll");
+
+    QVector <VertexDataSet> dataSets;
+    dataSets.reserve (names.size ());
+
+    for (QString &name : names)
+        dataSets.append ({ std::move (name), QPolygonF () });
+
+    return insertAll (std::move (dataSets));
+}
+
+/**
+ * Adds the given data sets, regions included, merging them into the collection in a single pass
+ *  like {@link #addAll}. Data sets whose names are repeated within the batch (after the first)
+ *  or already in use are skipped.
+ *
+ * @param dataSets - The data sets to add
+ *
+ * @return The names that weren't added because they were repeated or already in use, sorted
+ *  alphabetically and listed once each
+ */
+QStringList Aerodlyn::VertexDataSetCollection::insertAll (QVector <VertexDataSet> dataSets)
+{
+    AERO_PROFILE_SCOPE ("VertexDataSetCollection::insertAll");
+
+    QStringList conflicts;
+
+    // Stable, so that the first of the data sets sharing a name is the one added
+    std::stable_sort (dataSets.begin (), dataSets.end (), [] (const VertexDataSet &a, const VertexDataSet &b)
+        { return a.name.compare (b.name) < 0; });
+
+    // Both sequences are sorted, so they are merged like in a merge sort
+    QVector <VertexDataSet> merged;
+    merged.reserve (sets.size () + dataSets.size ());
+
+    // Data sets are moved out as they are merged, so the name of the previous one is kept aside
+    QString previousName;
+
+    auto existing = sets.begin ();
+    for (int i = 0; i < dataSets.size (); i++)
     {
-        const int comparison = it->name.compare (name);
+        VertexDataSet &dataSet = dataSets [i];
+
+        const bool repeated = i > 0 && previousName == dataSet.name;
+        previousName = dataSet.name;
+
+        if (repeated)
+        {
+            if (conflicts.isEmpty () || conflicts.last () != dataSet.name)
+                conflicts.append (dataSet.name);
+
+            continue;
+        }
+
+        for (; existing != sets.end () && existing->name.compare (dataSet.name) < 0; existing++)
+            merged.append (std::move (*existing));
 
-        if (comparison == 0)
-            return -1;
+        if (existing != sets.end () && existing->name.compare (dataSet.name) == 0)
+        {
+            conflicts.append (dataSet.name);
+            continue;
+        }
 
-        else if (comparison > 0)
-            break;
+        if (!dataSet.region.isEmpty ())
+            invalidateBounds (dataSet.name);
+
+        dataSet.dirty = true;
+        merged.append (std::move (dataSet));
     }
 
-    it = sets.insert (it, { name, QPolygonF () });
-    return static_cast <int> (std::distance (sets.begin (), it));
+    for (; existing != sets.end (); existing++)
+        merged.append (std::move (*existing));
+
+    sets = std::move (merged);
+    revisionCount++;
+
+    return conflicts;
 }
 
+/**
+ * Returns the index of the vertex data set with the given name.
+ *
+ * @param name - The name of the data set to find
+ *
+ * @return The index of the data set (sorted alphabetically) if one exists with the given name,
+ *  -1 otherwise
+ */
+int Aerodlyn::VertexDataSetCollection::indexOf (const QString &name) const
+{
+    const auto it = lowerBound (name);
+    if (it == sets.end () || it->name.compare (name) != 0)
+        return -1;
+
+    return static_cast <int> (std::distance (sets.constBegin (), it));
+}
+
+/**
+ * Returns the index at which a data set with the given name is, or would be inserted if it
+ *  doesn't exist, keeping the collection sorted by name.
+ *
+ * @param name - The name of the data set
+ *
+ * @return The index of the data set with the given name, or its insertion index
+ */
+int Aerodlyn::VertexDataSetCollection::insertionIndex (const QString &name) const
+    { return static_cast <int> (std::distance (sets.constBegin (), lowerBound (name))); }
+
 /**
  * Returns the current number of data sets in this collection.
  *
@@ -84,6 +255,16 @@ int Aerodlyn::VertexDataSetCollection::add (const QString name)
 int Aerodlyn::VertexDataSetCollection::length () const
     { return sets.length (); }
 
+/**
+ * Returns the vertex data set at the given index, which must be valid.
+ *
+ * @param index - The index of the data set to return
+ *
+ * @return The data set at the given index
+ */
+const Aerodlyn::VertexDataSet &Aerodlyn::VertexDataSetCollection::at (const int index) const
+    { return sets.at (index); }
+
 /**
  * Returns the region represented by the vertex data set with the given name, if one exists.
  *
@@ -94,11 +275,416 @@ int Aerodlyn::VertexDataSetCollection::length () const
  */
 std::optional <std::reference_wrapper <QPolygonF>> Aerodlyn::VertexDataSetCollection::get (const QString &name)
 {
-    for (auto it = sets.begin (); it != sets.end (); it++)
+    AERO_PROFILE_SCOPE ("VertexDataSetCollection::get");
+
+    const int index = indexOf (name);
+    if (index == -1)
+        return std::nullopt;
+
+    return std::optional <std::reference_wrapper <QPolygonF>> { sets [index].region };
+}
+
+/**
+ * Returns the derived geometry cache of the data set with the given name, if one exists. The
+ *  cache must be given the region (see {@link RegionGeometry#update}) before it is read.
+ *
+ * @param name - The name of the data set
+ *
+ * @return The derived geometry cache of the data set if one exists, an empty optional otherwise
+ */
+std::optional <std::reference_wrapper <Aerodlyn::RegionGeometry>> Aerodlyn::VertexDataSetCollection::geometry (const QString &name)
+{
+    const int index = indexOf (name);
+    if (index == -1)
+        return std::nullopt;
+
+    return std::optional <std::reference_wrapper <RegionGeometry>> { sets [index].geometry };
+}
+
+/**
+ * Returns the attributes of the vertices of the data set with the given name, if one exists.
+ *  Adding or removing a channel, or editing a value, must be followed by
+ *  {@link #markAttributesDirty}.
+ *
+ * @param name - The name of the data set
+ *
+ * @return The attributes of the data set if one exists, an empty optional otherwise
+ */
+std::optional <std::reference_wrapper <Aerodlyn::VertexAttributes>> Aerodlyn::VertexDataSetCollection::attributes (const QString &name)
+{
+    const int index = indexOf (name);
+    if (index == -1)
+        return std::nullopt;
+
+    return std::optional <std::reference_wrapper <VertexAttributes>> { sets [index].attributes };
+}
+
+/**
+ * Returns the geometry derived from the region of the data set at the given index, computing it
+ *  first if it changed since it was last computed.
+ *
+ * @param index - The index of the data set, which must be valid
+ *
+ * @return The up-to-date derived geometry of the data set
+ */
+const Aerodlyn::RegionGeometry &Aerodlyn::VertexDataSetCollection::geometryAt (const int index) const
+{
+    const VertexDataSet &set = sets.at (index);
+    set.geometry.update (set.region);
+
+    return set.geometry;
+}
+
+/**
+ * Returns the closed path through the vertices of the data set at the given index, for painting,
+ *  building it first if the region changed since it was last built.
+ *
+ * @param index - The index of the data set, which must be valid
+ *
+ * @return The path of the data set's region
+ */
+const QPainterPath &Aerodlyn::VertexDataSetCollection::pathAt (const int index) const
+{
+    const VertexDataSet &set = sets.at (index);
+    return set.geometry.path (set.region);
+}
+
+/**
+ * Moves the vertex at the given index of the data set with the given name, updating its derived
+ *  geometry incrementally and marking it as changed.
+ *
+ * @param name     - The name of the data set
+ * @param index    - The index of the vertex to move
+ * @param position - The new position of the vertex
+ *
+ * @return True if the vertex was moved, false if no such data set or vertex exists
+ */
+bool Aerodlyn::VertexDataSetCollection::movePoint (const QString &name, const int index, const QPointF &position)
+{
+    const int setIndex = indexOf (name);
+    if (setIndex == -1 || index < 0 || index >= sets.at (setIndex).region.size ())
+        return false;
+
+    VertexDataSet &set = sets [setIndex];
+    const QPointF from = set.region.at (index);
+
+    set.region [index] = position;
+    set.geometry.moveVertex (set.region, index, from);
+    set.dirty = true;
+    revisionCount++;
+
+    invalidateBounds (name);
+
+    return true;
+}
+
+/**
+ * Inserts a vertex before the given index of the data set with the given name, giving it a value
+ *  of zero (or false) in every attribute channel, and marks the data set as changed.
+ *
+ * @param name     - The name of the data set
+ * @param index    - The index of the new vertex, from 0 to the number of vertices
+ * @param position - The position of the new vertex
+ *
+ * @return True if the vertex was inserted, false if no such data set exists or the index is
+ *  out of range
+ */
+bool Aerodlyn::VertexDataSetCollection::insertPoint (const QString &name, const int index, const QPointF &position)
+{
+    const int setIndex = indexOf (name);
+    if (setIndex == -1 || index < 0 || index > sets.at (setIndex).region.size ())
+        return false;
+
+    VertexDataSet &set = sets [setIndex];
+
+    set.region.insert (index, position);
+    set.attributes.insertVertex (index);
+    set.geometry.invalidate ();
+    set.dirty = true;
+    revisionCount++;
+
+    invalidateBounds (name);
+
+    return true;
+}
+
+/**
+ * Removes the vertex at the given index of the data set with the given name, along with its
+ *  attribute values, and marks the data set as changed.
+ *
+ * @param name  - The name of the data set
+ * @param index - The index of the vertex to remove
+ *
+ * @return True if the vertex was removed, false if no such data set or vertex exists
+ */
+bool Aerodlyn::VertexDataSetCollection::removePoint (const QString &name, const int index)
+{
+    const int setIndex = indexOf (name);
+    if (setIndex == -1 || index < 0 || index >= sets.at (setIndex).region.size ())
+        return false;
+
+    VertexDataSet &set = sets [setIndex];
+
+    set.region.remove (index);
+    set.attributes.removeVertex (index);
+    set.geometry.invalidate ();
+    set.dirty = true;
+    revisionCount++;
+
+    invalidateBounds (name);
+
+    return true;
+}
+
+/**
+ * Marks the data set with the given name as changed since it was last saved, invalidates its
+ *  derived geometry, and truncates or pads its attribute channels to the length of its region. Must
+ *  be called after editing the region returned by {@link #get}, as the collection can't see those
+ *  edits. Vertices inserted or removed in the middle of the region should go through
+ *  {@link #insertPoint} and {@link #removePoint} instead, which keep their attribute values aligned.
+ *
+ * @param name - The name of the data set that changed
+ *
+ * @return True if a data set with the given name exists, false otherwise
+ */
+bool Aerodlyn::VertexDataSetCollection::markDirty (const QString &name)
+{
+    const int index = indexOf (name);
+    if (index == -1)
+        return false;
+
+    sets [index].attributes.resize (sets.at (index).region.size ());
+    sets [index].dirty = true;
+    sets [index].geometry.invalidate ();
+    revisionCount++;
+
+    invalidateBounds (name);
+
+    return true;
+}
+
+/**
+ * Marks the data set with the given name as changed since it was last saved, after its attributes
+ *  (see {@link #attributes}) were edited. Its derived geometry stays valid.
+ *
+ * @param name - The name of the data set that changed
+ *
+ * @return True if a data set with the given name exists, false otherwise
+ */
+bool Aerodlyn::VertexDataSetCollection::markAttributesDirty (const QString &name)
+{
+    const int index = indexOf (name);
+    if (index == -1)
+        return false;
+
+    sets [index].dirty = true;
+    revisionCount++;
+
+    return true;
+}
+
+/**
+ * Determines if the data set at the given index changed since it was last saved.
+ *
+ * @param index - The index of the data set, which must be valid
+ *
+ * @return True if the data set changed since it was last saved, false otherwise
+ */
+bool Aerodlyn::VertexDataSetCollection::isDirty (const int index) const
+    { return sets.at (index).dirty; }
+
+/**
+ * Determines if any data set was added, removed or changed since the collection was last saved.
+ *
+ * @return True if there are unsaved changes, false otherwise
+ */
+bool Aerodlyn::VertexDataSetCollection::hasChanges () const
+{
+    return !removed.isEmpty () ||
+        std::any_of (sets.constBegin (), sets.constEnd (), [] (const VertexDataSet &set) { return set.dirty; });
+}
+
+/**
+ * Returns the names of the data sets removed since the collection was last saved, in the order
+ *  they were removed. A name may also belong to a data set added again afterwards.
+ *
+ * @return The names of the removed data sets
+ */
+const QStringList &Aerodlyn::VertexDataSetCollection::removedNames () const
+    { return removed; }
+
+/**
+ * Marks every data set as saved, and forgets the data sets removed since the last save.
+ */
+void Aerodlyn::VertexDataSetCollection::markClean ()
+{
+    for (VertexDataSet &set : sets)
+        set.dirty = false;
+
+    removed.clear ();
+}
+
+/**
+ * Returns a number that changes whenever a data set is added, removed or changed (as far as the
+ *  collection can see, see {@link #markDirty}), so that copies of the collection can tell if
+ *  they are out of date.
+ *
+ * @return The revision of the collection
+ */
+quint64 Aerodlyn::VertexDataSetCollection::revision () const
+    { return revisionCount; }
+
+/**
+ * Returns the slabs that speed up point-in-polygon tests on the region of the data set at the
+ *  given index, building them first if the region changed since they were last built.
+ *
+ * @param index - The index of the data set, which must be valid
+ *
+ * @return The slabs of the data set's region
+ */
+const Aerodlyn::RegionSlabIndex &Aerodlyn::VertexDataSetCollection::slabsAt (const int index) const
+{
+    const VertexDataSet &set = sets.at (index);
+    return set.geometry.slabs (set.region);
+}
+
+/**
+ * Returns the shapes enclosing the region of the data set at the given index, computing them
+ *  first if the region changed since they were last computed.
+ *
+ * @param index - The index of the data set, which must be valid
+ *
+ * @return The shapes enclosing the data set's region
+ */
+const Aerodlyn::BoundingVolumes::Volumes &Aerodlyn::VertexDataSetCollection::volumesAt (const int index) const
+{
+    const VertexDataSet &set = sets.at (index);
+    return set.geometry.volumes (set.region);
+}
+
+/**
+ * Brings the shapes enclosing the region of every data set up to date, computing those that are
+ *  out of date in parallel.
+ */
+void Aerodlyn::VertexDataSetCollection::updateVolumes () const
+{
+    AERO_PROFILE_SCOPE ("VertexDataSetCollection::updateVolumes");
+
+    QVector <int> indices (sets.size ());
+    std::iota (indices.begin (), indices.end (), 0);
+
+    // Every task only touches the cache of its own data set
+    QtConcurrent::blockingMap (indices, [this] (const int &index) { volumesAt (index); });
+}
+
+/**
+ * Determines if the given point is inside the region of the data set at the given index, treating
+ *  the region as a closed polygon filled with the even-odd rule.
+ *
+ * @param index - The index of the data set, which must be valid
+ * @param point - The point to test
+ *
+ * @return True if the point is inside the region, false otherwise
+ */
+bool Aerodlyn::VertexDataSetCollection::containsPoint (const int index, const QPointF &point) const
+{
+    return slabsAt (index).contains (sets.at (index).region, point);
+}
+
+/**
+ * Returns the names of the data sets whose regions contain the given point.
+ *
+ * @param point - The point to search
+ *
+ * @return The names of the data sets found, sorted
+ */
+QStringList Aerodlyn::VertexDataSetCollection::regionsAt (const QPointF &point) const
+{
+    QStringList found = boundsTree ().query (point);
+
+    found.erase (std::remove_if (found.begin (), found.end (),
+        [this, &point] (const QString &name) { return !containsPoint (indexOf (name), point); }), found.end ());
+
+    return found;
+}
+
+/**
+ * Returns the names of the data sets whose bounding boxes touch the given box, including along
+ *  their edges. Data sets without vertices are never found.
+ *
+ * @param box - The box to search
+ *
+ * @return The names of the data sets found, sorted
+ */
+QStringList Aerodlyn::VertexDataSetCollection::regionsIn (const QRectF &box) const
+    { return boundsTree ().query (box); }
+
+/**
+ * Returns the index of the bounding boxes of the data sets, brought up to date first. Data sets
+ *  without vertices aren't in it.
+ *
+ * @return The up-to-date bounding box index
+ */
+const Aerodlyn::DataSetRTree &Aerodlyn::VertexDataSetCollection::boundsTree () const
+{
+    // Packing the whole tree again beats reinserting once a good part of the data sets changed
+    if (!boundsIndexed || staleBounds.size () > sets.size () / 4)
+    {
+        QVector <QPair <QString, QRectF>> entries;
+        entries.reserve (sets.size ());
+
+        for (int i = 0; i < sets.size (); i++)
+        {
+            if (!sets.at (i).region.isEmpty ())
+                entries.append ({ sets.at (i).name, geometryAt (i).bounds () });
+        }
+
+        boundsIndex.build (entries);
+        boundsIndexed = true;
+        staleBounds.clear ();
+
+        return boundsIndex;
+    }
+
+    for (const QString &name : qAsConst (staleBounds))
     {
-        if (it->name.compare (name) == 0)
-            return std::optional <std::reference_wrapper <QPolygonF>> { it->region };
+        const int index = indexOf (name);
+
+        if (index == -1 || sets.at (index).region.isEmpty ())
+            boundsIndex.remove (name);
+
+        else
+            boundsIndex.insert (name, geometryAt (index).bounds ());
     }
 
-    return std::nullopt;
+    staleBounds.clear ();
+    return boundsIndex;
+}
+
+/* Private Methods */
+/**
+ * Notes that the bounding box of the data set with the given name may have changed, so that it
+ *  is reinserted into the index before the next query.
+ *
+ * @param name - The name of the data set
+ */
+void Aerodlyn::VertexDataSetCollection::invalidateBounds (const QString &name)
+{
+    // Until the index is first built, there is nothing to keep up to date
+    if (boundsIndexed)
+        staleBounds.insert (name);
+}
+
+/**
+ * Returns an iterator to the first data set whose name does not sort before the given name, found
+ *  by binary search as the data sets are kept sorted by name.
+ *
+ * @param name - The name to search for
+ *
+ * @return An iterator to the first data set not sorting before the given name, or the end iterator
+ */
+QVector <Aerodlyn::VertexDataSet>::const_iterator Aerodlyn::VertexDataSetCollection::lowerBound (const QString &name) const
+{
+    return std::lower_bound (sets.constBegin (), sets.constEnd (), name,
+        [] (const VertexDataSet &set, const QString &value) { return set.name.compare (value) < 0; });
 }
@@ -1,28 +1,55 @@
 #ifndef VERTEXDATASETCOLLECTION_H
 #define VERTEXDATASETCOLLECTION_H
 
+#include <algorithm>
 #include <functional>
 #include <iterator>
+#include <numeric>
 #include <optional>
 
+#include <QPainterPath>
+#include <QPair>
+#include <QPointF>
 #include <QPolygonF>
+#include <QRectF>
+#include <QSet>
+#include <QStringList>
 #include <QVector>
+#include <QtConcurrent>
 
+#include "Root/Profiler.h"
+
+#include "DataSetRTree.h"
+#include "RegionGeometry.h"
+#include "VertexAttributes.h"
 #include "VertexDataSet.h"
 
 namespace Aerodlyn
 {
     /**
-     * Represents a collection of data sets, each identified by a user-typed name.
+     * Represents a collection of data sets, each identified by a user-typed name. Data sets are kept
+     *  sorted by name, so lookups by name are binary searches, and are indexed by their bounding boxes
+     *  (see {@link DataSetRTree}), so finding the data sets at a point doesn't look at every data set.
+     *  The index catches up with edits on the next query, only reinserting the data sets that changed.
      *
      * @author  Patrick Jahnig (Aerodlyn)
-     * @version 2020.01.14
+     * @version 2026.10.19
      */
     class VertexDataSetCollection
     {
         private: // Fields
+            quint64                 revisionCount = 0;
+
+            mutable bool            boundsIndexed = false;
+
+            QStringList             removed;
+
             QVector <VertexDataSet> sets;
 
+            mutable DataSetRTree    boundsIndex;
+
+            mutable QSet <QString>  staleBounds;
+
         public: // Methods
             /**
              * Determines if the collection has a vertex data set with the given name.
@@ -44,6 +71,25 @@ namespace Aerodlyn
              */
             bool remove (const QString &name);
 
+            /**
+             * Removes the vertex data set at the given index.
+             *
+             * @param index - The index of the data set to remove
+             *
+             * @return True if the data set was removed (i.e. the given index was valid), false otherwise
+             */
+            bool removeAt (const int index);
+
+            /**
+             * Removes every data set from this collection.
+             */
+            void removeAll ();
+
+            /**
+             * Clears the region of every data set in this collection, keeping the data sets themselves.
+             */
+            void clearAll ();
+
             /**
              * Creates and adds a new vertex data set with the given name. This method will not
              *  create duplicate data sets, so names must be unique.
@@ -55,6 +101,50 @@ namespace Aerodlyn
              */
             int add (const QString name);
 
+            /**
+             * Creates and adds a new vertex data set for each of the given names, merging them into the
+             *  collection in a single pass rather than inserting them one at a time. Names that are repeated
+             *  within the batch or already in use are skipped.
+             *
+             * @param names - The names of the data sets to create and add
+             *
+             * @return The names that weren't added because they were repeated or already in use, sorted
+             *  alphabetically and listed once each
+             */
+            QStringList addAll (QStringList names);
+
+            /**
+             * Adds the given data sets, regions included, merging them into the collection in a single pass
+             *  like {@link #addAll}. Data sets whose names are repeated within the batch (after the first)
+             *  or already in use are skipped.
+             *
+             * @param dataSets - The data sets to add
+             *
+             * @return The names that weren't added because they were repeated or already in use, sorted
+             *  alphabetically and listed once each
+             */
+            QStringList insertAll (QVector <VertexDataSet> dataSets);
+
+            /**
+             * Returns the index of the vertex data set with the given name.
+             *
+             * @param name - The name of the data set to find
+             *
+             * @return The index of the data set (sorted alphabetically) if one exists with the given name,
+             *  -1 otherwise
+             */
+            int indexOf (const QString &name) const;
+
+            /**
+             * Returns the index at which a data set with the given name is, or would be inserted if it
+             *  doesn't exist, keeping the collection sorted by name.
+             *
+             * @param name - The name of the data set
+             *
+             * @return The index of the data set with the given name, or its insertion index
+             */
+            int insertionIndex (const QString &name) const;
+
             /**
              * Returns the current number of data sets in this collection.
              *
@@ -62,6 +152,15 @@ namespace Aerodlyn
              */
             int length () const;
 
+            /**
+             * Returns the vertex data set at the given index, which must be valid.
+             *
+             * @param index - The index of the data set to return
+             *
+             * @return The data set at the given index
+             */
+            const VertexDataSet &at (const int index) const;
+
             /**
              * Returns the region represented by the vertex data set with the given name, if one exists.
              *
@@ -71,6 +170,227 @@ namespace Aerodlyn
              *  not exist, then an empty optional is returned
              */
             std::optional <std::reference_wrapper <QPolygonF>> get (const QString &name);
+
+            /**
+             * Returns the derived geometry cache of the data set with the given name, if one exists. The
+             *  cache must be given the region (see {@link RegionGeometry#update}) before it is read.
+             *
+             * @param name - The name of the data set
+             *
+             * @return The derived geometry cache of the data set if one exists, an empty optional otherwise
+             */
+            std::optional <std::reference_wrapper <RegionGeometry>> geometry (const QString &name);
+
+            /**
+             * Returns the attributes of the vertices of the data set with the given name, if one exists.
+             *  Adding or removing a channel, or editing a value, must be followed by
+             *  {@link #markAttributesDirty}.
+             *
+             * @param name - The name of the data set
+             *
+             * @return The attributes of the data set if one exists, an empty optional otherwise
+             */
+            std::optional <std::reference_wrapper <VertexAttributes>> attributes (const QString &name);
+
+            /**
+             * Returns the geometry derived from the region of the data set at the given index, computing it
+             *  first if it changed since it was last computed.
+             *
+             * @param index - The index of the data set, which must be valid
+             *
+             * @return The up-to-date derived geometry of the data set
+             */
+            const RegionGeometry &geometryAt (const int index) const;
+
+            /**
+             * Returns the closed path through the vertices of the data set at the given index, for painting,
+             *  building it first if the region changed since it was last built.
+             *
+             * @param index - The index of the data set, which must be valid
+             *
+             * @return The path of the data set's region
+             */
+            const QPainterPath &pathAt (const int index) const;
+
+            /**
+             * Moves the vertex at the given index of the data set with the given name, updating its derived
+             *  geometry incrementally and marking it as changed.
+             *
+             * @param name     - The name of the data set
+             * @param index    - The index of the vertex to move
+             * @param position - The new position of the vertex
+             *
+             * @return True if the vertex was moved, false if no such data set or vertex exists
+             */
+            bool movePoint (const QString &name, const int index, const QPointF &position);
+
+            /**
+             * Inserts a vertex before the given index of the data set with the given name, giving it a value
+             *  of zero (or false) in every attribute channel, and marks the data set as changed.
+             *
+             * @param name     - The name of the data set
+             * @param index    - The index of the new vertex, from 0 to the number of vertices
+             * @param position - The position of the new vertex
+             *
+             * @return True if the vertex was inserted, false if no such data set exists or the index is
+             *  out of range
+             */
+            bool insertPoint (const QString &name, const int index, const QPointF &position);
+
+            /**
+             * Removes the vertex at the given index of the data set with the given name, along with its
+             *  attribute values, and marks the data set as changed.
+             *
+             * @param name  - The name of the data set
+             * @param index - The index of the vertex to remove
+             *
+             * @return True if the vertex was removed, false if no such data set or vertex exists
+             */
+            bool removePoint (const QString &name, const int index);
+
+            /**
+             * Marks the data set with the given name as changed since it was last saved, invalidates its
+             *  derived geometry, and truncates or pads its attribute channels to the length of its region. Must
+             *  be called after editing the region returned by {@link #get}, as the collection can't see those
+             *  edits. Vertices inserted or removed in the middle of the region should go through
+             *  {@link #insertPoint} and {@link #removePoint} instead, which keep their attribute values aligned.
+             *
+             * @param name - The name of the data set that changed
+             *
+             * @return True if a data set with the given name exists, false otherwise
+             */
+            bool markDirty (const QString &name);
+
+            /**
+             * Marks the data set with the given name as changed since it was last saved, after its attributes
+             *  (see {@link #attributes}) were edited. Its derived geometry stays valid.
+             *
+             * @param name - The name of the data set that changed
+             *
+             * @return True if a data set with the given name exists, false otherwise
+             */
+            bool markAttributesDirty (const QString &name);
+
+            /**
+             * Determines if the data set at the given index changed since it was last saved.
+             *
+             * @param index - The index of the data set, which must be valid
+             *
+             * @return True if the data set changed since it was last saved, false otherwise
+             */
+            bool isDirty (const int index) const;
+
+            /**
+             * Determines if any data set was added, removed or changed since the collection was last saved.
+             *
+             * @return True if there are unsaved changes, false otherwise
+             */
+            bool hasChanges () const;
+
+            /**
+             * Returns the names of the data sets removed since the collection was last saved, in the order
+             *  they were removed. A name may also belong to a data set added again afterwards.
+             *
+             * @return The names of the removed data sets
+             */
+            const QStringList &removedNames () const;
+
+            /**
+             * Marks every data set as saved, and forgets the data sets removed since the last save.
+             */
+            void markClean ();
+
+            /**
+             * Returns a number that changes whenever a data set is added, removed or changed (as far as the
+             *  collection can see, see {@link #markDirty}), so that copies of the collection can tell if
+             *  they are out of date.
+             *
+             * @return The revision of the collection
+             */
+            quint64 revision () const;
+
+            /**
+             * Returns the slabs that speed up point-in-polygon tests on the region of the data set at the
+             *  given index, building them first if the region changed since they were last built.
+             *
+             * @param index - The index of the data set, which must be valid
+             *
+             * @return The slabs of the data set's region
+             */
+            const RegionSlabIndex &slabsAt (const int index) const;
+
+            /**
+             * Returns the shapes enclosing the region of the data set at the given index, computing them
+             *  first if the region changed since they were last computed.
+             *
+             * @param index - The index of the data set, which must be valid
+             *
+             * @return The shapes enclosing the data set's region
+             */
+            const BoundingVolumes::Volumes &volumesAt (const int index) const;
+
+            /**
+             * Brings the shapes enclosing the region of every data set up to date, computing those that are
+             *  out of date in parallel.
+             */
+            void updateVolumes () const;
+
+            /**
+             * Determines if the given point is inside the region of the data set at the given index, treating
+             *  the region as a closed polygon filled with the even-odd rule.
+             *
+             * @param index - The index of the data set, which must be valid
+             * @param point - The point to test
+             *
+             * @return True if the point is inside the region, false otherwise
+             */
+            bool containsPoint (const int index, const QPointF &point) const;
+
+            /**
+             * Returns the names of the data sets whose regions contain the given point.
+             *
+             * @param point - The point to search
+             *
+             * @return The names of the data sets found, sorted
+             */
+            QStringList regionsAt (const QPointF &point) const;
+
+            /**
+             * Returns the names of the data sets whose bounding boxes touch the given box, including along
+             *  their edges. Data sets without vertices are never found.
+             *
+             * @param box - The box to search
+             *
+             * @return The names of the data sets found, sorted
+             */
+            QStringList regionsIn (const QRectF &box) const;
+
+            /**
+             * Returns the index of the bounding boxes of the data sets, brought up to date first. Data sets
+             *  without vertices aren't in it.
+             *
+             * @return The up-to-date bounding box index
+             */
+            const DataSetRTree &boundsTree () const;
+
+        private: // Methods
+            /**
+             * Notes that the bounding box of the data set with the given name may have changed, so that it
+             *  is reinserted into the index before the next query.
+             *
+             * @param name - The name of the data set
+             */
+            void invalidateBounds (const QString &name);
+
+            /**
+             * Returns an iterator to the first data set whose name does not sort before the given name, found
+             *  by binary search as the data sets are kept sorted by name.
+             *
+             * @param name - The name to search for
+             *
+             * @return An iterator to the first data set not sorting before the given name, or the end iterator
+             */
+            QVector <VertexDataSet>::const_iterator lowerBound (const QString &name) const;
     };
 }
 
@@ -0,0 +1,153 @@
+#include "VertexTransform.h"
+
+#if defined (__SSE2__)
+    #include <emmintrin.h>
+    #include <type_traits>
+#endif
+
+/**
+ * A 2D affine transform, applied in bulk to the vertices of a region. A point (x, y) is mapped to
+ *  (m11 * x + m21 * y + dx, m12 * x + m22 * y + dy), matching the layout used by QTransform.
+ *
+ * @author  Patrick Jahnig (Aerodlyn)
+ * @version 2026.10.19
+ */
+
+namespace
+{
+#if defined (__SSE2__)
+    static_assert (std::is_same <qreal, double>::value && sizeof (QPointF) == 2 * sizeof (double),
+        "The SSE2 transform kernel expects QPointF to be two packed doubles");
+
+    /**
+     * Maps a single packed (x, y) point in place. Each column of the matrix is broadcast against
+     *  the matching coordinate so that both output coordinates are produced by one multiply-add.
+     */
+    inline void mapPacked (double * const point, const __m128d column1, const __m128d column2, const __m128d offset)
+    {
+        const __m128d xy = _mm_loadu_pd (point);
+        const __m128d xx = _mm_unpacklo_pd (xy, xy);
+        const __m128d yy = _mm_unpackhi_pd (xy, xy);
+
+        _mm_storeu_pd (point, _mm_add_pd (_mm_add_pd (_mm_mul_pd (xx, column1), _mm_mul_pd (yy, column2)), offset));
+    }
+#endif
+}
+
+/* Constructors/Deconstructors */
+/**
+ * Creates a new {@link VertexTransform} instance that is the identity transform.
+ */
+Aerodlyn::VertexTransform::VertexTransform () {}
+
+/* Public Methods */
+/**
+ * Creates a transform that translates points by the given offset.
+ *
+ * @param offset - The offset to translate by
+ *
+ * @return The translation transform
+ */
+Aerodlyn::VertexTransform Aerodlyn::VertexTransform::translation (const QPointF &offset)
+{
+    VertexTransform transform;
+    transform.dx = offset.x ();
+    transform.dy = offset.y ();
+
+    return transform;
+}
+
+/**
+ * Creates a transform that uniformly scales points about the given origin.
+ *
+ * @param origin - The fixed point of the scale
+ * @param factor - The scale factor
+ *
+ * @return The scale transform
+ */
+Aerodlyn::VertexTransform Aerodlyn::VertexTransform::scale (const QPointF &origin, const double factor)
+{
+    VertexTransform transform;
+    transform.m11 = factor;
+    transform.m22 = factor;
+    transform.dx  = origin.x () * (1.0 - factor);
+    transform.dy  = origin.y () * (1.0 - factor);
+
+    return transform;
+}
+
+/**
+ * Creates a transform that rotates points about the given origin.
+ *
+ * @param origin  - The fixed point of the rotation
+ * @param radians - The angle to rotate by, in radians (clockwise on screen)
+ *
+ * @return The rotation transform
+ */
+Aerodlyn::VertexTransform Aerodlyn::VertexTransform::rotation (const QPointF &origin, const double radians)
+{
+    const double c = std::cos (radians), s = std::sin (radians);
+
+    VertexTransform transform;
+    transform.m11 = c;
+    transform.m12 = s;
+    transform.m21 = -s;
+    transform.m22 = c;
+    transform.dx  = origin.x () - (c * origin.x () - s * origin.y ());
+    transform.dy  = origin.y () - (s * origin.x () + c * origin.y ());
+
+    return transform;
+}
+
+/**
+ * Applies this transform to the vertices of the given region at the given indices. Indices
+ *  must be valid for the given region.
+ *
+ * @param region  - The region whose vertices are transformed in place
+ * @param indices - The indices of the vertices to transform
+ */
+void Aerodlyn::VertexTransform::apply (QPolygonF &region, const QVector <int> &indices) const
+{
+    QPointF * const points = region.data ();
+
+#if defined (__SSE2__)
+    const __m128d column1 = _mm_set_pd (m12, m11), column2 = _mm_set_pd (m22, m21), offset = _mm_set_pd (dy, dx);
+
+    for (const int index : indices)
+        mapPacked (reinterpret_cast <double *> (points + index), column1, column2, offset);
+#else
+    for (const int index : indices)
+        points [index] = map (points [index]);
+#endif
+}
+
+/**
+ * Applies this transform to every vertex of the given region.
+ *
+ * @param region - The region whose vertices are transformed in place
+ */
+void Aerodlyn::VertexTransform::apply (QPolygonF &region) const
+{
+    QPointF * const points = region.data ();
+    const int size = region.size ();
+
+#if defined (__SSE2__)
+    const __m128d column1 = _mm_set_pd (m12, m11), column2 = _mm_set_pd (m22, m21), offset = _mm_set_pd (dy, dx);
+
+    for (int i = 0; i < size; i++)
+        mapPacked (reinterpret_cast <double *> (points + i), column1, column2, offset);
+#else
+    for (int i = 0; i < size; i++)
+        points [i] = map (points [i]);
+#endif
+}
+
+/**
+ * Returns the given point mapped by this transform.
+ *
+ * @param point - The point to map
+ *
+ * @return The mapped point
+ */
+QPointF Aerodlyn::VertexTransform::map (const QPointF &point) const
+    { return QPointF (m11 * point.x () + m21 * point.y () + dx, m12 * point.x () + m22 * point.y () + dy); }
@@ -0,0 +1,89 @@
+#ifndef VERTEX_TRANSFORM_H
+#define VERTEX_TRANSFORM_H
+
+#include <cmath>
+
+#include <QPointF>
+#include <QPolygonF>
+#include <QVector>
+
+namespace Aerodlyn
+{
+    /**
+     * A 2D affine transform, applied in bulk to the vertices of a region. A point (x, y) is mapped to
+     *  (m11 * x + m21 * y + dx, m12 * x + m22 * y + dy), matching the layout used by QTransform.
+     *
+     * @author  Patrick Jahnig (Aerodlyn)
+     * @version 2026.10.19
+     */
+    class VertexTransform
+    {
+        public: // Constructors/Deconstructors
+            /**
+             * Creates a new {@link VertexTransform} instance that is the identity transform.
+             */
+            VertexTransform ();
+
+        public: // Methods
+            /**
+             * Creates a transform that translates points by the given offset.
+             *
+             * @param offset - The offset to translate by
+             *
+             * @return The translation transform
+             */
+            static VertexTransform translation (const QPointF &offset);
+
+            /**
+             * Creates a transform that uniformly scales points about the given origin.
+             *
+             * @param origin - The fixed point of the scale
+             * @param factor - The scale factor
+             *
+             * @return The scale transform
+             */
+            static VertexTransform scale (const QPointF &origin, const double factor);
+
+            /**
+             * Creates a transform that rotates points about the given origin.
+             *
+             * @param origin  - The fixed point of the rotation
+             * @param radians - The angle to rotate by, in radians (clockwise on screen)
+             *
+             * @return The rotation transform
+             */
+            static VertexTransform rotation (const QPointF &origin, const double radians);
+
+            /**
+             * Applies this transform to the vertices of the given region at the given indices. Indices
+             *  must be valid for the given region.
+             *
+             * @param region  - The region whose vertices are transformed in place
+             * @param indices - The indices of the vertices to transform
+             */
+            void apply (QPolygonF &region, const QVector <int> &indices) const;
+
+            /**
+             * Applies this transform to every vertex of the given region.
+             *
+             * @param region - The region whose vertices are transformed in place
+             */
+            void apply (QPolygonF &region) const;
+
+            /**
+             * Returns the given point mapped by this transform.
+             *
+             * @param point - The point to map
+             *
+             * @return The mapped point
+             */
+            QPointF map (const QPointF &point) const;
+
+        private: // Variables
+            double m11 = 1.0, m12 = 0.0,
+                   m21 = 0.0, m22 = 1.0,
+                   dx  = 0.0, dy  = 0.0;
+    };
+}
+
+#endif // VERTEX_TRANSFORM_H
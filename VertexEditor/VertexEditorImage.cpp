@@ -4,8 +4,12 @@
  * Designed to be a subcomponent of a VertexEditorWindow instance, this class handles user input
  *  related to a drawn image.
  *
+ * Multiple vertices can be selected by dragging a rectangle (Shift + drag) or a lasso (Ctrl + drag).
+ *  Dragging a selected vertex translates the whole selection, while Ctrl + wheel scales and
+ *  Shift + wheel rotates the selection about its centroid.
+ *
  * @author  Patrick Jahnig (psj516)
- * @version 2020.01.18
+ * @version 2026.10.19
  */
 
 /* Constructors/Deconstructors */
@@ -17,7 +21,10 @@
  */
 Aerodlyn::VertexEditorImage::VertexEditorImage (QWidget *parent) : QScrollArea (parent), PARENT (parent)
 {
-    image = new VertexEditorRenderedImage (selectedPointIndex, center);
+    image = new VertexEditorRenderedImage (selectedPointIndex, selectedPoints, selectionOutline, center);
+
+    scheduler = new FrameScheduler (this);
+    connect (scheduler, &FrameScheduler::frame, this, &VertexEditorImage::handleFrame);
 
     setMinimumWidth (300);
     setMouseTracking (true);
@@ -41,19 +48,116 @@ Aerodlyn::VertexEditorImage::~VertexEditorImage () {}
 bool Aerodlyn::VertexEditorImage::setImageFile (const QString &filepath)
     { return image->load (filepath); }
 
+/**
+ * Returns the size of the loaded image, which is also the extent of the regions drawn over it.
+ *  Region coordinates are relative to the center of the image.
+ *
+ * @return The size of the loaded image, or an empty size if no image is loaded
+ */
+QSize Aerodlyn::VertexEditorImage::imageSize () const
+    { return image->imageSize (); }
+
+/**
+ * Returns the loaded image, as it was read from its file.
+ *
+ * @return The loaded image, or a null image if no image is loaded
+ */
+const QImage &Aerodlyn::VertexEditorImage::loadedImage () const
+    { return image->loadedImage (); }
+
 /**
  * Sets the region to use for input handling and rendering.
  *
- * @param region - The {@link QPolygonF} region of points
+ * @param region   - The {@link QPolygonF} region of points
+ * @param geometry - The derived geometry cache of the region, used to skip hit-testing and painting
+ *                      the region when the mouse or the painted area is outside of its bounds
  */
-void Aerodlyn::VertexEditorImage::setRegion (std::optional <std::reference_wrapper <QPolygonF>> region)
+void Aerodlyn::VertexEditorImage::setRegion (std::optional <std::reference_wrapper <QPolygonF>> region,
+    std::optional <std::reference_wrapper <RegionGeometry>> geometry)
 {
-    this->region = region;
-    image->setRegion (this->region);
+    this->region   = region;
+    this->geometry = geometry;
+    image->setRegion (this->region, this->geometry);
+
+    spatialIndexDirty = true;
+    clearSelection ();
 }
 
+/**
+ * Requests that the rendered image be repainted. Requests are merged, so the image is repainted
+ *  at most once per display frame.
+ */
 void Aerodlyn::VertexEditorImage::update ()
-    { image->update (); }
+{
+    repaintRequested = true;
+    scheduler->requestFrame ();
+}
+
+/**
+ * Clears the current multi-vertex selection, if any.
+ */
+void Aerodlyn::VertexEditorImage::clearSelection ()
+{
+    selectedPoints.clear ();
+    selectionOutline.clear ();
+}
+
+/**
+ * Returns the indices, in ascending order, of the currently selected vertices.
+ *
+ * @return The indices of the currently selected vertices
+ */
+const QVector <int> &Aerodlyn::VertexEditorImage::selection () const
+    { return selectedPoints; }
+
+/**
+ * Returns the scheduler that paces input handling and repainting of this instance. Owners can
+ *  connect to its frame signal to batch their own refreshes into the same frame.
+ *
+ * @return The frame scheduler of this instance
+ */
+Aerodlyn::FrameScheduler *Aerodlyn::VertexEditorImage::frameScheduler () const
+    { return scheduler; }
+
+/**
+ * Determines if the latest frame composed of the rendered image shows its current state.
+ *
+ * @return True if the latest frame is current, false otherwise
+ */
+bool Aerodlyn::VertexEditorImage::hasCurrentFrame () const
+    { return image->hasCurrentFrame (); }
+
+/**
+ * Shows or hides the performance HUD drawn over the rendered image.
+ *
+ * @param visible - True to show the HUD, false to hide it
+ */
+void Aerodlyn::VertexEditorImage::setHudVisible (const bool visible)
+    { image->setHudVisible (visible); }
+
+/**
+ * Shows every data set of the given collection under the current region, or stops showing them.
+ *
+ * @param collection - The data sets to show, or null to only show the current region
+ */
+void Aerodlyn::VertexEditorImage::setOverlay (const VertexDataSetCollection *collection)
+{
+    image->setOverlay (collection);
+    update ();
+}
+
+/**
+ * Outlines the data sets of the given collection with the given names, or stops outlining them.
+ *
+ * @param collection - The data sets to outline from, or null to outline none
+ * @param names      - The names of the data sets to outline
+ */
+void Aerodlyn::VertexEditorImage::setHighlighted (const VertexDataSetCollection *collection,
+    const QSet <QString> &names)
+{
+    image->setHighlighted (collection, names);
+    update ();
+}
 
 /**
  * Returns the mouse position associated with the given {@link QMouseEvent} adjusted for the location
@@ -77,31 +181,16 @@ const QPointF Aerodlyn::VertexEditorImage::adjustedMousePosition (const QMouseEv
  */
 void Aerodlyn::VertexEditorImage::mouseMoveEvent (QMouseEvent *event)
 {
+    AERO_PROFILE_SCOPE ("VertexEditorImage::mouseMoveEvent");
+    scheduler->noteEvent ();
     if (!region.has_value ())
         return;
 
-    const QPointF adjPos = adjustedMousePosition (event);
-    if (!leftButtonHeld)
-    {
-        selectedPointIndex = -1;
-        for (int i = 0; i < region->get ().size () && selectedPointIndex == -1; i++)
-        {
-            const QPointF point = region->get ().at (i);
-            if (Utils::isInCircle (adjPos, point, POINT_RADIUS))
-                selectedPointIndex = i;
-        }
-    }
-
-    // TODO: Selected point index to prevent losing the point being dragged
-    if (selectedPointIndex != -1)
-    {
-        emit mouseHovered (selectedPointIndex);
+    // Only the latest position matters, it is applied once at the start of the next frame
+    pendingPosition = adjustedMousePosition (event);
+    movePending     = true;
 
-        if (leftButtonHeld)
-            emit mouseMoved (adjPos.x (), adjPos.y (), selectedPointIndex);
-    }
-
-    image->update ();
+    scheduler->requestFrame ();
 }
 
 /**
@@ -109,13 +198,46 @@ void Aerodlyn::VertexEditorImage::mouseMoveEvent (QMouseEvent *event)
  */
 void Aerodlyn::VertexEditorImage::mousePressEvent (QMouseEvent *event)
 {
+    scheduler->noteEvent ();
+    applyPendingMove ();
+
     const QPointF adjPos = adjustedMousePosition (event);
-    leftButtonHeld = true;
+    leftButtonHeld   = true;
+    dragOrigin       = adjPos;
+    lastDragPosition = adjPos;
+
+    if (event->modifiers () & Qt::AltModifier)
+        emit regionPicked (adjPos.x (), adjPos.y ());
 
-    if (selectedPointIndex == -1)
+    else if (region.has_value () && event->modifiers () & Qt::ShiftModifier)
+    {
+        dragMode = DragMode::Rectangle;
+        clearSelection ();
+    }
+
+    else if (region.has_value () && event->modifiers () & Qt::ControlModifier)
+    {
+        dragMode = DragMode::Lasso;
+        clearSelection ();
+        selectionOutline << adjPos;
+    }
+
+    else if (selectedPointIndex != -1 && std::binary_search (selectedPoints.begin (), selectedPoints.end (), selectedPointIndex))
+        dragMode = DragMode::Selection;
+
+    else if (selectedPointIndex != -1)
+    {
+        dragMode = DragMode::Point;
+        clearSelection ();
+    }
+
+    else if (!selectedPoints.isEmpty ())
+        clearSelection ();
+
+    else
         emit mouseClicked (adjPos.x (), adjPos.y ());
 
-    image->update ();
+    update ();
 }
 
 /**
@@ -124,7 +246,22 @@ void Aerodlyn::VertexEditorImage::mousePressEvent (QMouseEvent *event)
 void Aerodlyn::VertexEditorImage::mouseReleaseEvent (QMouseEvent *event)
 {
     Q_UNUSED (event)
+
+    scheduler->noteEvent ();
+    applyPendingMove ();
+
     leftButtonHeld = false;
+
+    if (dragMode == DragMode::Lasso && region.has_value ())
+        selectedPoints = indexedRegion ().queryPolygon (region->get (), selectionOutline);
+
+    if (dragMode == DragMode::Rectangle || dragMode == DragMode::Lasso)
+        selectionOutline.clear ();
+
+    if (repaintRequested || dragMode == DragMode::Rectangle || dragMode == DragMode::Lasso)
+        update ();
+
+    dragMode = DragMode::None;
 }
 
 /**
@@ -132,3 +269,189 @@ void Aerodlyn::VertexEditorImage::mouseReleaseEvent (QMouseEvent *event)
  */
 void Aerodlyn::VertexEditorImage::resizeEvent (QResizeEvent * const event)
     { image->resizeToFit (event->size ()); }
+
+/**
+ * See: https://doc.qt.io/qt-5/qwidget.html#wheelEvent
+ */
+void Aerodlyn::VertexEditorImage::wheelEvent (QWheelEvent *event)
+{
+    scheduler->noteEvent ();
+
+    const bool scaling = event->modifiers () & Qt::ControlModifier, rotating = event->modifiers () & Qt::ShiftModifier;
+    if (!region.has_value () || selectedPoints.isEmpty () || (!scaling && !rotating))
+    {
+        QScrollArea::wheelEvent (event);
+        return;
+    }
+
+    const int steps = event->angleDelta ().y () / 120;
+    if (steps == 0)
+        return;
+
+    if (scaling)
+        transformSelection (VertexTransform::scale (selectionCentroid (), std::pow (SCALE_STEP, steps)));
+
+    else
+        transformSelection (VertexTransform::rotation (selectionCentroid (), steps * ROTATION_STEP));
+
+    update ();
+    event->accept ();
+}
+
+/* Private Slots */
+/**
+ * Handles the start of a display frame by applying the latest pending mouse movement and issuing
+ *  a single repaint, or none if nothing visible changed.
+ */
+void Aerodlyn::VertexEditorImage::handleFrame ()
+{
+    AERO_PROFILE_SCOPE ("VertexEditorImage::handleFrame");
+    applyPendingMove ();
+
+    scheduler->noteFrame (repaintRequested);
+    if (repaintRequested)
+    {
+        repaintRequested = false;
+        image->compose (scheduler->frameTimer ());
+    }
+}
+
+/* Private Methods */
+/**
+ * Applies the latest mouse position recorded by {@link #mouseMoveEvent}, if any, updating the
+ *  hovered point and any drag in progress. A repaint is only flagged if the hovered point or the
+ *  dragged geometry changed.
+ */
+void Aerodlyn::VertexEditorImage::applyPendingMove ()
+{
+    if (!movePending || !region.has_value ())
+        return;
+
+    movePending = false;
+
+    const QPointF adjPos = pendingPosition;
+    const int previousIndex = selectedPointIndex;
+
+    if (!leftButtonHeld)
+    {
+        AERO_PROFILE_SCOPE ("VertexEditorImage::hitTest");
+        selectedPointIndex = withinRegionBounds (adjPos)
+            ? indexedRegion ().hitTest (region->get (), adjPos, POINT_RADIUS) : -1;
+    }
+
+    bool changed = selectedPointIndex != previousIndex;
+    switch (dragMode)
+    {
+        case DragMode::Rectangle:
+            selectionOutline = QPolygonF (QRectF (dragOrigin, adjPos).normalized ());
+            selectedPoints   = indexedRegion ().queryRect (region->get (), QRectF (dragOrigin, adjPos));
+            changed          = true;
+            break;
+
+        case DragMode::Lasso:
+            selectionOutline << adjPos;
+            changed = true;
+            break;
+
+        case DragMode::Selection:
+            transformSelection (VertexTransform::translation (adjPos - lastDragPosition));
+            changed = true;
+            break;
+
+        default:
+            break;
+    }
+
+    lastDragPosition = adjPos;
+
+    // TODO: Selected point index to prevent losing the point being dragged
+    if (selectedPointIndex != -1)
+    {
+        if (selectedPointIndex != previousIndex)
+            emit mouseHovered (selectedPointIndex);
+
+        if (leftButtonHeld && dragMode == DragMode::Point)
+        {
+            emit mouseMoved (adjPos.x (), adjPos.y (), selectedPointIndex);
+            spatialIndexDirty = true;
+            changed           = true;
+        }
+    }
+
+    // Picked up by the frame currently being handled, or the one requested by the caller
+    repaintRequested |= changed;
+}
+
+/**
+ * Returns the spatial index over the current region, rebuilding it first if the region has
+ *  changed since it was last indexed.
+ *
+ * @return The up-to-date spatial index over the current region
+ */
+const Aerodlyn::RegionSpatialIndex &Aerodlyn::VertexEditorImage::indexedRegion ()
+{
+    const QPolygonF &points = region->get ();
+
+    if (spatialIndexDirty || spatialIndex.size () != points.size ())
+    {
+        spatialIndex.rebuild (points);
+        spatialIndexDirty = false;
+
+        // Points may have been removed by the owner (e.g. the data set was cleared)
+        selectedPoints.erase (std::remove_if (selectedPoints.begin (), selectedPoints.end (),
+            [&] (const int index) { return index >= points.size (); }), selectedPoints.end ());
+    }
+
+    return spatialIndex;
+}
+
+/**
+ * Determines if the given position is close enough to the bounding box of the current region for
+ *  a point of the region to be hit there. Always true if the region has no geometry cache.
+ *
+ * @param position - The position to check, relative to the center of the image
+ *
+ * @return False if no point of the region can be hit at the given position, true otherwise
+ */
+bool Aerodlyn::VertexEditorImage::withinRegionBounds (const QPointF &position) const
+{
+    if (!geometry.has_value () || region->get ().isEmpty ())
+        return true;
+
+    geometry->get ().update (region->get ());
+
+    return geometry->get ().bounds ().adjusted (-POINT_RADIUS, -POINT_RADIUS, POINT_RADIUS, POINT_RADIUS)
+        .contains (position);
+}
+
+/**
+ * Applies the given transform to every selected vertex in a single pass, and signals the
+ *  change once for the whole selection.
+ *
+ * @param transform - The transform to apply to the selected vertices
+ */
+void Aerodlyn::VertexEditorImage::transformSelection (const VertexTransform &transform)
+{
+    indexedRegion ();
+    if (selectedPoints.isEmpty ())
+        return;
+
+    transform.apply (region->get (), selectedPoints);
+    spatialIndexDirty = true;
+
+    emit regionTransformed (selectedPoints);
+}
+
+/**
+ * Returns the centroid of the currently selected vertices.
+ *
+ * @return The average position of the selected vertices
+ */
+QPointF Aerodlyn::VertexEditorImage::selectionCentroid () const
+{
+    QPointF sum;
+    for (const int index : selectedPoints)
+        sum += region->get ().at (index);
+
+    return selectedPoints.isEmpty () ? sum : sum / selectedPoints.size ();
+}
@@ -1,6 +1,8 @@
 #ifndef VERTEXEDITORIMAGE_H
 #define VERTEXEDITORIMAGE_H
 
+#include <algorithm>
+#include <cmath>
 #include <functional>
 #include <optional>
 
@@ -14,10 +16,19 @@
 #include <QResizeEvent>
 #include <QScrollArea>
 #include <QScrollBar>
+#include <QSet>
+#include <QSize>
+#include <QString>
 #include <QVector>
+#include <QWheelEvent>
 #include <QWidget>
 
+#include "Root/Profiler.h"
 #include "Root/Utils.h"
+#include "VertexEditor/Utilities/RegionGeometry.h"
+#include "VertexEditor/Utilities/RegionSpatialIndex.h"
+#include "VertexEditor/Utilities/VertexTransform.h"
+#include "VertexEditor/FrameScheduler.h"
 #include "VertexEditor/VertexEditorRenderedImage.h"
 
 namespace Aerodlyn
@@ -27,8 +38,12 @@ namespace Aerodlyn
      *  of an image as well as the vertex points of a selected data set (given from the owner of this
      *  specific VertexEditorImage instance).
      *
+     * Multiple vertices can be selected by dragging a rectangle (Shift + drag) or a lasso (Ctrl + drag).
+     *  Dragging a selected vertex translates the whole selection, while Ctrl + wheel scales and
+     *  Shift + wheel rotates the selection about its centroid.
+     *
      * @author  Patrick Jahnig (Aerodlyn)
-     * @version 2020.01.18
+     * @version 2026.10.19
      */
     class VertexEditorImage : public QScrollArea
     {
@@ -59,15 +74,86 @@ namespace Aerodlyn
              */
             bool setImageFile (const QString &filepath);
 
+            /**
+             * Returns the size of the loaded image, which is also the extent of the regions drawn over it.
+             *  Region coordinates are relative to the center of the image.
+             *
+             * @return The size of the loaded image, or an empty size if no image is loaded
+             */
+            QSize imageSize () const;
+
+            /**
+             * Returns the loaded image, as it was read from its file.
+             *
+             * @return The loaded image, or a null image if no image is loaded
+             */
+            const QImage &loadedImage () const;
+
             /**
              * Sets the region to use for input handling and rendering.
              *
-             * @param region - The {@link QPolygonF} region of points
+             * @param region   - The {@link QPolygonF} region of points
+             * @param geometry - The derived geometry cache of the region, used to skip hit-testing and painting
+             *                      the region when the mouse or the painted area is outside of its bounds
              */
-            void setRegion (std::optional <std::reference_wrapper <QPolygonF>> region);
+            void setRegion (std::optional <std::reference_wrapper <QPolygonF>> region,
+                std::optional <std::reference_wrapper <RegionGeometry>> geometry = std::nullopt);
 
+            /**
+             * Requests that the rendered image be repainted. Requests are merged, so the image is repainted
+             *  at most once per display frame.
+             */
             void update ();
 
+            /**
+             * Clears the current multi-vertex selection, if any.
+             */
+            void clearSelection ();
+
+            /**
+             * Returns the indices, in ascending order, of the currently selected vertices.
+             *
+             * @return The indices of the currently selected vertices
+             */
+            const QVector <int> &selection () const;
+
+            /**
+             * Returns the scheduler that paces input handling and repainting of this instance. Owners can
+             *  connect to its frame signal to batch their own refreshes into the same frame.
+             *
+             * @return The frame scheduler of this instance
+             */
+            FrameScheduler *frameScheduler () const;
+
+            /**
+             * Determines if the latest frame composed of the rendered image shows its current state.
+             *
+             * @return True if the latest frame is current, false otherwise
+             */
+            bool hasCurrentFrame () const;
+
+            /**
+             * Shows or hides the performance HUD drawn over the rendered image.
+             *
+             * @param visible - True to show the HUD, false to hide it
+             */
+            void setHudVisible (const bool visible);
+
+            /**
+             * Shows every data set of the given collection under the current region, or stops showing them.
+             *
+             * @param collection - The data sets to show, or null to only show the current region
+             */
+            void setOverlay (const VertexDataSetCollection *collection);
+
+            /**
+             * Outlines the data sets of the given collection with the given names, or stops outlining them.
+             *
+             * @param collection - The data sets to outline from, or null to outline none
+             * @param names      - The names of the data sets to outline
+             */
+            void setHighlighted (const VertexDataSetCollection *collection, const QSet <QString> &names);
+
             /**
              * Returns the mouse position associated with the given {@link QMouseEvent} adjusted for the location
              *  of the viewport.
@@ -99,21 +185,100 @@ namespace Aerodlyn
              */
             void resizeEvent (QResizeEvent * event) override final;
 
+            /**
+             * See: https://doc.qt.io/qt-5/qwidget.html#wheelEvent
+             */
+            void wheelEvent (QWheelEvent *event) override final;
+
+        private: // Types
+            /**
+             * The action performed by dragging the mouse with the left button held.
+             */
+            enum class DragMode { None, Point, Selection, Rectangle, Lasso };
+
+        private: // Methods
+            /**
+             * Applies the latest mouse position recorded by {@link #mouseMoveEvent}, if any, updating the
+             *  hovered point and any drag in progress. A repaint is only flagged if the hovered point or the
+             *  dragged geometry changed.
+             */
+            void applyPendingMove ();
+
+            /**
+             * Returns the spatial index over the current region, rebuilding it first if the region has
+             *  changed since it was last indexed.
+             *
+             * @return The up-to-date spatial index over the current region
+             */
+            const RegionSpatialIndex &indexedRegion ();
+
+            /**
+             * Determines if the given position is close enough to the bounding box of the current region for
+             *  a point of the region to be hit there. Always true if the region has no geometry cache.
+             *
+             * @param position - The position to check, relative to the center of the image
+             *
+             * @return False if no point of the region can be hit at the given position, true otherwise
+             */
+            bool withinRegionBounds (const QPointF &position) const;
+
+            /**
+             * Applies the given transform to every selected vertex in a single pass, and signals the
+             *  change once for the whole selection.
+             *
+             * @param transform - The transform to apply to the selected vertices
+             */
+            void transformSelection (const VertexTransform &transform);
+
+            /**
+             * Returns the centroid of the currently selected vertices.
+             *
+             * @return The average position of the selected vertices
+             */
+            QPointF selectionCentroid () const;
+
         private: // Variables
-            bool                                               leftButtonHeld;
+            bool                                               leftButtonHeld     = false;
+            bool                                               movePending        = false;
+            bool                                               repaintRequested   = false;
+            bool                                               spatialIndexDirty  = true;
 
             int                                                selectedPointIndex = -1;
 
             const double                                       POINT_RADIUS       = 5.0;
+            const double                                       ROTATION_STEP      = M_PI / 180.0;
+            const double                                       SCALE_STEP         = 1.05;
+
+            DragMode                                           dragMode           = DragMode::None;
+
+            FrameScheduler                                     *scheduler;
 
             QPointF                                            center;
+            QPointF                                            dragOrigin;
+            QPointF                                            lastDragPosition;
+            QPointF                                            pendingPosition;
+
+            QPolygonF                                          selectionOutline;
+
+            QVector <int>                                      selectedPoints;
+
+            RegionSpatialIndex                                 spatialIndex;
 
             const QWidget                                      PARENT;
 
             std::optional <std::reference_wrapper <QPolygonF>> region;
 
+            std::optional <std::reference_wrapper <RegionGeometry>> geometry;
+
             VertexEditorRenderedImage                          *image;
 
+        private slots:
+            /**
+             * Handles the start of a display frame by applying the latest pending mouse movement and issuing
+             *  a single repaint, or none if nothing visible changed.
+             */
+            void handleFrame ();
+
         signals:
             /**
              * Signals that the mouse has been clicked within this VertexEditorImage instance, and
@@ -124,6 +289,15 @@ namespace Aerodlyn
              */
             void mouseClicked (const double x, const double y);
 
+            /**
+             * Signals that the mouse has been clicked with Alt held within this VertexEditorImage
+             *  instance, to pick the data set whose region is under the click.
+             *
+             * @param x - The x coordinate of the mouse click
+             * @param y - The y coordinate of the mouse click
+             */
+            void regionPicked (const double x, const double y);
+
             /**
              * Signals that the mouse has been moved within this VertexEditorImage instance, and
              *  may be hovering over a data point. If so then index is the index of that point,
@@ -142,6 +316,14 @@ namespace Aerodlyn
              * @param index - The index of the point being hovered over
              */
             void mouseMoved (const double x, const double y, const int index);
+
+            /**
+             * Signals that a bulk transform (translate, scale or rotate) has been applied to the
+             *  selected vertices of the current region.
+             *
+             * @param indices - The indices of the vertices that were transformed
+             */
+            void regionTransformed (const QVector <int> &indices);
     };
 }
 
@@ -4,8 +4,15 @@
  * A subcomponent of {@link VertexEditorImage}, represents the image file that gets rendered to the
  *  application as well as the background that gets rendered behind that image.
  *
+ * Frames are composed on the render thread of a {@link FrameComposer}, so painting only draws the
+ *  latest finished frame (and the HUD over it). Frames cover the part of this instance shown in its
+ *  scroll area and a margin around it, so scrolling a little is painted from the frame there is.
+ *  While shown, a frame that is out of date or doesn't cover what is being painted (such as after
+ *  scrolling further or resizing) is submitted, and the last frame stays up until it is finished.
+ *  Only when this instance is hidden or grabbed is the current state composed right away.
+ *
  * @author  Patrick Jahnig (Aerodlyn)
- * @version 2020.01.18
+ * @version 2026.10.19
  */
 
 /* Constructors/Deconstructors */
@@ -15,16 +22,24 @@
  *
  * @param selectedPointIndex    - The integer representing the index of the point that the user has
  *                                  selected
+ * @param selectedPoints        - The sorted indices of the points in the multi-vertex selection
+ * @param selectionOutline      - The rubber band rectangle or lasso currently being dragged, empty
+ *                                  if no selection is being made
  * @param center                - The current center of the rendered area, used for determining the
  *                                  location to render points by relative to that center (as some
  *                                  coordinates may be negative)
  */
-Aerodlyn::VertexEditorRenderedImage::VertexEditorRenderedImage (const int &selectedPointIndex, QPointF &center)
-    : QLabel (nullptr), selectedPointIndex (selectedPointIndex), center (center)
+Aerodlyn::VertexEditorRenderedImage::VertexEditorRenderedImage (const int &selectedPointIndex,
+    const QVector <int> &selectedPoints, const QPolygonF &selectionOutline, QPointF &center)
+    : QLabel (nullptr), selectedPointIndex (selectedPointIndex), selectedPoints (selectedPoints),
+      selectionOutline (selectionOutline), center (center)
 {
     setSizePolicy (QSizePolicy::Ignored, QSizePolicy::Ignored);
     setScaledContents (true);
     setMouseTracking (true);
+
+    // Emitted from the render thread, so the repaint is queued to this one
+    QObject::connect (&composer, &FrameComposer::frameReady, this, [this] { update (); });
 }
 
 /**
@@ -43,11 +58,12 @@ Aerodlyn::VertexEditorRenderedImage::~VertexEditorRenderedImage () {}
  */
 bool Aerodlyn::VertexEditorRenderedImage::load (const QString &filepath)
 {
+    AERO_PROFILE_SCOPE ("VertexEditorRenderedImage::load");
+
     if (image.load (filepath))
     {
+        // Also composes a frame of the new image
         resizeToFit (size ());
-        update ();
-
         return true;
     }
 
@@ -77,15 +93,124 @@ void Aerodlyn::VertexEditorRenderedImage::resizeToFit (const QSize &size)
     }
 
     center = QPointF (width () / 2, height () / 2);
+    compose ();
+}
+
+/**
+ * Returns the size of the loaded image.
+ *
+ * @return The size of the loaded image, or an empty size if no image is loaded
+ */
+QSize Aerodlyn::VertexEditorRenderedImage::imageSize () const
+    { return image.size (); }
+
+/**
+ * Returns the loaded image, as it was read from its file.
+ *
+ * @return The loaded image, or a null image if no image is loaded
+ */
+const QImage &Aerodlyn::VertexEditorRenderedImage::loadedImage () const
+    { return image; }
+
+/**
+ * Sets the region to use for input handling and rendering.
+ *
+ * @param region   - The {@link QPolygonF} region of points
+ * @param geometry - The derived geometry cache of the region, used to skip painting it when it is
+ *                      outside of the area being painted
+ */
+void Aerodlyn::VertexEditorRenderedImage::setRegion (std::optional <std::reference_wrapper <QPolygonF>> region,
+    std::optional <std::reference_wrapper <RegionGeometry>> geometry)
+{
+    this->region   = region;
+    this->geometry = geometry;
+
+    revision++;
+}
+
+/**
+ * Shows or hides the performance HUD, which overlays frame, paint and hit-test times, the vertex
+ *  count and the memory use of the application. Showing the HUD enables the profiler.
+ *
+ * @param visible - True to show the HUD, false to hide it
+ */
+void Aerodlyn::VertexEditorRenderedImage::setHudVisible (const bool visible)
+{
+    hudVisible = visible;
+    if (visible)
+        Profiler::setEnabled (true);
+
+    update ();
+}
+
+/**
+ * Shows every data set of the given collection under the current region, each filled with its own
+ *  translucent color, or stops showing them.
+ *
+ * @param collection - The data sets to show, or null to only show the current region
+ */
+void Aerodlyn::VertexEditorRenderedImage::setOverlay (const VertexDataSetCollection *collection)
+{
+    overlay = collection;
+    revision++;
+}
+
+/**
+ * Outlines the data sets of the given collection with the given names over everything else, such
+ *  as the ones found to overlap, or stops outlining them.
+ *
+ * @param collection - The data sets to outline from, or null to outline none
+ * @param names      - The names of the data sets to outline
+ */
+void Aerodlyn::VertexEditorRenderedImage::setHighlighted (const VertexDataSetCollection *collection,
+    const QSet <QString> &names)
+{
+    highlightSource = collection;
+    highlighted     = names;
+
+    revision++;
+}
+
+/**
+ * Composes a frame of the current state on the render thread, and repaints this instance once it
+ *  is finished. Called whenever anything shown may have changed, including the state referenced
+ *  from the parent {@link VertexEditorImage}.
+ *
+ * @param frameTimer - A timer started at the start of the display frame that asked for the frame,
+ *                      if one did, which the HUD shows the time to its blit from
+ */
+void Aerodlyn::VertexEditorRenderedImage::compose (const QElapsedTimer &frameTimer)
+{
+    // The referenced state changes without this instance knowing, so every request is a new revision
+    revision++;
+
+    if (frameTimer.isValid ())
+    {
+        this->frameTimer = frameTimer;
+        timedRevision    = revision;
+    }
+
+    FrameComposer::Snapshot &snapshot = composer.nextSnapshot ();
+    takeSnapshot (snapshot);
+
+    submittedArea     = snapshot.area;
+    submittedRevision = revision;
+
+    composer.submit ();
 }
 
 /**
- * Sets the point list to use for input handling and rendering.
+ * Determines if the latest finished frame shows the current state of the part of this instance
+ *  that is shown, so that painting would only draw it.
  *
- * @param pointList - The pointer to the selected list of points, can be null
+ * @return True if the latest frame is current, false if it is out of date, covers another part or
+ *  none was finished
  */
-void Aerodlyn::VertexEditorRenderedImage::setRegion (std::optional <std::reference_wrapper <QPolygonF>> region)
-    { this->region = region; }
+bool Aerodlyn::VertexEditorRenderedImage::hasCurrentFrame ()
+{
+    composer.takeFrame ();
+    return composer.frame ().revision == revision && composer.frame ().area.contains (visibleArea ());
+}
 
 /* Overridden Protected Methods */
 /**
@@ -93,36 +218,171 @@ void Aerodlyn::VertexEditorRenderedImage::setRegion (std::optional <std::referen
  */
 void Aerodlyn::VertexEditorRenderedImage::paintEvent (QPaintEvent *event)
 {
-    Q_UNUSED (event)
+    const QRect &exposed = event->rect ();
+
+    composer.takeFrame ();
+    if (composer.frame ().revision != revision || !composer.frame ().area.contains (exposed))
+    {
+        // Painting on screen is clipped to the shown part, so painting beyond it means this instance
+        //  is being grabbed. A hidden or grabbed instance is expected to show the current state, so it
+        //  is composed right away
+        if (!isVisible () || !visibleArea ().contains (exposed))
+        {
+            FrameComposer::Snapshot snapshot;
+            takeSnapshot (snapshot);
+
+            snapshot.area = snapshot.area.united (exposed);
+            composer.composeNow (snapshot);
+        }
+
+        // Otherwise the last frame (or as much of it as covers what is painted) stays up until the
+        //  one on its way is finished, rather than waiting for it
+        else if (submittedRevision != revision || !submittedArea.contains (visibleArea ()))
+            compose ();
+    }
 
     QPainter painter (this);
-    painter.setPen (BACKGROUND_COLOR);
-    painter.setBrush (QBrush (painter.pen ().color ()));
-    painter.drawRect (0, 0, width () - 1, height () - 1);
-    painter.drawImage ((width () - image.width ()) / 2, (height () - image.height ()) / 2, image);
+    {
+        AERO_PROFILE_SCOPE ("VertexEditorRenderedImage::paintEvent");
 
-    if (!region.has_value ())
-        return;
+        // Whatever the frame doesn't cover (such as before the first one is finished) is left to the
+        //  background of the scroll area
+        const FrameComposer::Frame &frame = composer.frame ();
+        const QRect blitted = exposed & frame.area;
 
-    int size = region->get ().size ();
+        if (!frame.image.isNull () && !blitted.isEmpty ())
+        {
+            const QPointF source = QPointF (blitted.topLeft () - frame.area.topLeft ()) * frame.image.devicePixelRatio ();
 
-    painter.setPen (QColor ("#FFFFFF"));
-    if (size >= 2)
-        painter.drawLine (region->get ().at (0) + center, region->get ().at (size - 1) + center);
+            painter.drawImage (QPointF (blitted.topLeft ()), frame.image, QRectF (source,
+                QSizeF (blitted.size ()) * frame.image.devicePixelRatio ()));
+        }
+    }
 
-    for (int i = 0; i < size; i++)
+    // The first blit of a frame that shows the state asked for by a display frame (or a later one)
+    //  ends the time of that display frame
+    if (frameTimer.isValid () && composer.frame ().revision >= timedRevision)
     {
-        const QPointF point = region->get ().at (i) + center;
+        lastFrameTime = frameTimer.nsecsElapsed ();
+        frameTimer.invalidate ();
+    }
 
-        if (size >= 2 && i < size - 1)
-            painter.drawLine (point, region->get ().at (i + 1) + center);
+    if (hudVisible)
+        paintHud (painter);
+}
+
+/* Private Methods */
+/**
+ * Copies everything a frame shows into the given snapshot: the part of this instance that is
+ *  shown and a margin around it, the image, the data sets of the overlay that lie within that
+ *  part and the highlighted ones, and the current region with its selection.
+ *
+ * @param snapshot - The snapshot to fill
+ */
+void Aerodlyn::VertexEditorRenderedImage::takeSnapshot (FrameComposer::Snapshot &snapshot)
+{
+    AERO_PROFILE_SCOPE ("VertexEditorRenderedImage::takeSnapshot");
 
-        if (selectedPointIndex == i)
-            painter.setBrush (QBrush ("#000000"));
+    snapshot.revision         = revision;
+    snapshot.size             = size ();
+    snapshot.area             = visibleArea ().adjusted (-COMPOSE_MARGIN, -COMPOSE_MARGIN, COMPOSE_MARGIN, COMPOSE_MARGIN) & rect ();
+    snapshot.devicePixelRatio = devicePixelRatioF ();
+    snapshot.center           = center;
+    snapshot.image            = image;
 
-        else
-            painter.setBrush (QBrush ("#FFFFFF"));
+    // Regions are in coordinates relative to the center, and only the ones within the area are handed
+    //  over. The bounds are cached by the collections, which only this thread may use
+    const QRectF visible = QRectF (snapshot.area).translated (-center);
 
-        painter.drawEllipse (point, POINT_RADIUS, POINT_RADIUS);
+    snapshot.overlay.clear ();
+    if (overlay != nullptr)
+    {
+        // Bounding boxes of regions without area are grown, so that they can still intersect. The names
+        //  found are sorted, as the collection is, so the overlay keeps its order
+        for (const QString &name : overlay->regionsIn (visible.adjusted (-1.0, -1.0, 1.0, 1.0)))
+        {
+            const int index = overlay->indexOf (name);
+            snapshot.overlay.append ({ overlay->at (index).region, overlay->geometryAt (index).bounds (),
+                static_cast <int> (qHash (name) % 360) });
+        }
+    }
+
+    snapshot.highlighted.clear ();
+    if (highlightSource != nullptr)
+    {
+        // Highlighted data sets may have been deleted or renamed since, so they are looked up by name
+        for (const QString &name : highlighted)
+        {
+            const int index = highlightSource->indexOf (name);
+            if (index >= 0)
+                snapshot.highlighted.append ({ highlightSource->at (index).region, highlightSource->geometryAt (index).bounds () });
+        }
     }
+
+    snapshot.hasRegion    = region.has_value ();
+    snapshot.region       = snapshot.hasRegion ? region->get () : QPolygonF ();
+    snapshot.regionBounds = QRectF ();
+
+    if (snapshot.hasRegion && geometry.has_value () && !snapshot.region.isEmpty ())
+    {
+        geometry->get ().update (snapshot.region);
+        snapshot.regionBounds = geometry->get ().bounds ();
+    }
+
+    snapshot.selectedPointIndex = selectedPointIndex;
+    snapshot.selectedPoints     = selectedPoints;
+    snapshot.selectionOutline   = selectionOutline;
+}
+
+/**
+ * Returns the part of this instance shown in its scroll area, or all of it if it isn't shown.
+ *
+ * @return The shown part of this instance, in its coordinates
+ */
+QRect Aerodlyn::VertexEditorRenderedImage::visibleArea () const
+{
+    const QRect shown = visibleRegion ().boundingRect ();
+    return shown.isEmpty () ? rect () : shown;
+}
+
+/**
+ * Paints the performance HUD in the top left corner of the visible part of this instance.
+ *
+ * @param painter - The painter to paint with
+ */
+void Aerodlyn::VertexEditorRenderedImage::paintHud (QPainter &painter)
+{
+    const auto milliseconds = [] (const qint64 nanoseconds)
+        { return nanoseconds < 0 ? QString ("n/a") : QString ("%1 ms").arg (nanoseconds / 1.0e6, 0, 'f', 2); };
+
+    const qint64 memory = Profiler::residentMemory ();
+
+    QStringList lines;
+    lines << QString ("Frame:    %1").arg (milliseconds (lastFrameTime))
+          << QString ("Paint:    %1").arg (milliseconds (Profiler::lastDuration ("VertexEditorRenderedImage::paintEvent")))
+          << QString ("Compose:  %1").arg (milliseconds (Profiler::lastDuration ("FrameComposer::compose")))
+          << QString ("Hit-test: %1").arg (milliseconds (Profiler::lastDuration ("VertexEditorImage::hitTest")))
+          << QString ("Vertices: %1").arg (region.has_value () ? region->get ().size () : 0)
+          << QString ("Memory:   %1").arg (memory < 0 ? QString ("n/a") : QString ("%1 MB").arg (memory / 1048576.0, 0, 'f', 1));
+
+    // Only looked up once the HUD is shown, to keep font loading out of startup
+    const QFont font = QFontDatabase::systemFont (QFontDatabase::FixedFont);
+
+    const QPoint origin = visibleRegion ().boundingRect ().topLeft () + QPoint (HUD_MARGIN, HUD_MARGIN);
+    const QFontMetrics metrics (font);
+
+    int textWidth = 0;
+    for (const QString &line : lines)
+        textWidth = std::max (textWidth, metrics.horizontalAdvance (line));
+
+    const QRect background (origin, QSize (textWidth + 2 * HUD_MARGIN, lines.size () * metrics.height () + 2 * HUD_MARGIN));
+
+    painter.setPen (Qt::NoPen);
+    painter.setBrush (HUD_BACKGROUND_COLOR);
+    painter.drawRect (background);
+
+    painter.setFont (font);
+    painter.setPen (QColor ("#FFFFFF"));
+    for (int i = 0; i < lines.size (); i++)
+        painter.drawText (origin + QPoint (HUD_MARGIN, HUD_MARGIN + i * metrics.height () + metrics.ascent ()), lines.at (i));
 }
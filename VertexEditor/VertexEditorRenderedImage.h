@@ -1,26 +1,51 @@
 #ifndef VERTEX_EDITOR_RENDERED_IMAGE_H
 #define VERTEX_EDITOR_RENDERED_IMAGE_H
 
+#include <algorithm>
 #include <functional>
 #include <optional>
 
+#include <QElapsedTimer>
+#include <QFont>
+#include <QFontDatabase>
+#include <QFontMetrics>
+#include <QHash>
 #include <QImage>
 #include <QLabel>
 #include <QMouseEvent>
 #include <QPainter>
+#include <QPaintEvent>
 #include <QPolygonF>
 #include <QPointF>
+#include <QRect>
+#include <QRectF>
 #include <QResizeEvent>
+#include <QSet>
+#include <QSize>
+#include <QString>
+#include <QStringList>
 #include <QVector>
 
+#include "Root/Profiler.h"
+#include "VertexEditor/FrameComposer.h"
+#include "VertexEditor/Utilities/RegionGeometry.h"
+#include "VertexEditor/Utilities/VertexDataSetCollection.h"
+
 namespace Aerodlyn
 {
     /**
      * A subcomponent of {@link VertexEditorImage}, represents the image file that gets rendered to the
      *  application as well as the background that gets rendered behind that image.
      *
+     * Frames are composed on the render thread of a {@link FrameComposer}, so painting only draws the
+     *  latest finished frame (and the HUD over it). Frames cover the part of this instance shown in its
+     *  scroll area and a margin around it, so scrolling a little is painted from the frame there is.
+     *  While shown, a frame that is out of date or doesn't cover what is being painted (such as after
+     *  scrolling further or resizing) is submitted, and the last frame stays up until it is finished.
+     *  Only when this instance is hidden or grabbed is the current state composed right away.
+     *
      * @author  Patrick Jahnig (Aerodlyn)
-     * @version 2020.01.18
+     * @version 2026.10.19
      */
     class VertexEditorRenderedImage : public QLabel
     {
@@ -31,11 +56,15 @@ namespace Aerodlyn
              *
              * @param selectedPointIndex    - The integer representing the index of the point that the user has
              *                                  selected
+             * @param selectedPoints        - The sorted indices of the points in the multi-vertex selection
+             * @param selectionOutline      - The rubber band rectangle or lasso currently being dragged, empty
+             *                                  if no selection is being made
              * @param center                - The current center of the rendered area, used for determining the
              *                                  location to render points by relative to that center (as some
              *                                  coordinates may be negative)
              */
-            VertexEditorRenderedImage (const int &selectedPointIndex, QPointF &center);
+            VertexEditorRenderedImage (const int &selectedPointIndex, const QVector <int> &selectedPoints,
+                const QPolygonF &selectionOutline, QPointF &center);
 
             /**
              * Destroys this {@link VertexEditorRenderedImage} instance.
@@ -62,12 +91,73 @@ namespace Aerodlyn
              */
             void resizeToFit (const QSize &size);
 
+            /**
+             * Returns the size of the loaded image.
+             *
+             * @return The size of the loaded image, or an empty size if no image is loaded
+             */
+            QSize imageSize () const;
+
+            /**
+             * Returns the loaded image, as it was read from its file.
+             *
+             * @return The loaded image, or a null image if no image is loaded
+             */
+            const QImage &loadedImage () const;
+
             /**
              * Sets the region to use for input handling and rendering.
              *
-             * @param region - The {@link QPolygonF} region of points
+             * @param region   - The {@link QPolygonF} region of points
+             * @param geometry - The derived geometry cache of the region, used to skip painting it when it is
+             *                      outside of the area being painted
+             */
+            void setRegion (std::optional <std::reference_wrapper <QPolygonF>> region,
+                std::optional <std::reference_wrapper <RegionGeometry>> geometry = std::nullopt);
+
+            /**
+             * Shows or hides the performance HUD, which overlays frame, paint and hit-test times, the vertex
+             *  count and the memory use of the application. Showing the HUD enables the profiler.
+             *
+             * @param visible - True to show the HUD, false to hide it
              */
-            void setRegion (std::optional <std::reference_wrapper <QPolygonF>> region);
+            void setHudVisible (const bool visible);
+
+            /**
+             * Shows every data set of the given collection under the current region, each filled with its own
+             *  translucent color, or stops showing them.
+             *
+             * @param collection - The data sets to show, or null to only show the current region
+             */
+            void setOverlay (const VertexDataSetCollection *collection);
+
+            /**
+             * Outlines the data sets of the given collection with the given names over everything else, such
+             *  as the ones found to overlap, or stops outlining them.
+             *
+             * @param collection - The data sets to outline from, or null to outline none
+             * @param names      - The names of the data sets to outline
+             */
+            void setHighlighted (const VertexDataSetCollection *collection, const QSet <QString> &names);
+
+            /**
+             * Composes a frame of the current state on the render thread, and repaints this instance once it
+             *  is finished. Called whenever anything shown may have changed, including the state referenced
+             *  from the parent {@link VertexEditorImage}.
+             *
+             * @param frameTimer - A timer started at the start of the display frame that asked for the frame,
+             *                      if one did, which the HUD shows the time to its blit from
+             */
+            void compose (const QElapsedTimer &frameTimer = QElapsedTimer ());
+
+            /**
+             * Determines if the latest finished frame shows the current state of the part of this instance
+             *  that is shown, so that painting would only draw it.
+             *
+             * @return True if the latest frame is current, false if it is out of date, covers another part or
+             *  none was finished
+             */
+            bool hasCurrentFrame ();
 
         protected: // Methods
             /**
@@ -75,19 +165,75 @@ namespace Aerodlyn
              */
             void paintEvent (QPaintEvent *event) override final;
 
+        private: // Methods
+            /**
+             * Copies everything a frame shows into the given snapshot: the part of this instance that is
+             *  shown and a margin around it, the image, the data sets of the overlay that lie within that
+             *  part and the highlighted ones, and the current region with its selection.
+             *
+             * @param snapshot - The snapshot to fill
+             */
+            void takeSnapshot (FrameComposer::Snapshot &snapshot);
+
+            /**
+             * Returns the part of this instance shown in its scroll area, or all of it if it isn't shown.
+             *
+             * @return The shown part of this instance, in its coordinates
+             */
+            QRect visibleArea () const;
+
+            /**
+             * Paints the performance HUD in the top left corner of the visible part of this instance.
+             *
+             * @param painter - The painter to paint with
+             */
+            void paintHud (QPainter &painter);
+
         private: // Variables
+            bool                                               hudVisible           = false;
+
             const int                                          &selectedPointIndex;
+            const int                                          HUD_MARGIN           = 6;
+
+            // How far beyond the shown part of this instance frames are composed, so that scrolling
+            //  doesn't immediately leave the frame
+            const int                                          COMPOSE_MARGIN       = 256;
+
+            // The time from the start of the last display frame that asked for a frame to its blit
+            qint64                                             lastFrameTime        = -1;
+
+            // Bumped whenever anything shown may have changed, to tell if a frame is current
+            quint64                                            revision             = 1;
+            quint64                                            submittedRevision    = 0;
+            quint64                                            timedRevision        = 0;
+
+            const QVector <int>                                &selectedPoints;
 
-            const double                                       POINT_RADIUS         = 5.0;
+            const QPolygonF                                    &selectionOutline;
 
-            const QColor                                       BACKGROUND_COLOR     = QColor ("#FF00FF");
+            const QColor                                       HUD_BACKGROUND_COLOR = QColor (0, 0, 0, 180);
+
+            const VertexDataSetCollection                      *overlay             = nullptr;
+            const VertexDataSetCollection                      *highlightSource     = nullptr;
+
+            // Started at the start of the display frame that asked for the frame being timed
+            QElapsedTimer                                      frameTimer;
+
+            FrameComposer                                      composer;
 
             QImage                                             image;
 
             QPointF                                            &center;
 
+            // The part of this instance covered by the last submitted snapshot
+            QRect                                              submittedArea;
+
+            QSet <QString>                                     highlighted;
+
 
             std::optional <std::reference_wrapper <QPolygonF>> region;
+
+            std::optional <std::reference_wrapper <RegionGeometry>> geometry;
     };
 }
 
@@ -9,15 +9,60 @@ Aerodlyn::VertexEditorTable::VertexEditorTable (QWidget *parent) : QTableWidget
 
     setAlternatingRowColors (true);
     setHorizontalHeaderLabels (headerList);
+
+    connect (this, &QTableWidget::itemChanged, this, &VertexEditorTable::handleItemChanged);
 }
 
 Aerodlyn::VertexEditorTable::~VertexEditorTable () {}
 
 /* Public Methods */
-void Aerodlyn::VertexEditorTable::setRegion (std::optional <std::reference_wrapper <QPolygonF>> region)
+/**
+ * Shows the given region, with a column after X and Y for each attribute channel (two for
+ *  vectors). Flags are shown as check boxes, other attributes as editable numbers.
+ *
+ * @param region     - The region to show, or none to show nothing
+ * @param attributes - The attributes of the vertices of the region, kept as long as it
+ */
+void Aerodlyn::VertexEditorTable::setRegion (std::optional <std::reference_wrapper <QPolygonF>> region,
+                                             std::optional <std::reference_wrapper <VertexAttributes>> attributes)
 {
     this->clearContents ();
-    this->region = region;
+    this->region     = region;
+    this->attributes = attributes;
+
+    QStringList headerList;
+    headerList.append (DATA_COLUMN_01_HEADER);
+    headerList.append (DATA_COLUMN_02_HEADER);
+
+    attributeColumns.clear ();
+    if (attributes.has_value ())
+    {
+        const VertexAttributes &channels = attributes->get ();
+        for (int c = 0; c < channels.channelCount (); c++)
+        {
+            const VertexAttributes::Channel &channel = channels.channel (c);
+
+            if (channel.type == VertexAttributes::Type::Vector)
+            {
+                attributeColumns.append ({ c, 0 });
+                attributeColumns.append ({ c, 1 });
+                headerList.append (channel.name + " x");
+                headerList.append (channel.name + " y");
+            }
+
+            else
+            {
+                attributeColumns.append ({ c, 0 });
+                headerList.append (channel.name);
+            }
+        }
+    }
+
+    setColumnCount (INITIAL_NUM_COLUMNS + attributeColumns.size ());
+    setHorizontalHeaderLabels (headerList);
+
+    QResizeEvent event (size (), size ());
+    resizeEvent (&event);
 
     update (true);
 }
@@ -30,6 +75,8 @@ void Aerodlyn::VertexEditorTable::setRegion (std::optional <std::reference_wrapp
  */
 void Aerodlyn::VertexEditorTable::update (const bool refresh)
 {
+    AERO_PROFILE_SCOPE ("VertexEditorTable::update");
+
     if (!region.has_value ())
         return;
 
@@ -47,20 +94,116 @@ void Aerodlyn::VertexEditorTable::update (const bool refresh)
  */
 void Aerodlyn::VertexEditorTable::update (const int row)
 {
-    if (!region.has_value ())
+    AERO_PROFILE_SCOPE ("VertexEditorTable::updateRow");
+
+    if (!region.has_value () || row >= region->get ().length () || row >= rowCount ())
         return;
 
     const QPointF point = region->get ().at (row);
 
-    setCellWidget (row, 0, new QLabel (QString::number (point.x ())));
-    setCellWidget (row, 1, new QLabel (QString::number (point.y ())));
+    QLabel *xLabel = qobject_cast <QLabel *> (cellWidget (row, 0)), *yLabel = qobject_cast <QLabel *> (cellWidget (row, 1));
+    if (xLabel && yLabel)
+    {
+        xLabel->setText (QString::number (point.x ()));
+        yLabel->setText (QString::number (point.y ()));
+    }
+
+    else
+    {
+        setCellWidget (row, 0, new QLabel (QString::number (point.x ())));
+        setCellWidget (row, 1, new QLabel (QString::number (point.y ())));
+    }
+
+    if (attributeColumns.isEmpty ())
+        return;
+
+    // Filling in the cells isn't an edit
+    const QSignalBlocker blocker (this);
+
+    const VertexAttributes &channels = attributes->get ();
+    for (int column = 0; column < attributeColumns.size (); column++)
+    {
+        const QPair <int, int> &channel = attributeColumns.at (column);
+        const double value = channels.value (channel.first, row, channel.second);
+
+        QTableWidgetItem *cell = item (row, INITIAL_NUM_COLUMNS + column);
+        if (!cell)
+        {
+            cell = new QTableWidgetItem ();
+            if (channels.channel (channel.first).type == VertexAttributes::Type::Flag)
+                cell->setFlags (Qt::ItemIsEnabled | Qt::ItemIsSelectable | Qt::ItemIsUserCheckable);
+
+            setItem (row, INITIAL_NUM_COLUMNS + column, cell);
+        }
+
+        if (channels.channel (channel.first).type == VertexAttributes::Type::Flag)
+            cell->setCheckState (value != 0.0 ? Qt::Checked : Qt::Unchecked);
+
+        else
+            cell->setText (QString::number (value));
+    }
+}
+
+/**
+ * Updates the given rows in the table to reflect new information, repainting the table
+ *  once for the whole batch rather than once per row.
+ *
+ * @param rows - The rows to update
+ */
+void Aerodlyn::VertexEditorTable::update (const QVector <int> &rows)
+{
+    AERO_PROFILE_SCOPE ("VertexEditorTable::update");
+
+    if (!region.has_value ())
+        return;
+
+    setUpdatesEnabled (false);
+    for (const int row : rows)
+        update (row);
+
+    setUpdatesEnabled (true);
 }
 
 /* Overridden Protected Methods */
 void Aerodlyn::VertexEditorTable::resizeEvent (QResizeEvent *event)
 {
-    int columnWidth = static_cast <int> (event->size ().width () * 0.5f);
+    int columnWidth = event->size ().width () / columnCount ();
+
+    for (int column = 0; column < columnCount (); column++)
+        setColumnWidth (column, columnWidth);
+}
+
+/* Private Methods */
+/**
+ * Stores an edited attribute cell in the attributes, reverting it if it isn't a number.
+ *
+ * @param item - The cell that changed
+ */
+void Aerodlyn::VertexEditorTable::handleItemChanged (QTableWidgetItem *item)
+{
+    const int column = item->column () - INITIAL_NUM_COLUMNS;
+    if (column < 0 || column >= attributeColumns.size () || !attributes.has_value ())
+        return;
+
+    VertexAttributes &channels = attributes->get ();
+    const QPair <int, int> &channel = attributeColumns.at (column);
+
+    bool ok = true;
+    double value;
+
+    if (channels.channel (channel.first).type == VertexAttributes::Type::Flag)
+        value = item->checkState () == Qt::Checked ? 1.0 : 0.0;
+
+    else
+        value = item->text ().toDouble (&ok);
+
+    if (ok)
+        channels.setValue (channel.first, item->row (), value, channel.second);
+
+    // Shows the value as stored, such as an integer rounded, or the old value if the new one wasn't
+    //  a number
+    update (item->row ());
 
-    setColumnWidth (0, columnWidth);
-    setColumnWidth (1, columnWidth);
+    if (ok)
+        emit attributeEdited (item->row ());
 }
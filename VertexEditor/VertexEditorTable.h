@@ -6,15 +6,22 @@
 
 #include <QHeaderView>
 #include <QLabel>
+#include <QPair>
 #include <QPointF>
 #include <QPolygonF>
 #include <QResizeEvent>
+#include <QSignalBlocker>
 #include <QString>
 #include <QStringList>
 #include <QTableWidget>
+#include <QTableWidgetItem>
 #include <QVector>
 #include <QVectorIterator>
 
+#include "Root/Profiler.h"
+
+#include "Utilities/VertexAttributes.h"
+
 #define INITIAL_NUM_COLUMNS 2
 #define INITIAL_NUM_ROWS    0
 
@@ -25,12 +32,22 @@ namespace Aerodlyn
      */
     class VertexEditorTable : public QTableWidget
     {
+        Q_OBJECT
+
         public: // Constructors/Deconstructors
             VertexEditorTable (QWidget *parent = nullptr);
             ~VertexEditorTable () override;
 
         public: // Methods
-            void setRegion (std::optional <std::reference_wrapper <QPolygonF>> region = std::nullopt);
+            /**
+             * Shows the given region, with a column after X and Y for each attribute channel (two for
+             *  vectors). Flags are shown as check boxes, other attributes as editable numbers.
+             *
+             * @param region     - The region to show, or none to show nothing
+             * @param attributes - The attributes of the vertices of the region, kept as long as it
+             */
+            void setRegion (std::optional <std::reference_wrapper <QPolygonF>> region = std::nullopt,
+                            std::optional <std::reference_wrapper <VertexAttributes>> attributes = std::nullopt);
 
             /**
              * Updates the table, either by updating the last row (i.e. a new data point as been
@@ -47,14 +64,43 @@ namespace Aerodlyn
              */
             void update (const int row);
 
+            /**
+             * Updates the given rows in the table to reflect new information, repainting the table
+             *  once for the whole batch rather than once per row.
+             *
+             * @param rows - The rows to update
+             */
+            void update (const QVector <int> &rows);
+
+        signals:
+            /**
+             * Signals that an attribute value of the given row was edited in the table, so that the data
+             *  set can be marked as changed.
+             *
+             * @param row - The row (i.e. the index of the vertex) whose attribute was edited
+             */
+            void attributeEdited (const int row);
+
         protected: // Methods
             void resizeEvent (QResizeEvent *event) override final;
 
+        private: // Methods
+            /**
+             * Stores an edited attribute cell in the attributes, reverting it if it isn't a number.
+             *
+             * @param item - The cell that changed
+             */
+            void handleItemChanged (QTableWidgetItem *item);
+
         private: // Variables
-            std::optional <std::reference_wrapper <QPolygonF>> region                = std::nullopt;
+            std::optional <std::reference_wrapper <QPolygonF>>        region                = std::nullopt;
+            std::optional <std::reference_wrapper <VertexAttributes>> attributes            = std::nullopt;
+
+            // The channel and component shown in each column after X and Y
+            QVector <QPair <int, int>>                                attributeColumns;
 
-            const QString                                      DATA_COLUMN_01_HEADER = "X";
-            const QString                                      DATA_COLUMN_02_HEADER = "Y";
+            const QString                                             DATA_COLUMN_01_HEADER = "X";
+            const QString                                             DATA_COLUMN_02_HEADER = "Y";
     };
 }
 
@@ -17,7 +17,7 @@
  *
  * @param parent The parent of the VertexEditorWindow
  */
-Aerodlyn::VertexEditorWindow::VertexEditorWindow (QWidget *parent) : QMainWindow (parent), selectedDataSetIndex (-1)
+Aerodlyn::VertexEditorWindow::VertexEditorWindow (QWidget *parent) : QMainWindow (parent)
 {
     centralWidget = new QWidget ();
     setCentralWidget (centralWidget);
@@ -48,15 +48,37 @@ Aerodlyn::VertexEditorWindow::VertexEditorWindow (QWidget *parent) : QMainWindow
 
     deleteAllDataSets = new QPushButton ("Delete All Data Sets");
     dataSetVBox->addWidget (deleteAllDataSets);
+    connect (deleteAllDataSets, &QPushButton::released, this, &VertexEditorWindow::handleDeleteAllDataSets);
 
     gridLayout->addLayout (dataSetVBox, 0, 1);
 
-    dataSetListWidget = new QListWidget ();
-    gridLayout->addWidget (dataSetListWidget, 1, 1);
-    connect (dataSetListWidget, &QListWidget::currentRowChanged, this, &VertexEditorWindow::handleDataSelection);
+    dataSetListVBox = new QVBoxLayout ();
+
+    dataSetFilterEdit = new QLineEdit ();
+    dataSetFilterEdit->setPlaceholderText (DATA_SET_FILTER_PLACEHOLDER);
+    dataSetFilterEdit->setClearButtonEnabled (true);
+    dataSetListVBox->addWidget (dataSetFilterEdit);
+    connect (dataSetFilterEdit, &QLineEdit::textChanged, this, &VertexEditorWindow::handleFilterChanged);
+
+    dataSetListModel = new Aerodlyn::DataSetListModel (dataSets, this);
+
+    dataSetListView = new QListView ();
+    dataSetListView->setModel (dataSetListModel);
+    dataSetListView->setUniformItemSizes (true);
+    dataSetListVBox->addWidget (dataSetListView);
+    connect (dataSetListView->selectionModel (), &QItemSelectionModel::currentRowChanged, this,
+        [this] (const QModelIndex &current) { handleDataSelection (current.isValid () ? current.row () : -1); });
+
+    gridLayout->addLayout (dataSetListVBox, 1, 1);
 
     vertexTable = new Aerodlyn::VertexEditorTable ();
     gridLayout->addWidget (vertexTable, 2, 1);
+    connect (vertexTable, &Aerodlyn::VertexEditorTable::attributeEdited, this,
+             [this] { dataSets.markAttributesDirty (selectedDataSetName); });
+
+    geometryLabel = new QLabel ();
+    geometryLabel->setTextInteractionFlags (Qt::TextSelectableByMouse);
+    gridLayout->addWidget (geometryLabel, 3, 1);
 
     vertexImage = new Aerodlyn::VertexEditorImage (this);
     gridLayout->addWidget (vertexImage, 0, 0, gridLayout->rowCount (), 1);
@@ -66,12 +88,112 @@ Aerodlyn::VertexEditorWindow::VertexEditorWindow (QWidget *parent) : QMainWindow
              &Aerodlyn::VertexEditorWindow::handleHoveredPoint);
     connect (vertexImage, &Aerodlyn::VertexEditorImage::mouseMoved, this,
              &Aerodlyn::VertexEditorWindow::handleMouseMoved);
+    connect (vertexImage, &Aerodlyn::VertexEditorImage::regionPicked, this,
+             &Aerodlyn::VertexEditorWindow::handleRegionPicked);
+    connect (vertexImage, &Aerodlyn::VertexEditorImage::regionTransformed, this,
+             &Aerodlyn::VertexEditorWindow::handleRegionTransformed);
+
+    // Connected after the image's own handler, which applies the input of the frame, so the rows that
+    //  input edits are refreshed in the same frame
+    connect (vertexImage->frameScheduler (), &Aerodlyn::FrameScheduler::frame, this,
+             &Aerodlyn::VertexEditorWindow::handleFrame);
 
     centralWidget->setLayout (gridLayout);
 
-    // Create menu bar
-    fileMenu = menuBar ()->addMenu ("&File");
+    // Create the (empty) menus, their actions aren't needed until after the first frame
+    fileMenu   = menuBar ()->addMenu ("&File");
+    regionMenu = menuBar ()->addMenu ("&Region");
+    viewMenu   = menuBar ()->addMenu ("&View");
+
+    StartupTrace::afterFirstFrame (this, [this] { initializeDeferred (); });
+
+    // Set minimum size and set it as the initial size
+    resize (minimumSize ());
+    setWindowTitle (Utils::getTitle ());
+}
 
+/**
+ * Destroys the VertexEditorWindow.
+ *  NOTE: Most of the memory management is done by Qt.
+ *  NOTE: This is here in case I need it in the future, but it does nothing at the moment.
+ */
+Aerodlyn::VertexEditorWindow::~VertexEditorWindow () {}
+
+/* Public Methods */
+/**
+ * Returns the data sets being edited, such as for serving them to other processes. The data sets
+ *  change as they are edited, and must only be read from the GUI thread.
+ *
+ * @return The data sets being edited
+ */
+const Aerodlyn::VertexDataSetCollection &Aerodlyn::VertexEditorWindow::dataSetCollection () const
+    { return dataSets; }
+
+/**
+ * Returns the scheduler that paces input handling and repainting of the image, and the refreshes
+ *  of the table and side panel batched with it.
+ *
+ * @return The frame scheduler of the image
+ */
+Aerodlyn::FrameScheduler *Aerodlyn::VertexEditorWindow::frameScheduler () const
+    { return vertexImage->frameScheduler (); }
+
+/**
+ * Determines if the latest frame composed of the image shows its current state, as frames are
+ *  composed on a render thread after the frame scheduler signals them.
+ *
+ * @return True if the latest frame is current, false otherwise
+ */
+bool Aerodlyn::VertexEditorWindow::hasCurrentFrame () const
+    { return vertexImage->hasCurrentFrame (); }
+
+/**
+ * Opens the image file at the given filepath, replacing the previously opened image if one
+ *  was previously opened.
+ *
+ * @param filepath - The (full) filepath of the image file to open
+ *
+ * @return True if the image was opened, false otherwise
+ */
+bool Aerodlyn::VertexEditorWindow::openImageFile (const QString &filepath)
+{
+    if (!vertexImage->setImageFile (filepath))
+        return false;
+
+    emit imageOpened (filepath);
+    return true;
+}
+
+/**
+ * Opens the project file at the given filepath, replacing every data set with the ones saved
+ *  in it. Unsaved changes are lost.
+ *
+ * @param filepath - The (full) filepath of the project file to open
+ *
+ * @return True if the project was opened, false if it isn't a project file or couldn't be read
+ */
+bool Aerodlyn::VertexEditorWindow::openProjectFile (const QString &filepath)
+{
+    dataSetListView->selectionModel ()->clearCurrentIndex ();
+    selectDataSet (QString ());
+
+    if (!projectFile.load (filepath, dataSets))
+        return false;
+
+    projectFilepath = filepath;
+    dataSetListModel->reload ();
+
+    emit projectOpened (filepath);
+    return true;
+}
+
+/* Private Methods */
+/**
+ * Creates the actions of the menus. Deferred until after the first frame, as none of them are
+ *  visible before a menu is opened.
+ */
+void Aerodlyn::VertexEditorWindow::initializeMenus ()
+{
     QList <QKeySequence> loadShortcuts = QList <QKeySequence> ();
     loadShortcuts.append (QKeySequence ("Ctrl+L"));
     loadShortcuts.append (QKeySequence ("Cmd+L"));
@@ -81,6 +203,15 @@ Aerodlyn::VertexEditorWindow::VertexEditorWindow (QWidget *parent) : QMainWindow
     fileMenu->addAction (loadImageAction);
     connect (loadImageAction, &QAction::triggered, this, &VertexEditorWindow::handleOpenImage);
 
+    QList <QKeySequence> openProjectShortcuts = QList <QKeySequence> ();
+    openProjectShortcuts.append (QKeySequence ("Ctrl+O"));
+    openProjectShortcuts.append (QKeySequence ("Cmd+O"));
+
+    openProjectAction = new QAction ("&Open Project...");
+    openProjectAction->setShortcuts (openProjectShortcuts);
+    fileMenu->addAction (openProjectAction);
+    connect (openProjectAction, &QAction::triggered, this, &VertexEditorWindow::handleOpenProject);
+
     QList <QKeySequence> saveShortcuts = QList <QKeySequence> ();
     saveShortcuts.append (QKeySequence ("Ctrl+S"));
     saveShortcuts.append (QKeySequence ("Cmd+S"));
@@ -90,26 +221,218 @@ Aerodlyn::VertexEditorWindow::VertexEditorWindow (QWidget *parent) : QMainWindow
     fileMenu->addAction (saveDataAction);
     connect (saveDataAction, &QAction::triggered, this, &VertexEditorWindow::handleSaveDataSets);
 
+    importNamesAction = new QAction ("&Import Data Set Names...");
+    fileMenu->addAction (importNamesAction);
+    connect (importNamesAction, &QAction::triggered, this, &VertexEditorWindow::handleImportDataSetNames);
+
+    importRegionsAction = new QAction ("Import &Regions...");
+    fileMenu->addAction (importRegionsAction);
+    connect (importRegionsAction, &QAction::triggered, this, &VertexEditorWindow::handleImportRegions);
+
     QList <QKeySequence> quitShortcuts = QList <QKeySequence> ();
     quitShortcuts.append (QKeySequence ("Ctrl+Q"));
     quitShortcuts.append (QKeySequence ("Cmd+Q"));
 
+    exportHeaderAction = new QAction ("Export C++ &Header...");
+    fileMenu->addAction (exportHeaderAction);
+    connect (exportHeaderAction, &QAction::triggered, this, &VertexEditorWindow::handleExportHeader);
+
+    exportMasksAction = new QAction ("Export Collision &Masks...");
+    fileMenu->addAction (exportMasksAction);
+    connect (exportMasksAction, &QAction::triggered, this, &VertexEditorWindow::handleExportMasks);
+
+    exportDistanceFieldsAction = new QAction ("Export &Distance Fields...");
+    fileMenu->addAction (exportDistanceFieldsAction);
+    connect (exportDistanceFieldsAction, &QAction::triggered, this, &VertexEditorWindow::handleExportDistanceFields);
+
     quitAction = new QAction ("&Quit");
     quitAction->setShortcuts (quitShortcuts);
     fileMenu->addAction (quitAction);
     connect (quitAction, &QAction::triggered, this, &VertexEditorWindow::handleQuit);
 
-    // Set minimum size and set it as the initial size
-    resize (minimumSize ());
-    setWindowTitle (WINDOW_TITLE);
+    unionRegionAction = new QAction ("&Union With...");
+    regionMenu->addAction (unionRegionAction);
+    connect (unionRegionAction, &QAction::triggered, this, [this] { handleCombineRegions (RegionClipper::Operation::Union); });
+
+    intersectRegionAction = new QAction ("&Intersect With...");
+    regionMenu->addAction (intersectRegionAction);
+    connect (intersectRegionAction, &QAction::triggered, this,
+             [this] { handleCombineRegions (RegionClipper::Operation::Intersection); });
+
+    subtractRegionAction = new QAction ("&Subtract...");
+    regionMenu->addAction (subtractRegionAction);
+    connect (subtractRegionAction, &QAction::triggered, this,
+             [this] { handleCombineRegions (RegionClipper::Operation::Difference); });
+
+    xorRegionAction = new QAction ("E&xclusive Or With...");
+    regionMenu->addAction (xorRegionAction);
+    connect (xorRegionAction, &QAction::triggered, this, [this] { handleCombineRegions (RegionClipper::Operation::Xor); });
+
+    findOverlapsAction = new QAction ("Find &Overlaps...");
+    regionMenu->addAction (findOverlapsAction);
+    connect (findOverlapsAction, &QAction::triggered, this, &VertexEditorWindow::handleFindOverlaps);
+
+    clearOverlapsAction = new QAction ("&Clear Overlap Highlights");
+    regionMenu->addAction (clearOverlapsAction);
+    connect (clearOverlapsAction, &QAction::triggered, this, &VertexEditorWindow::handleClearOverlaps);
+
+    cleanUpRegionsAction = new QAction ("Clean &Up Regions...");
+    regionMenu->addAction (cleanUpRegionsAction);
+    connect (cleanUpRegionsAction, &QAction::triggered, this, &VertexEditorWindow::handleCleanUpRegions);
+
+    propagateFramesAction = new QAction ("&Propagate to Frames...");
+    regionMenu->addAction (propagateFramesAction);
+    connect (propagateFramesAction, &QAction::triggered, this, &VertexEditorWindow::handlePropagateToFrames);
+
+    regionMenu->addSeparator ();
+
+    addVertexAttributeAction = new QAction ("Add Vertex &Attribute...");
+    regionMenu->addAction (addVertexAttributeAction);
+    connect (addVertexAttributeAction, &QAction::triggered, this, &VertexEditorWindow::handleAddVertexAttribute);
+
+    removeVertexAttributeAction = new QAction ("&Remove Vertex Attribute...");
+    regionMenu->addAction (removeVertexAttributeAction);
+    connect (removeVertexAttributeAction, &QAction::triggered, this, &VertexEditorWindow::handleRemoveVertexAttribute);
+
+    showAllRegionsAction = new QAction ("Show &All Regions");
+    showAllRegionsAction->setCheckable (true);
+    viewMenu->addAction (showAllRegionsAction);
+    connect (showAllRegionsAction, &QAction::toggled, this, &VertexEditorWindow::handleShowAllRegionsToggled);
+
+    livePreviewAction = new QAction ("Publish &Live Preview");
+    livePreviewAction->setCheckable (true);
+    viewMenu->addAction (livePreviewAction);
+    connect (livePreviewAction, &QAction::toggled, this, &VertexEditorWindow::handleLivePreviewToggled);
+
+    showHudAction = new QAction ("Show Performance &HUD");
+    showHudAction->setCheckable (true);
+    showHudAction->setShortcut (QKeySequence ("F3"));
+    viewMenu->addAction (showHudAction);
+    connect (showHudAction, &QAction::toggled, this, &VertexEditorWindow::handleShowHudToggled);
+
+    profilingAction = new QAction ("Record &Profiling Events");
+    profilingAction->setCheckable (true);
+    viewMenu->addAction (profilingAction);
+    connect (profilingAction, &QAction::toggled, this, &VertexEditorWindow::handleProfilingToggled);
+
+    exportTraceAction = new QAction ("&Export Trace...");
+    viewMenu->addAction (exportTraceAction);
+    connect (exportTraceAction, &QAction::triggered, this, &VertexEditorWindow::handleExportTrace);
 }
 
 /**
- * Destroys the VertexEditorWindow.
- *  NOTE: Most of the memory management is done by Qt.
- *  NOTE: This is here in case I need it in the future, but it does nothing at the moment.
+ * Adds a data set for each of the given names in a single batch, reporting every name that
+ *  was already in use in a single message.
+ *
+ * @param names - The names of the data sets to add
  */
-Aerodlyn::VertexEditorWindow::~VertexEditorWindow () {}
+void Aerodlyn::VertexEditorWindow::addDataSets (const QStringList &names)
+{
+    if (names.isEmpty ())
+        return;
+
+    const QStringList conflicts = dataSetListModel->addAll (names);
+
+    // Inserting data sets moves the others in memory
+    selectDataSet (selectedDataSetName);
+    restoreDataSetSelection ();
+
+    if (!conflicts.isEmpty ())
+    {
+        QString listed = conflicts.mid (0, MAX_LISTED_CONFLICTS).join ("\n");
+        if (conflicts.size () > MAX_LISTED_CONFLICTS)
+            listed += QString ("\n... and %1 more").arg (conflicts.size () - MAX_LISTED_CONFLICTS);
+
+        QString errorText = QString ("%1 of %2 data sets weren't added, as their names are already in use:\n%3"
+            "\n\nYou can either clear those data sets, or delete them and add them again.")
+            .arg (conflicts.size ()).arg (names.size ()).arg (listed);
+        QMessageBox::critical (this, "Error", errorText);
+    }
+}
+
+/**
+ * Splits the given text into data set names. Each line may hold several names separated by
+ *  semicolons, and whitespace is removed from every name.
+ *
+ * @param text - The text to split
+ *
+ * @return The names in the given text, without any empty names
+ */
+QStringList Aerodlyn::VertexEditorWindow::parseDataSetNames (const QString &text)
+{
+    QStringList names;
+
+    for (const QString &line : text.split ('\n', QString::SkipEmptyParts))
+        names.append (line.simplified ().replace (" ", "").split (";", QString::SkipEmptyParts));
+
+    return names;
+}
+
+/**
+ * Selects the data set with the given name for editing, giving its region to the table and the
+ *  image. Also used to refresh the region after data sets have moved in memory.
+ *
+ * @param name - The name of the data set to select, or an empty string to select none
+ */
+void Aerodlyn::VertexEditorWindow::selectDataSet (const QString &name)
+{
+    selectedDataSetName = name;
+    currentRegion       = name.isEmpty () ? std::nullopt : dataSets.get (name);
+
+    pendingTableRows.clear ();
+
+    vertexTable->setRegion (currentRegion, name.isEmpty () ? std::nullopt : dataSets.attributes (name));
+    vertexImage->setRegion (currentRegion, name.isEmpty () ? std::nullopt : dataSets.geometry (name));
+    vertexImage->update ();
+
+    updateGeometryLabel ();
+}
+
+/**
+ * Shows the geometry derived from the region of the selected data set (its bounds, area,
+ *  centroid, perimeter and winding order) in the side panel.
+ */
+void Aerodlyn::VertexEditorWindow::updateGeometryLabel ()
+{
+    const int index = dataSets.indexOf (selectedDataSetName);
+    if (index == -1)
+    {
+        geometryLabel->clear ();
+        return;
+    }
+
+    const RegionGeometry &geometry = dataSets.geometryAt (index);
+    const QRectF bounds = geometry.bounds ();
+
+    QString winding = "None";
+    if (geometry.winding () == RegionGeometry::Winding::Clockwise)
+        winding = "Clockwise";
+
+    else if (geometry.winding () == RegionGeometry::Winding::CounterClockwise)
+        winding = "Counter-clockwise";
+
+    geometryLabel->setText (QString ("Bounds: (%1, %2) %3 x %4\nArea: %5\nCentroid: (%6, %7)\nPerimeter: %8\nWinding: %9")
+        .arg (bounds.x (), 0, 'f', 1).arg (bounds.y (), 0, 'f', 1)
+        .arg (bounds.width (), 0, 'f', 1).arg (bounds.height (), 0, 'f', 1)
+        .arg (geometry.area (), 0, 'f', 1)
+        .arg (geometry.centroid ().x (), 0, 'f', 1).arg (geometry.centroid ().y (), 0, 'f', 1)
+        .arg (geometry.perimeter (), 0, 'f', 1)
+        .arg (winding));
+}
+
+/**
+ * Makes the row of the selected data set current in the data set list again after the list was
+ *  reset, without selecting the data set a second time.
+ */
+void Aerodlyn::VertexEditorWindow::restoreDataSetSelection ()
+{
+    const int row = dataSetListModel->rowOf (selectedDataSetName);
+    if (row != -1)
+    {
+        const QSignalBlocker blocker (dataSetListView->selectionModel ());
+        dataSetListView->setCurrentIndex (dataSetListModel->index (row));
+    }
+}
 
 /* Private slots */
 /**
@@ -123,8 +446,10 @@ void Aerodlyn::VertexEditorWindow::addPointToSelectedDataSet (const double x, co
 {
     if (currentRegion.has_value ())
     {
-        currentRegion->get () << QPointF (x, y);
+        dataSets.insertPoint (selectedDataSetName, currentRegion->get ().size (), QPointF (x, y));
+
         vertexTable->update ();
+        updateGeometryLabel ();
     }
 }
 
@@ -137,30 +462,79 @@ void Aerodlyn::VertexEditorWindow::handleAddDataSet ()
 {
     // TODO: Adjust to use regex
     bool confirmed;
-    QStringList names = QInputDialog::getText (this, DATA_SET_INPUT_DIALOG_HEADER, DATA_SET_INPUT_DIALOG_DESC,
-        QLineEdit::Normal, "", &confirmed)
-        .simplified ()
-        .replace (" ", "")
-        .split (";", QString::SkipEmptyParts);
+    const QString text = QInputDialog::getText (this, DATA_SET_INPUT_DIALOG_HEADER, DATA_SET_INPUT_DIALOG_DESC,
+        QLineEdit::Normal, "", &confirmed);
 
     if (confirmed)
+        addDataSets (parseDataSetNames (text));
+}
+
+/**
+ * Handles adding an attribute channel, with a name and type chosen by the user, to the selected
+ *  data set, with a value of zero (or false) for every vertex. Does nothing if no data set is
+ *  selected or if canceled.
+ */
+void Aerodlyn::VertexEditorWindow::handleAddVertexAttribute ()
+{
+    if (!currentRegion.has_value ())
+        return;
+
+    bool confirmed;
+    const QString name = QInputDialog::getText (this, ATTRIBUTE_INPUT_HEADER, ATTRIBUTE_NAME_DESC, QLineEdit::Normal, "",
+        &confirmed).simplified ();
+
+    if (!confirmed || name.isEmpty ())
+        return;
+
+    static const VertexAttributes::Type TYPES [] = { VertexAttributes::Type::Flag, VertexAttributes::Type::Integer,
+        VertexAttributes::Type::Scalar, VertexAttributes::Type::Vector };
+
+    QStringList types;
+    for (const VertexAttributes::Type type : TYPES)
+        types.append (VertexAttributes::typeName (type));
+
+    const QString choice = QInputDialog::getItem (this, ATTRIBUTE_INPUT_HEADER, ATTRIBUTE_TYPE_DESC, types, 0, false,
+        &confirmed);
+
+    if (!confirmed)
+        return;
+
+    VertexAttributes &attributes = dataSets.attributes (selectedDataSetName)->get ();
+    if (!attributes.addChannel (name, TYPES [types.indexOf (choice)], currentRegion->get ().size ()))
     {
-        for (QString name : names)
-        {
-            const int index = dataSets.add (name);
+        QMessageBox::critical (this, "Error", QString ("The attribute '%1' already exists.").arg (name));
+        return;
+    }
 
-            if (index >= 0)
-                dataSetListWidget->insertItem (index, name);
+    dataSets.markAttributesDirty (selectedDataSetName);
+    vertexTable->setRegion (currentRegion, dataSets.attributes (selectedDataSetName));
+}
 
-            else
-            {
-                // Prompt user if they would like to rename one of the conflicting data sets
-                QString errorText = QString ("A data set with the name '%1' already exists."
-                    "\nYou can either clear that data set, or delete it and add it again.").arg (name);
-                QMessageBox::critical (this, "Error", errorText);
-            }
-        }
+/**
+ * Handles removing an attribute channel, chosen by the user, from the selected data set. Does
+ *  nothing if no data set is selected or if canceled.
+ */
+void Aerodlyn::VertexEditorWindow::handleRemoveVertexAttribute ()
+{
+    if (!currentRegion.has_value ())
+        return;
+
+    VertexAttributes &attributes = dataSets.attributes (selectedDataSetName)->get ();
+    if (attributes.isEmpty ())
+    {
+        QMessageBox::information (this, ATTRIBUTE_INPUT_HEADER, ATTRIBUTE_NONE_DESC);
+        return;
     }
+
+    bool confirmed;
+    const QString name = QInputDialog::getItem (this, ATTRIBUTE_INPUT_HEADER, ATTRIBUTE_REMOVE_DESC, attributes.names (),
+        0, false, &confirmed);
+
+    if (!confirmed || !attributes.removeChannel (name))
+        return;
+
+    dataSets.markAttributesDirty (selectedDataSetName);
+    vertexTable->setRegion (currentRegion, dataSets.attributes (selectedDataSetName));
 }
 
 /**
@@ -171,26 +545,150 @@ void Aerodlyn::VertexEditorWindow::handleClearDataSet ()
     if (currentRegion.has_value ())
     {
         currentRegion->get ().clear ();
+        dataSets.markDirty (selectedDataSetName);
 
         vertexImage->update ();
         vertexTable->update ();
+        updateGeometryLabel ();
     }
 }
 
+/**
+ * Handles cleaning up the region of every data set: merging vertices within a distance chosen
+ *  by the user, removing vertices that don't turn and giving every region the chosen winding
+ *  order, then listing what changed. Does nothing if canceled.
+ */
+void Aerodlyn::VertexEditorWindow::handleCleanUpRegions ()
+{
+    if (dataSets.length () == 0)
+        return;
+
+    bool confirmed;
+    const double tolerance = QInputDialog::getDouble (this, CLEANUP_INPUT_HEADER, CLEANUP_TOLERANCE_DESC, 1.0, 0.0,
+        64.0, 2, &confirmed);
+
+    if (!confirmed)
+        return;
+
+    const QString choice = QInputDialog::getItem (this, CLEANUP_INPUT_HEADER, CLEANUP_WINDING_DESC, CLEANUP_WINDINGS, 0,
+        false, &confirmed);
+
+    if (!confirmed)
+        return;
+
+    static const RegionGeometry::Winding WINDINGS [] = { RegionGeometry::Winding::Clockwise,
+        RegionGeometry::Winding::CounterClockwise, RegionGeometry::Winding::None };
+
+    QApplication::setOverrideCursor (Qt::WaitCursor);
+    const RegionCleaner::Summary summary = RegionCleaner::cleanAll (dataSets, tolerance,
+        WINDINGS [CLEANUP_WINDINGS.indexOf (choice)]);
+    QApplication::restoreOverrideCursor ();
+
+    if (summary.changed.isEmpty ())
+    {
+        QMessageBox::information (this, CLEANUP_INPUT_HEADER, CLEANUP_NONE_DESC);
+        return;
+    }
+
+    // The vertices of the selected region may have been removed, so the table and image start over
+    if (summary.changed.contains (selectedDataSetName))
+        selectDataSet (selectedDataSetName);
+
+    vertexImage->update ();
+
+    QString listed = summary.changed.mid (0, MAX_LISTED_CONFLICTS).join ("\n");
+    if (summary.changed.size () > MAX_LISTED_CONFLICTS)
+        listed += QString ("\n... and %1 more").arg (summary.changed.size () - MAX_LISTED_CONFLICTS);
+
+    QMessageBox message (QMessageBox::Information, CLEANUP_INPUT_HEADER,
+        QString ("%1 data sets changed: %2 vertices merged, %3 collinear vertices removed and %4 regions reversed.\n%5")
+            .arg (summary.changed.size ()).arg (summary.mergedVertices).arg (summary.collinearVertices)
+            .arg (summary.reversedRegions).arg (listed), QMessageBox::Ok, this);
+    message.setDetailedText (summary.changed.join ("\n"));
+    message.exec ();
+}
+
 /**
  * Handles clearing all currently existing data sets. Does nothing if no data sets exist.
  */
 void Aerodlyn::VertexEditorWindow::handleClearAllDataSets ()
 {
-    for (int i = 0; i < dataSetListWidget->count (); i++)
+    if (dataSets.length () == 0)
+        return;
+
+    dataSets.clearAll ();
+
+    vertexImage->update ();
+    vertexTable->update ();
+    updateGeometryLabel ();
+}
+
+/**
+ * Handles no longer outlining the data sets found to overlap.
+ */
+void Aerodlyn::VertexEditorWindow::handleClearOverlaps ()
+    { vertexImage->setHighlighted (nullptr, QSet <QString> ()); }
+
+/**
+ * Handles combining the region of the selected data set with the region of another data set
+ *  chosen by the user, storing the result in a new data set. Regions are combined as closed
+ *  polygons filled with the even-odd rule, and a result made of several pieces (or with holes)
+ *  is joined into a single region by bridges. Does nothing if no data set is selected or if
+ *  canceled.
+ *
+ * @param operation - The operation to combine the regions with
+ */
+void Aerodlyn::VertexEditorWindow::handleCombineRegions (const RegionClipper::Operation operation)
+{
+    if (!currentRegion.has_value ())
+        return;
+
+    QStringList others;
+    for (int i = 0; i < dataSets.length (); i++)
     {
-        const auto item = dataSets.get (dataSetListWidget->item (i)->text ());
-        if (item.has_value ())
-            item->get ().clear ();
+        if (dataSets.at (i).name != selectedDataSetName)
+            others.append (dataSets.at (i).name);
+    }
 
-        vertexImage->update ();
-        vertexTable->update ();
+    if (others.isEmpty ())
+        return;
+
+    bool confirmed;
+    const QString other = QInputDialog::getItem (this, COMBINE_INPUT_HEADER, COMBINE_OTHER_DESC, others, 0, false,
+        &confirmed);
+
+    if (!confirmed)
+        return;
+
+    static const char *const SUFFIXES [] = { "union", "intersection", "difference", "xor" };
+    const QString suggested = QString ("%1_%2_%3").arg (selectedDataSetName, SUFFIXES [static_cast <int> (operation)], other);
+
+    const QString name = QInputDialog::getText (this, COMBINE_INPUT_HEADER, COMBINE_NAME_DESC, QLineEdit::Normal,
+        suggested, &confirmed).simplified ().replace (" ", "");
+
+    if (!confirmed || name.isEmpty ())
+        return;
+
+    const QPolygonF region = RegionClipper::merge (RegionClipper::clip (currentRegion->get (),
+        dataSets.at (dataSets.indexOf (other)).region, operation));
+
+    if (region.isEmpty ())
+    {
+        QMessageBox::information (this, COMBINE_INPUT_HEADER, COMBINE_EMPTY_DESC);
+        return;
+    }
+
+    if (dataSetListModel->add (name) < 0)
+    {
+        QMessageBox::critical (this, "Error", QString ("The name '%1' is already in use.").arg (name));
+        return;
     }
+
+    dataSets.get (name)->get () = region;
+    dataSets.markDirty (name);
+
+    selectDataSet (name);
+    restoreDataSetSelection ();
 }
 
 /**
@@ -200,14 +698,7 @@ void Aerodlyn::VertexEditorWindow::handleClearAllDataSets ()
  * @param currentRow The row (index) of the data set that was selected
  */
 void Aerodlyn::VertexEditorWindow::handleDataSelection (int currentRow)
-{
-    selectedDataSetIndex = currentRow;
-    currentRegion = dataSets.get (dataSetListWidget->item (selectedDataSetIndex)->text ());
-
-    vertexTable->setRegion (currentRegion);
-    vertexImage->setRegion (currentRegion);
-    vertexImage->update ();
-}
+    { selectDataSet (dataSetListModel->nameAt (currentRow)); }
 
 /**
  * Handles deleting the currently selected data set. Does nothing if no data set is
@@ -217,15 +708,329 @@ void Aerodlyn::VertexEditorWindow::handleDeleteDataSet ()
 {
     if (currentRegion.has_value ())
     {
-        const QListWidgetItem *item = dataSetListWidget->takeItem (selectedDataSetIndex);
+        const int row = dataSetListModel->rowOf (selectedDataSetName);
+
+        // Deselect first, so that nothing refers to the data set while it is removed
+        dataSetListView->selectionModel ()->clearCurrentIndex ();
+        selectDataSet (QString ()); // TODO: Set to another existing region if there is one
+
+        if (row != -1)
+            dataSetListModel->removeDataSet (row);
+    }
+}
+
+/**
+ * Handles deleting every data set. Does nothing if no data sets exist.
+ */
+void Aerodlyn::VertexEditorWindow::handleDeleteAllDataSets ()
+{
+    if (dataSets.length () == 0)
+        return;
+
+    dataSetListView->selectionModel ()->clearCurrentIndex ();
+    selectDataSet (QString ());
+
+    dataSetListModel->removeAll ();
+}
+
+/**
+ * Handles exporting every data set as a C++ header of constexpr vertex tables, to a file chosen
+ *  by the user.
+ */
+void Aerodlyn::VertexEditorWindow::handleExportHeader ()
+{
+    const QString filepath = QFileDialog::getSaveFileName (this, HEADER_OUTPUT_HEADER, lastOpenedDirPath,
+        HEADER_FILE_TYPES);
+
+    if (filepath.isEmpty ())
+        return;
+
+    lastOpenedDirPath = filepath.left (filepath.lastIndexOf (QDir::separator ()));
+
+    if (!HeaderExporter::save (filepath, dataSets))
+        QMessageBox::critical (this, "Error", QString ("The header couldn't be written to '%1'.").arg (filepath));
+}
+
+/**
+ * Handles exporting a signed distance field for every data set, at a resolution relative to the
+ *  loaded image chosen by the user, to a directory chosen by the user.
+ */
+void Aerodlyn::VertexEditorWindow::handleExportDistanceFields ()
+{
+    const QSize size = vertexImage->imageSize ();
+    if (size.isEmpty () || dataSets.length () == 0)
+    {
+        QMessageBox::critical (this, "Error",
+            "An image must be loaded and at least one data set created to export distance fields.");
+        return;
+    }
+
+    bool confirmed;
+    const QString format = QInputDialog::getItem (this, DISTANCE_OUTPUT_HEADER, DISTANCE_FORMAT_DESC, DISTANCE_FORMATS,
+        0, false, &confirmed);
+
+    if (!confirmed)
+        return;
+
+    const double scale = QInputDialog::getDouble (this, DISTANCE_OUTPUT_HEADER, DISTANCE_SCALE_DESC, 1.0, 0.125, 8.0, 3,
+        &confirmed);
+
+    if (!confirmed)
+        return;
+
+    const auto encoding = DISTANCE_FORMATS.indexOf (format) == 0 ? DistanceField::Encoding::Byte :
+        DistanceField::Encoding::Float;
+
+    // Float fields hold the distances themselves, so only 8-bit fields need a spread
+    double spread = 1.0;
+    if (encoding == DistanceField::Encoding::Byte)
+    {
+        spread = QInputDialog::getDouble (this, DISTANCE_OUTPUT_HEADER, DISTANCE_SPREAD_DESC, 8.0, 0.5, 1024.0, 1,
+            &confirmed);
+
+        if (!confirmed)
+            return;
+    }
+
+    const QString directory = QFileDialog::getExistingDirectory (this, DISTANCE_OUTPUT_HEADER, lastOpenedDirPath);
+    if (directory.isEmpty ())
+        return;
+
+    // Region coordinates are relative to the center of the image, which the scale moves along with the size
+    const QSize fieldSize (std::max (1, qRound (size.width () * scale)), std::max (1, qRound (size.height () * scale)));
+    const QPointF origin (size.width () / 2 * scale, size.height () / 2 * scale);
+
+    QApplication::setOverrideCursor (Qt::WaitCursor);
+    const QStringList failed = DistanceField::exportAll (dataSets, fieldSize, origin, scale, spread, encoding,
+        QDir (directory));
+    QApplication::restoreOverrideCursor ();
+
+    if (!failed.isEmpty ())
+    {
+        QString errorText = QString ("The distance fields of %1 data sets couldn't be written to '%2':\n%3")
+            .arg (failed.size ()).arg (directory).arg (failed.mid (0, MAX_LISTED_CONFLICTS).join ("\n"));
+        QMessageBox::critical (this, "Error", errorText);
+    }
+}
+
+/**
+ * Handles exporting a collision mask for every data set, rasterized at the resolution of the
+ *  loaded image, to a directory chosen by the user.
+ */
+void Aerodlyn::VertexEditorWindow::handleExportMasks ()
+{
+    const QSize size = vertexImage->imageSize ();
+    if (size.isEmpty () || dataSets.length () == 0)
+    {
+        QMessageBox::critical (this, "Error", "An image must be loaded and at least one data set created to export masks.");
+        return;
+    }
+
+    bool confirmed;
+    const QString format = QInputDialog::getItem (this, MASK_OUTPUT_HEADER, MASK_FORMAT_DESC, MASK_FORMATS, 0, false,
+        &confirmed);
+
+    if (!confirmed)
+        return;
+
+    const QString directory = QFileDialog::getExistingDirectory (this, MASK_OUTPUT_HEADER, lastOpenedDirPath);
+    if (directory.isEmpty ())
+        return;
+
+    const int formatIndex = MASK_FORMATS.indexOf (format);
+    const auto bits       = formatIndex == 0 ? RegionRasterizer::Format::Byte : RegionRasterizer::Format::Bit;
+    const auto encoding   = formatIndex == 2 ? RegionRasterizer::Encoding::Packed : RegionRasterizer::Encoding::Png;
+
+    // Region coordinates are relative to the center of the image
+    const QPointF origin (size.width () / 2, size.height () / 2);
+
+    QApplication::setOverrideCursor (Qt::WaitCursor);
+    const QStringList failed = RegionRasterizer::exportAll (dataSets, size, origin, bits, encoding, QDir (directory));
+    QApplication::restoreOverrideCursor ();
+
+    if (!failed.isEmpty ())
+    {
+        QString errorText = QString ("The masks of %1 data sets couldn't be written to '%2':\n%3")
+            .arg (failed.size ()).arg (directory).arg (failed.mid (0, MAX_LISTED_CONFLICTS).join ("\n"));
+        QMessageBox::critical (this, "Error", errorText);
+    }
+}
+
+/**
+ * Handles exporting the events recorded by the profiler to a Chrome trace-event JSON file
+ *  chosen by the user.
+ */
+void Aerodlyn::VertexEditorWindow::handleExportTrace ()
+{
+    QString filepath = QFileDialog::getSaveFileName (this, TRACE_OUTPUT_HEADER, lastOpenedDirPath,
+        TRACE_OUTPUT_FILE_TYPES);
+
+    if (!filepath.isEmpty () && !Profiler::exportChromeTrace (filepath))
+        QMessageBox::critical (this, "Error", QString ("The trace couldn't be written to '%1'.").arg (filepath));
+}
+
+/**
+ * Initializes everything that isn't needed to show the first frame of the window, and then
+ *  finishes the startup trace.
+ */
+void Aerodlyn::VertexEditorWindow::initializeDeferred ()
+{
+    initializeMenus ();
+    StartupTrace::mark ("menus initialized");
+
+    StartupTrace::finish ();
+}
+
+/**
+ * Handles importing data set names from a text file chosen by the user, adding a data set for
+ *  each of them.
+ */
+void Aerodlyn::VertexEditorWindow::handleImportDataSetNames ()
+{
+    QString filepath = QFileDialog::getOpenFileName (this, NAMES_INPUT_HEADER, lastOpenedDirPath,
+        NAMES_INPUT_FILE_TYPES);
+
+    if (filepath.isEmpty ())
+        return;
+
+    lastOpenedDirPath = filepath.left (filepath.lastIndexOf (QDir::separator ()));
+
+    QFile file (filepath);
+    if (!file.open (QIODevice::ReadOnly | QIODevice::Text))
+    {
+        QMessageBox::critical (this, "Error", QString ("'%1' couldn't be read.").arg (filepath));
+        return;
+    }
 
-        dataSets.remove (item->text ());
+    addDataSets (parseDataSetNames (QString::fromUtf8 (file.readAll ())));
+}
 
-        delete item;
-        currentRegion = std::nullopt; // TODO: Set to another existing region if there is one
+/**
+ * Handles importing the regions of PhysicsEditor or Box2D JSON, Tiled or SVG files chosen by the
+ *  user, adding a data set for each of them.
+ */
+void Aerodlyn::VertexEditorWindow::handleImportRegions ()
+{
+    const QStringList filepaths = QFileDialog::getOpenFileNames (this, REGIONS_INPUT_HEADER, lastOpenedDirPath,
+        REGIONS_INPUT_FILE_TYPES);
+
+    if (filepaths.isEmpty ())
+        return;
+
+    lastOpenedDirPath = filepaths.first ().left (filepaths.first ().lastIndexOf (QDir::separator ()));
+
+    // Other tools place shapes in image pixels from the top left, while regions are relative to the
+    //  center of the image (rounded down to a whole pixel, like everywhere else)
+    const QSize size = vertexImage->imageSize ();
+    const QPointF origin = size.isEmpty () ? QPointF () : QPointF (size.width () / 2, size.height () / 2);
+
+    QApplication::setOverrideCursor (Qt::WaitCursor);
+
+    const RegionImporter::Result result = RegionImporter::readAll (filepaths, origin);
+    const int found = result.dataSets.size (), before = dataSets.length ();
+    const QStringList conflicts = found > 0 ? dataSetListModel->insertAll (result.dataSets) : QStringList ();
 
-        vertexTable->setRegion (currentRegion);
+    // Inserting data sets moves the others in memory
+    if (found > 0)
+    {
+        selectDataSet (selectedDataSetName);
+        restoreDataSetSelection ();
     }
+
+    QApplication::restoreOverrideCursor ();
+
+    QStringList problems;
+    for (const RegionImporter::Error &error : result.errors)
+        problems.append (error.toString ());
+
+    for (const QString &conflict : conflicts)
+        problems.append (QString ("%1: name already in use").arg (conflict));
+
+    if (problems.isEmpty () && found > 0)
+        return;
+
+    QString listed = problems.mid (0, MAX_LISTED_CONFLICTS).join ("\n");
+    if (problems.size () > MAX_LISTED_CONFLICTS)
+        listed += QString ("\n... and %1 more").arg (problems.size () - MAX_LISTED_CONFLICTS);
+
+    if (found == 0)
+    {
+        QMessageBox::critical (this, "Error", problems.isEmpty () ? REGIONS_NONE_DESC :
+            QString ("%1\n\n%2").arg (REGIONS_NONE_DESC, listed));
+        return;
+    }
+
+    QMessageBox::warning (this, REGIONS_INPUT_HEADER, QString ("%1 of %2 regions were added, with these problems:\n%3")
+        .arg (dataSets.length () - before).arg (found).arg (listed));
+}
+
+/**
+ * Handles finding every pair of data sets whose regions overlap, listing the pairs and
+ *  outlining their data sets on the image until the next search or until cleared.
+ */
+void Aerodlyn::VertexEditorWindow::handleFindOverlaps ()
+{
+    QApplication::setOverrideCursor (Qt::WaitCursor);
+    const QVector <QPair <QString, QString>> overlaps = OverlapDetector::findOverlaps (dataSets);
+    QApplication::restoreOverrideCursor ();
+
+    QSet <QString> names;
+    QStringList pairs;
+
+    for (const QPair <QString, QString> &overlap : overlaps)
+    {
+        names << overlap.first << overlap.second;
+        pairs.append (QString ("%1 and %2").arg (overlap.first, overlap.second));
+    }
+
+    vertexImage->setHighlighted (&dataSets, names);
+
+    if (pairs.isEmpty ())
+    {
+        QMessageBox::information (this, OVERLAP_OUTPUT_HEADER, OVERLAP_NONE_DESC);
+        return;
+    }
+
+    QString listed = pairs.mid (0, MAX_LISTED_CONFLICTS).join ("\n");
+    if (pairs.size () > MAX_LISTED_CONFLICTS)
+        listed += QString ("\n... and %1 more").arg (pairs.size () - MAX_LISTED_CONFLICTS);
+
+    // Every pair is listed in the details, which can be copied from
+    QMessageBox message (QMessageBox::Warning, OVERLAP_OUTPUT_HEADER,
+        QString ("%1 pairs of data sets overlap, and are outlined on the image:\n%2").arg (pairs.size ()).arg (listed),
+        QMessageBox::Ok, this);
+    message.setDetailedText (pairs.join ("\n"));
+    message.exec ();
+}
+
+/**
+ * Handles the text of the data set filter changing by filtering the data set list, keeping the
+ *  selected data set selected if it still matches.
+ *
+ * @param text - The new filter text
+ */
+void Aerodlyn::VertexEditorWindow::handleFilterChanged (const QString &text)
+{
+    dataSetListModel->setFilter (text);
+    restoreDataSetSelection ();
+}
+
+/**
+ * Handles the start of a display frame by refreshing, in a single batch, every row of the data
+ *  table that was edited since the last frame, along with the geometry shown in the side panel.
+ */
+void Aerodlyn::VertexEditorWindow::handleFrame ()
+{
+    if (pendingTableRows.isEmpty ())
+        return;
+
+    QVector <int> rows = pendingTableRows.values ().toVector ();
+    pendingTableRows.clear ();
+
+    std::sort (rows.begin (), rows.end ());
+    vertexTable->update (rows);
+
+    updateGeometryLabel ();
 }
 
 /**
@@ -256,12 +1061,11 @@ void Aerodlyn::VertexEditorWindow::handleMouseMoved (const double x, const doubl
     if (!currentRegion.has_value ())
         return;
 
-    QPointF &point = currentRegion->get () [index];
+    dataSets.movePoint (selectedDataSetName, index, QPointF (x, y));
 
-    point.setX (x);
-    point.setY (y);
-
-    vertexTable->update (index);
+    // Moves are applied while a frame is handled, whose end refreshes the row, or else just before
+    //  the image requests a frame itself
+    pendingTableRows.insert (index);
 }
 
 /**
@@ -276,23 +1080,262 @@ void Aerodlyn::VertexEditorWindow::handleOpenImage ()
     if (!filepath.isEmpty ())
     {
         lastOpenedDirPath = filepath.left (filepath.lastIndexOf (QDir::separator ()));
-        vertexImage->setImageFile (filepath);
+        openImageFile (filepath);
     }
 }
 
 /**
- * Handles gracefully exiting the program. If the user has unsaved data, a prompt will
- *  inform the user of that and ask if they want to save the data before exiting.
+ * Handles opening a project file, replacing every data set with the ones saved in it. Asks the
+ *  user first if there are unsaved changes.
+ */
+void Aerodlyn::VertexEditorWindow::handleOpenProject ()
+{
+    if (dataSets.hasChanges () && QMessageBox::question (this, PROJECT_INPUT_HEADER,
+        "The data sets have unsaved changes, which will be lost. Open a project anyway?") != QMessageBox::Yes)
+        return;
+
+    QString filepath = QFileDialog::getOpenFileName (this, PROJECT_INPUT_HEADER, lastOpenedDirPath,
+        PROJECT_FILE_TYPES);
+
+    if (filepath.isEmpty ())
+        return;
+
+    lastOpenedDirPath = filepath.left (filepath.lastIndexOf (QDir::separator ()));
+
+    if (!openProjectFile (filepath))
+        QMessageBox::critical (this, "Error", QString ("'%1' isn't a project file or couldn't be read.").arg (filepath));
+
+    else if (projectFile.isPartial ())
+        QMessageBox::warning (this, PROJECT_INPUT_HEADER, QString ("'%1' is damaged, so only the data sets before the damage "
+            "were loaded. Saving rewrites the file without the damaged part.").arg (filepath));
+}
+
+/**
+ * Handles picking a data set on the canvas by selecting the data set whose region contains the
+ *  given coordinates. Where regions overlap, picking the same spot again cycles through them.
+ *  Does nothing if no region contains the coordinates.
+ *
+ * @param x - The x coordinate
+ * @param y - The y coordinate
+ */
+void Aerodlyn::VertexEditorWindow::handleRegionPicked (const double x, const double y)
+{
+    const QStringList names = dataSets.regionsAt (QPointF (x, y));
+    if (names.isEmpty ())
+        return;
+
+    // The names are sorted, so the one after the selected data set is the next one under the click
+    const int selected = names.indexOf (selectedDataSetName);
+    const QString &name = names.at ((selected + 1) % names.size ());
+
+    if (name != selectedDataSetName)
+    {
+        selectDataSet (name);
+        restoreDataSetSelection ();
+    }
+}
+
+/**
+ * Handles refreshing the data table after a bulk transform has been applied to the selected
+ *  vertices of the current data set.
+ *
+ * @param indices - The indices of the vertices that were transformed
+ */
+void Aerodlyn::VertexEditorWindow::handleRegionTransformed (const QVector <int> &indices)
+{
+    // Like moves, transforms are applied while a frame is handled or just before the image requests one
+    for (const int index : indices)
+        pendingTableRows.insert (index);
+
+    dataSets.markDirty (selectedDataSetName);
+}
+
+/**
+ * Handles enabling or disabling the profiler.
+ *
+ * @param enabled - True if the profiler should record events, false otherwise
+ */
+void Aerodlyn::VertexEditorWindow::handleProfilingToggled (const bool enabled)
+    { Profiler::setEnabled (enabled); }
+
+/**
+ * Handles carrying the region of the selected data set over to every frame of the loaded
+ *  sprite sheet, sliced on a grid or around its opaque parts as chosen by the user. Each frame
+ *  gets a new data set named after the selected one and the frame's number. Does nothing if no
+ *  data set is selected or if canceled.
+ */
+void Aerodlyn::VertexEditorWindow::handlePropagateToFrames ()
+{
+    if (!currentRegion.has_value () || currentRegion->get ().isEmpty ())
+        return;
+
+    const QImage &image = vertexImage->loadedImage ();
+    if (image.isNull ())
+    {
+        QMessageBox::critical (this, "Error", "A sprite sheet must be loaded to propagate a region to its frames.");
+        return;
+    }
+
+    bool confirmed;
+    const QString slicing = QInputDialog::getItem (this, FRAMES_INPUT_HEADER, FRAMES_SLICING_DESC, FRAMES_SLICINGS, 0,
+        false, &confirmed);
+
+    if (!confirmed)
+        return;
+
+    QVector <QRect> frames;
+    if (FRAMES_SLICINGS.indexOf (slicing) == 0)
+    {
+        const int columns = QInputDialog::getInt (this, FRAMES_INPUT_HEADER, FRAMES_COLUMNS_DESC, 4, 1, image.width (), 1,
+            &confirmed);
+
+        if (!confirmed)
+            return;
+
+        const int rows = QInputDialog::getInt (this, FRAMES_INPUT_HEADER, FRAMES_ROWS_DESC, 1, 1, image.height (), 1,
+            &confirmed);
+
+        if (!confirmed)
+            return;
+
+        frames = SpriteSheet::gridFrames (image.size (), columns, rows);
+    }
+
+    else
+    {
+        QApplication::setOverrideCursor (Qt::WaitCursor);
+        frames = SpriteSheet::detectFrames (image);
+        QApplication::restoreOverrideCursor ();
+    }
+
+    // Region coordinates are relative to the center of the image
+    const QPointF origin (image.width () / 2, image.height () / 2);
+    const QPolygonF region = currentRegion->get ();
+    const VertexAttributes attributes = dataSets.attributes (selectedDataSetName)->get ();
+    const int source = SpriteSheet::frameAt (frames, region.boundingRect ().center () + origin);
+
+    if (source == -1)
+    {
+        QMessageBox::critical (this, "Error", "The selected region isn't inside any frame.");
+        return;
+    }
+
+    const int reach = QInputDialog::getInt (this, FRAMES_INPUT_HEADER, FRAMES_REACH_DESC, 4, 0, 64, 1, &confirmed);
+    if (!confirmed)
+        return;
+
+    // Frames are numbered from 1, padded so that the names sort in frame order
+    const int digits = QString::number (frames.size ()).size ();
+
+    QStringList names, conflicts;
+    for (int i = 0; i < frames.size (); i++)
+    {
+        names.append (QString ("%1_%2").arg (selectedDataSetName).arg (i + 1, digits, 10, QChar ('0')));
+        if (dataSets.indexOf (names.last ()) != -1)
+            conflicts.append (names.last ());
+    }
+
+    if (!conflicts.isEmpty ())
+    {
+        QString listed = conflicts.mid (0, MAX_LISTED_CONFLICTS).join ("\n");
+        if (conflicts.size () > MAX_LISTED_CONFLICTS)
+            listed += QString ("\n... and %1 more").arg (conflicts.size () - MAX_LISTED_CONFLICTS);
+
+        QMessageBox::critical (this, "Error", QString ("No data sets were added, as %1 of the names for the frames are "
+            "already in use:\n%2").arg (conflicts.size ()).arg (listed));
+        return;
+    }
+
+    QApplication::setOverrideCursor (Qt::WaitCursor);
+    const QVector <QPolygonF> regions = SpriteSheet::propagate (region, image, origin, frames, source, reach);
+    QApplication::restoreOverrideCursor ();
+
+    addDataSets (names);
+
+    for (int i = 0; i < names.size (); i++)
+    {
+        // Frames keep the vertices of the region, so they keep its attributes too
+        dataSets.get (names.at (i))->get () = regions.at (i);
+        dataSets.attributes (names.at (i))->get () = attributes;
+        dataSets.markDirty (names.at (i));
+    }
+
+    vertexImage->update ();
+}
+
+/**
+ * Handles gracefully exiting the program by closing the window, which ends the event loop.
  */
 void Aerodlyn::VertexEditorWindow::handleQuit ()
-    { exit (0); }
+    { close (); }
 
 /**
- * Handles saving the current data sets to file, whose filetype is of the users choosing (possibly
- *  defined by the user). Does nothing if no data sets exist.
+ * Handles saving the data sets to the project file, asking the user where to save it the first
+ *  time. Only the data sets changed since the last save are written.
  */
 void Aerodlyn::VertexEditorWindow::handleSaveDataSets ()
 {
-    /* if (dataSetList.length () > 0)
-        QString filename = QFileDialog::getSaveFileName (this, "Save Data Sets", lastOpenedDirPath); */
+    if (projectFilepath.isEmpty ())
+    {
+        projectFilepath = QFileDialog::getSaveFileName (this, PROJECT_OUTPUT_HEADER, lastOpenedDirPath,
+            PROJECT_FILE_TYPES);
+
+        if (projectFilepath.isEmpty ())
+            return;
+
+        lastOpenedDirPath = projectFilepath.left (projectFilepath.lastIndexOf (QDir::separator ()));
+    }
+
+    if (!projectFile.save (projectFilepath, dataSets))
+        QMessageBox::critical (this, "Error", QString ("The data sets couldn't be saved to '%1'.").arg (projectFilepath));
+}
+
+/**
+ * Handles starting or stopping the live preview feed, which publishes the data sets into shared
+ *  memory for a running game to pick up.
+ *
+ * @param enabled - True if the data sets should be published, false otherwise
+ */
+void Aerodlyn::VertexEditorWindow::handleLivePreviewToggled (const bool enabled)
+{
+    if (!enabled)
+    {
+        livePreviewFeed.stop ();
+        return;
+    }
+
+    if (!livePreviewFeed.start (LivePreviewHeader::defaultKey ()))
+    {
+        QMessageBox::critical (this, "Error", QString ("The live preview couldn't be published: %1")
+            .arg (livePreviewFeed.errorString ()));
+
+        const QSignalBlocker blocker (livePreviewAction);
+        livePreviewAction->setChecked (false);
+
+        return;
+    }
+
+    livePreviewFeed.watch (&dataSets);
+}
+
+/**
+ * Handles showing or hiding every data set under the current region.
+ *
+ * @param visible - True if every data set should be shown, false otherwise
+ */
+void Aerodlyn::VertexEditorWindow::handleShowAllRegionsToggled (const bool visible)
+    { vertexImage->setOverlay (visible ? &dataSets : nullptr); }
+
+/**
+ * Handles showing or hiding the performance HUD drawn over the image.
+ *
+ * @param visible - True if the HUD should be shown, false otherwise
+ */
+void Aerodlyn::VertexEditorWindow::handleShowHudToggled (const bool visible)
+{
+    // The HUD relies on the profiler for its timings
+    if (visible)
+        profilingAction->setChecked (true);
+
+    vertexImage->setHudVisible (visible);
 }
@@ -6,28 +6,54 @@
 #include <optional>
 #include <utility>
 
+#include <QApplication>
 #include <QDir>
+#include <QFile>
 #include <QFileDialog>
 #include <QGridLayout>
+#include <QImage>
 #include <QInputDialog>
+#include <QItemSelectionModel>
 #include <QKeySequence>
 #include <QLabel>
+#include <QLineEdit>
 #include <QList>
-#include <QListWidget>
+#include <QListView>
 #include <QMainWindow>
 #include <QMenu>
 #include <QMenuBar>
 #include <QMessageBox>
+#include <QPair>
 #include <QPointF>
 #include <QPolygonF>
 #include <QPushButton>
+#include <QRect>
+#include <QRectF>
+#include <QSet>
+#include <QSignalBlocker>
+#include <QSize>
 #include <QString>
+#include <QStringList>
 #include <QVBoxLayout>
 #include <QVector>
 
+#include "Root/Profiler.h"
+#include "Root/StartupTrace.h"
 #include "Root/Utils.h"
+#include "Utilities/DistanceField.h"
+#include "Utilities/HeaderExporter.h"
+#include "Utilities/OverlapDetector.h"
+#include "Utilities/ProjectFile.h"
+#include "Utilities/RegionCleaner.h"
+#include "Utilities/RegionImporter.h"
+#include "Utilities/RegionClipper.h"
+#include "Utilities/RegionRasterizer.h"
+#include "Utilities/SpriteSheet.h"
+#include "Utilities/VertexAttributes.h"
 #include "Utilities/VertexDataSetCollection.h"
 
+#include "DataSetListModel.h"
+#include "LivePreviewFeed.h"
 #include "VertexEditorImage.h"
 #include "VertexEditorTable.h"
 
@@ -62,23 +88,97 @@ namespace Aerodlyn
              */
             ~VertexEditorWindow ();
 
+        public: // Methods
+            /**
+             * Returns the data sets being edited, such as for serving them to other processes. The data sets
+             *  change as they are edited, and must only be read from the GUI thread.
+             *
+             * @return The data sets being edited
+             */
+            const VertexDataSetCollection &dataSetCollection () const;
+
+            /**
+             * Returns the scheduler that paces input handling and repainting of the image, and the refreshes
+             *  of the table and side panel batched with it.
+             *
+             * @return The frame scheduler of the image
+             */
+            FrameScheduler *frameScheduler () const;
+
+            /**
+             * Determines if the latest frame composed of the image shows its current state, as frames are
+             *  composed on a render thread after the frame scheduler signals them.
+             *
+             * @return True if the latest frame is current, false otherwise
+             */
+            bool hasCurrentFrame () const;
+
+            /**
+             * Opens the image file at the given filepath, replacing the previously opened image if one
+             *  was previously opened.
+             *
+             * @param filepath - The (full) filepath of the image file to open
+             *
+             * @return True if the image was opened, false otherwise
+             */
+            bool openImageFile (const QString &filepath);
+
+            /**
+             * Opens the project file at the given filepath, replacing every data set with the ones saved
+             *  in it. Unsaved changes are lost.
+             *
+             * @param filepath - The (full) filepath of the project file to open
+             *
+             * @return True if the project was opened, false if it isn't a project file or couldn't be read
+             */
+            bool openProjectFile (const QString &filepath);
+
         private: // Variables
-            int                                                selectedDataSetIndex;
+            const int                                          MAX_LISTED_CONFLICTS     = 20;
 
             const unsigned int                                 MARGIN                   = 5;
             const unsigned int                                 SPACING                  = 5;
 
             std::optional <std::reference_wrapper <QPolygonF>> currentRegion            = std::nullopt;
 
+            QAction                                            *exportDistanceFieldsAction;
+            QAction                                            *exportHeaderAction;
+            QAction                                            *exportMasksAction;
+            QAction                                            *clearOverlapsAction;
+            QAction                                            *addVertexAttributeAction;
+            QAction                                            *cleanUpRegionsAction;
+            QAction                                            *exportTraceAction;
+            QAction                                            *findOverlapsAction;
+            QAction                                            *importNamesAction;
+            QAction                                            *importRegionsAction;
+            QAction                                            *intersectRegionAction;
+            QAction                                            *livePreviewAction;
             QAction                                            *loadImageAction;
+            QAction                                            *openProjectAction;
+            QAction                                            *profilingAction;
+            QAction                                            *propagateFramesAction;
             QAction                                            *quitAction;
+            QAction                                            *removeVertexAttributeAction;
             QAction                                            *saveDataAction;
+            QAction                                            *showAllRegionsAction;
+            QAction                                            *showHudAction;
+            QAction                                            *subtractRegionAction;
+            QAction                                            *unionRegionAction;
+            QAction                                            *xorRegionAction;
 
             QGridLayout                                        *gridLayout;
 
-            QListWidget                                        *dataSetListWidget;
+            DataSetListModel                                   *dataSetListModel;
+
+            QLabel                                             *geometryLabel;
+
+            QLineEdit                                          *dataSetFilterEdit;
+
+            QListView                                          *dataSetListView;
 
             QMenu                                              *fileMenu;
+            QMenu                                              *regionMenu;
+            QMenu                                              *viewMenu;
 
             QPushButton                                        *addDataSetButton;
             QPushButton                                        *clearDataSetButton;
@@ -86,11 +186,20 @@ namespace Aerodlyn
             QPushButton                                        *deleteDataSet;
             QPushButton                                        *deleteAllDataSets;
 
+            QSet <int>                                         pendingTableRows;
+
+            LivePreviewFeed                                    livePreviewFeed;
+
+            ProjectFile                                        projectFile;
+
             QString                                            lastOpenedDirPath        = QDir::homePath ();
+            QString                                            projectFilepath;
+            QString                                            selectedDataSetName;
 
             const QString                                      DATA_COLUMN_01_HEADER    = "X";
             const QString                                      DATA_COLUMN_02_HEADER    = "Y";
 
+            QVBoxLayout                                        *dataSetListVBox;
             QVBoxLayout                                        *dataSetVBox;
 
 //            QVector <float>                                *currentDataSetPoints = nullptr;
@@ -104,14 +213,56 @@ namespace Aerodlyn
             VertexEditorTable                                  *vertexTable = nullptr;
 
             // TODO: Move to separate file
+            const QString ATTRIBUTE_INPUT_HEADER        = "Vertex Attributes",
+                            ATTRIBUTE_NAME_DESC         = "Name of the new attribute (the same for every vertex of the region):",
+                            ATTRIBUTE_TYPE_DESC         = "Type of the new attribute:",
+                            ATTRIBUTE_REMOVE_DESC       = "Attribute to remove, along with its values:",
+                            ATTRIBUTE_NONE_DESC         = "The selected data set has no attributes.";
+            const QString CLEANUP_INPUT_HEADER          = "Clean Up Regions",
+                            CLEANUP_TOLERANCE_DESC      = "Merge vertices within this distance, in image pixels:",
+                            CLEANUP_WINDING_DESC        = "Winding order to give every region (as seen on screen):",
+                            CLEANUP_NONE_DESC           = "Every region is already clean.";
+            const QStringList CLEANUP_WINDINGS          = { "Clockwise", "Counter-clockwise", "Keep each region's own" };
+            const QString COMBINE_INPUT_HEADER          = "Combine Regions",
+                            COMBINE_OTHER_DESC          = "Data set to combine the selected data set with:",
+                            COMBINE_NAME_DESC           = "Name of the new data set holding the result:",
+                            COMBINE_EMPTY_DESC          = "The regions combine into nothing, so no data set was added.";
             const QString DATA_SET_INPUT_DIALOG_HEADER  = "Enter name of data set",
                             DATA_SET_INPUT_DIALOG_DESC  = "A data set name can contain any character except for spaces"
                                                             "\nas any will be removed upon creation. Multiple data sets"
                                                             "\ncan be created by separating the names with a semicolon"
                                                             " (';').";
+            const QString DATA_SET_FILTER_PLACEHOLDER   = "Filter data sets (start with '^' to match prefixes)";
+            const QString DISTANCE_OUTPUT_HEADER        = "Export Distance Fields",
+                            DISTANCE_FORMAT_DESC        = "Distance field format:",
+                            DISTANCE_SCALE_DESC         = "Resolution, in field pixels per image pixel:",
+                            DISTANCE_SPREAD_DESC        = "Distance from the edge mapped to black or white, in image pixels:";
+            const QStringList DISTANCE_FORMATS          = { "PNG, 8-bit", "PFM, 32-bit float" };
             const QString FILE_INPUT_HEADER             = "Open Image",
                             FILE_INPUT_FILE_TYPES       = "Images (*jpeg *jpg *.png)";
-            const QString WINDOW_TITLE                  = "Vertex Editor | Ver. 2018.08.03";
+            const QString FRAMES_INPUT_HEADER           = "Propagate to Frames",
+                            FRAMES_SLICING_DESC         = "Slice the image into frames:",
+                            FRAMES_COLUMNS_DESC         = "Frames across:",
+                            FRAMES_ROWS_DESC            = "Frames down:",
+                            FRAMES_REACH_DESC           = "Snap vertices to the sprite's outline within this distance, in image pixels:";
+            const QStringList FRAMES_SLICINGS           = { "On a grid", "Around opaque parts" };
+            const QString HEADER_OUTPUT_HEADER          = "Export C++ Header",
+                            HEADER_FILE_TYPES           = "C++ Header (*.h *.hpp)";
+            const QString MASK_OUTPUT_HEADER            = "Export Collision Masks",
+                            MASK_FORMAT_DESC            = "Mask format:";
+            const QStringList MASK_FORMATS              = { "PNG, 8-bit", "PNG, 1-bit", "Packed bitset, 1-bit" };
+            const QString OVERLAP_OUTPUT_HEADER         = "Find Overlaps",
+                            OVERLAP_NONE_DESC           = "No two data sets overlap.";
+            const QString NAMES_INPUT_HEADER            = "Import Data Set Names",
+                            NAMES_INPUT_FILE_TYPES      = "Text Files (*.txt);;All Files (*)";
+            const QString REGIONS_INPUT_HEADER          = "Import Regions",
+                            REGIONS_INPUT_FILE_TYPES    = "Polygon Files (*.json *.tmx *.tsx *.svg);;All Files (*)",
+                            REGIONS_NONE_DESC           = "No regions were found in the chosen files.";
+            const QString PROJECT_INPUT_HEADER          = "Open Project",
+                            PROJECT_OUTPUT_HEADER       = "Save Data Sets",
+                            PROJECT_FILE_TYPES          = "AeroHelper Project (*.ahp)";
+            const QString TRACE_OUTPUT_HEADER           = "Export Trace",
+                            TRACE_OUTPUT_FILE_TYPES     = "Chrome Trace (*.json)";
 
         private: // Methods
             /**
@@ -125,7 +276,57 @@ namespace Aerodlyn
              */
             void addPointToDataTable (const float x, const float y, const int index);
 
+            /**
+             * Creates the actions of the menus. Deferred until after the first frame, as none of them are
+             *  visible before a menu is opened.
+             */
+            void initializeMenus ();
+
+            /**
+             * Adds a data set for each of the given names in a single batch, reporting every name that
+             *  was already in use in a single message.
+             *
+             * @param names - The names of the data sets to add
+             */
+            void addDataSets (const QStringList &names);
+
+            /**
+             * Splits the given text into data set names. Each line may hold several names separated by
+             *  semicolons, and whitespace is removed from every name.
+             *
+             * @param text - The text to split
+             *
+             * @return The names in the given text, without any empty names
+             */
+            static QStringList parseDataSetNames (const QString &text);
+
+            /**
+             * Selects the data set with the given name for editing, giving its region to the table and the
+             *  image. Also used to refresh the region after data sets have moved in memory.
+             *
+             * @param name - The name of the data set to select, or an empty string to select none
+             */
+            void selectDataSet (const QString &name);
+
+            /**
+             * Makes the row of the selected data set current in the data set list again after the list was
+             *  reset, without selecting the data set a second time.
+             */
+            void restoreDataSetSelection ();
+
+            /**
+             * Shows the geometry derived from the region of the selected data set (its bounds, area,
+             *  centroid, perimeter and winding order) in the side panel.
+             */
+            void updateGeometryLabel ();
+
         private slots:
+            /**
+             * Initializes everything that isn't needed to show the first frame of the window, and then
+             *  finishes the startup trace.
+             */
+            void initializeDeferred ();
+
             /**
              * Adds the given coordinates to the currently selected data set.
              *  NOTE: Does nothing if no data set is selected.
@@ -142,6 +343,26 @@ namespace Aerodlyn
              */
             void handleAddDataSet ();
 
+            /**
+             * Handles adding an attribute channel, with a name and type chosen by the user, to the selected
+             *  data set, with a value of zero (or false) for every vertex. Does nothing if no data set is
+             *  selected or if canceled.
+             */
+            void handleAddVertexAttribute ();
+
+            /**
+             * Handles removing an attribute channel, chosen by the user, from the selected data set. Does
+             *  nothing if no data set is selected or if canceled.
+             */
+            void handleRemoveVertexAttribute ();
+
+            /**
+             * Handles cleaning up the region of every data set: merging vertices within a distance chosen
+             *  by the user, removing vertices that don't turn and giving every region the chosen winding
+             *  order, then listing what changed. Does nothing if canceled.
+             */
+            void handleCleanUpRegions ();
+
             /**
              * Handles clearing the currently selected data set. Does nothing if no data set is selected.
              */
@@ -152,6 +373,22 @@ namespace Aerodlyn
              */
             void handleClearAllDataSets ();
 
+            /**
+             * Handles no longer outlining the data sets found to overlap.
+             */
+            void handleClearOverlaps ();
+
+            /**
+             * Handles combining the region of the selected data set with the region of another data set
+             *  chosen by the user, storing the result in a new data set. Regions are combined as closed
+             *  polygons filled with the even-odd rule, and a result made of several pieces (or with holes)
+             *  is joined into a single region by bridges. Does nothing if no data set is selected or if
+             *  canceled.
+             *
+             * @param operation - The operation to combine the regions with
+             */
+            void handleCombineRegions (const RegionClipper::Operation operation);
+
             /**
              * Handles selecting a row (data set) from the list widget that contains the names of all of
              *  the data sets.
@@ -166,6 +403,67 @@ namespace Aerodlyn
              */
             void handleDeleteDataSet ();
 
+            /**
+             * Handles deleting every data set. Does nothing if no data sets exist.
+             */
+            void handleDeleteAllDataSets ();
+
+            /**
+             * Handles exporting the events recorded by the profiler to a Chrome trace-event JSON file
+             *  chosen by the user.
+             */
+            void handleExportTrace ();
+
+            /**
+             * Handles exporting every data set as a C++ header of constexpr vertex tables, to a file chosen
+             *  by the user.
+             */
+            void handleExportHeader ();
+
+            /**
+             * Handles exporting a signed distance field for every data set, at a resolution relative to the
+             *  loaded image chosen by the user, to a directory chosen by the user.
+             */
+            void handleExportDistanceFields ();
+
+            /**
+             * Handles exporting a collision mask for every data set, rasterized at the resolution of the
+             *  loaded image, to a directory chosen by the user.
+             */
+            void handleExportMasks ();
+
+            /**
+             * Handles the start of a display frame by refreshing, in a single batch, every row of the data
+             *  table that was edited since the last frame, along with the geometry shown in the side panel.
+             */
+            void handleFrame ();
+
+            /**
+             * Handles importing data set names from a text file chosen by the user, adding a data set for
+             *  each of them.
+             */
+            void handleImportDataSetNames ();
+
+            /**
+             * Handles importing the regions of PhysicsEditor or Box2D JSON, Tiled or SVG files chosen by the
+             *  user, adding a data set for each of them.
+             */
+            void handleImportRegions ();
+
+            /**
+             * Handles finding every pair of data sets whose regions overlap, listing the pairs and
+             *  outlining their data sets on the image until the next search or until cleared.
+             */
+            void handleFindOverlaps ();
+
+            /**
+             * Handles the text of the data set filter changing by filtering the data set list, keeping the
+             *  selected data set selected if it still matches.
+             *
+             * @param text - The new filter text
+             */
+            void handleFilterChanged (const QString &text);
+
             /**
              * Handles selecting the row of the table view that represents the point that the user is currently
              *  hovering their mouse over. If the user is not hovering over a point, then the last added point is
@@ -191,16 +489,91 @@ namespace Aerodlyn
             void handleOpenImage ();
 
             /**
-             * Handles gracefully exiting the program. If the user has unsaved data, a prompt will
-             *  inform the user of that and ask if they want to save the data before exiting.
+             * Handles opening a project file, replacing every data set with the ones saved in it. Asks the
+             *  user first if there are unsaved changes.
+             */
+            void handleOpenProject ();
+
+            /**
+             * Handles enabling or disabling the profiler.
+             *
+             * @param enabled - True if the profiler should record events, false otherwise
+             */
+            void handleProfilingToggled (const bool enabled);
+
+            /**
+             * Handles picking a data set on the canvas by selecting the data set whose region contains the
+             *  given coordinates. Where regions overlap, picking the same spot again cycles through them.
+             *  Does nothing if no region contains the coordinates.
+             *
+             * @param x - The x coordinate
+             * @param y - The y coordinate
+             */
+            void handleRegionPicked (const double x, const double y);
+
+            /**
+             * Handles refreshing the data table after a bulk transform has been applied to the selected
+             *  vertices of the current data set.
+             *
+             * @param indices - The indices of the vertices that were transformed
+             */
+            void handleRegionTransformed (const QVector <int> &indices);
+
+            /**
+             * Handles carrying the region of the selected data set over to every frame of the loaded
+             *  sprite sheet, sliced on a grid or around its opaque parts as chosen by the user. Each frame
+             *  gets a new data set named after the selected one and the frame's number. Does nothing if no
+             *  data set is selected or if canceled.
+             */
+            void handlePropagateToFrames ();
+
+            /**
+             * Handles gracefully exiting the program by closing the window, which ends the event loop.
              */
             void handleQuit ();
 
             /**
-             * Handles saving the current data sets to file, whose filetype is of the users choosing (possibly
-             *  defined by the user). Does nothing if no data sets exist.
+             * Handles saving the data sets to the project file, asking the user where to save it the first
+             *  time. Only the data sets changed since the last save are written.
              */
             void handleSaveDataSets ();
+
+            /**
+             * Handles starting or stopping the live preview feed, which publishes the data sets into shared
+             *  memory for a running game to pick up.
+             *
+             * @param enabled - True if the data sets should be published, false otherwise
+             */
+            void handleLivePreviewToggled (const bool enabled);
+
+            /**
+             * Handles showing or hiding every data set under the current region.
+             *
+             * @param visible - True if every data set should be shown, false otherwise
+             */
+            void handleShowAllRegionsToggled (const bool visible);
+
+            /**
+             * Handles showing or hiding the performance HUD drawn over the image.
+             *
+             * @param visible - True if the HUD should be shown, false otherwise
+             */
+            void handleShowHudToggled (const bool visible);
+
+        signals:
+            /**
+             * Signals that an image file was opened.
+             *
+             * @param filepath - The (full) filepath of the image file
+             */
+            void imageOpened (const QString &filepath);
+
+            /**
+             * Signals that a project file was opened.
+             *
+             * @param filepath - The (full) filepath of the project file
+             */
+            void projectOpened (const QString &filepath);
     };
 }
 